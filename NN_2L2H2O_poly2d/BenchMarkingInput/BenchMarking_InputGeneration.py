@@ -272,3 +272,19 @@ with open(filename,'ab') as f:
     
 print("Input data array for benchmarking generated !")    
 
+
+# In[20]:
+
+# Same samples as a binary sample file (see samplefile.hpp), mapped by the benchmarking tester at run time:
+# 64 byte header (magic, value size, count, dim, data offset) then the samples row-major in double precision
+binfilename='NN_2L2H2O_poly2d_benchmarking.bin'
+with open(binfilename,'wb') as f:
+    header = np.zeros(8, dtype=np.uint64)
+    header.view(np.uint8)[:8] = np.frombuffer(b'NNSAMPL1', dtype=np.uint8)
+    header.view(np.uint32)[2] = 8
+    header[2], header[3], header[4] = X.shape[0], X.shape[1], 64
+    header.tofile(f)
+    np.ascontiguousarray(X, dtype=np.float64).tofile(f)
+
+print("Binary sample file for benchmarking generated !")
+
@@ -3,12 +3,17 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <fstream>
+#include <stdlib.h>
+#include <string.h>
 #include <H5Cpp.h>
 
 
+#if !defined(NN_CPU)
 #include<cuda.h>
 #include<cudnn.h>
 #include<cublas_v2.h>
+#endif
 
 
 #include "readhdf5.hpp"
@@ -28,6 +33,11 @@
 #define INFILE1     "32_2b_nn_single.hdf5"     // HDF5 files for different precisions
 #define INFILE2     "32_2b_nn_double.hdf5"
 
+#define KERASFILE1  "keras_prediction_single_precision.csv"  // scores Keras gives for the same samples
+#define KERASFILE2  "keras_prediction_double_precision.csv"
+
+#define TOLERANCE   1e-3                // default largest score error of a reduced precision, -tolerance= changes it
+
 // char to check if the dataset is weight or bias, as HDF5 may save the dataset name differently due to version diversity
 #define CHECKCHAR1  "W"                 // dense_1_[W]           for "W"
 #define CHECKCHAR2  "l"                 // dense_1/kerne[l]      for "l"
@@ -40,28 +50,32 @@ using namespace std;
 using namespace H5;
 
 
-// tester function, including reading HDF5 file, creating layers, and making the prediction.
-template <typename T>
-void runtester(const char* filename, const char* checkchar, T* input){
+// read the scores of a Keras prediction, one per line
+vector<double> readKerasScores(const char* filename){
+     vector<double> scores;
+     ifstream file(filename);
+     double score;
+     while (file >> score) {
+          scores.push_back(score);
+          file.ignore(1, ',');
+     }
+     return scores;
+}
+
+
+// read the layers of the model saved in file, the dense layers with their weights and biases, and the activations,
+// the last one made linear
+template <typename M>
+void readmodel(H5File& file, const char* checkchar, Layer_Net_t<M>& layers){
      // initialize memory for rank, dims, and data
      // !!! Don't forget to free memory before exit!!!
      hsize_t data_rank=0;
      hsize_t* data_dims = nullptr;
-     T* data = nullptr;     
+     M* data = nullptr;     
      
      hsize_t bias_rank=0;
      hsize_t* bias_dims = nullptr;
-     T* bias = nullptr;
-     
-     Layer_Net_t<T> layers;
-     
-     // reserver for results
-     unsigned long int outsize = 0; 
-     T* output = nullptr;     
-     
-     // Open HDF5 file handle, read only
-     H5File file(filename,H5F_ACC_RDONLY);
-     
+     M* bias = nullptr;
      
      try{     
           // Get saved layer names
@@ -87,10 +101,10 @@ void runtester(const char* filename, const char* checkchar, T* input){
                     // check the dataset name's last character to see if this dataset is a Weight or a Bias
                     if (wt.compare((wt.length()-1),1, checkchar )==0){
                          // get out weight data
-                         Read_Layer_Data_By_DatName<T> (file, datasetPath.c_str(), data, data_rank, data_dims); 
+                         Read_Layer_Data_By_DatName<M> (file, datasetPath.c_str(), data, data_rank, data_dims); 
                     }else{
                          // get out bias data
-                         Read_Layer_Data_By_DatName<T> (file, datasetPath.c_str(), bias, bias_rank, bias_dims);             
+                         Read_Layer_Data_By_DatName<M> (file, datasetPath.c_str(), bias, bias_rank, bias_dims);             
                     }
                }
                // When reading out a dense layer, a 2d weight matrix is obtained
@@ -116,6 +130,40 @@ void runtester(const char* filename, const char* checkchar, T* input){
           // So change the last activiation layer's type to linear
           layers.get_layer_by_seq(LASTATVID) -> acttype = ACTLINEAR;
           
+     } catch (...){
+          if(bias!=NULL)       delete[] bias;
+          if(bias_dims!=NULL)  delete[] bias_dims;
+          if(data!=NULL)       delete[] data;
+          if(data_dims!=NULL)  delete[] data_dims;  
+          throw;
+     }
+
+     // Free memory of allocated arraies.
+     if(bias!=NULL)       delete[] bias;
+     if(bias_dims!=NULL)  delete[] bias_dims;
+     if(data!=NULL)       delete[] data;
+     if(data_dims!=NULL)  delete[] data_dims;     
+}
+
+
+// tester function, including reading HDF5 file, creating layers, and making the prediction.
+// The reduced precisions of Plan_t are then checked against the prediction and the Keras scores of kerasfile,
+// and for a float model also against the same model evaluated in double precision.
+template <typename T>
+void runtester(const char* filename, const char* checkchar, T* input, const char* kerasfile, double tolerance){
+     Layer_Net_t<T> layers;
+     
+     // reserver for results
+     unsigned long int outsize = 0; 
+     T* output = nullptr;     
+     
+     // Open HDF5 file handle, read only
+     H5File file(filename,H5F_ACC_RDONLY);
+     
+     
+     try{     
+          readmodel(file, checkchar, layers);
+          
           cout << endl;
           cout << "Prediction all samples : " <<endl;
           layers.predict(input, SAMPLECOUNT, SAMPLEDIM, output, outsize);
@@ -148,21 +196,65 @@ void runtester(const char* filename, const char* checkchar, T* input){
           }
           cout << endl;        
           
+          // a NaN input must give a NaN score, not be clamped into a finite one by tanh, and leave the other sample alone
+          vector<T> nansamples(input, input + SAMPLEDIM);
+          nansamples.insert(nansamples.end(), input, input + SAMPLEDIM);
+          nansamples[SAMPLEDIM] = numeric_limits<T>::quiet_NaN();
+          T* nanoutput = nullptr;
+          unsigned long int nansize = 0;
+          layers.predict(nansamples.data(), 2, SAMPLEDIM, nanoutput, nansize);
+          bool nanpropagated = isfinite(nanoutput[0]) && isnan(nanoutput[1]);
+          cout << endl << " Scores of a sample and of the same sample with a NaN input : " << nanoutput[0] << "  " << nanoutput[1] << endl;
+          delete[] nanoutput;
+          if (!nanpropagated) {
+               throw runtime_error("a NaN input does not give a NaN score");
+          }
+          
+          // reduced precision weights, checked against this prediction and the Keras one
+          vector<double> native(output, output + outsize);
+          vector<double> keras = readKerasScores(kerasfile);
+          vector<const double*> references(1, native.data());
+          if (keras.size() >= outsize) {
+               references.push_back(keras.data());
+          } else {
+               cout << " No Keras scores in " << kerasfile << ", checking against this prediction only" << endl;
+          }
+          
+          // the same weights and samples in double precision, the scores a float model approximates. The double
+          // model of INFILE2 is a fit of its own, its scores differ from these by more than the tolerance.
+          vector<double> widened;
+          if (!TypeIsDouble<T>::value) {
+               Layer_Net_t<double> widenedlayers;
+               readmodel(file, checkchar, widenedlayers);
+               vector<double> widenedinput(input, input + SAMPLECOUNT*SAMPLEDIM);
+               double* widenedoutput = nullptr;
+               unsigned long int widenedsize = 0;
+               widenedlayers.predict(widenedinput.data(), SAMPLECOUNT, SAMPLEDIM, widenedoutput, widenedsize);
+               widened.assign(widenedoutput, widenedoutput + widenedsize);
+               delete[] widenedoutput;
+               references.push_back(widened.data());
+          }
+          
+          cout << endl << " Weight precisions, largest error allowed " << scientific << setprecision(2) << tolerance << " :" << endl;
+          vector<PrecisionCheck_t> checks;
+          try {
+               Precision_t selected = select_precision(layers, input, SAMPLECOUNT, SAMPLEDIM, references, tolerance, &checks);
+               for (const PrecisionCheck_t& check : checks) {
+                    cout << "     " << setw(6) << precision_name(check.precision) << " : max error " << check.maxerror
+                         << ", rms error " << check.rmserror << (check.accepted ? "" : "  refused") << endl;
+               }
+               cout << " Selected precision : " << precision_name(selected) << endl;
+          } catch (const runtime_error& e) {
+               cout << " " << e.what() << endl;
+          }
           
      } catch (...){
-          if(bias!=NULL)       delete[] bias;
-          if(bias_dims!=NULL)  delete[] bias_dims;
-          if(data!=NULL)       delete[] data;
-          if(data_dims!=NULL)  delete[] data_dims;  
           if(output!=NULL) delete[] output;          
           file.close();
+          throw;
      }
 
      // Free memory of allocated arraies.
-     if(bias!=NULL)       delete[] bias;
-     if(bias_dims!=NULL)  delete[] bias_dims;
-     if(data!=NULL)       delete[] data;
-     if(data_dims!=NULL)  delete[] data_dims;     
      if(output!=NULL) delete[] output;       
      file.close();
      return;
@@ -170,19 +262,36 @@ void runtester(const char* filename, const char* checkchar, T* input){
 
 
 
-int main(void){
+int main(int argc, char *argv[]){
+     double tolerance = TOLERANCE;
+     for (int ii = 1; ii < argc; ii++) {
+          if (strncmp(argv[ii], "-tolerance=", 11) == 0) {
+               tolerance = atof(argv[ii] + 11);
+          }
+     }
+     
      try{
      cout << " Run tester with single floating point precision : " <<endl;
-     runtester<float> (INFILE1, CHECKCHAR1, X[0]);
+     runtester<float> (INFILE1, CHECKCHAR1, X[0], KERASFILE1, tolerance);
      cout << endl << endl;
      cout << " ================================================= " <<endl << endl;
      cout << " Run tester with double floating point precision : " <<endl;
-     runtester<double>(INFILE2, CHECKCHAR2, Y[0]);
+     runtester<double>(INFILE2, CHECKCHAR2, Y[0], KERASFILE2, tolerance);
+     } catch (const exception& e) {
+          cout << endl << " Tester failed : " << e.what() << endl;
+#if !defined(NN_CPU)
+          cudaDeviceReset();
+#endif
+          exit(1);     
      } catch (...) {
+#if !defined(NN_CPU)
           cudaDeviceReset();
+#endif
           exit(1);     
      }
+#if !defined(NN_CPU)
      cudaDeviceReset();
+#endif
      exit(0);      
      
      return 0;
@@ -6,17 +6,22 @@
 #include <H5Cpp.h>
 #include <chrono>
 
+#if !defined(NN_CPU)
 #include<cuda.h>
 #include<cudnn.h>
 #include<cublas_v2.h>
+#endif
 
 
 #include "readhdf5.hpp"
 #include "network.cu"
+#include "samplefile.hpp"
+#include "modelfile.hpp"
 
-#include "BenchMarkingInput/NN_2L2H2O_poly2d_benchmarking.in"          // input sample data, in 2D array
-#define SAMPLECOUNT 42105                  // input sample count
-#define SAMPLEDIM   69                  // each input sample's dim 
+// input samples, mapped at run time. Sample count and dimension are read from the file header.
+// Make it from the output of BenchMarking_InputGeneration.py with
+//     ./convert_samples BenchMarkingInput/NN_2L2H2O_poly2d_benchmarking.in BenchMarkingInput/NN_2L2H2O_poly2d_benchmarking.bin
+#define SAMPLEFILE  "BenchMarkingInput/NN_2L2H2O_poly2d_benchmarking.bin"
 
 #define PATHTOMODEL "/model_weights"    // usual path to the group saving all the layers in HDF5 file
 #define LAYERNAMES  "layer_names"       // Attribute name saving the list of layer names in HDF5
@@ -45,8 +50,11 @@ using namespace H5;
 
 
 // tester function, including reading HDF5 file, creating layers, and making the prediction.
+// With a mapped model file (modelfile.hpp) the layers are taken from it instead, and the HDF5 file is not opened.
 template <typename T>
-void runtester(const char* filename, const char* checkchar, T* input, int iterations){
+void runtester(const char* filename, const char* checkchar, const ModelFile_t<T>* model,
+               const T* input, int samplecount, int sampledim, int iterations, int chunk, Precision_t precision,
+               int batch, bool fixed, int threads, int systems, bool trace){
      // initialize memory for rank, dims, and data
      // !!! Don't forget to free memory before exit!!!
      hsize_t data_rank=0;
@@ -65,78 +73,187 @@ void runtester(const char* filename, const char* checkchar, T* input, int iterat
      T* output = nullptr;
      
      
-     // Open HDF5 file handle, read only
-     H5File file(filename,H5F_ACC_RDONLY);
+     H5File file;
+     chrono::time_point<chrono::high_resolution_clock> starttm, endtm;
      
-     
-     try{     
-          // Get saved layer names
-          vector<string> layernames;
-          layernames = Read_Attr_Data_By_Seq(file,PATHTOMODEL, LAYERNAMES); 
-
-          for (string layername : layernames) {
-               // for one single layer
-               // layer's fullpath
-               string layerpath = mkpath ( string(PATHTOMODEL),  layername ) ;
+     try{
+          starttm = chrono::high_resolution_clock::now();
+          if (model != NULL) {
+               // explicit layer graph, weights read in place
+               layers.load_model(*model);
+               cout << " Loaded " << model->layers() << " layers from the model file" << endl;
+          } else {
+               // Open HDF5 file handle, read only
+               file.openFile(filename,H5F_ACC_RDONLY);
+          
+               // Get saved layer names
+               vector<string> layernames;
+               layernames = Read_Attr_Data_By_Seq(file,PATHTOMODEL, LAYERNAMES); 
+
+               for (string layername : layernames) {
+                    // for one single layer
+                    // layer's fullpath
+                    string layerpath = mkpath ( string(PATHTOMODEL),  layername ) ;
                
-               // get this layer's dataset names
-               vector<string> weights;
-               weights = Read_Attr_Data_By_Seq(file,layerpath.c_str(), WEIGHTNAMES);
+                    // get this layer's dataset names
+                    vector<string> weights;
+                    weights = Read_Attr_Data_By_Seq(file,layerpath.c_str(), WEIGHTNAMES);
                
                
-               cout << " Reading out layer data: " << layername << endl;
-               for (string wt : weights ) {
-                    // foe one data set
-                    // dataset's path
-                    string datasetPath = mkpath(layerpath,wt) ;
+                    cout << " Reading out layer data: " << layername << endl;
+                    for (string wt : weights ) {
+                         // foe one data set
+                         // dataset's path
+                         string datasetPath = mkpath(layerpath,wt) ;
                     
-                    // check the dataset name's last character to see if this dataset is a Weight or a Bias
-                    if (wt.compare((wt.length()-1),1, checkchar )==0){
-                         // get out weight data
-                         Read_Layer_Data_By_DatName<T> (file, datasetPath.c_str(), data, data_rank, data_dims); 
-                    }else{
-                         // get out bias data
-                         Read_Layer_Data_By_DatName<T> (file, datasetPath.c_str(), bias, bias_rank, bias_dims);             
+                         // check the dataset name's last character to see if this dataset is a Weight or a Bias
+                         if (wt.compare((wt.length()-1),1, checkchar )==0){
+                              // get out weight data
+                              Read_Layer_Data_By_DatName<T> (file, datasetPath.c_str(), data, data_rank, data_dims); 
+                         }else{
+                              // get out bias data
+                              Read_Layer_Data_By_DatName<T> (file, datasetPath.c_str(), bias, bias_rank, bias_dims);             
+                         }
+                    }
+                    // When reading out a dense layer, a 2d weight matrix is obtained
+                    // Otherwise, it is a 0d matrix (null)
+                    if (data_rank==2){
+                         cout << " Initialize dense layer : " << layername << endl;
+                         layers.insert_layer(layername, data_dims[0], data_dims[1], data, bias);
+                         data_rank=0;
+                         bias_rank=0;
+                    } else {
+                         cout << " Initialize activiation layer : " << layername << endl;
+                         layers.insert_layer(layername, ACTTANH);               
                     }
-               }
-               // When reading out a dense layer, a 2d weight matrix is obtained
-               // Otherwise, it is a 0d matrix (null)
-               if (data_rank==2){
-                    cout << " Initialize dense layer : " << layername << endl;
-                    layers.insert_layer(layername, data_dims[0], data_dims[1], data, bias);
-                    data_rank=0;
-                    bias_rank=0;
-               } else {
-                    cout << " Initialize activiation layer : " << layername << endl;
-                    layers.insert_layer(layername, ACTTANH);               
-               }
 
                
-               cout << " Layer " << layername << " is initialized. " <<endl <<endl;
-          }
+                    cout << " Layer " << layername << " is initialized. " <<endl <<endl;
+               }
           
-          cout << "Inserting Layers finished !" <<endl;
+               cout << "Inserting Layers finished !" <<endl;
           
-          // In our test model, we insert 5 (fully_connect + tanh_activiation) layers
-          // plus 1 (fully_connect + linear_activiation) layers
-          // So change the last activiation layer's type to linear
-          layers.get_layer_by_seq(LASTATVID) -> acttype = ACTLINEAR;
+               // In our test model, we insert 5 (fully_connect + tanh_activiation) layers
+               // plus 1 (fully_connect + linear_activiation) layers
+               // So change the last activiation layer's type to linear
+               layers.get_layer_by_seq(LASTATVID) -> acttype = ACTLINEAR;
+          }
+          endtm = chrono::high_resolution_clock::now();
+          cout << "Model loaded in microsecond: " << chrono::duration_cast<chrono::microseconds>(endtm-starttm).count() << endl;
           
           cout << endl;
-          cout << "Prediction all samples for "<< iterations <<" times." <<endl;
+          cout << "Prediction all " << samplecount << " samples for "<< iterations <<" times";
+          if (batch <= 0 || batch > samplecount) batch = samplecount;
+          if (batch < samplecount) cout << ", " << batch << " samples per call";
+          cout << "." << endl;
+          
+          // workspace and scores are allocated once, the timed predictions allocate nothing
+          Plan_t<T> plan(layers, batch, sampledim, precision);
+          cout << "Weights in " << precision_name(precision) << " precision" << endl;
+          outsize = (unsigned long int)samplecount*plan.get_outputs();
+          output  = new T[outsize];
           
-          chrono::time_point<chrono::high_resolution_clock> starttm, endtm;
           long long int totaltime=0;
 
           for(int ii=0; ii<iterations; ii++){          
                starttm = chrono::high_resolution_clock::now();
-               layers.predict(input, SAMPLECOUNT, SAMPLEDIM, output, outsize);
+               for (int first = 0; first < samplecount; first += batch) {
+                    plan.predict(input + (size_t)first*sampledim, min(batch, samplecount - first), output + (size_t)first*plan.get_outputs());
+               }
                endtm = chrono::high_resolution_clock::now();
                totaltime += (long long int)chrono::duration_cast<chrono::microseconds>(endtm-starttm).count();
           }
           cout << "Total   operation time in microsecond: " << totaltime << endl;
           cout << "Average operation time in microsecond: " << ((double)totaltime)/iterations <<endl << endl;          
           
+          // the same calls on the network of the fixed two-body topology (network_fixed.hpp), on the host
+          if (fixed) {
+               try {
+                    unique_ptr<Fixed_2B_Net_t<T> > fixednet(new Fixed_2B_Net_t<T>(layers));
+                    vector<T> fixedoutput(outsize);
+                    totaltime = 0;
+                    for(int ii=0; ii<iterations; ii++){
+                         starttm = chrono::high_resolution_clock::now();
+                         for (int first = 0; first < samplecount; first += batch) {
+                              fixednet->predict(input + (size_t)first*sampledim, min(batch, samplecount - first),
+                                                fixedoutput.data() + (size_t)first*fixednet->outputs);
+                         }
+                         endtm = chrono::high_resolution_clock::now();
+                         totaltime += (long long int)chrono::duration_cast<chrono::microseconds>(endtm-starttm).count();
+                    }
+                    double maxdiff = 0;
+                    for (size_t ii = 0; ii < outsize; ii++) maxdiff = max(maxdiff, (double)fabs(fixedoutput[ii] - output[ii]));
+                    cout << "Fixed topology network, average operation time in microsecond: " << ((double)totaltime)/iterations
+                         << " , max difference to the plan: " << maxdiff << endl << endl;
+               } catch (const runtime_error& e) {
+                    cout << "No fixed topology network : " << e.what() << endl << endl;
+               }
+          }
+          
+          // the same samples split between independent systems, each of them a thread calling the pool at once :
+          // one model shared by all, predicted by the workers of the pool in tiles, each with its own context
+          if (threads > 0 || systems > 0) {
+               shared_ptr<const Model_t<T> > shared(new Model_t<T>(layers));
+               Pool_t<T> pool(shared, threads, POOL_TILE, precision);
+               if (systems <= 0) systems = 1;
+               vector<T> pooloutput(outsize);
+               const int width = pool.get_outputs();
+               totaltime = 0;
+               for(int ii=0; ii<iterations; ii++){
+                    starttm = chrono::high_resolution_clock::now();
+                    vector<thread> callers;
+                    for (int s = 0; s < systems; s++) {
+                         callers.push_back(thread([&, s]{
+                              const int first = (int)((size_t)samplecount*s/systems);
+                              const int last  = (int)((size_t)samplecount*(s + 1)/systems);
+                              for (int b = first; b < last; b += batch) {
+                                   pool.predict(input + (size_t)b*sampledim, min(batch, last - b), pooloutput.data() + (size_t)b*width);
+                              }
+                         }));
+                    }
+                    for (size_t s = 0; s < callers.size(); s++) callers[s].join();
+                    endtm = chrono::high_resolution_clock::now();
+                    totaltime += (long long int)chrono::duration_cast<chrono::microseconds>(endtm-starttm).count();
+               }
+               double maxdiff = 0;
+               for (size_t ii = 0; ii < outsize; ii++) maxdiff = max(maxdiff, (double)fabs(pooloutput[ii] - output[ii]));
+               cout << systems << " systems on a pool of " << pool.get_threads() << " threads, average operation time in microsecond: "
+                    << ((double)totaltime)/iterations << " , stolen tiles: " << pool.get_steals()
+                    << " , max difference to the plan: " << maxdiff << endl << endl;
+          }
+          
+          // the same samples streamed in chunks : copied from the mapping while the previous chunk is predicted,
+          // and their scores compared with the ones above while the next chunk is predicted
+          if (chunk > 0) {
+               Plan_t<T> streamplan(layers, chunk, sampledim, precision);
+               const int outwidth = streamplan.get_outputs();
+               double maxdiff = 0;
+               starttm = chrono::high_resolution_clock::now();
+               size_t streamed = streamplan.predict_stream(
+                    [&](size_t first, int count, T* in) {
+                         int n = (int)min((size_t)count, samplecount - first);
+                         copy(input + first*sampledim, input + (first + n)*sampledim, in);
+                         return n;
+                    },
+                    [&](size_t first, int n, const T* out) {
+                         for (size_t ii = 0; ii < (size_t)n*outwidth; ii++) {
+                              maxdiff = max(maxdiff, (double)fabs(out[ii] - output[first*outwidth + ii]));
+                         }
+                    });
+               endtm = chrono::high_resolution_clock::now();
+               cout << "Streamed " << streamed << " samples in chunks of " << chunk << " in microsecond: "
+                    << chrono::duration_cast<chrono::microseconds>(endtm-starttm).count()
+                    << " , max difference to the batch prediction: " << maxdiff << endl << endl;
+          }
+          
+          // the stages of Layer_Net_t::predict() as well, which allocates and copies at each call
+          if (trace) {
+               T* layeroutput = nullptr;
+               unsigned long int layeroutsize = 0;
+               layers.predict(input, samplecount, sampledim, layeroutput, layeroutsize);
+               delete[] layeroutput;
+          }
+          
           // show up the final score, to check the result consistency
           // first, setup the precision
           if(TypeIsDouble<T>::value) {
@@ -188,8 +305,9 @@ void runtester(const char* filename, const char* checkchar, T* input, int iterat
 
 int main(int argc, char *argv[]){
      
-    cout << " Usage :  THIS_EXECUTABLE_FILE  [-device=0] [-iter=100] " <<endl << endl;
+    cout << " Usage :  THIS_EXECUTABLE_FILE  [-device=0] [-iter=100] [-samples=" << SAMPLEFILE << "] [-model=FILE] [-chunk=N] [-precision=native|fp16|bf16|int8] [-batch=N] [-fixed] [-threads=N] [-systems=N] [-trace=FILE] " <<endl << endl;
 
+#if !defined(NN_CPU)
     int version = (int)cudnnGetVersion();  // display the currunt CUDNN library version
     
     // next three lines are utility functions to check the gpu-devices
@@ -205,6 +323,10 @@ int main(int argc, char *argv[]){
     }     
     checkCudaErrors( cudaSetDevice(device) );
     std::cout << "Using device " << device << std::endl;
+#else
+    printf("Host compiler version : %s %s\n", COMPILER_NAME, COMPILER_VER);
+    std::cout << "Running on the CPU backend" << std::endl;
+#endif
     
     // define how many times of the test will be run
     int iteration = DEFAULTTEST;
@@ -213,14 +335,101 @@ int main(int argc, char *argv[]){
         iteration = getCmdLineArgumentInt(argc, (const char **)argv, "iter");
     }         
     
+    // which sample file to use
+    char* samplefile = (char*)SAMPLEFILE;
+    if (checkCmdLineFlag(argc, (const char **)argv, "samples"))
+    {
+        getCmdLineArgumentString(argc, (const char **)argv, "samples", &samplefile);
+    }
+
+    // flat model file made by convert_model, instead of the HDF5 file
+    char* modelfile = NULL;
+    if (checkCmdLineFlag(argc, (const char **)argv, "model"))
+    {
+        getCmdLineArgumentString(argc, (const char **)argv, "model", &modelfile);
+    }
+
+    // also stream the samples in chunks of this size
+    int chunk = 0;
+    if (checkCmdLineFlag(argc, (const char **)argv, "chunk"))
+    {
+        chunk = getCmdLineArgumentInt(argc, (const char **)argv, "chunk");
+    }
+
+    // storage of the dense weights in the plan
+    Precision_t precision = Precision_t::NATIVE;
+    if (checkCmdLineFlag(argc, (const char **)argv, "precision"))
+    {
+        char* name = NULL;
+        getCmdLineArgumentString(argc, (const char **)argv, "precision", &name);
+        precision = Precision_t::MAX_PRECISION_VALUE;
+        for (int p = 0; p < (int)Precision_t::MAX_PRECISION_VALUE; p++) {
+            if (name != NULL && strcmp(name, precision_name(Precision_t(p))) == 0) precision = Precision_t(p);
+        }
+        if (precision == Precision_t::MAX_PRECISION_VALUE) {
+            cout << " Unknown precision " << (name != NULL ? name : "") << endl;
+            exit(1);
+        }
+    }
+
+    // samples per prediction call, all of them by default
+    int batch = 0;
+    if (checkCmdLineFlag(argc, (const char **)argv, "batch"))
+    {
+        batch = getCmdLineArgumentInt(argc, (const char **)argv, "batch");
+    }
+
+    // also time the network of the fixed two-body topology
+    bool fixed = checkCmdLineFlag(argc, (const char **)argv, "fixed");
+
+    // also time a pool of threads (0 : one per core) on the shared model, called by several systems at once
+    int threads = 0;
+    if (checkCmdLineFlag(argc, (const char **)argv, "threads"))
+    {
+        threads = getCmdLineArgumentInt(argc, (const char **)argv, "threads");
+    }
+    int systems = 0;
+    if (checkCmdLineFlag(argc, (const char **)argv, "systems"))
+    {
+        systems = getCmdLineArgumentInt(argc, (const char **)argv, "systems");
+    }
+
+    // time of each stage, printed and written as a Chrome trace (only in a build with make TRACE=1)
+    char* tracefile = NULL;
+    if (checkCmdLineFlag(argc, (const char **)argv, "trace"))
+    {
+        getCmdLineArgumentString(argc, (const char **)argv, "trace", &tracefile);
+    }
+
     try{
+          SampleFile_t<double> samples(samplefile);
+          cout << " Mapped " << samples.count() << " samples of dimension " << samples.dim() << " from " << samplefile << endl;
+
+          unique_ptr<ModelFile_t<double> > model;
+          if (modelfile != NULL) {
+               model.reset(new ModelFile_t<double>(modelfile));
+               cout << " Mapped model file " << modelfile << endl;
+          }
+
           cout << " Run tester with double floating point precision : " <<endl;
-          runtester<double>(INFILE2, CHECKCHAR2, X[0], iteration);
+          runtester<double>(INFILE2, CHECKCHAR2, model.get(), samples.data(), samples.count(), samples.dim(), iteration, chunk, precision, batch, fixed, threads, systems, tracefile != NULL);
+          
+          if (tracefile != NULL) {
+               if (!STAGE_TRACE_ENABLED) cout << " No stages to trace, build with make TRACE=1" << endl;
+               STAGE_TRACE_SUMMARY(cout);
+               STAGE_TRACE_WRITE(tracefile);
+          }
      } 
+     catch (const exception& e){
+          cout << e.what() << endl;
+          exit(1);
+     }
      catch (...){
           //checkCudaErrors(cudaDeviceReset());
           exit(1);
      }
+#if !defined(NN_CPU)
      checkCudaErrors(cudaDeviceReset());
+#endif
      exit(0);
 }
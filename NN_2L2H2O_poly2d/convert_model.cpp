@@ -0,0 +1,225 @@
+/**
+* Convert a Keras HDF5 model to the flat model file of modelfile.hpp
+*
+* Usage :  convert_model  INPUT.hdf5  OUTPUT  [-float]
+*
+* The layers and their order come from the "model_config" attribute that Keras saves with the model (Sequential models
+* of Dense and Activation layers, Keras 1 and 2 alike) :
+*    - an Activation layer gives an activation layer of the same type (linear or tanh),
+*    - a Dense layer gives a dense layer, followed by an activation layer if its own "activation" is not linear.
+* The weights of a dense layer are the 2D dataset of its group in /model_weights, the bias the 1D one,
+* whatever their names are.
+*
+* The weights are saved in double precision, or in single precision with -float (HDF5 converts them if needed).
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <string.h>
+#include <H5Cpp.h>
+
+#include "readhdf5.hpp"
+#include "modelfile.hpp"
+
+#define PATHTOMODEL "/model_weights"    // usual path to the group saving all the layers in HDF5 file
+#define LAYERNAMES  "layer_names"       // Attribute name saving the list of layer names in HDF5
+#define WEIGHTNAMES "weight_names"      // Attribute name saving the list of weight names in HDF5
+#define MODELCONFIG "model_config"      // Attribute of the root group, the model architecture in JSON
+
+using namespace std;
+using namespace H5;
+
+
+// The JSON text without the white space outside of strings, so that it can be searched for "key":"value"
+static string compactJson(const string& json){
+     string compact;
+     bool   quoted = false;
+     for (size_t i = 0; i < json.size(); i++) {
+          const char c = json[i];
+          if (quoted) {
+               compact += c;
+               if (c == '\\' && i + 1 < json.size()) {
+                    compact += json[++i];
+               } else if (c == '"') {
+                    quoted = false;
+               }
+          } else if (c == '"') {
+               compact += c;
+               quoted = true;
+          } else if (!isspace((unsigned char)c)) {
+               compact += c;
+          }
+     }
+     return compact;
+}
+
+
+// Value of the string "key" in json[begin, end), or "" if it is not there
+static string findString(const string& json, size_t begin, size_t end, const string& key){
+     const string pattern = "\"" + key + "\":\"";
+     size_t p = json.find(pattern, begin);
+     if (p == string::npos || p >= end) return "";
+     p += pattern.size();
+     return json.substr(p, json.find('"', p) - p);
+}
+
+
+// Class and activation of a layer of the model_config : the class_name of the object whose config has this name
+static void findLayer(const string& json, const string& name, string& classname, string& activation){
+     const string pattern = "\"config\":{\"name\":\"" + name + "\"";
+     const size_t config  = json.find(pattern);
+     if (config == string::npos) {
+          throw runtime_error("layer " + name + " is not in the model_config");
+     }
+     const string classkey = "\"class_name\":\"";
+     const size_t p = json.rfind(classkey, config);
+     if (p == string::npos) {
+          throw runtime_error("no class for layer " + name);
+     }
+     classname = json.substr(p + classkey.size(), json.find('"', p + classkey.size()) - p - classkey.size());
+
+     // end of the config object
+     size_t end   = json.find('{', config);
+     int    depth = 0;
+     bool   quoted = false;
+     for (; end < json.size(); end++) {
+          if (quoted) {
+               if (json[end] == '\\') end++;
+               else if (json[end] == '"') quoted = false;
+          } else if (json[end] == '"') {
+               quoted = true;
+          } else if (json[end] == '{') {
+               depth++;
+          } else if (json[end] == '}' && --depth == 0) {
+               break;
+          }
+     }
+     activation = findString(json, config, end, "activation");
+}
+
+
+static uint32_t activationType(const string& activation, const string& name){
+     if (activation == "" || activation == "linear") return MODELFILE_LINEAR;
+     if (activation == "tanh")                       return MODELFILE_TANH;
+     throw runtime_error("layer " + name + " : activation " + activation + " is not supported by Layer_Net_t");
+}
+
+
+static ModelFileLayer makeLayer(const string& name, uint32_t type, uint32_t acttype, uint32_t inputs, uint32_t outputs){
+     ModelFileLayer layer;
+     memset(&layer, 0, sizeof(layer));
+     strncpy(layer.name, name.c_str(), MODELFILE_NAMESIZE - 1);
+     layer.type    = type;
+     layer.acttype = acttype;
+     layer.inputs  = inputs;
+     layer.outputs = outputs;
+     return layer;
+}
+
+
+template <typename T>
+void convert(const char* input, const char* output){
+     H5File file(input, H5F_ACC_RDONLY);
+     const string json = compactJson(Read_Attr_String(file, "/", MODELCONFIG));
+     const vector<string> layernames = Read_Attr_Data_By_Seq(file, PATHTOMODEL, LAYERNAMES);
+     if (layernames.empty()) {
+          throw runtime_error(string("no layers in ") + PATHTOMODEL);
+     }
+
+     vector<ModelFileLayer> layers;
+     vector<vector<T> >     weights, biases;       // kept until the file is written
+     for (const string& name : layernames) {
+          string classname, activation;
+          findLayer(json, name, classname, activation);
+
+          if (classname == "Activation") {
+               layers.push_back(makeLayer(name, MODELFILE_ACTIVATION, activationType(activation, name), 0, 0));
+               weights.push_back(vector<T>());
+               biases.push_back(vector<T>());
+          } else if (classname == "Dense") {
+               const string layerpath = mkpath(string(PATHTOMODEL), name);
+               T* data = nullptr;
+               hsize_t* dims = nullptr;
+               hsize_t rank = 0, inputs = 0, outputs = 0;
+               vector<T> w, b;
+               for (const string& wt : Read_Attr_Data_By_Seq(file, layerpath.c_str(), WEIGHTNAMES)) {
+                    Read_Layer_Data_By_DatName<T>(file, mkpath(layerpath, wt).c_str(), data, rank, dims);
+                    if (rank == 2) {
+                         inputs = dims[0]; outputs = dims[1];
+                         w.assign(data, data + inputs*outputs);
+                    } else if (rank == 1) {
+                         b.assign(data, data + dims[0]);
+                    }
+               }
+               delete[] data;
+               delete[] dims;
+               if (w.empty() || b.size() != outputs) {
+                    throw runtime_error("dense layer " + name + " needs a 2D weight and a 1D bias of its outputs");
+               }
+
+               layers.push_back(makeLayer(name, MODELFILE_DENSE, 0, inputs, outputs));
+               weights.push_back(w);
+               biases.push_back(b);
+               const uint32_t acttype = activationType(activation, name);
+               if (acttype != MODELFILE_LINEAR) {
+                    layers.push_back(makeLayer(name + "_activation", MODELFILE_ACTIVATION, acttype, 0, 0));
+                    weights.push_back(vector<T>());
+                    biases.push_back(vector<T>());
+               }
+          } else {
+               throw runtime_error("layer " + name + " : class " + classname + " is not supported by Layer_Net_t");
+          }
+     }
+     file.close();
+
+     vector<const T*> weightptrs, biasptrs;
+     for (size_t i = 0; i < layers.size(); i++) {
+          weightptrs.push_back(weights[i].empty() ? NULL : weights[i].data());
+          biasptrs.push_back  (biases[i].empty()  ? NULL : biases[i].data());
+     }
+     writeModelFile<T>(output, layers, weightptrs, biasptrs);
+
+     cout << " Converted " << layers.size() << " layers to " << output << " :" << endl;
+     for (const ModelFileLayer& l : layers) {
+          if (l.type == MODELFILE_DENSE) {
+               cout << "     " << l.name << " : dense " << l.inputs << " -> " << l.outputs << endl;
+          } else {
+               cout << "     " << l.name << " : " << (l.acttype == MODELFILE_TANH ? "tanh" : "linear") << endl;
+          }
+     }
+}
+
+
+int main(int argc, char *argv[]){
+     if (argc < 3) {
+          cout << " Usage :  convert_model  INPUT.hdf5  OUTPUT  [-float] " << endl;
+          return 1;
+     }
+
+     bool singleprecision = false;
+     for (int ii = 3; ii < argc; ii++) {
+          if (strcmp(argv[ii], "-float") == 0) {
+               singleprecision = true;
+          } else {
+               cout << " Unknown option " << argv[ii] << endl;
+               return 1;
+          }
+     }
+
+     try {
+          if (singleprecision) {
+               convert<float>(argv[1], argv[2]);
+          } else {
+               convert<double>(argv[1], argv[2]);
+          }
+     } catch (const exception& e) {
+          cerr << argv[1] << " : " << e.what() << endl;
+          return 1;
+     } catch (const H5::Exception& e) {
+          cerr << argv[1] << " : " << e.getDetailMsg() << endl;
+          return 1;
+     }
+     return 0;
+}
@@ -0,0 +1,170 @@
+/**
+* Convert NN input samples from text to the binary sample file of samplefile.hpp
+*
+* Usage :  convert_samples  INPUT  OUTPUT  [-array=NAME]  [-float]
+*
+* INPUT is either
+*    - a C array as written by BenchMarking_InputGeneration.py, e.g. BenchMarkingInput/NN_2L2H2O_poly2d_benchmarking.in :
+*           double X[][69] = { {a , b , ...} , {...} } ;
+*      each inner {...} is one sample. If the file holds several arrays (NN_2L2H2O_poly2d.in has X and Y),
+*      -array=NAME selects one, otherwise the first one is read.
+*    - a CSV / text file (np.savetxt) : one sample per line, values separated by commas or spaces,
+*      lines starting with # are skipped.
+*
+* The samples are saved in double precision, or in single precision with -float.
+* All samples must have the same dimension.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <stdlib.h>
+#include <string.h>
+
+#include "samplefile.hpp"
+
+using namespace std;
+
+
+// Add one sample to the table, checking its dimension against the first one
+static void addSample(vector<double>& values, size_t& dim, size_t& count, const vector<double>& sample){
+     if (sample.empty()) return;
+     if (count == 0) {
+          dim = sample.size();
+     } else if (sample.size() != dim) {
+          ostringstream message;
+          message << "sample " << count << " has " << sample.size() << " values instead of " << dim;
+          throw runtime_error(message.str());
+     }
+     values.insert(values.end(), sample.begin(), sample.end());
+     count++;
+}
+
+
+// Parse the numbers of text[begin, end), separated by anything that can't start a number (",", " ", "\n")
+static void parseNumbers(const string& text, size_t begin, size_t end, vector<double>& sample){
+     const char* p    = text.c_str() + begin;
+     const char* stop = text.c_str() + end;
+     while (p < stop) {
+          char* next;
+          double v = strtod(p, &next);
+          if (next == p) {
+               p++;
+          } else {
+               if (next > stop) break;
+               sample.push_back(v);
+               p = next;
+          }
+     }
+}
+
+
+// Samples of a C array "TYPE NAME[][DIM] = { {...} , {...} } ;"
+static void readArray(const string& text, const char* name, vector<double>& values, size_t& dim, size_t& count){
+     size_t start = 0;
+     if (name != NULL) {
+          // NAME followed by [ , skipping white space
+          string key(name);
+          for (start = text.find(key); start != string::npos; start = text.find(key, start + 1)) {
+               size_t after = text.find_first_not_of(" \t", start + key.size());
+               bool word = start == 0 || !(isalnum(text[start-1]) || text[start-1] == '_');
+               if (word && after != string::npos && text[after] == '[') break;
+          }
+          if (start == string::npos) {
+               throw runtime_error(string("array ") + name + " not found");
+          }
+     }
+     start = text.find('=', start);
+     start = start == string::npos ? string::npos : text.find('{', start);
+     if (start == string::npos) {
+          throw runtime_error("no array initializer found");
+     }
+
+     // depth 1 is the array, depth 2 a sample
+     int depth = 0;
+     size_t rowbegin = 0;
+     for (size_t i = start; i < text.size(); i++) {
+          if (text[i] == '{') {
+               depth++;
+               rowbegin = i + 1;
+          } else if (text[i] == '}') {
+               if (depth == 2) {
+                    vector<double> sample;
+                    parseNumbers(text, rowbegin, i, sample);
+                    addSample(values, dim, count, sample);
+               }
+               if (--depth == 0) return;
+          }
+     }
+     throw runtime_error("unterminated array");
+}
+
+
+// Samples of a CSV / text file, one per line
+static void readTable(const string& text, vector<double>& values, size_t& dim, size_t& count){
+     istringstream lines(text);
+     string line;
+     while (getline(lines, line)) {
+          size_t first = line.find_first_not_of(" \t\r");
+          if (first == string::npos || line[first] == '#') continue;
+          vector<double> sample;
+          parseNumbers(line, 0, line.size(), sample);
+          addSample(values, dim, count, sample);
+     }
+}
+
+
+int main(int argc, char *argv[]){
+     if (argc < 3) {
+          cout << " Usage :  convert_samples  INPUT  OUTPUT  [-array=NAME]  [-float] " << endl;
+          return 1;
+     }
+
+     const char* arrayname = NULL;
+     bool singleprecision = false;
+     for (int ii = 3; ii < argc; ii++) {
+          if (strncmp(argv[ii], "-array=", 7) == 0) {
+               arrayname = argv[ii] + 7;
+          } else if (strcmp(argv[ii], "-float") == 0) {
+               singleprecision = true;
+          } else {
+               cout << " Unknown option " << argv[ii] << endl;
+               return 1;
+          }
+     }
+
+     try {
+          ifstream input(argv[1]);
+          if (!input) {
+               throw runtime_error(string("cannot open ") + argv[1]);
+          }
+          stringstream buffer;
+          buffer << input.rdbuf();
+          const string text = buffer.str();
+
+          vector<double> values;
+          size_t dim = 0, count = 0;
+          if (arrayname != NULL || text.find('{') != string::npos) {
+               readArray(text, arrayname, values, dim, count);
+          } else {
+               readTable(text, values, dim, count);
+          }
+
+          if (singleprecision) {
+               vector<float> floats(values.begin(), values.end());
+               writeSampleFile<float>(argv[2], floats.data(), count, dim);
+          } else {
+               writeSampleFile<double>(argv[2], values.data(), count, dim);
+          }
+          cout << " Converted " << count << " samples of dimension " << dim << " to " << argv[2]
+               << (singleprecision ? " (single precision)" : " (double precision)") << endl;
+
+     } catch (const exception& e) {
+          cerr << argv[1] << " : " << e.what() << endl;
+          return 1;
+     }
+     return 0;
+}
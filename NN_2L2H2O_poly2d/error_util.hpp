@@ -52,6 +52,9 @@
 
 #define CUDNN_VERSION_STR  TOSTR(CUDNN_MAJOR) "." TOSTR (CUDNN_MINOR) "." TOSTR(CUDNN_PATCHLEVEL)
 
+// The CPU backend (-DNN_CPU) has no CUDA, only the command line helpers below are used
+#if !defined(NN_CPU)
+
 #define FatalError(s) {                                                \
     std::stringstream _where, _message;                                \
     _where << __FILE__ << ':' << __LINE__;                             \
@@ -105,6 +108,8 @@ static void  showDevices( void )
     }
 } 
 
+#endif // !NN_CPU
+
 #if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
 #ifndef _CRT_SECURE_NO_DEPRECATE
 #define _CRT_SECURE_NO_DEPRECATE
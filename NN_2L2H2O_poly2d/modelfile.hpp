@@ -0,0 +1,232 @@
+#if !defined(_MODELFILE_H_)
+#define _MODELFILE_H_
+
+/**
+* Flat binary model, so that workers start without parsing HDF5 or copying the weights.
+*
+* Layout, all in the native (little endian) byte order, every part starting at a 64 byte aligned offset:
+*    - a 64 byte header (ModelFileHeader) : magic "NNMODELF", format version, size of one value (4 = float, 8 = double),
+*                                           layer count, input and output widths of the model, offset of the layer table
+*                                           and size of the whole file
+*    - the layer table, one 64 byte ModelFileLayer per layer in the order they are run : name, Type_t and ActType_t
+*      of network.cu, dimensions, and the offsets of the weights and bias of a dense layer
+*    - the weights of each dense layer, row-major [inputs x outputs] as Keras saves them, then its bias [outputs]
+*
+* The layer graph is explicit : the converter convert_model.cpp reads it from the Keras model_config, so the loader
+* needs no guess about which dataset is a weight or which activation is the last one.
+*
+* ModelFile_t<T> maps the file read only and shared : all the processes that load the same model use the same
+* page cache pages, and Layer_Net_t::load_model() makes layers that read their weights in place (see network.cu).
+* MODELFILE_VERSION changes with the layout, files of another version are refused and must be converted again.
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "whichtype.hpp"
+
+#define MODELFILE_MAGIC      "NNMODELF"
+#define MODELFILE_VERSION    1
+#define MODELFILE_ALIGNMENT  64            // header, table, weights and biases, one cache line
+#define MODELFILE_NAMESIZE   32            // layer names are cut to 31 characters
+
+struct ModelFileHeader {
+     char     magic[8];       // MODELFILE_MAGIC, without the ending 0
+     uint32_t version;        // MODELFILE_VERSION
+     uint32_t typesize;       // 4 for float weights, 8 for double weights
+     uint64_t layers;         // entries of the layer table
+     uint64_t inputs;         // values of one input sample
+     uint64_t outputs;        // scores of one sample
+     uint64_t table;          // byte offset of the layer table from the start of the file
+     uint64_t size;           // byte size of the file
+     uint64_t reserved;       // 0
+};
+static_assert(sizeof(ModelFileHeader) == MODELFILE_ALIGNMENT, "the layer table must start aligned");
+
+struct ModelFileLayer {
+     char     name[MODELFILE_NAMESIZE];   // 0 terminated
+     uint32_t type;           // Type_t : 1 dense, 2 activation
+     uint32_t acttype;        // ActType_t of an activation layer : 1 linear, 2 tanh
+     uint32_t inputs;         // dimensions of a dense layer, 0 for an activation
+     uint32_t outputs;
+     uint64_t weights;        // byte offsets of W and b of a dense layer, 0 for an activation
+     uint64_t bias;
+};
+static_assert(sizeof(ModelFileLayer) == MODELFILE_ALIGNMENT, "the layer table entries must stay aligned");
+
+#define MODELFILE_DENSE       1           // values of Type_t
+#define MODELFILE_ACTIVATION  2
+#define MODELFILE_LINEAR      1           // values of ActType_t
+#define MODELFILE_TANH        2
+
+
+template <typename T>
+class ModelFile_t {
+private:
+     void*  mapping;
+     size_t mapsize;
+     ModelFileHeader header;
+
+     ModelFile_t(const ModelFile_t&);
+     ModelFile_t& operator=(const ModelFile_t&);
+
+     // Check the header and every layer against the size of the mapping, returns the first error found
+     std::string check() const {
+          if (memcmp(header.magic, MODELFILE_MAGIC, sizeof(header.magic)) != 0) {
+               return "not a model file";
+          }
+          if (header.version != MODELFILE_VERSION) {
+               std::ostringstream message;
+               message << "model file version " << header.version << ", this build reads version " << MODELFILE_VERSION
+                       << ", convert it again with convert_model";
+               return message.str();
+          }
+          if (header.typesize != sizeof(T)) {
+               return TypeIsDouble<T>::value ? "weights are not in double precision, convert it again without -float"
+                                             : "weights are not in single precision, convert it again with -float";
+          }
+          // each bound divides, so that no product of header fields can wrap around
+          if (header.size != mapsize || header.table % MODELFILE_ALIGNMENT != 0 || header.table > mapsize
+              || header.layers > (mapsize - header.table) / sizeof(ModelFileLayer)) {
+               return "truncated or corrupted model file";
+          }
+
+          uint64_t width = header.inputs;
+          for (size_t i = 0; i < header.layers; i++) {
+               const ModelFileLayer& l = layer(i);
+               std::ostringstream message;
+               message << "layer " << i << " (" << std::string(l.name, strnlen(l.name, MODELFILE_NAMESIZE)) << ") : ";
+               if (l.type == MODELFILE_DENSE) {
+                    if (l.inputs != width || l.outputs == 0) {
+                         message << "has " << l.inputs << " inputs, the previous layer gives " << width;
+                         return message.str();
+                    }
+                    if (l.weights % MODELFILE_ALIGNMENT != 0 || l.bias % MODELFILE_ALIGNMENT != 0
+                        || l.weights > mapsize || (uint64_t)l.inputs * l.outputs > (mapsize - l.weights) / sizeof(T)
+                        || l.bias > mapsize || l.outputs > (mapsize - l.bias) / sizeof(T)) {
+                         message << "weights out of the file";
+                         return message.str();
+                    }
+                    width = l.outputs;
+               } else if (l.type == MODELFILE_ACTIVATION) {
+                    if (l.acttype != MODELFILE_LINEAR && l.acttype != MODELFILE_TANH) {
+                         message << "unknown activation type " << l.acttype;
+                         return message.str();
+                    }
+               } else {
+                    message << "unknown layer type " << l.type;
+                    return message.str();
+               }
+          }
+          if (width != header.outputs) {
+               return "the layers do not give the outputs of the header";
+          }
+          return "";
+     }
+
+public:
+     // Map a model file, throws runtime_error if it cannot be read, is of another version or holds another type than T
+     ModelFile_t(const char* filename) : mapping(NULL), mapsize(0) {
+          int fd = open(filename, O_RDONLY);
+          if (fd < 0) {
+               throw std::runtime_error(std::string("Cannot open model file ") + filename);
+          }
+          struct stat status;
+          if (fstat(fd, &status) != 0 || (size_t)status.st_size < sizeof(ModelFileHeader)) {
+               close(fd);
+               throw std::runtime_error(std::string("Model file is too short: ") + filename);
+          }
+          mapsize = status.st_size;
+          mapping = mmap(NULL, mapsize, PROT_READ, MAP_SHARED, fd, 0);
+          close(fd);
+          if (mapping == MAP_FAILED) {
+               mapping = NULL;
+               throw std::runtime_error(std::string("Cannot map model file ") + filename);
+          }
+
+          memcpy(&header, mapping, sizeof(header));
+          const std::string error = check();
+          if (!error.empty()) {
+               munmap(mapping, mapsize);
+               mapping = NULL;
+               throw std::runtime_error(std::string(filename) + " : " + error);
+          }
+     }
+
+     ~ModelFile_t() {
+          if (mapping != NULL) munmap(mapping, mapsize);
+     }
+
+     size_t   layers()  const { return header.layers; }
+     size_t   inputs()  const { return header.inputs; }
+     size_t   outputs() const { return header.outputs; }
+     const ModelFileLayer& layer(size_t i) const {
+          return ((const ModelFileLayer*)((const char*)mapping + header.table))[i];
+     }
+     std::string name(size_t i) const { return std::string(layer(i).name, strnlen(layer(i).name, MODELFILE_NAMESIZE)); }
+     const T* weights(size_t i) const { return (const T*)((const char*)mapping + layer(i).weights); }
+     const T* bias(size_t i)    const { return (const T*)((const char*)mapping + layer(i).bias); }
+};
+
+
+// Write a model in the format above. layers has the name, type, activation and dimensions of each layer, its offsets
+// are set here. weights and biases have one array per layer, NULL for the activations.
+template <typename T>
+void writeModelFile(const char* filename, std::vector<ModelFileLayer> layers,
+                    const std::vector<const T*>& weights, const std::vector<const T*>& biases) {
+     ModelFileHeader header;
+     memset(&header, 0, sizeof(header));
+     memcpy(header.magic, MODELFILE_MAGIC, sizeof(header.magic));
+     header.version  = MODELFILE_VERSION;
+     header.typesize = sizeof(T);
+     header.layers   = layers.size();
+     header.table    = MODELFILE_ALIGNMENT;   // right after the header
+
+     // place the weights and biases after the table, each at an aligned offset
+     uint64_t offset = header.table + layers.size() * sizeof(ModelFileLayer);
+     uint64_t width  = 0;
+     for (size_t i = 0; i < layers.size(); i++) {
+          layers[i].weights = layers[i].bias = 0;
+          if (layers[i].type != MODELFILE_DENSE) continue;
+          if (width == 0) header.inputs = layers[i].inputs;
+          width = layers[i].outputs;
+          offset = (offset + MODELFILE_ALIGNMENT - 1) / MODELFILE_ALIGNMENT * MODELFILE_ALIGNMENT;
+          layers[i].weights = offset;
+          offset += (uint64_t)layers[i].inputs * layers[i].outputs * sizeof(T);
+          offset = (offset + MODELFILE_ALIGNMENT - 1) / MODELFILE_ALIGNMENT * MODELFILE_ALIGNMENT;
+          layers[i].bias = offset;
+          offset += (uint64_t)layers[i].outputs * sizeof(T);
+     }
+     header.outputs = width;
+     header.size    = offset;
+
+     std::ofstream file(filename, std::ios::binary);
+     if (!file) {
+          throw std::runtime_error(std::string("Cannot create model file ") + filename);
+     }
+     file.write((const char*)&header, sizeof(header));
+     if (!layers.empty()) file.write((const char*)layers.data(), layers.size() * sizeof(ModelFileLayer));
+
+     const char zeros[MODELFILE_ALIGNMENT] = {};
+     for (size_t i = 0; i < layers.size(); i++) {
+          if (layers[i].type != MODELFILE_DENSE) continue;
+          file.write(zeros, layers[i].weights - (uint64_t)file.tellp());
+          file.write((const char*)weights[i], (size_t)layers[i].inputs * layers[i].outputs * sizeof(T));
+          file.write(zeros, layers[i].bias - (uint64_t)file.tellp());
+          file.write((const char*)biases[i], (size_t)layers[i].outputs * sizeof(T));
+     }
+     if (!file) {
+          throw std::runtime_error(std::string("Cannot write model file ") + filename);
+     }
+}
+
+#endif
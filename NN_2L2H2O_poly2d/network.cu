@@ -49,6 +49,17 @@
 *    - softmax forwards, using cudnnSoftmaxForward()
 *    - Activation_TANH forwards, using cudnnActivationForward() with CUDNN_ACTIVATION_TANH
 *    - Activation_ReLU forwards, using cudnnActivationForward() with CUDNN_ACTIVATION_RELU
+*    - fully connected and Activation_TANH backwards, giving the gradients of the scores with respect to the inputs
+*    - a CPU backend (network_cpu.hpp) with the same interface, used instead of CUDNN/CUBLAS when compiled with -DNN_CPU
+*    - fused dense + bias + activation operators, built from the list of layers by Layer_Net_t::compile()
+*    - execution plans (Plan_t), whose workspace is allocated once and reused by every prediction
+*    - models loaded from a mapped flat model file (modelfile.hpp), the weights being read in place
+*    - streaming prediction of sample sets of any size (Plan_t::predict_stream), loading, predicting and storing overlapped
+*    - plans with their dense weights stored in fp16, bf16 or int8 (Precision_t), and select_precision() which keeps
+*      the smallest of them whose scores stay within a tolerance of reference scores
+*    - immutable models shared by threads (Model_t), each with its own context, and a work stealing pool (Pool_t)
+*    - networks of a fixed topology (network_fixed.hpp), whose layer shapes are template parameters, for small batches
+*    - stage timers and counters of the predictions (stageTrace.h of the top directory), compiled in with make TRACE=1
 *
 * The code currently works with single precision float.
 *
@@ -78,18 +89,45 @@
 #include <sstream>
 #include <fstream>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
 #include <string>
 #include <algorithm>   
 #include <limits>
+#include <vector>
+#include <functional>
+#include <future>
+#include <memory>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+
+#if !defined(NN_CPU)
 #include<cuda.h>
 #include<cudnn.h>
 #include<cublas_v2.h>
+#endif
 
 #include"error_util.hpp"
 #include"whichtype.hpp"
+#include"modelfile.hpp"
+#include"stageTrace.h"                 // in the top directory, stage timers compiled in with make TRACE=1
 
 using namespace std;
 
+// With the stage timers, a traced stage waits for the device before it ends, so that it gets the time of its kernels
+// and not of their launch. Without them nothing is synchronized.
+#if STAGE_TRACE_ENABLED && !defined(NN_CPU)
+#define NN_TRACE_SYNC()     checkCudaErrors( cudaDeviceSynchronize() )
+#else
+#define NN_TRACE_SYNC()
+#endif
+
+#if !defined(NN_CPU)
 // Helper function showing the data on Device
 template <typename T>
 void printDeviceVector(int size, T* vec_d)
@@ -111,6 +149,7 @@ void printDeviceVector(int size, T* vec_d)
     std::cout << std::endl;
     delete [] vec;
 }
+#endif
 
 //===========================================================================================================
 // Type of layers
@@ -130,6 +169,70 @@ enum class ActType_t {
      MAX_ACTTYPE_VALUE = 3
 };
 
+// Storage of the dense weights of an execution plan (Plan_t). The products are still accumulated in the type T
+// of the plan (Plan_t<float> accumulates in fp32), and the biases, inputs, activations and outputs stay in T.
+enum class Precision_t {
+     NATIVE         = 0 ,     // T, the weights of the layers as they are
+     FP16           = 1 ,     // IEEE half precision, 11 significant bits
+     BF16           = 2 ,     // bfloat16, the upper half of a float, 8 significant bits
+     INT8           = 3 ,     // signed bytes, with one scale per output : max |W| of the output is 127
+     MAX_PRECISION_VALUE = 4
+};
+
+#if defined(__CUDACC__)
+#define NN_HOST_DEVICE __host__ __device__
+#else
+#define NN_HOST_DEVICE
+#endif
+
+// Conversions of the reduced precisions, the same on the host and on the device. The weights are finite :
+// values beyond the half precision range become infinite, and NaN is not kept.
+inline uint16_t floatToHalf(float f){
+     uint32_t bits;
+     memcpy(&bits, &f, sizeof(bits));
+     const uint16_t sign = (bits >> 16) & 0x8000;
+     const float    a    = fabsf(f);
+     if (!(a < 65520.0f)) return sign | 0x7c00;
+     if (a < 6.103515625e-05f) {
+          // subnormal, in units of 2^-24, rounded to nearest even (1024 gives the smallest normal)
+          return sign | (uint16_t)lrintf(a * 16777216.0f);
+     }
+     memcpy(&bits, &a, sizeof(bits));
+     bits += 0xfff + ((bits >> 13) & 1);             // round to nearest even on the 13 bits dropped
+     return sign | (uint16_t)((bits >> 13) - (112 << 10));
+}
+
+NN_HOST_DEVICE inline float halfToFloat(uint16_t h){
+     // the exponent moves from bias 15 to 127 by a multiplication by 2^112, which also normalizes subnormals
+     uint32_t bits = (uint32_t)(h & 0x7fff) << 13;
+     float f;
+     memcpy(&f, &bits, sizeof(f));
+     f *= 5.192296858534828e+33f;
+     memcpy(&bits, &f, sizeof(bits));
+     bits |= (uint32_t)(h & 0x8000) << 16;
+     memcpy(&f, &bits, sizeof(f));
+     return f;
+}
+
+inline uint16_t floatToBfloat16(float f){
+     uint32_t bits;
+     memcpy(&bits, &f, sizeof(bits));
+     bits += 0x7fff + ((bits >> 16) & 1);            // round to nearest even
+     return (uint16_t)(bits >> 16);
+}
+
+NN_HOST_DEVICE inline float bfloat16ToFloat(uint16_t h){
+     uint32_t bits = (uint32_t)h << 16;
+     float f;
+     memcpy(&f, &bits, sizeof(f));
+     return f;
+}
+
+// the model files of modelfile.hpp store these values
+static_assert(int(Type_t::DENSE) == MODELFILE_DENSE && int(Type_t::ACTIVIATION) == MODELFILE_ACTIVATION
+              && int(ActType_t::LINEAR) == MODELFILE_LINEAR && int(ActType_t::TANH) == MODELFILE_TANH,
+              "layer types of the model files");
+
 
 
 // define layers
@@ -146,6 +249,7 @@ struct Layer_t
     int outputs;    // number of output dimension
     T *data_h, *data_d;  // weight matrix in host and device
     T *bias_h, *bias_d;  // bias vector in host and device
+    bool shared_h = false;     // data_h and bias_h belong to someone else (e.g. a mapped model file)
     
     Layer_t<T>* prev=nullptr;  // list ptr to previous layer
     Layer_t<T>* next=nullptr;  // list ptr to next layer
@@ -157,19 +261,29 @@ struct Layer_t
     
     
     // construct dense layer via loaded matrix from host
+    // With _shared the host arrays are not copied but read in place, and must outlive the layer
     Layer_t<T>( string _name, int _inputs, int _outputs, 
-          T* _data_h, T* _bias_h)
-                  : inputs(_inputs), outputs(_outputs), type(Type_t::DENSE), acttype(ActType_t::NOACTIVIATION)
+          const T* _data_h, const T* _bias_h, bool _shared = false)
+                  : inputs(_inputs), outputs(_outputs), type(Type_t::DENSE), acttype(ActType_t::NOACTIVIATION),
+                    shared_h(_shared)
     {     
         name = _name ;
-        data_h = new T[inputs*outputs];       
-        bias_h = new T[outputs];
-        copy(_data_h, (_data_h+inputs*outputs), data_h);
-        copy(_bias_h, (_bias_h+       outputs), bias_h);
+        if (shared_h) {
+            data_h = const_cast<T*>(_data_h);      // only read
+            bias_h = const_cast<T*>(_bias_h);
+        } else {
+            data_h = new T[inputs*outputs];       
+            bias_h = new T[outputs];
+            copy(_data_h, (_data_h+inputs*outputs), data_h);
+            copy(_bias_h, (_bias_h+       outputs), bias_h);
+        }
 
+#if !defined(NN_CPU)
+        // the CPU backend reads data_h and bias_h
         readAllocMemcpy( inputs * outputs, 
                         &data_h, &data_d);
         readAllocMemcpy( outputs, &bias_h, &bias_d);
+#endif
         
         // Some tester, if need to check layer input
         //cout<< "Layer weights initializing: " << endl;
@@ -202,13 +316,16 @@ struct Layer_t
     
     ~Layer_t<T>()
     { 
-        if (data_h != NULL) delete [] data_h;
+        if (data_h != NULL && !shared_h) delete [] data_h;
+        if (bias_h != NULL && !shared_h) delete [] bias_h;
+#if !defined(NN_CPU)
         if (data_d != NULL) checkCudaErrors( cudaFree(data_d) );
-        if (bias_h != NULL) delete [] bias_h;
         if (bias_d != NULL) checkCudaErrors( cudaFree(bias_d) );
+#endif
     }
     
     
+#if !defined(NN_CPU)
 private:
 
      // Allocate device memory from existing data_h
@@ -220,10 +337,33 @@ private:
                                      size_b,
                                      cudaMemcpyHostToDevice) );
      }    
+#endif
+     
+};
+
+
+//===========================================================================================
+//
+// One operator of a compiled model : a dense layer with the activation that follows it fused in,
+// or an activation alone if no dense layer comes before it
+//
+template <typename T>
+struct Operator_t
+{
+     const Layer_t<T>* dense;      // nullptr for an activation alone
+     ActType_t         acttype;    // LINEAR if nothing is applied after the dense layer
      
+     // Weights of the dense layer in another precision, made by Plan_t in the memory of its backend :
+     // weights [inputs x outputs] of the stored type, and for INT8 the scale of each output
+     Precision_t       precision;  // NATIVE : the weights of the layer are used
+     const void*       weights;
+     const T*          scale;
 };
 
 
+#if defined(NN_CPU)
+#include"network_cpu.hpp"              // after Layer_t and Operator_t, which it reads
+#else
 // ===========================================================================================================================================
 //
 // Function to perform forward action on fully connected layer, according to different type of data
@@ -243,13 +383,16 @@ private:
 // in column-major, sequence is [a11 a21 a12 a22 a13 a23]
 // Therefore, we must claim to CUBLAS that the saved data ([m,n]) has [n] "rows" and [m] "cols" 
 // And DO NOT transpose them, as the matrices have already been regarded as "transposed" matrices in the eye of CUBLAS.
+//
+// With _transa = CUBLAS_OP_T the weight is used transposed : C[_out,N] = alpha * A[_in,_out]^T dot X[_in,N] + beta * C,
+// which is how the backward pass brings the gradients of a layer's outputs back to its inputs.
 
 
 template <typename T>
 struct gemm{
      gemm(          cublasHandle_t cublasHandle, int _input_vector_length, int _output_vector_length, int _vector_counts, 
                     void *_weight, void *_inputs, void *_bias,
-                    double alpha=1.0, double beta=1.0){
+                    double alpha=1.0, double beta=1.0, cublasOperation_t _transa=CUBLAS_OP_N){
                     cout << " Don't know what to do with this type of data " << endl;
      };
 };
@@ -258,12 +401,12 @@ template <>
 struct gemm<double>{
      gemm<double> (cublasHandle_t cublasHandle, int _input_vector_length, int _output_vector_length, int _vector_counts, 
                     const double *_weight, const double *_inputs, double *_bias,
-                    double alpha=1.0, double beta=1.0){
+                    double alpha=1.0, double beta=1.0, cublasOperation_t _transa=CUBLAS_OP_N){
      
-                    checkCublasErrors( cublasDgemm(cublasHandle, CUBLAS_OP_N, CUBLAS_OP_N,
+                    checkCublasErrors( cublasDgemm(cublasHandle, _transa, CUBLAS_OP_N,
                                             _output_vector_length, _vector_counts, _input_vector_length, 
                                             &alpha, 
-                                            _weight, _output_vector_length,
+                                            _weight, _transa == CUBLAS_OP_N ? _output_vector_length : _input_vector_length,
                                             _inputs, _input_vector_length,
                                             &beta,
                                             _bias, _output_vector_length) );           
@@ -274,18 +417,106 @@ template <>
 struct gemm<float>{
      gemm<float> ( cublasHandle_t cublasHandle, int _input_vector_length, int _output_vector_length, int _vector_counts, 
                     const float *_weight, const float *_inputs, float *_bias,
-                    float alpha=1.0, float beta=1.0){
+                    float alpha=1.0, float beta=1.0, cublasOperation_t _transa=CUBLAS_OP_N){
 
-                    checkCublasErrors( cublasSgemm(cublasHandle, CUBLAS_OP_N, CUBLAS_OP_N,
+                    checkCublasErrors( cublasSgemm(cublasHandle, _transa, CUBLAS_OP_N,
                                             _output_vector_length, _vector_counts, _input_vector_length, 
                                             &alpha, 
-                                            _weight, _output_vector_length,
+                                            _weight, _transa == CUBLAS_OP_N ? _output_vector_length : _input_vector_length,
                                             _inputs, _input_vector_length,
                                             &beta,
                                             _bias, _output_vector_length) );
      };
 };
 
+// ===========================================================================================================================================
+//
+// Fused dense + bias + activation : y[N,_out] = act( X[N,_in] dot W[_in,_out] + bias ), in one pass over the output.
+// Each thread computes one output value, so a warp reads the same input sample (broadcast) and consecutive columns
+// of W from shared memory, which holds the whole layer (our layers are at most 69 x 32).
+// denseActivationEpilogue() is used instead after a gemm, for layers too large for shared memory.
+// The weights of a plan in a reduced precision (Precision_t) are decoded when they are read, weight_t<T,P> gives
+// their stored type; those layers read W from global memory when they do not fit in shared memory.
+
+#define FUSED_THREADS     256         // threads per block
+#define FUSED_MAXBLOCKS   1024        // grid-stride loop beyond, so that W is loaded by fewer blocks
+#define FUSED_MAXSHARED   (48*1024)   // bytes of shared memory for W and bias
+
+template <typename T>
+__device__ inline T activate(T v, ActType_t acttype){
+     return acttype == ActType_t::TANH ? tanh(v) : v;
+}
+
+template <typename T, Precision_t P>
+struct weight_t{
+     typedef T type;
+     static const bool scaled = false;
+     __device__ static T value(type w) { return w; }
+};
+
+template <typename T>
+struct weight_t<T, Precision_t::FP16>{
+     typedef uint16_t type;
+     static const bool scaled = false;
+     __device__ static T value(type w) { return halfToFloat(w); }
+};
+
+template <typename T>
+struct weight_t<T, Precision_t::BF16>{
+     typedef uint16_t type;
+     static const bool scaled = false;
+     __device__ static T value(type w) { return bfloat16ToFloat(w); }
+};
+
+template <typename T>
+struct weight_t<T, Precision_t::INT8>{
+     typedef int8_t type;
+     static const bool scaled = true;      // acc * scale[o] + b[o]
+     __device__ static T value(type w) { return w; }
+};
+
+template <typename T, Precision_t P>
+__global__ void denseActivationKernel(int n, int in, int out, 
+                                      const T* __restrict__ x, const typename weight_t<T,P>::type* __restrict__ w,
+                                      const T* __restrict__ scale, const T* __restrict__ b, 
+                                      T* __restrict__ y, ActType_t acttype, bool cached=true){
+     typedef weight_t<T,P> WT;
+     extern __shared__ __align__(sizeof(double)) unsigned char fused_shared[];
+     const T* bs = b;
+     const T* ss = scale;
+     const typename WT::type* ws = w;
+     if (cached) {
+          // bias, scales, then W, so that each part stays aligned
+          T* bc = (T*)fused_shared;
+          T* sc = bc + out;
+          typename WT::type* wc = (typename WT::type*)(sc + (WT::scaled ? out : 0));
+          for (int i = threadIdx.x; i < in*out; i += blockDim.x) wc[i] = w[i];
+          for (int i = threadIdx.x; i < out;    i += blockDim.x) bc[i] = b[i];
+          if (WT::scaled) for (int i = threadIdx.x; i < out; i += blockDim.x) sc[i] = scale[i];
+          __syncthreads();
+          bs = bc; ss = sc; ws = wc;
+     }
+     
+     const size_t total = (size_t)n*out;
+     for (size_t t = blockIdx.x*(size_t)blockDim.x + threadIdx.x; t < total; t += (size_t)gridDim.x*blockDim.x) {
+          const int s = t / out;
+          const int o = t % out;
+          const T* xs = x + (size_t)s*in;
+          T acc = WT::scaled ? T(0) : bs[o];
+          for (int p = 0; p < in; p++) acc += xs[p] * WT::value(ws[p*out + o]);
+          if (WT::scaled) acc = acc * ss[o] + bs[o];
+          y[t] = activate(acc, acttype);
+     }
+}
+
+template <typename T>
+__global__ void denseActivationEpilogue(int n, int out, const T* __restrict__ b, T* __restrict__ y, ActType_t acttype){
+     const size_t total = (size_t)n*out;
+     for (size_t t = blockIdx.x*(size_t)blockDim.x + threadIdx.x; t < total; t += (size_t)gridDim.x*blockDim.x) {
+          y[t] = activate(y[t] + b[t % out], acttype);
+     }
+}
+
 // ==================================================================================================================================
 //
 // Network Algorithem class
@@ -323,6 +554,12 @@ private:
 
     cudnnActivationDescriptor_t  activDesc; // Activiation type used in CUDNN
 
+    // Workspace of an execution plan (Plan_t) : the input and two ping-pong buffers, allocated once by reserve()
+    T* workspace[3] = {nullptr, nullptr, nullptr};
+    
+    // Weights stored by storeWeights()
+    vector<void*> stored;
+
     
     // create and destroy handles/descriptors, note the sequence of creating/destroying
     void createHandles()
@@ -394,18 +631,104 @@ private:
     };
     ~network_t<T>()
     {
+        for (int i = 0; i < 3; i++) release(workspace[i]);
+        for (size_t i = 0; i < stored.size(); i++) checkCudaErrors( cudaFree(stored[i]) );
         destroyHandles();
     }
     
-    // Resize device memory and initialize to 0
-    void resize(int size, T **data)
+    // Resize device memory and initialize to 0, unless the caller writes all of it
+    void resize(size_t size, T **data, bool clear = true)
     {
+        STAGE_SCOPE("nn.alloc");
         if (*data != NULL)
         {
             checkCudaErrors( cudaFree(*data) );
         }
         checkCudaErrors( cudaMalloc(data, size*sizeof(T)) );
-        checkCudaErrors( cudaMemset(*data, 0, size*sizeof(T)) );        
+        if (clear) checkCudaErrors( cudaMemset(*data, 0, size*sizeof(T)) );        
+    }
+    
+    void release(T *data)
+    {
+        if (data != NULL) checkCudaErrors( cudaFree(data) );
+    }
+    
+    // Copy the input of the first layer to the device, into *data, and return it
+    const T* upload(size_t size, const T* src, T** data)
+    {
+        checkCudaErrors( cudaMalloc(data, size*sizeof(T)) );
+        checkCudaErrors( cudaMemcpy(*data, src, size*sizeof(T), cudaMemcpyHostToDevice) );
+        return *data;
+    }
+    
+    void download(size_t size, const T* data, T* dst)
+    {
+        checkCudaErrors( cudaMemcpy(dst, data, size*sizeof(T), cudaMemcpyDeviceToHost) );
+    }
+    
+    // Host buffers exchanged with the device at every prediction, pinned so that the copies go at full speed
+    T* allocHost(size_t size)
+    {
+        T* data = nullptr;
+        checkCudaErrors( cudaMallocHost((void**)&data, size*sizeof(T)) );
+        return data;
+    }
+    
+    void freeHost(T *data)
+    {
+        if (data != NULL) checkCudaErrors( cudaFreeHost(data) );
+    }
+    
+    // Weights of a plan in another precision (Operator_t) : a device copy, kept as long as the backend
+    const void* storeWeights(size_t bytes, const void* src)
+    {
+        void* data = nullptr;
+        checkCudaErrors( cudaMalloc(&data, bytes) );
+        checkCudaErrors( cudaMemcpy(data, src, bytes, cudaMemcpyHostToDevice) );
+        stored.push_back(data);
+        return data;
+    }
+    
+    // Allocate the workspace of forward() for batches of up to maxbatch samples of w inputs,
+    // no layer being wider than maxwidth. The device runs everything, threads is only for the CPU backend.
+    void reserve(int maxbatch, int maxwidth, int w, int threads = 0)
+    {
+        resize((size_t)maxbatch*w,        &workspace[0], false);
+        resize((size_t)maxbatch*maxwidth, &workspace[1], false);
+        resize((size_t)maxbatch*maxwidth, &workspace[2], false);
+    }
+    
+    // Run the operators of a compiled model on n samples (at most the maxbatch of reserve()), from host input
+    // to host output, through the workspace only
+    void forward(const vector<Operator_t<T> >& operators, int n, int w, const T* input, T* output)
+    {
+        STAGE_SPAN("nn.forward");
+        {
+            STAGE_SPAN("nn.upload");
+            checkCudaErrors( cudaMemcpy(workspace[0], input, (size_t)n*w*sizeof(T), cudaMemcpyHostToDevice) );
+        }
+        const T* srcData = workspace[0];
+        for (size_t i = 0; i < operators.size(); i++) {
+            STAGE_SPAN_AT("nn.layer", i);
+            STAGE_COUNT_AT("nn.samples", i, n);
+            const Operator_t<T>& op = operators[i];
+            T* dstData = workspace[1 + i%2];
+            if (op.dense != nullptr) {
+                switch (op.precision) {
+                case Precision_t::FP16: denseActivationReduced<Precision_t::FP16>(op, n, w, srcData, dstData); break;
+                case Precision_t::BF16: denseActivationReduced<Precision_t::BF16>(op, n, w, srcData, dstData); break;
+                case Precision_t::INT8: denseActivationReduced<Precision_t::INT8>(op, n, w, srcData, dstData); break;
+                default:                denseActivation(*op.dense, op.acttype, n, w, srcData, dstData);
+                }
+                w = op.dense->outputs;
+            } else {
+                tanhForward(n, w, 1, srcData, dstData);
+            }
+            srcData = dstData;
+            NN_TRACE_SYNC();
+        }
+        STAGE_SPAN("nn.download");
+        download((size_t)n*w, srcData, output);
     }
     
     
@@ -432,11 +755,11 @@ private:
     // Fully connected forwards, using cublas only
     void fullyConnectedForward(const Layer_t<T>& layer,
                           int& n, int& h, int& w,
-                          T* srcData, T** dstData)
+                          const T* srcData, T** dstData)
     {     
         int dim_x = h * w;
         int dim_y = layer.outputs;
-        resize(n*dim_y, dstData);
+        resize((size_t)n*dim_y, dstData);
         
             
         // add bias into dstData
@@ -448,13 +771,72 @@ private:
         // for future ease, set h = total_num_of_ele_in_output, and w = 1
         h = dim_y; w = 1;      
     } 
+    
+    // Fully connected forwards with the activation that follows, fused : the output is written once, already activated,
+    // instead of clearing it, adding the bias, the gemm and the activation each going through it
+    void fullyConnectedActivationForward(const Layer_t<T>& layer, ActType_t acttype,
+                          int& n, int& h, int& w,
+                          const T* srcData, T** dstData)
+    {
+        int dim_x = h * w;
+        int dim_y = layer.outputs;
+        resize((size_t)n*dim_y, dstData, false);
+        
+        denseActivation(layer, acttype, n, dim_x, srcData, *dstData);
+        
+        h = dim_y; w = 1;
+    }
+    
+    // The fused operator on n samples of dim_x inputs, into dstData [n x layer.outputs] which is already allocated
+    void denseActivation(const Layer_t<T>& layer, ActType_t acttype, int n, int dim_x, const T* srcData, T* dstData)
+    {
+        int dim_y = layer.outputs;
+        
+        const size_t total  = (size_t)n*dim_y;
+        const int    blocks = (int)min((total + FUSED_THREADS - 1) / FUSED_THREADS, (size_t)FUSED_MAXBLOCKS);
+        const size_t shared = ((size_t)dim_x*dim_y + dim_y) * sizeof(T);
+        if (shared <= FUSED_MAXSHARED) {
+            denseActivationKernel<T, Precision_t::NATIVE><<<blocks, FUSED_THREADS, shared>>>(n, dim_x, dim_y, srcData,
+                                                                       layer.data_d, nullptr, layer.bias_d, dstData, acttype);
+        } else {
+            gemm<T>(cublasHandle, dim_x, dim_y, n, layer.data_d, srcData, dstData, 1.0, 0.0);
+            denseActivationEpilogue<T><<<blocks, FUSED_THREADS>>>(n, dim_y, layer.bias_d, dstData, acttype);
+        }
+        checkCudaErrors( cudaGetLastError() );
+    }
+    
+    // The fused operator with the weights of the plan in a reduced precision (Operator_t::weights and scale),
+    // decoded by the kernel : no gemm for these, W is read from global memory if it does not fit in shared memory
+    template <Precision_t P>
+    void denseActivationReduced(const Operator_t<T>& op, int n, int dim_x, const T* srcData, T* dstData)
+    {
+        typedef weight_t<T,P> WT;
+        const Layer_t<T>& layer = *op.dense;
+        int dim_y = layer.outputs;
+        
+        const size_t total  = (size_t)n*dim_y;
+        const int    blocks = (int)min((total + FUSED_THREADS - 1) / FUSED_THREADS, (size_t)FUSED_MAXBLOCKS);
+        const size_t shared = (size_t)dim_y * sizeof(T) * (WT::scaled ? 2 : 1) + (size_t)dim_x*dim_y*sizeof(typename WT::type);
+        const bool   cached = shared <= FUSED_MAXSHARED;
+        denseActivationKernel<T, P><<<blocks, FUSED_THREADS, cached ? shared : 0>>>(n, dim_x, dim_y, srcData,
+                          (const typename WT::type*)op.weights, op.scale, layer.bias_d, dstData, op.acttype, cached);
+        checkCudaErrors( cudaGetLastError() );
+    }
+    
+    // Fully connected backwards : gradients of the layer inputs [n x layer.inputs] from the gradients of its outputs
+    // [n x layer.outputs], i.e. dX = W^T dot dY. The bias does not change them.
+    void fullyConnectedBackward(const Layer_t<T>& layer, int n, const T* srcDiff, T** dstDiff)
+    {
+        resize((size_t)n*layer.inputs, dstDiff);
+        gemm<T>(cublasHandle, layer.outputs, layer.inputs, n, layer.data_d, srcDiff, *dstDiff, 1.0, 0.0, CUBLAS_OP_T);
+    }
 
 
  
     // Softmax forwards from CUDNN
-    void softmaxForward(int n, int h, int w, T* srcData, T** dstData)
+    void softmaxForward(int n, int h, int w, const T* srcData, T** dstData)
     {
-        resize(n*h*w, dstData);
+        resize((size_t)n*h*w, dstData);
 
         setTensorDesc(srcTensorDesc, dataType, n, h, w);
         setTensorDesc(dstTensorDesc, dataType, n, h, w);
@@ -473,14 +855,19 @@ private:
     }
     
     // activation forward with hyperbolic tangential
-    void activationForward_TANH(int n, int h, int w, T* srcData, T** dstData)
+    void activationForward_TANH(int n, int h, int w, const T* srcData, T** dstData)
+    {
+        resize((size_t)n*h*w, dstData);
+        tanhForward(n, h, w, srcData, *dstData);
+    }
+    
+    // the same into dstData, already allocated
+    void tanhForward(int n, int h, int w, const T* srcData, T* dstData)
     {
         checkCUDNN( cudnnSetActivationDescriptor(activDesc,
                                                 CUDNN_ACTIVATION_TANH,
                                                 CUDNN_PROPAGATE_NAN,
                                                 0.0) );         
-    
-        resize(n*h*w, dstData);
 
         setTensorDesc(srcTensorDesc, dataType, n, h, w);
         setTensorDesc(dstTensorDesc, dataType, n, h, w);
@@ -494,17 +881,44 @@ private:
                                             srcData,
                                             &beta,
                                             dstTensorDesc,
-                                            *dstData) );    
+                                            dstData) );    
+    }
+    
+    // activation backward with hyperbolic tangential : dx = (1 - y*y) * dy,
+    // y and x are the output and the input of activationForward_TANH()
+    void activationBackward_TANH(int n, int h, int w, const T* y, const T* dy, const T* x, T** dx)
+    {
+        checkCUDNN( cudnnSetActivationDescriptor(activDesc,
+                                                CUDNN_ACTIVATION_TANH,
+                                                CUDNN_PROPAGATE_NAN,
+                                                0.0) );         
+    
+        resize((size_t)n*h*w, dx);
+
+        setTensorDesc(srcTensorDesc, dataType, n, h, w);
+        setTensorDesc(dstTensorDesc, dataType, n, h, w);
+
+        T alpha = 1.0;
+        T beta  = 0.0;
+        checkCUDNN( cudnnActivationBackward(cudnnHandle,
+                                            activDesc,
+                                            &alpha,
+                                            dstTensorDesc, y,
+                                            dstTensorDesc, dy,
+                                            srcTensorDesc, x,
+                                            &beta,
+                                            srcTensorDesc,
+                                            *dx) );    
     }
     
     // activation forward with ReLU nonlinearty    
-    void activationForward_ReLU(int n, int h, int w, T* srcData, T** dstData)
+    void activationForward_ReLU(int n, int h, int w, const T* srcData, T** dstData)
     {
         checkCUDNN( cudnnSetActivationDescriptor(activDesc,
                                                 CUDNN_ACTIVATION_RELU,
                                                 CUDNN_PROPAGATE_NAN,
                                                 0.0) );   
-        resize(n*h*w, dstData);
+        resize((size_t)n*h*w, dstData);
 
         setTensorDesc(srcTensorDesc, dataType, n, h, w);
         setTensorDesc(dstTensorDesc, dataType, n, h, w);
@@ -523,6 +937,16 @@ private:
 
 };
 
+#endif // !NN_CPU
+
+
+// Backend running the layers : CUDNN/CUBLAS on the device, or the CPU kernels of network_cpu.hpp
+#if defined(NN_CPU)
+template <typename T> using network_backend_t = network_cpu_t<T>;
+#else
+template <typename T> using network_backend_t = network_t<T>;
+#endif
+
 
 //===========================================================================================
 //
@@ -532,10 +956,14 @@ template <typename T>
 class Layer_Net_t{
 private:
 
+     // the layers as fused operators, built by compile() before the first prediction
+     vector<Operator_t<T> > operators;
+     bool compiled = false;
+
      // network algorithm initialize with constructor
      // Note, as nVidia suggested, it is best practice to let all cuda context live 
      // as long as the application without frequent create/destroy
-     network_t<T> neural_net;
+     network_backend_t<T> neural_net;
      
      void switchptr(T** & alpha, T** & bravo){
           T** tmp;
@@ -577,6 +1005,7 @@ public:
           } else {
                root = new Layer_t<T>(_name, _inputs, _outputs, _data_h, _bias_h);
           };
+          compiled = false;
      
      };
      
@@ -590,6 +1019,7 @@ public:
           } else {
                root = new Layer_t<T>(_name, _acttype);
           };
+          compiled = false;
      
      };     
      
@@ -603,13 +1033,39 @@ public:
           } else {
                root = new Layer_t<T>(_name, _acttype);
           };
+          compiled = false;
      
      };      
      
+     // Append the layers of a mapped model file (modelfile.hpp). The dense layers read their weights in the mapping,
+     // without any copy on the host (the device still gets its own), so the file must outlive the model.
+     void load_model(const ModelFile_t<T>& _file){
+          for (size_t i = 0; i < _file.layers(); i++) {
+               const ModelFileLayer& l = _file.layer(i);
+               Layer_t<T>* layer;
+               if (l.type == MODELFILE_DENSE) {
+                    layer = new Layer_t<T>(_file.name(i), l.inputs, l.outputs, _file.weights(i), _file.bias(i), true);
+               } else {
+                    layer = new Layer_t<T>(_file.name(i), static_cast<ActType_t>(l.acttype));
+               }
+               if (root!=NULL) {
+                    Layer_t<T>* curr = root;
+                    while(curr->next) {curr = curr->next;};
+                    curr->next = layer;
+                    curr->next->prev = curr;
+               } else {
+                    root = layer;
+               };
+          }
+          compiled = false;
+     }
+     
      // Get layer ptr according to its index (start from 1 as 1st layer, 2 as seond layer ...)
+     // The caller may change the layer (e.g. its activation type), so the model is compiled again before the next prediction
      Layer_t<T>* get_layer_by_seq(int _n){
           Layer_t<T>* curr=root;
           int i = 1;
+          compiled = false;
           
           while( (curr->next != NULL)  && (i<_n) ){
                curr = curr->next;
@@ -618,84 +1074,640 @@ public:
           return curr;
      }
      
+     // Walk the list of layers and fuse each dense layer with the activation after it (TANH or LINEAR),
+     // so that each dense layer goes through its output once. Called by predict() when the layers have changed.
+     void compile(){
+          operators.clear();
+          for (Layer_t<T>* curr = root; curr != NULL; curr = curr->next) {
+               Operator_t<T> op = { nullptr, ActType_t::LINEAR, Precision_t::NATIVE, nullptr, nullptr };
+               if (curr->type == Type_t::DENSE) {
+                    op.dense = curr;
+                    if (curr->next != NULL && curr->next->type == Type_t::ACTIVIATION
+                        && (curr->next->acttype == ActType_t::TANH || curr->next->acttype == ActType_t::LINEAR)) {
+                         curr = curr->next;
+                         op.acttype = curr->acttype;
+                    }
+               } else if (curr->type == Type_t::ACTIVIATION) {
+                    // activiation::linear = doing NOTHING 
+                    if (curr->acttype == ActType_t::LINEAR) continue;
+                    if (curr->acttype != ActType_t::TANH) {
+                         cout << "Unknown activation type!" <<endl;
+                         continue;
+                    }
+                    op.acttype = curr->acttype;
+               } else {
+                    cout << "Unknown layer type!" <<endl;
+                    continue;
+               }
+               operators.push_back(op);
+          }
+          compiled = true;
+     }
+     
+     // The fused operators, compiled if the layers have changed (see Plan_t)
+     const vector<Operator_t<T> >& get_operators(){
+          if (!compiled) compile();
+          return operators;
+     }
+     
      // Make prediction according to all the layers in the model
-     void predict(T* _inputData, int _n, int _w, T* & _outputData_h, unsigned long int& _outsize){
+     // _inputData is only read, it can point into a mapped sample file (samplefile.hpp)
+     void predict(const T* _inputData, int _n, int _w, T* & _outputData_h, unsigned long int& _outsize){
         
         if (root != NULL) {
+             STAGE_SPAN("nn.predict");
              
              int n,h,w;   // number of sampels in one batch ; height ; width 
              
              T *devData_alpha = nullptr, *devData_bravo = nullptr;  // two storage places (alpha and bravo) saving data flow
              
-             // two ptrs towards either alpha or bravo
-             // controlling from which the data is read
-             // and to which the result is written to 
-             T** srcDataPtr = nullptr, **dstDataPtr = nullptr; 
+             // the data read by the next layer, 
+             // and two ptrs towards either alpha or bravo : 
+             // the one the result is written to, and the other one
+             const T* srcData = nullptr;
+             T** dstDataPtr = nullptr, **spareDataPtr = nullptr; 
 
              
              // initialize storage alpha and save input vector into it
+             // (the CPU backend reads the input in place instead)
              //cout << " Initializing input data ... " << endl;               
              n = _n; h = 1; w = _w;               
-             checkCudaErrors( cudaMalloc(&devData_alpha, n*h*w*sizeof(T)) );
-             checkCudaErrors( cudaMemcpy( devData_alpha, _inputData,
-                                          n*h*w*sizeof(T),
-                                          cudaMemcpyHostToDevice) );
-             srcDataPtr = &devData_alpha;
-             dstDataPtr = &devData_bravo;
-
-                                  
+             {
+                  STAGE_SPAN("nn.upload");
+                  srcData = neural_net.upload((size_t)n*h*w, _inputData, &devData_alpha);
+             }
+             dstDataPtr   = &devData_bravo;
+             spareDataPtr = &devData_alpha;
+
+             
+             if (!compiled) compile();
+             
+             for (size_t i = 0; i < operators.size(); i++) {
+               STAGE_SPAN_AT("nn.layer", i);
+               STAGE_COUNT_AT("nn.samples", i, n);
+               const Operator_t<T>& op = operators[i];
+               if (op.dense != nullptr) {
+                    // dense layer, bias and activation in one pass
+                    neural_net.fullyConnectedActivationForward(*op.dense, op.acttype, n, h, w, srcData, dstDataPtr);
+               } else {
+                    neural_net.activationForward_TANH(n, h, w, srcData, dstDataPtr);
+               }
+               NN_TRACE_SYNC();
+               
+               // Swith the origin/target memory array after the step
+               srcData = *dstDataPtr;
+               switchptr(dstDataPtr, spareDataPtr);
+             }
+             
+             //cout << "Final score : " ;        
+             //printDeviceVector<T>(n*h*w, srcData);
+             
+             _outsize=(unsigned long int)n*h*w;
+             {
+                  STAGE_SPAN("nn.alloc");
+                  if(_outputData_h!=NULL){
+                         delete[] _outputData_h;
+                  }
+                  _outputData_h = new T[_outsize];
+             }
+             {
+                  STAGE_SPAN("nn.download");
+                  neural_net.download(_outsize, srcData, _outputData_h);
+             }
+             
+             
+             
+             // Don't forget to release resource !!!
+             srcData = nullptr;
+             dstDataPtr = nullptr;
+             spareDataPtr = nullptr;
+              
+             STAGE_SPAN("nn.release");
+             neural_net.release(devData_alpha);
+             neural_net.release(devData_bravo);
+        
+        }
+        return;
+         
+     } 
+     
+     
+     // Make prediction, and the gradients of each sample's score with respect to its inputs in the same pass.
+     // The model must give one score per sample. _gradient_h gets [_n x _w] values, in the layout of _inputData,
+     // e.g. the feature gradients that computeNNFeatureGradients() of the two-body code turns into forces.
+     // All intermediate outputs stay on the device until the backward pass has used them.
+     void predict_and_gradient(const T* _inputData, int _n, int _w, T* & _outputData_h, unsigned long int& _outsize,
+                               T* & _gradient_h){
+        
+        if (root != NULL) {
+             
+             int n,h,w;
+             
+             // data[0] is the input, data[i+1] the output of layers[i], which has width[i+1] values per sample
+             vector<const T*>    data;
+             vector<int>         width;
+             vector<Layer_t<T>*> layers;
+             vector<T*>          owned;        // what to release at the end
+             
+             n = _n; h = 1; w = _w;
+             T* input_d = nullptr;
+             data.push_back(neural_net.upload((size_t)n*h*w, _inputData, &input_d));
+             width.push_back(h*w);
+             owned.push_back(input_d);
+             
              Layer_t<T>* curr = root;
              do{
-               //cout << " Processing Layer : " << curr->name << endl;
+               T* output_d = nullptr;
                if ( curr-> type == Type_t::DENSE ) { 
-                    // If it is a dense layer, we perform fully_connected forward 
-                    neural_net.fullyConnectedForward((*curr), n, h, w, *srcDataPtr, dstDataPtr);
-                    
-                    // Swith the origin/target memory array after the step
-                    switchptr(srcDataPtr, dstDataPtr);
-                      
+                    neural_net.fullyConnectedForward((*curr), n, h, w, data.back(), &output_d);
                } else if (curr -> type == Type_t::ACTIVIATION){
-                    // If it is an activiation layer, perform corresponding activiation forwards
-                    // In fact, activiation::linear = doing NOTHING 
+                    // activiation::linear changes nothing, neither forwards nor backwards
                     if (curr -> acttype == ActType_t::TANH){
-                         neural_net.activationForward_TANH(n, h, w, *srcDataPtr, dstDataPtr);
-                         switchptr(srcDataPtr, dstDataPtr);
+                         neural_net.activationForward_TANH(n, h, w, data.back(), &output_d);
                     } else if (curr->acttype != ActType_t::LINEAR) {    
                          cout << "Unknown activation type!" <<endl;
                     } 
                } else {
                     cout << "Unknown layer type!" <<endl;
                }
+               if (output_d != nullptr) {
+                    data.push_back(output_d);
+                    width.push_back(h*w);
+                    layers.push_back(curr);
+                    owned.push_back(output_d);
+               }
              } while(  (curr=curr->next) != NULL);
              
-             //cout << "Final score : " ;        
-             //printDeviceVector<T>(n*h*w, *srcDataPtr);
-             
-             _outsize=n*h*w;
+             _outsize=(unsigned long int)n*h*w;
              if(_outputData_h!=NULL){
                     delete[] _outputData_h;
              }
              _outputData_h = new T[_outsize];
-             cudaDeviceSynchronize();
-             cudaMemcpy(_outputData_h, *srcDataPtr, _outsize*sizeof(T), cudaMemcpyDeviceToHost);            
-             
+             neural_net.download(_outsize, data.back(), _outputData_h);
              
+             if (h*w != 1) {
+                  cout << "Gradients need one score per sample, the model gives " << h*w << "!" << endl;
+             } else {
+                  // backwards from d(score)/d(score) = 1, the two diff arrays swap at each layer as in predict()
+                  T *diff_alpha = nullptr, *diff_bravo = nullptr;
+                  vector<T> ones(n, T(1.0));
+                  const T* diff = neural_net.upload((size_t)n, ones.data(), &diff_alpha);
+                  T** dstDiffPtr = &diff_bravo, **spareDiffPtr = &diff_alpha;
+                  
+                  for (int i = (int)layers.size() - 1; i >= 0; i--) {
+                       if (layers[i]->type == Type_t::DENSE) {
+                            neural_net.fullyConnectedBackward(*layers[i], n, diff, dstDiffPtr);
+                       } else {
+                            neural_net.activationBackward_TANH(n, width[i], 1, data[i+1], diff, data[i], dstDiffPtr);
+                       }
+                       diff = *dstDiffPtr;
+                       switchptr(dstDiffPtr, spareDiffPtr);
+                  }
+                  
+                  if(_gradient_h!=NULL){
+                         delete[] _gradient_h;
+                  }
+                  _gradient_h = new T[(size_t)n*_w];
+                  neural_net.download((size_t)n*_w, diff, _gradient_h);
+                  
+                  neural_net.release(diff_alpha);
+                  neural_net.release(diff_bravo);
+             }
              
-             // Don't forget to release resource !!!
-             srcDataPtr = nullptr;
-             dstDataPtr = nullptr;
-              
-             checkCudaErrors( cudaFree(devData_alpha) );
-             checkCudaErrors( cudaFree(devData_bravo) );
-        
+             for (size_t i = 0; i < owned.size(); i++) {
+                  neural_net.release(owned[i]);
+             }
         }
         return;
-         
-     } 
+     }
 };
 
 
+//===========================================================================================
+//
+// Immutable model, shared by the threads that predict with it : the fused operators of a Layer_Net_t and their own
+// dense layers, which nothing changes after the constructor. Each thread has its own execution context (a Plan_t made
+// from the shared_ptr), with its workspace and, for the GPU, its handles and descriptors.
+//
+template <typename T>
+class Model_t{
+private:
+     vector<Layer_t<T>*>    layers;       // the dense layers of the operators
+     vector<Operator_t<T> > operators;
+     int inputs;
+     int outputs;
+     
+     Model_t(const Model_t&);
+     Model_t& operator=(const Model_t&);
+
+public:
+     // Copy of the compiled layers of _net, which may then change or go. Layers whose host weights are read in place
+     // (load_model()) still are, the model file must outlive this model.
+     explicit Model_t<T>(Layer_Net_t<T>& _net) : inputs(0), outputs(0)
+     {
+          const vector<Operator_t<T> >& ops = _net.get_operators();
+          for (size_t i = 0; i < ops.size(); i++) {
+               Operator_t<T> op = ops[i];
+               if (op.dense != nullptr) {
+                    const Layer_t<T>& l = *op.dense;
+                    layers.push_back(new Layer_t<T>(l.name, l.inputs, l.outputs, l.data_h, l.bias_h, l.shared_h));
+                    op.dense = layers.back();
+                    if (inputs == 0) inputs = l.inputs;
+                    outputs = l.outputs;
+               }
+               operators.push_back(op);
+          }
+     }
+     
+     ~Model_t<T>()
+     {
+          for (size_t i = 0; i < layers.size(); i++) delete layers[i];
+     }
+     
+     const vector<Operator_t<T> >& get_operators() const { return operators; }
+     int get_inputs()  const { return inputs;  }
+     int get_outputs() const { return outputs; }
+};
+
+
+//===========================================================================================
+//
+// Execution plan of a model, for predictions at every step of a simulation : the operators of the compiled model,
+// and a workspace sized once for batches of up to maxbatch samples and kept from one prediction to the next.
+// predict() writes the scores into an array of the caller and allocates nothing, on the host or on the device.
+//    - on the device the workspace is the input and two ping-pong buffers of maxbatch samples of the widest layer,
+//      larger batches are predicted maxbatch samples at a time
+//    - on the CPU it is two buffers of one tile per thread, each tile going through all operators while it is in cache
+// The plan has its own backend (handles, workspace), and reads the layers of the model, which must outlive it.
+// Make a new plan if the layers change. A plan is used by one thread at a time.
+//
+// predict_stream() scores sample sets of any size in chunks of maxbatch samples, which bounds the memory it needs.
+//
+template <typename T>
+class Plan_t{
+private:
+     shared_ptr<const Model_t<T> > model;    // kept alive for its operators, if the plan was made from it
+     network_backend_t<T>   neural_net;
+     vector<Operator_t<T> > operators;
+     
+     int maxbatch;   // samples of the workspace
+     int inputs;     // width of one sample
+     int outputs;    // width of its score(s)
+     Precision_t precision;
+     
+     // host chunks of predict_stream(), allocated by its first call
+     T* stream_in[2]  = {nullptr, nullptr};
+     T* stream_out[2] = {nullptr, nullptr};
+     
+     Plan_t(const Plan_t&);
+     Plan_t& operator=(const Plan_t&);
+
+     // Weights of a dense operator in the precision of the plan, in the memory of the backend
+     void store_weights(Operator_t<T>& op){
+          const Layer_t<T>& l = *op.dense;
+          const size_t count = (size_t)l.inputs * l.outputs;
+          op.precision = precision;
+          if (precision == Precision_t::FP16 || precision == Precision_t::BF16) {
+               vector<uint16_t> w(count);
+               for (size_t i = 0; i < count; i++) {
+                    w[i] = precision == Precision_t::FP16 ? floatToHalf((float)l.data_h[i]) : floatToBfloat16((float)l.data_h[i]);
+               }
+               op.weights = neural_net.storeWeights(count * sizeof(uint16_t), w.data());
+          } else if (precision == Precision_t::INT8) {
+               // symmetric, per output : the largest |W| of each output column becomes 127
+               vector<T> scale(l.outputs, T(0));
+               for (size_t i = 0; i < count; i++) {
+                    scale[i % l.outputs] = max(scale[i % l.outputs], (T)fabs(l.data_h[i]));
+               }
+               for (int o = 0; o < l.outputs; o++) scale[o] = scale[o] > 0 ? scale[o] / 127 : T(1);
+               vector<int8_t> w(count);
+               for (size_t i = 0; i < count; i++) {
+                    w[i] = (int8_t)lrint(l.data_h[i] / scale[i % l.outputs]);
+               }
+               op.weights = neural_net.storeWeights(count * sizeof(int8_t), w.data());
+               op.scale   = (const T*)neural_net.storeWeights(l.outputs * sizeof(T), scale.data());
+          }
+     }
+
+     // Widths of the operators, weights in the precision of the plan, and the workspace
+     void build(int threads){
+          int maxwidth = inputs;
+          outputs = inputs;
+          for (size_t i = 0; i < operators.size(); i++) {
+               if (operators[i].dense != nullptr) {
+                    outputs = operators[i].dense->outputs;
+                    if (precision != Precision_t::NATIVE) store_weights(operators[i]);
+               }
+               maxwidth = max(maxwidth, outputs);
+          }
+          neural_net.reserve(maxbatch, maxwidth, inputs, threads);
+     }
+
+public:
+     // _precision : storage of the dense weights (see Precision_t), converted here from the weights of the model
+     Plan_t<T>(Layer_Net_t<T>& _model, int _maxbatch, int _inputs, Precision_t _precision = Precision_t::NATIVE)
+                  : operators(_model.get_operators()), maxbatch(_maxbatch > 0 ? _maxbatch : 1), inputs(_inputs),
+                    precision(_precision)
+     {
+          build(0);
+     }
+     
+     // A plan on a shared model (Model_t), e.g. the execution context of one thread : only the workspace is its own.
+     // With the CPU backend it runs on _threads OpenMP threads, 0 for all of them.
+     Plan_t<T>(const shared_ptr<const Model_t<T> >& _model, int _maxbatch, Precision_t _precision = Precision_t::NATIVE,
+               int _threads = 0)
+                  : model(_model), operators(_model->get_operators()), maxbatch(_maxbatch > 0 ? _maxbatch : 1),
+                    inputs(_model->get_inputs()), precision(_precision)
+     {
+          build(_threads);
+     }
+     
+     ~Plan_t<T>()
+     {
+          for (int i = 0; i < 2; i++) {
+               if (stream_in[i]  != nullptr) neural_net.freeHost(stream_in[i]);
+               if (stream_out[i] != nullptr) neural_net.freeHost(stream_out[i]);
+          }
+     }
+     
+     int get_max_batch() const { return maxbatch; }
+     int get_inputs()    const { return inputs;   }
+     int get_outputs()   const { return outputs;  }
+     Precision_t get_precision() const { return precision; }
+     
+     // Predict _n samples of get_inputs() values into _outputData_h, which holds _n x get_outputs() values
+     void predict(const T* _inputData, int _n, T* _outputData_h){
+          for (int first = 0; first < _n; first += maxbatch) {
+               int n = min(_n - first, maxbatch);
+               neural_net.forward(operators, n, inputs, _inputData + (size_t)first*inputs, _outputData_h + (size_t)first*outputs);
+          }
+     }
+     
+     // Streaming prediction, maxbatch samples at a time, in three stages that overlap : while chunk k is predicted,
+     // _load fills chunk k+1 in a background thread and _store gets the scores of chunk k-1 in another one.
+     //    _load(first, count, input)  writes at most count samples, from sample first on, into input and returns how many
+     //                                it wrote, 0 once there are no more, e.g. reading a file or computing features
+     //    _store(first, n, output)    gets the scores of samples [first, first+n), n x get_outputs() values, in order
+     // Exceptions of either are thrown here once the chunks in flight are done.
+     // Besides the workspace, the host holds two input and two output chunks (pinned for the GPU) whatever the
+     // number of samples, 2 * maxbatch * (get_inputs() + get_outputs()) values. Returns the number of samples.
+     size_t predict_stream(const function<int(size_t, int, T*)>& _load, const function<void(size_t, int, const T*)>& _store){
+          for (int i = 0; i < 2; i++) {
+               if (stream_in[i]  == nullptr) stream_in[i]  = neural_net.allocHost((size_t)maxbatch*inputs);
+               if (stream_out[i] == nullptr) stream_out[i] = neural_net.allocHost((size_t)maxbatch*outputs);
+          }
+          
+          size_t first = 0;
+          int    curr  = 0;
+          int    n     = _load(first, maxbatch, stream_in[curr]);
+          future<void> stored;                 // _store of the previous chunk, which reads the other output chunk
+          while (n > 0) {
+               future<int> next = async(launch::async, _load, first + n, maxbatch, stream_in[1 - curr]);
+               
+               predict(stream_in[curr], n, stream_out[curr]);
+               
+               if (stored.valid()) stored.get();
+               stored = async(launch::async, _store, first, n, (const T*)stream_out[curr]);
+               
+               first += n;
+               n = next.get();
+               curr = 1 - curr;
+          }
+          if (stored.valid()) stored.get();
+          return first;
+     }
+};
+
+
+//===========================================================================================
+//
+// Pool of threads predicting with one shared model (Model_t), for several independent callers at once (e.g. one per
+// simulated system). Each worker has its own execution context, a Plan_t of one tile on one thread, so its scratch
+// stays its own. predict() cuts the samples in tiles, queues a contiguous range of them on each worker, and waits.
+// A worker takes its tiles from the front of its queue, and once it is empty steals from the back of the others,
+// so uneven tiles or callers still keep every core busy. Exceptions of a tile are thrown by the predict() of its caller.
+//
+#define POOL_TILE   240    // samples of one task, the tile of the CPU backend
+
+template <typename T>
+class Pool_t{
+private:
+     // one predict() call, on the stack of its caller until all its tiles are done
+     struct Job_t {
+          const T*           input;
+          T*                 output;
+          int                remaining;     // tiles not done yet, under lock
+          exception_ptr      error;
+          mutex              lock;
+          condition_variable done;
+     };
+     
+     struct Tile_t {
+          Job_t* job;
+          int    first;
+          int    n;
+     };
+     
+     struct Worker_t {
+          mutex                   lock;      // of tiles
+          deque<Tile_t>           tiles;
+          unique_ptr<Plan_t<T> >  context;
+          thread                  runner;
+     };
+     
+     shared_ptr<const Model_t<T> > model;
+     int tile;
+     int inputs;
+     int outputs;
+     vector<unique_ptr<Worker_t> > workers;
+     
+     mutex              idle_lock;
+     condition_variable idle;
+     size_t             queued   = 0;      // tiles in all the queues, under idle_lock
+     bool               stopping = false;
+     atomic<size_t>     next_worker;       // first worker of the next job, so that small jobs are spread as well
+     atomic<size_t>     steals;
+     
+     Pool_t(const Pool_t&);
+     Pool_t& operator=(const Pool_t&);
+     
+     // A tile from the front of the queue of worker self, or else from the back of another one
+     bool take(size_t self, Tile_t& task){
+          for (size_t k = 0; k < workers.size(); k++) {
+               Worker_t& worker = *workers[(self + k) % workers.size()];
+               lock_guard<mutex> guard(worker.lock);
+               if (worker.tiles.empty()) continue;
+               if (k == 0) {
+                    task = worker.tiles.front();
+                    worker.tiles.pop_front();
+               } else {
+                    task = worker.tiles.back();
+                    worker.tiles.pop_back();
+                    steals++;
+               }
+               return true;
+          }
+          return false;
+     }
+     
+     void run(size_t self){
+          Plan_t<T>& context = *workers[self]->context;
+          for (;;) {
+               Tile_t task;
+               if (take(self, task)) {
+                    {
+                         lock_guard<mutex> guard(idle_lock);
+                         queued--;
+                    }
+                    exception_ptr error;
+                    try {
+                         context.predict(task.job->input  + (size_t)task.first*inputs, task.n,
+                                         task.job->output + (size_t)task.first*outputs);
+                    } catch (...) {
+                         error = current_exception();
+                    }
+                    lock_guard<mutex> guard(task.job->lock);
+                    if (error && !task.job->error) task.job->error = error;
+                    if (--task.job->remaining == 0) task.job->done.notify_all();
+                    continue;
+               }
+               unique_lock<mutex> guard(idle_lock);
+               idle.wait(guard, [this]{ return queued > 0 || stopping; });
+               if (stopping && queued == 0) return;
+          }
+     }
+
+public:
+     // _threads workers (0 : one per core), each with a context of _tile samples in the precision _precision
+     Pool_t<T>(const shared_ptr<const Model_t<T> >& _model, int _threads = 0, int _tile = POOL_TILE,
+               Precision_t _precision = Precision_t::NATIVE)
+                  : model(_model), tile(_tile > 0 ? _tile : POOL_TILE), inputs(_model->get_inputs()),
+                    outputs(_model->get_outputs()), next_worker(0), steals(0)
+     {
+          if (_threads <= 0) _threads = max(1, (int)thread::hardware_concurrency());
+          for (int i = 0; i < _threads; i++) {
+               workers.push_back(unique_ptr<Worker_t>(new Worker_t));
+               workers.back()->context.reset(new Plan_t<T>(model, tile, _precision, 1));
+          }
+          for (int i = 0; i < _threads; i++) {
+               workers[i]->runner = thread(&Pool_t<T>::run, this, (size_t)i);
+          }
+     }
+     
+     ~Pool_t<T>()
+     {
+          {
+               lock_guard<mutex> guard(idle_lock);
+               stopping = true;
+          }
+          idle.notify_all();
+          for (size_t i = 0; i < workers.size(); i++) workers[i]->runner.join();
+     }
+     
+     int    get_threads() const { return (int)workers.size(); }
+     int    get_inputs()  const { return inputs;  }
+     int    get_outputs() const { return outputs; }
+     size_t get_steals()  const { return steals;  }    // tiles run by another worker than the one they were queued on
+     
+     // Predict _n samples of get_inputs() values into _outputData_h (_n x get_outputs() values) on the workers.
+     // Any number of threads may call it at the same time.
+     void predict(const T* _inputData, int _n, T* _outputData_h){
+          if (_n <= 0) return;
+          Job_t job;
+          job.input     = _inputData;
+          job.output    = _outputData_h;
+          const int tiles = (_n + tile - 1) / tile;
+          job.remaining = tiles;
+          
+          // counted first, so that the workers which take them never see fewer queued than they took
+          {
+               lock_guard<mutex> guard(idle_lock);
+               queued += tiles;
+          }
+          const size_t W     = workers.size();
+          const size_t start = next_worker++;
+          for (size_t w = 0; w < W; w++) {
+               // contiguous tiles [tiles*w/W, tiles*(w+1)/W) for the w-th worker from start
+               Worker_t& worker = *workers[(start + w) % W];
+               lock_guard<mutex> guard(worker.lock);
+               for (int t = (int)(tiles*w/W); t < (int)(tiles*(w + 1)/W); t++) {
+                    Tile_t task = { &job, t*tile, min(tile, _n - t*tile) };
+                    worker.tiles.push_back(task);
+               }
+          }
+          idle.notify_all();
+          
+          unique_lock<mutex> guard(job.lock);
+          job.done.wait(guard, [&job]{ return job.remaining == 0; });
+          if (job.error) rethrow_exception(job.error);
+     }
+};
+
+
+//===========================================================================================
+//
+// Validation of the reduced precisions : a plan of each precision predicts the samples, and its scores are compared
+// to every reference (e.g. the double precision model and the scores Keras saved for the same samples).
+//
+struct PrecisionCheck_t {
+     Precision_t precision;
+     double      maxerror;     // largest |score - reference| over all the references
+     double      rmserror;     // root mean square of the same differences
+     bool        accepted;     // maxerror <= tolerance
+};
+
+inline const char* precision_name(Precision_t _precision){
+     switch (_precision) {
+     case Precision_t::NATIVE: return "native";
+     case Precision_t::FP16:   return "fp16";
+     case Precision_t::BF16:   return "bf16";
+     case Precision_t::INT8:   return "int8";
+     default:                  return "unknown";
+     }
+}
+
+// Check every precision on _n samples of _w values, against the references (_n x outputs scores each), and return
+// the one with the smallest weights whose error stays within _tolerance (in the units of the scores), in the order
+// INT8, FP16, BF16, NATIVE. Throws runtime_error if none does. _checks, if given, gets the result of each precision.
+template <typename T>
+Precision_t select_precision(Layer_Net_t<T>& _model, const T* _samples, int _n, int _w,
+                             const vector<const double*>& _references, double _tolerance,
+                             vector<PrecisionCheck_t>* _checks = nullptr){
+     const Precision_t order[] = { Precision_t::INT8, Precision_t::FP16, Precision_t::BF16, Precision_t::NATIVE };
+     Precision_t selected = Precision_t::MAX_PRECISION_VALUE;
+     if (_checks != nullptr) _checks->clear();
+     for (Precision_t precision : order) {
+          Plan_t<T> plan(_model, _n, _w, precision);
+          vector<T> scores((size_t)_n * plan.get_outputs());
+          plan.predict(_samples, _n, scores.data());
+          
+          PrecisionCheck_t check = { precision, 0, 0, false };
+          size_t count = 0;
+          for (const double* reference : _references) {
+               for (size_t i = 0; i < scores.size(); i++) {
+                    const double d = fabs((double)scores[i] - reference[i]);
+                    check.maxerror  = max(check.maxerror, d);
+                    check.rmserror += d*d;
+                    count++;
+               }
+          }
+          check.rmserror = count > 0 ? sqrt(check.rmserror / count) : 0;
+          check.accepted = check.maxerror <= _tolerance;
+          if (check.accepted && selected == Precision_t::MAX_PRECISION_VALUE) selected = precision;
+          if (_checks != nullptr) _checks->push_back(check);
+     }
+     if (selected == Precision_t::MAX_PRECISION_VALUE) {
+          ostringstream message;
+          message << "no precision gives scores within " << _tolerance << " of the references";
+          throw runtime_error(message.str());
+     }
+     return selected;
+}
+
+
+
 
 
+#include"network_fixed.hpp"            // after Layer_Net_t and Operator_t, which it reads
 
 #endif //end of "_NN_H_"
@@ -0,0 +1,633 @@
+#if !defined(_NETWORK_CPU_H_)
+#define _NETWORK_CPU_H_
+
+/**
+* CPU backend of Layer_Net_t, for nodes without a GPU.
+*
+* network.cu includes it instead of CUDNN/CUBLAS, after Layer_t, when it is compiled with -DNN_CPU by the host
+* compiler only (see the *_cpu targets of the Makefile). network_cpu_t offers the same methods as network_t,
+* on host memory, so Layer_Net_t and the testers are the same for both backends.
+*
+* Dense layers compute y[n x out] = x[n x in] dot W[in x out] + b, with W in its Keras (row-major) layout.
+* Our shapes are tall and skinny (69 -> 32 -> ... -> 1 over tens of thousands of samples), so :
+*    - samples are cut in tiles of NN_CPU_TILE, which are distributed over the OpenMP threads,
+*    - inside a tile, a register block of MR samples x NV vectors of outputs is accumulated over the whole
+*      input dimension, reading one row of W and broadcasting one input per sample at each step.
+*      The W of one layer (at most a few ten KB) stays in L1, the tile of inputs in L2.
+* The vectors are GCC/Clang vector extensions of NN_CPU_VECTOR_BYTES, so the same code compiles to
+* AVX-512, AVX2 or SSE according to -march. Compile with -ffp-contract=fast to get FMAs.
+*
+* The activation that follows a dense layer is applied to the accumulators before they are stored (fused operator).
+* forward(), which runs the execution plans (Plan_t), takes each tile through all the operators in turn, between two
+* buffers of one tile per thread, so the intermediate outputs stay in L2 instead of going through memory for each layer.
+* tanh is evaluated on whole vectors, as expm1(2|x|)/(expm1(2|x|)+2) with one division, expm1 from a polynomial
+* and the exponent set in the bits. It is within a few ulp of libm.
+*/
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <map>
+#include <new>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+static inline int omp_get_max_threads() { return 1; }
+static inline int omp_get_thread_num() { return 0; }
+#endif
+
+
+#if defined(__AVX512F__)
+#define NN_CPU_VECTOR_BYTES  64             // one zmm register
+#define NN_CPU_ACCUMULATORS  24             // register block, out of 32 registers
+#elif defined(__AVX__)
+#define NN_CPU_VECTOR_BYTES  32             // one ymm register
+#define NN_CPU_ACCUMULATORS  12             // out of 16 registers
+#else
+#define NN_CPU_VECTOR_BYTES  16
+#define NN_CPU_ACCUMULATORS  12
+#endif
+
+#define NN_CPU_TILE          240            // samples of one work item, a multiple of every register block height
+#define NN_CPU_ALIGNMENT     64             // host buffers, one cache line
+
+
+// Vector types of the backend, and of the integers with the same lane count (exponent bits of exp)
+template <typename T>
+struct cpu_vector{};
+
+template <>
+struct cpu_vector<double>{
+     typedef double  type  __attribute__((vector_size(NN_CPU_VECTOR_BYTES)));
+     typedef int64_t itype __attribute__((vector_size(NN_CPU_VECTOR_BYTES)));
+};
+
+template <>
+struct cpu_vector<float>{
+     typedef float   type  __attribute__((vector_size(NN_CPU_VECTOR_BYTES)));
+     typedef int32_t itype __attribute__((vector_size(NN_CPU_VECTOR_BYTES)));
+};
+
+template <typename V, typename T>
+inline V cpu_load(const T* p){
+     V v;
+     memcpy(&v, p, sizeof(V));
+     return v;
+}
+
+template <typename V, typename T>
+inline void cpu_store(T* p, V v){
+     memcpy(p, &v, sizeof(V));
+}
+
+// a - 0 is a for every a (unlike a + 0 for a = -0), so the subtraction folds away and only the broadcast is left
+template <typename V, typename T>
+inline V cpu_broadcast(T a){
+     return a - V{};
+}
+
+
+// ===========================================================================================================================================
+//
+// tanh on vectors
+//
+
+inline cpu_vector<double>::type cpu_tanh(cpu_vector<double>::type x){
+     typedef cpu_vector<double>::type  V;
+     typedef cpu_vector<double>::itype VI;
+
+     const V zero = V{};
+     V a = x < zero ? -x : x;
+     a = a > zero + 20.0 ? zero + 20.0 : a;        // tanh(20) is 1 in double precision, NaN stays NaN
+
+     // expm1(2a) = 2^n (expm1(r) + 1) - 1, |r| <= ln2/2, exact for n = 0 so that tanh keeps its precision near 0
+     V t  = a + a;
+     VI ni = __builtin_convertvector(t * 1.4426950408889634 + 0.5, VI);
+     V nf = __builtin_convertvector(ni, V);
+     V r  = t - nf * 6.93145751953125E-1 - nf * 1.42860682030941723212E-6;
+     V q  = zero + 1.0/6227020800.0;                // Taylor series of expm1 up to r^13/13!
+     q = q*r + 1.0/479001600.0;
+     q = q*r + 1.0/39916800.0;
+     q = q*r + 1.0/3628800.0;
+     q = q*r + 1.0/362880.0;
+     q = q*r + 1.0/40320.0;
+     q = q*r + 1.0/5040.0;
+     q = q*r + 1.0/720.0;
+     q = q*r + 1.0/120.0;
+     q = q*r + 1.0/24.0;
+     q = q*r + 1.0/6.0;
+     q = q*r + 0.5;
+     q = (q*r)*r + r;
+     VI bits = (ni + 1023) << 52;
+     V scale;
+     memcpy(&scale, &bits, sizeof(V));
+     V em = scale*q + (scale - 1.0);
+
+     // tanh(a) = expm1(2a) / (expm1(2a) + 2), one division
+     V y = em / (em + 2.0);
+     return x < zero ? -y : y;
+}
+
+inline cpu_vector<float>::type cpu_tanh(cpu_vector<float>::type x){
+     typedef cpu_vector<float>::type  V;
+     typedef cpu_vector<float>::itype VI;
+
+     const V zero = V{};
+     V a = x < zero ? -x : x;
+     a = a > zero + 10.0f ? zero + 10.0f : a;       // tanh(10) is 1 in single precision, NaN stays NaN
+
+     V t  = a + a;
+     VI ni = __builtin_convertvector(t * 1.44269504f + 0.5f, VI);
+     V nf = __builtin_convertvector(ni, V);
+     V r  = t - nf * 0.693359375f + nf * 2.12194440e-4f;
+     V q  = zero + 1.0f/40320.0f;                   // Taylor series of expm1 up to r^8/8!
+     q = q*r + 1.0f/5040.0f;
+     q = q*r + 1.0f/720.0f;
+     q = q*r + 1.0f/120.0f;
+     q = q*r + 1.0f/24.0f;
+     q = q*r + 1.0f/6.0f;
+     q = q*r + 0.5f;
+     q = (q*r)*r + r;
+     VI bits = (ni + 127) << 23;
+     V scale;
+     memcpy(&scale, &bits, sizeof(V));
+     V em = scale*q + (scale - 1.0f);
+
+     V y = em / (em + 2.0f);
+     return x < zero ? -y : y;
+}
+
+// Activations applied to the accumulators of a dense layer
+struct cpu_linear_t{
+     template <typename V> static V apply(V v) { return v; }
+};
+
+struct cpu_tanh_t{
+     template <typename V> static V apply(V v) { return cpu_tanh(v); }
+};
+
+// one value, through a vector so that it is rounded as the others
+template <typename ACT, typename T>
+inline T cpu_activate(T a){
+     return ACT::apply(cpu_broadcast<typename cpu_vector<T>::type>(a))[0];
+}
+
+// y = tanh(x) on size values, which may be the same array, on the calling thread
+template <typename T>
+inline void cpu_tanh_values(size_t size, const T* x, T* y){
+     typedef typename cpu_vector<T>::type V;
+     const size_t L = sizeof(V)/sizeof(T);
+
+     for (size_t i = 0; i < size / L; i++) cpu_store(y + i*L, cpu_tanh(cpu_load<V>(x + i*L)));
+
+     // the last values through one padded vector, so that all are rounded the same way
+     const size_t rest = size % L;
+     if (rest > 0) {
+          T buffer[L] = {};
+          memcpy(buffer, x + size - rest, rest*sizeof(T));
+          cpu_store(buffer, cpu_tanh(cpu_load<V>(buffer)));
+          memcpy(y + size - rest, buffer, rest*sizeof(T));
+     }
+}
+
+// the same over the OpenMP threads, in chunks of whole vectors
+template <typename T>
+void cpu_tanh_forward(size_t size, const T* x, T* y){
+     const size_t chunk = (size_t)NN_CPU_TILE*NN_CPU_VECTOR_BYTES;
+
+     #pragma omp parallel for schedule(static)
+     for (size_t first = 0; first < size; first += chunk) {
+          cpu_tanh_values(size - first < chunk ? size - first : chunk, x + first, y + first);
+     }
+}
+
+
+// ===========================================================================================================================================
+//
+// Dense layer kernels
+//
+
+// Register block : MR samples (rows of x and y) x NV vectors of outputs, accumulated over the k inputs
+template <typename T, typename ACT, int MR, int NV>
+inline void cpu_dense_block(int k, const T* x, int ldx, const T* w, int ldw, const T* b, T* y, int ldy){
+     typedef typename cpu_vector<T>::type V;
+     const int L = sizeof(V)/sizeof(T);
+
+     V acc[MR][NV];
+     for (int j = 0; j < NV; j++) {
+          V bj = cpu_load<V>(b + j*L);
+          for (int r = 0; r < MR; r++) acc[r][j] = bj;
+     }
+
+     for (int p = 0; p < k; p++) {
+          V wp[NV];
+          for (int j = 0; j < NV; j++) wp[j] = cpu_load<V>(w + (size_t)p*ldw + j*L);
+          for (int r = 0; r < MR; r++) {
+               V xr = cpu_broadcast<V>(x[(size_t)r*ldx + p]);
+               for (int j = 0; j < NV; j++) acc[r][j] += xr * wp[j];
+          }
+     }
+
+     for (int r = 0; r < MR; r++)
+          for (int j = 0; j < NV; j++) cpu_store(y + (size_t)r*ldy + j*L, ACT::apply(acc[r][j]));
+}
+
+// All m samples of a tile, for one panel of NV vectors of outputs
+template <typename T, typename ACT, int NV>
+inline void cpu_dense_panel(int m, int k, const T* x, int ldx, const T* w, int ldw, const T* b, T* y, int ldy){
+     const int MR = NN_CPU_ACCUMULATORS / NV;
+     int r = 0;
+     for (; r + MR <= m; r += MR)
+          cpu_dense_block<T, ACT, MR, NV>(k, x + (size_t)r*ldx, ldx, w, ldw, b, y + (size_t)r*ldy, ldy);
+     for (; r < m; r++)
+          cpu_dense_block<T, ACT, 1, NV>(k, x + (size_t)r*ldx, ldx, w, ldw, b, y + (size_t)r*ldy, ldy);
+}
+
+// yt[m x out] = act( xt[m x in] dot w[in x out] + b ) for the m samples of one tile, on the calling thread
+template <typename T, typename ACT>
+inline void cpu_dense_tile(int m, int in, int out, const T* xt, const T* w, const T* b, T* yt){
+     typedef typename cpu_vector<T>::type V;
+     const int L = sizeof(V)/sizeof(T);
+
+     // widest panels first, then the outputs that do not fill a vector (e.g. the single final score)
+     int c = 0;
+     for (; c + 4*L <= out; c += 4*L) cpu_dense_panel<T, ACT, 4>(m, in, xt, in, w + c, out, b + c, yt + c, out);
+     if    (c + 2*L <= out) { cpu_dense_panel<T, ACT, 2>(m, in, xt, in, w + c, out, b + c, yt + c, out); c += 2*L; }
+     if    (c +   L <= out) { cpu_dense_panel<T, ACT, 1>(m, in, xt, in, w + c, out, b + c, yt + c, out); c +=   L; }
+     for (; c < out; c++) {
+          for (int r = 0; r < m; r++) {
+               const T* xr = xt + (size_t)r*in;
+               T s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+               int p = 0;
+               for (; p + 4 <= in; p += 4) {
+                    s0 += xr[p  ] * w[(size_t)(p  )*out + c];
+                    s1 += xr[p+1] * w[(size_t)(p+1)*out + c];
+                    s2 += xr[p+2] * w[(size_t)(p+2)*out + c];
+                    s3 += xr[p+3] * w[(size_t)(p+3)*out + c];
+               }
+               for (; p < in; p++) s0 += xr[p] * w[(size_t)p*out + c];
+               yt[(size_t)r*out + c] = cpu_activate<ACT>(b[c] + ((s0 + s1) + (s2 + s3)));
+          }
+     }
+}
+
+// Weight formats of an execution plan (Precision_t of network.cu) : the stored type, L weights as a vector of T (load)
+// and one weight as a T (value). Half and bfloat16 are widened in the integer lanes, without F16C / AVX512-BF16.
+// The weights of a scaled format are multiplied by the scale of their output.
+template <typename T, Precision_t P>
+struct cpu_weights{};
+
+// the 16 and 8 bit weights of one vector of T, and the floats they widen to
+template <typename T>
+struct cpu_vector_narrow{
+     static const int L = NN_CPU_VECTOR_BYTES / sizeof(T);
+     typedef uint16_t htype __attribute__((vector_size(2*L)));
+     typedef int8_t   btype __attribute__((vector_size(L)));
+     typedef uint32_t utype __attribute__((vector_size(4*L)));
+     typedef int32_t  itype __attribute__((vector_size(4*L)));
+     typedef float    ftype __attribute__((vector_size(4*L)));
+};
+
+template <typename T>
+struct cpu_weights<T, Precision_t::FP16>{
+     typedef uint16_t type;
+     static const bool scaled = false;
+     template <typename V> static V load(const uint16_t* w) {
+          typedef cpu_vector_narrow<T> N;
+          // as halfToFloat() : exponent moved by a multiplication by 2^112, then the sign
+          typename N::utype h = __builtin_convertvector(cpu_load<typename N::htype>(w), typename N::utype);
+          typename N::utype u = (h & 0x7fff) << 13;
+          typename N::ftype f;
+          memcpy(&f, &u, sizeof(f));
+          f *= 5.192296858534828e+33f;
+          memcpy(&u, &f, sizeof(u));
+          u |= (h & 0x8000) << 16;
+          memcpy(&f, &u, sizeof(f));
+          return __builtin_convertvector(f, V);
+     }
+     static T value(uint16_t w) { return halfToFloat(w); }
+};
+
+template <typename T>
+struct cpu_weights<T, Precision_t::BF16>{
+     typedef uint16_t type;
+     static const bool scaled = false;
+     template <typename V> static V load(const uint16_t* w) {
+          typedef cpu_vector_narrow<T> N;
+          typename N::utype u = __builtin_convertvector(cpu_load<typename N::htype>(w), typename N::utype) << 16;
+          typename N::ftype f;
+          memcpy(&f, &u, sizeof(f));
+          return __builtin_convertvector(f, V);
+     }
+     static T value(uint16_t w) { return bfloat16ToFloat(w); }
+};
+
+template <typename T>
+struct cpu_weights<T, Precision_t::INT8>{
+     typedef int8_t type;
+     static const bool scaled = true;
+     template <typename V> static V load(const int8_t* w) {
+          // through int32 : GCC does not vectorize the byte to double conversion in one step
+          typedef cpu_vector_narrow<T> N;
+          return __builtin_convertvector(__builtin_convertvector(cpu_load<typename N::btype>(w), typename N::itype), V);
+     }
+     static T value(int8_t w) { return w; }
+};
+
+
+// The weights [in x out] of a dense operator stored in another precision, as T in wt : decoded once per tile, so that
+// the kernels above run on them unchanged and the decoding is shared by all the samples of the tile
+template <typename T, typename WF>
+inline void cpu_decode_weights(int in, int out, const typename WF::type* w, const T* s, T* wt){
+     typedef typename cpu_vector<T>::type V;
+     const int L = sizeof(V)/sizeof(T);
+     for (int p = 0; p < in; p++) {
+          const typename WF::type* wp = w  + (size_t)p*out;
+          T*                       tp = wt + (size_t)p*out;
+          int c = 0;
+          for (; c + L <= out; c += L) {
+               V v = WF::template load<V>(wp + c);
+               cpu_store(tp + c, WF::scaled ? v * cpu_load<V>(s + c) : v);
+          }
+          for (; c < out; c++) tp[c] = WF::scaled ? WF::value(wp[c]) * s[c] : WF::value(wp[c]);
+     }
+}
+
+// One dense operator of an execution plan on a tile. Weights in another precision are decoded into wt first,
+// which holds the inputs x outputs values of the layer.
+template <typename T, typename ACT>
+inline void cpu_operator_tile(const Operator_t<T>& op, int m, int in, const T* xt, T* yt, T* wt){
+     const Layer_t<T>& l = *op.dense;
+     const T* w = l.data_h;
+     switch (op.precision) {
+     case Precision_t::FP16 :
+          cpu_decode_weights<T, cpu_weights<T, Precision_t::FP16> >(in, l.outputs, (const uint16_t*)op.weights, op.scale, wt);
+          w = wt;
+          break;
+     case Precision_t::BF16 :
+          cpu_decode_weights<T, cpu_weights<T, Precision_t::BF16> >(in, l.outputs, (const uint16_t*)op.weights, op.scale, wt);
+          w = wt;
+          break;
+     case Precision_t::INT8 :
+          cpu_decode_weights<T, cpu_weights<T, Precision_t::INT8> >(in, l.outputs, (const int8_t*)op.weights, op.scale, wt);
+          w = wt;
+          break;
+     default :
+          break;
+     }
+     cpu_dense_tile<T, ACT>(m, in, l.outputs, xt, w, l.bias_h, yt);
+}
+
+// y[n x out] = act( x[n x in] dot w[in x out] + b ), the tiles over the OpenMP threads
+template <typename T, typename ACT>
+void cpu_dense_forward(int n, int in, int out, const T* x, const T* w, const T* b, T* y){
+     #pragma omp parallel for schedule(static)
+     for (int first = 0; first < n; first += NN_CPU_TILE) {
+          const int m = n - first < NN_CPU_TILE ? n - first : NN_CPU_TILE;
+          cpu_dense_tile<T, ACT>(m, in, out, x + (size_t)first*in, w, b, y + (size_t)first*out);
+     }
+}
+
+
+// ===========================================================================================================================================
+//
+// Network algorithms on the CPU, same interface as network_t of network.cu
+// Buffers are host memory, aligned to NN_CPU_ALIGNMENT.
+//
+template <typename T>
+class network_cpu_t
+{
+private:
+     // Released buffers are kept for the next ones : large blocks come from mmap, and touching fresh pages
+     // costs about as much as the layers themselves. capacity has every buffer, spare the free ones.
+     std::map<T*, size_t> capacity;
+     std::vector<T*>      spare;
+
+     // Workspace of forward(), allocated by reserve() : two tile buffers per thread
+     std::vector<T*>      workspace;
+
+     // Weights stored by storeWeights(), and one buffer per thread they are decoded into by forward()
+     std::vector<void*>   stored;
+     std::vector<T*>      decoded;
+     size_t               decodedsize = 0;
+
+     network_cpu_t(const network_cpu_t&);
+     network_cpu_t& operator=(const network_cpu_t&);
+
+public:
+     network_cpu_t<T>() {};
+
+     ~network_cpu_t<T>()
+     {
+          for (typename std::map<T*, size_t>::iterator it = capacity.begin(); it != capacity.end(); ++it) {
+               free(it->first);
+          }
+          for (size_t i = 0; i < stored.size(); i++) free(stored[i]);
+     };
+
+     // Resize a buffer. Unlike the device version it is never cleared, as every kernel writes all its outputs.
+     void resize(size_t size, T **data, bool /*clear*/ = true)
+     {
+          STAGE_SCOPE("nn.alloc");
+          release(*data);
+          *data = NULL;
+
+          // smallest spare buffer that is large enough
+          size_t best = spare.size();
+          for (size_t i = 0; i < spare.size(); i++) {
+               size_t c = capacity[spare[i]];
+               if (c >= size && (best == spare.size() || c < capacity[spare[best]])) best = i;
+          }
+          if (best < spare.size()) {
+               *data = spare[best];
+               spare.erase(spare.begin() + best);
+               return;
+          }
+
+          void* p = NULL;
+          if (posix_memalign(&p, NN_CPU_ALIGNMENT, size*sizeof(T) > 0 ? size*sizeof(T) : NN_CPU_ALIGNMENT) != 0) {
+               throw std::bad_alloc();
+          }
+          *data = (T*)p;
+          capacity[*data] = size;
+     }
+
+     void release(T *data)
+     {
+          if (data != NULL) spare.push_back(data);
+     }
+
+     // Input of the first layer : host memory is read in place, *data is left as it is
+     const T* upload(size_t /*size*/, const T* src, T** /*data*/)
+     {
+          return src;
+     }
+
+     void download(size_t size, const T* data, T* dst)
+     {
+          if (data != dst) memcpy(dst, data, size*sizeof(T));
+     }
+
+     // Host buffers of the caller, e.g. the chunks of Plan_t::predict_stream()
+     T* allocHost(size_t size)
+     {
+          void* p = NULL;
+          if (posix_memalign(&p, NN_CPU_ALIGNMENT, size*sizeof(T) > 0 ? size*sizeof(T) : NN_CPU_ALIGNMENT) != 0) {
+               throw std::bad_alloc();
+          }
+          return (T*)p;
+     }
+
+     void freeHost(T *data)
+     {
+          free(data);
+     }
+
+     // Weights of a plan in another precision (Operator_t) : an aligned copy, kept as long as the backend
+     const void* storeWeights(size_t bytes, const void* src)
+     {
+          void* p = NULL;
+          if (posix_memalign(&p, NN_CPU_ALIGNMENT, bytes > 0 ? bytes : NN_CPU_ALIGNMENT) != 0) {
+               throw std::bad_alloc();
+          }
+          memcpy(p, src, bytes);
+          stored.push_back(p);
+          return p;
+     }
+
+     // Allocate the workspace of forward() for threads OpenMP threads, 0 for the current number. Tiles do not depend
+     // on the batch, maxbatch only bounds their size.
+     void reserve(int maxbatch, int maxwidth, int /*w*/, int threads = 0)
+     {
+          const int rows = maxbatch < NN_CPU_TILE ? maxbatch : NN_CPU_TILE;
+          for (size_t i = 0; i < workspace.size(); i++) release(workspace[i]);
+          workspace.assign(2*(threads > 0 ? threads : omp_get_max_threads()), (T*)NULL);
+          for (size_t i = 0; i < workspace.size(); i++) resize((size_t)rows*maxwidth, &workspace[i]);
+     }
+
+     // Run the operators of a compiled model on n samples, from input to output, tile by tile through the workspace
+     void forward(const std::vector<Operator_t<T> >& operators, int n, int w, const T* input, T* output)
+     {
+          const int threads = (int)workspace.size() / 2;
+
+          // the largest layer stored in another precision, allocated by the first call only
+          size_t decodesize = 0;
+          for (size_t i = 0; i < operators.size(); i++) {
+               const Operator_t<T>& op = operators[i];
+               if (op.dense != nullptr && op.precision != Precision_t::NATIVE) {
+                    decodesize = std::max(decodesize, (size_t)op.dense->inputs * op.dense->outputs);
+               }
+          }
+          if (decodesize > decodedsize || (int)decoded.size() < threads) {
+               decodedsize = std::max(decodesize, decodedsize);
+               decoded.resize(threads, (T*)NULL);
+               for (size_t i = 0; i < decoded.size(); i++) resize(decodedsize, &decoded[i]);
+          }
+
+          STAGE_SPAN("nn.forward");
+          #pragma omp parallel for schedule(static) num_threads(threads)
+          for (int first = 0; first < n; first += NN_CPU_TILE) {
+               STAGE_SPAN("nn.tile");
+               const int m      = n - first < NN_CPU_TILE ? n - first : NN_CPU_TILE;
+               T* const  tile[] = { workspace[2*omp_get_thread_num()], workspace[2*omp_get_thread_num() + 1] };
+               T* const  wt     = decoded.empty() ? NULL : decoded[omp_get_thread_num()];
+
+               const T* src   = input + (size_t)first*w;
+               int      width = w;
+               for (size_t i = 0; i < operators.size(); i++) {
+                    STAGE_SCOPE_AT("nn.layer", i);
+                    STAGE_COUNT_AT("nn.samples", i, m);
+                    const Operator_t<T>& op = operators[i];
+                    const int outwidth = op.dense != nullptr ? op.dense->outputs : width;
+                    T* dst = i + 1 < operators.size() ? tile[i%2] : output + (size_t)first*outwidth;
+                    if (op.dense == nullptr) {
+                         cpu_tanh_values((size_t)m*width, src, dst);
+                    } else if (op.acttype == ActType_t::TANH) {
+                         cpu_operator_tile<T, cpu_tanh_t>  (op, m, width, src, dst, wt);
+                    } else {
+                         cpu_operator_tile<T, cpu_linear_t>(op, m, width, src, dst, wt);
+                    }
+                    src = dst; width = outwidth;
+               }
+               download((size_t)m*width, src, output + (size_t)first*width);
+          }
+     }
+
+     // Fully connected forwards, with the bias
+     void fullyConnectedForward(const Layer_t<T>& layer,
+                          int& n, int& h, int& w,
+                          const T* srcData, T** dstData)
+     {
+          int dim_x = h * w;
+          int dim_y = layer.outputs;
+          resize((size_t)n*dim_y, dstData);
+
+          cpu_dense_forward<T, cpu_linear_t>(n, dim_x, dim_y, srcData, layer.data_h, layer.bias_h, *dstData);
+
+          // for future ease, set h = total_num_of_ele_in_output, and w = 1
+          h = dim_y; w = 1;
+     }
+
+     // Fully connected forwards with the activation that follows, applied in the registers before the store
+     void fullyConnectedActivationForward(const Layer_t<T>& layer, ActType_t acttype,
+                          int& n, int& h, int& w,
+                          const T* srcData, T** dstData)
+     {
+          int dim_x = h * w;
+          int dim_y = layer.outputs;
+          resize((size_t)n*dim_y, dstData, false);
+
+          if (acttype == ActType_t::TANH) {
+               cpu_dense_forward<T, cpu_tanh_t>  (n, dim_x, dim_y, srcData, layer.data_h, layer.bias_h, *dstData);
+          } else {
+               cpu_dense_forward<T, cpu_linear_t>(n, dim_x, dim_y, srcData, layer.data_h, layer.bias_h, *dstData);
+          }
+
+          h = dim_y; w = 1;
+     }
+
+     // Fully connected backwards : dX = dY dot W^T, through the forward kernel with the transposed weights
+     void fullyConnectedBackward(const Layer_t<T>& layer, int n, const T* srcDiff, T** dstDiff)
+     {
+          resize((size_t)n*layer.inputs, dstDiff);
+
+          std::vector<T> weight_t((size_t)layer.inputs*layer.outputs), zeros(layer.inputs, T(0));
+          for (int i = 0; i < layer.inputs; i++)
+               for (int o = 0; o < layer.outputs; o++)
+                    weight_t[(size_t)o*layer.inputs + i] = layer.data_h[(size_t)i*layer.outputs + o];
+
+          cpu_dense_forward<T, cpu_linear_t>(n, layer.outputs, layer.inputs, srcDiff, weight_t.data(), zeros.data(), *dstDiff);
+     }
+
+     // activation forward with hyperbolic tangential
+     void activationForward_TANH(int n, int h, int w, const T* srcData, T** dstData)
+     {
+          resize((size_t)n*h*w, dstData);
+          cpu_tanh_forward((size_t)n*h*w, srcData, *dstData);
+     }
+
+     // activation backward with hyperbolic tangential : dx = (1 - y*y) * dy
+     void activationBackward_TANH(int n, int h, int w, const T* y, const T* dy, const T* x, T** dx)
+     {
+          const size_t size = (size_t)n*h*w;
+          resize(size, dx);
+          T* out = *dx;
+          #pragma omp parallel for simd schedule(static)
+          for (size_t i = 0; i < size; i++) out[i] = (T(1) - y[i]*y[i]) * dy[i];
+     }
+
+     // activation forward with ReLU nonlinearty
+     void activationForward_ReLU(int n, int h, int w, const T* srcData, T** dstData)
+     {
+          const size_t size = (size_t)n*h*w;
+          resize(size, dstData);
+          T* out = *dstData;
+          #pragma omp parallel for simd schedule(static)
+          for (size_t i = 0; i < size; i++) out[i] = srcData[i] > T(0) ? srcData[i] : T(0);
+     }
+};
+
+#endif
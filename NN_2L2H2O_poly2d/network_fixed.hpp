@@ -0,0 +1,229 @@
+#if !defined(_NETWORK_FIXED_H_)
+#define _NETWORK_FIXED_H_
+
+/**
+* Network of a fixed topology, whose layer dimensions and activations are template parameters.
+*
+* network.cu includes it after Layer_Net_t. Fixed_Net_t<T, IN, Dense_t<OUT, ACT>...> copies the weights of a loaded
+* model whose fused operators (Layer_Net_t::compile()) have exactly these shapes, and predicts on the host without
+* walking the list of layers, dispatching on Type_t/ActType_t or launching anything : each layer is an inlined
+* function whose loops have constant bounds, so the compiler unrolls them and keeps the accumulators in registers.
+* The weights of our models (about 50 KB in double precision) stay in L1/L2 between calls.
+* It is meant for small batches, e.g. the dimers of one MD step of a small cluster, where the dispatch of Layer_Net_t
+* and Plan_t costs more than the math. Large batches are spread over the OpenMP threads.
+*
+* The type of a loaded model is given by fixed_net_type(model), e.g. to write it into the source once :
+*    Fixed_Net_t<double, 69, Dense_t<32, ActType_t::TANH>, ..., Dense_t<1, ActType_t::LINEAR> >
+* Fixed_2B_Net_t<T> is the one of the two-body models of this directory.
+*/
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define FIXED_SAMPLES      24        // largest group of samples run together, a multiple of the register blocks
+#define FIXED_ALIGNMENT    64        // weights and intermediate outputs, one cache line
+#define FIXED_PARALLEL     1024      // smallest batch spread over the OpenMP threads
+
+
+// One dense layer of a Fixed_Net_t : OUT outputs, with the activation ACT (TANH or LINEAR) fused in
+template <int OUT, ActType_t ACT>
+struct Dense_t{
+     static const int       outputs = OUT;
+     static const ActType_t acttype = ACT;
+};
+
+
+// y[m x OUT] = act( x[m x IN] dot w[IN x OUT] + b ), m <= FIXED_SAMPLES. With the CPU backend it is its register
+// blocked kernel, with the activation applied to the accumulators, here with constant shapes ; otherwise plain loops.
+template <typename T, int IN, int OUT, ActType_t ACT>
+inline void fixed_dense(int m, const T* x, const T* w, const T* b, T* y){
+#if defined(NN_CPU)
+     if (ACT == ActType_t::TANH) cpu_dense_tile<T, cpu_tanh_t>  (m, IN, OUT, x, w, b, y);
+     else                        cpu_dense_tile<T, cpu_linear_t>(m, IN, OUT, x, w, b, y);
+#else
+     for (int s = 0; s < m; s++) {
+          T acc[OUT];
+          for (int o = 0; o < OUT; o++) acc[o] = b[o];
+          for (int p = 0; p < IN; p++) {
+               const T xp = x[s*IN + p];
+               for (int o = 0; o < OUT; o++) acc[o] += xp * w[p*OUT + o];
+          }
+          for (int o = 0; o < OUT; o++) y[s*OUT + o] = ACT == ActType_t::TANH ? tanh(acc[o]) : acc[o];
+     }
+#endif
+}
+
+
+// Weights and bias of one layer L with IN inputs, copied from the fused operator of a model
+template <typename T, int IN, typename L>
+struct Fixed_Dense_t{
+     alignas(FIXED_ALIGNMENT) T w[IN*L::outputs];
+     alignas(FIXED_ALIGNMENT) T b[L::outputs];
+
+     void load(const vector<Operator_t<T> >& _operators, size_t _index){
+          const Operator_t<T>& op = _operators[_index];
+          if (op.dense == nullptr || op.dense->inputs != IN || op.dense->outputs != L::outputs || op.acttype != L::acttype) {
+               ostringstream message;
+               message << "operator " << _index << " is not a dense layer " << IN << " -> " << L::outputs
+                       << (L::acttype == ActType_t::TANH ? " with tanh" : " (linear)");
+               throw runtime_error(message.str());
+          }
+          copy(op.dense->data_h, op.dense->data_h + IN*L::outputs, w);
+          copy(op.dense->bias_h, op.dense->bias_h + L::outputs,    b);
+     }
+
+     void apply(int m, const T* x, T* y) const { fixed_dense<T, IN, L::outputs, L::acttype>(m, x, w, b, y); }
+
+     static void describe(ostream& out){
+          out << ", Dense_t<" << L::outputs << ", ActType_t::" << (L::acttype == ActType_t::TANH ? "TANH" : "LINEAR") << ">";
+     }
+};
+
+// The layers from IN inputs on : the first one, and the others recursively. The intermediate outputs of the
+// FIXED_SAMPLES samples are on the stack.
+template <typename T, int IN, typename L, typename... REST>
+struct Fixed_Layers_t{
+     typedef Fixed_Layers_t<T, L::outputs, REST...> next_t;
+     static const int outputs = next_t::outputs;
+     static const int count   = 1 + next_t::count;
+
+     Fixed_Dense_t<T, IN, L> layer;
+     next_t                  next;
+
+     void load(const vector<Operator_t<T> >& _operators, size_t _index){
+          layer.load(_operators, _index);
+          next.load(_operators, _index + 1);
+     }
+
+     void forward(int m, const T* x, T* y) const {
+          alignas(FIXED_ALIGNMENT) T h[FIXED_SAMPLES*L::outputs];
+          layer.apply(m, x, h);
+          next.forward(m, h, y);
+     }
+
+     static void describe(ostream& out){
+          Fixed_Dense_t<T, IN, L>::describe(out);
+          next_t::describe(out);
+     }
+};
+
+template <typename T, int IN, typename L>
+struct Fixed_Layers_t<T, IN, L>{
+     static const int outputs = L::outputs;
+     static const int count   = 1;
+
+     Fixed_Dense_t<T, IN, L> layer;
+
+     void load(const vector<Operator_t<T> >& _operators, size_t _index){
+          layer.load(_operators, _index);
+     }
+
+     void forward(int m, const T* x, T* y) const { layer.apply(m, x, y); }
+
+     static void describe(ostream& out){ Fixed_Dense_t<T, IN, L>::describe(out); }
+};
+
+
+// The Fixed_Net_t type of a model, to be compiled in : its dense operators and their activations
+template <typename T>
+string fixed_net_type(Layer_Net_t<T>& _model){
+     const vector<Operator_t<T> >& operators = _model.get_operators();
+     ostringstream name;
+     name << "Fixed_Net_t<" << (TypeIsDouble<T>::value ? "double" : "float") << ", ";
+     if (operators.empty() || operators[0].dense == nullptr) {
+          name << "?";
+     } else {
+          name << operators[0].dense->inputs;
+     }
+     for (size_t i = 0; i < operators.size(); i++) {
+          if (operators[i].dense == nullptr) {
+               name << ", tanh alone (not supported)";
+          } else {
+               name << ", Dense_t<" << operators[i].dense->outputs << ", ActType_t::"
+                    << (operators[i].acttype == ActType_t::TANH ? "TANH" : "LINEAR") << ">";
+          }
+     }
+     name << ">";
+     return name.str();
+}
+
+
+//===========================================================================================
+//
+// The network : IN inputs, then the dense layers LAYERS in order (Dense_t)
+//
+template <typename T, int IN, typename... LAYERS>
+class Fixed_Net_t{
+private:
+     typedef Fixed_Layers_t<T, IN, LAYERS...> layers_t;
+     layers_t layers;
+
+public:
+     static const int inputs  = IN;
+     static const int outputs = layers_t::outputs;
+
+     // aligned on the heap as well, which new does not do for alignas beyond 16 bytes before C++17
+     static void* operator new(size_t _size){
+          void* p = NULL;
+          if (posix_memalign(&p, FIXED_ALIGNMENT, _size) != 0) throw bad_alloc();
+          return p;
+     }
+     static void operator delete(void* _p){ free(_p); }
+
+     // Copy the weights of _model, throws runtime_error if its operators are not the layers of this type
+     explicit Fixed_Net_t(Layer_Net_t<T>& _model){
+          const vector<Operator_t<T> >& operators = _model.get_operators();
+          try {
+               if (operators.size() != (size_t)layers_t::count) {
+                    ostringstream message;
+                    message << "it has " << operators.size() << " operators instead of " << layers_t::count;
+                    throw runtime_error(message.str());
+               }
+               layers.load(operators, 0);
+          } catch (const runtime_error& e) {
+               throw runtime_error("the model is not a " + type_name() + " : " + e.what()
+                                   + ", it is a " + fixed_net_type(_model));
+          }
+     }
+
+     // The C++ type of this network
+     static string type_name(){
+          ostringstream name;
+          name << "Fixed_Net_t<" << (TypeIsDouble<T>::value ? "double" : "float") << ", " << IN;
+          layers_t::describe(name);
+          name << ">";
+          return name.str();
+     }
+
+     // Predict _n samples of IN values into _outputData_h, which holds _n x outputs values (as Plan_t::predict)
+     void predict(const T* _inputData, int _n, T* _outputData_h) const {
+          #pragma omp parallel for schedule(static) if(_n >= FIXED_PARALLEL)
+          for (int first = 0; first < _n; first += FIXED_SAMPLES) {
+               layers.forward(min(_n - first, FIXED_SAMPLES), _inputData + (size_t)first*IN, _outputData_h + (size_t)first*outputs);
+          }
+     }
+
+     // The same, with the signature of Layer_Net_t::predict() : _outputData_h is (re)allocated with new[]
+     void predict(const T* _inputData, int _n, int _w, T* & _outputData_h, unsigned long int& _outsize) const {
+          if (_w != IN) {
+               ostringstream message;
+               message << type_name() << " takes samples of " << IN << " values, not " << _w;
+               throw runtime_error(message.str());
+          }
+          _outsize = (unsigned long int)_n*outputs;
+          if (_outputData_h != NULL) delete[] _outputData_h;
+          _outputData_h = new T[_outsize];
+          predict(_inputData, _n, _outputData_h);
+     }
+};
+
+
+// The two-body models of this directory : 69 features, five tanh layers of 32, one linear score
+template <typename T>
+using Fixed_2B_Net_t = Fixed_Net_t<T, 69, Dense_t<32, ActType_t::TANH>, Dense_t<32, ActType_t::TANH>,
+                                          Dense_t<32, ActType_t::TANH>, Dense_t<32, ActType_t::TANH>,
+                                          Dense_t<32, ActType_t::TANH>, Dense_t<1,  ActType_t::LINEAR> >;
+
+#endif
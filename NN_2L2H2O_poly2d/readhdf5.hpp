@@ -232,6 +232,30 @@ vector<string> Read_Attr_Data_By_Seq (H5File file, const char* path, const char*
 }
 
 
+// Function to read out one string attribute of a group, fixed or variable length, e.g. the JSON "model_config" that Keras
+// saves at the root of the file. Throws runtime_error if it is missing or not a string.
+string Read_Attr_String (H5File file, const char* path, const char* _attr){
+     Group grp = file.openGroup(path);
+     if (!grp.attrExists(_attr)) {
+          throw runtime_error(string("no attribute ") + _attr + " in " + path);
+     }
+     Attribute attr = grp.openAttribute(_attr);
+     if (attr.getTypeClass() != H5T_STRING) {
+          throw runtime_error(string("attribute ") + _attr + " is not a string");
+     }
+     StrType type = attr.getStrType();
+     string value;
+     if (type.isVariableStr()) {
+          attr.read(type, value);
+     } else {
+          vector<char> buff(type.getSize() + 1, 0);
+          attr.read(type, (void*)buff.data());
+          value = buff.data();
+     }
+     return value;
+}
+
+
 // concat two string for a path
 string mkpath(string _a, string _b){
      string finalstring;
@@ -0,0 +1,133 @@
+#if !defined(_SAMPLEFILE_H_)
+#define _SAMPLEFILE_H_
+
+/**
+* Binary container of NN input samples, so that the testers map a data set of any size at run time
+* instead of compiling it in as a C array.
+*
+* Layout, all in the native (little endian) byte order:
+*    - a 64 byte header (SampleFileHeader) : magic "NNSAMPL1", size of one value (4 = float, 8 = double),
+*                                            sample count, sample dimension, and byte offset of the data
+*    - the samples, row-major [count x dim], starting at a 64 byte aligned offset
+*
+* SampleFile_t<T> maps the file read only, and data() points straight into the mapping,
+* so Layer_Net_t::predict() reads the samples without any copy on the host.
+* Files are written by writeSampleFile(), e.g. through the converter convert_samples.cpp
+* from the existing .in arrays or CSV/text files.
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "whichtype.hpp"
+
+#define SAMPLEFILE_MAGIC     "NNSAMPL1"
+#define SAMPLEFILE_ALIGNMENT 64            // data offset, one cache line / AVX-512 register
+
+struct SampleFileHeader {
+     char     magic[8];       // SAMPLEFILE_MAGIC, without the ending 0
+     uint32_t typesize;       // 4 for float samples, 8 for double samples
+     uint32_t reserved;       // 0
+     uint64_t count;          // number of samples
+     uint64_t dim;            // values in each sample
+     uint64_t offset;         // byte offset of the first sample from the start of the file
+     uint64_t padding[3];     // the header fills 64 bytes
+};
+static_assert(sizeof(SampleFileHeader) == SAMPLEFILE_ALIGNMENT, "the sample data must start aligned");
+
+
+template <typename T>
+class SampleFile_t {
+private:
+     void*  mapping;
+     size_t mapsize;
+     SampleFileHeader header;
+
+     SampleFile_t(const SampleFile_t&);
+     SampleFile_t& operator=(const SampleFile_t&);
+
+public:
+     // Map a sample file, throws runtime_error if it cannot be read or holds another type than T
+     SampleFile_t(const char* filename) : mapping(NULL), mapsize(0) {
+          int fd = open(filename, O_RDONLY);
+          if (fd < 0) {
+               throw std::runtime_error(std::string("Cannot open sample file ") + filename);
+          }
+          struct stat status;
+          if (fstat(fd, &status) != 0 || (size_t)status.st_size < sizeof(SampleFileHeader)) {
+               close(fd);
+               throw std::runtime_error(std::string("Sample file is too short: ") + filename);
+          }
+          mapsize = status.st_size;
+          mapping = mmap(NULL, mapsize, PROT_READ, MAP_PRIVATE, fd, 0);
+          close(fd);
+          if (mapping == MAP_FAILED) {
+               mapping = NULL;
+               throw std::runtime_error(std::string("Cannot map sample file ") + filename);
+          }
+
+          memcpy(&header, mapping, sizeof(header));
+          std::string error;
+          if (memcmp(header.magic, SAMPLEFILE_MAGIC, sizeof(header.magic)) != 0) {
+               error = "not a sample file";
+          } else if (header.typesize != sizeof(T)) {
+               error = TypeIsDouble<T>::value ? "samples are not in double precision, convert it again without -float"
+                                              : "samples are not in single precision, convert it again with -float";
+          } else if (header.offset % SAMPLEFILE_ALIGNMENT != 0 || header.offset > mapsize
+                     || header.dim == 0 || header.dim > mapsize / sizeof(T)
+                     || header.count > (mapsize - header.offset) / (header.dim * sizeof(T))) {
+               // each bound divides, so that no product of header fields can wrap around
+               error = "truncated or corrupted sample file";
+          }
+          if (!error.empty()) {
+               munmap(mapping, mapsize);
+               mapping = NULL;
+               throw std::runtime_error(std::string(filename) + " : " + error);
+          }
+
+          // samples are read once, in order
+          madvise(mapping, mapsize, MADV_SEQUENTIAL);
+     }
+
+     ~SampleFile_t() {
+          if (mapping != NULL) munmap(mapping, mapsize);
+     }
+
+     const T* data()  const { return (const T*)((const char*)mapping + header.offset); }
+     const T* sample(size_t i) const { return data() + i * header.dim; }
+     size_t   count() const { return header.count; }
+     size_t   dim()   const { return header.dim; }
+};
+
+
+// Write count samples of dim values in the format above
+template <typename T>
+void writeSampleFile(const char* filename, const T* data, size_t count, size_t dim) {
+     std::ofstream file(filename, std::ios::binary);
+     if (!file) {
+          throw std::runtime_error(std::string("Cannot create sample file ") + filename);
+     }
+
+     SampleFileHeader header;
+     memset(&header, 0, sizeof(header));
+     memcpy(header.magic, SAMPLEFILE_MAGIC, sizeof(header.magic));
+     header.typesize = sizeof(T);
+     header.count    = count;
+     header.dim      = dim;
+     header.offset   = SAMPLEFILE_ALIGNMENT;   // right after the header, which is 64 bytes
+
+     file.write((const char*)&header, sizeof(header));
+     file.write((const char*)data, count * dim * sizeof(T));
+     if (!file) {
+          throw std::runtime_error(std::string("Cannot write sample file ") + filename);
+     }
+}
+
+#endif
@@ -0,0 +1,291 @@
+#include "twobodyForceCPU.h"
+#include "twobodyForceInteraction.h"
+#include <boost/timer/timer.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+static inline int omp_get_max_threads() { return 1; }
+static inline void omp_set_num_threads(int) {}
+#endif
+
+// Benchmarks of the pieces of the two-body interaction on one dimer, and of the host engine on lattices
+// of water molecules over a range of sizes and thread counts. The results are written as JSON, so that
+// releases can be compared by a script:
+//
+//     ./benchmark_2b [--molecules 512,4096] [--threads 1,2,4] [--min-time 0.5] [--output results.json]
+//                    [--symmetric]
+//
+// The lattices use the expanded polynomial, or its symmetry reduced form with --symmetric.
+// Each case repeats its call, doubling the count, until it ran for at least --min-time seconds.
+
+// Results are summed into this so that nothing gets optimized away
+static volatile double sink;
+
+// Wall time of one call of f in ns
+template <typename F>
+static double timeCall(F f, double minTime) {
+    for (long calls = 1; ; calls *= 2) {
+        boost::timer::cpu_timer timer;
+        for (long c = 0; c < calls; c++)
+            f();
+        double ns = (double) timer.elapsed().wall;
+        if (ns >= 1e9*minTime)
+            return ns/calls;
+    }
+}
+
+static std::vector<int> parseList(const char * s) {
+    std::vector<int> values;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ','))
+        values.push_back(atoi(item.c_str()));
+    return values;
+}
+
+// Same water as run_test.cpp
+static void referenceDimer(double4 * posq) {
+    posq[0] = make_double4(-1.516074336e+00, -2.023167650e-01,  1.454672917e+00, 0.);
+    posq[1] = make_double4(-6.218989773e-01, -6.009430735e-01,  1.572437625e+00, 0.);
+    posq[2] = make_double4(-2.017613812e+00, -4.190350349e-01,  2.239642849e+00, 0.);
+    posq[3] = make_double4(-1.763651687e+00, -3.816594649e-01, -1.300353949e+00, 0.);
+    posq[4] = make_double4(-1.903851736e+00, -4.935677617e-01, -3.457810126e-01, 0.);
+    posq[5] = make_double4(-2.527904158e+00, -7.613550077e-01, -1.733803676e+00, 0.);
+}
+
+// Cubic lattice of the first water 3 A apart as in run_test_cpu, periodic once it is wide enough
+static PeriodicBox makeLattice(unsigned int nMolecules, const NeighborList & neighbors, std::vector<double4> & posq) {
+    double4 water[6];
+    referenceDimer(water);
+    unsigned int side = 1;
+    while (side*side*side < nMolecules)
+        side++;
+    const double spacing = 3.0;
+
+    posq.resize(3*nMolecules);
+    for (unsigned int m = 0; m < nMolecules; m++) {
+        double sx = spacing*(m % side);
+        double sy = spacing*((m / side) % side);
+        double sz = spacing*(m / (side*side));
+        for (int k = 0; k < 3; k++)
+            posq[3*m + k] = make_double4(water[k].x + sx, water[k].y + sy, water[k].z + sz, 0.);
+    }
+
+    if (side*spacing >= 2.*(neighbors.getCutoff() + neighbors.getSkin()))
+        return makeOrthorhombicBox(side*spacing, side*spacing, side*spacing);
+    return makeNonPeriodicBox();
+}
+
+// Dimers the engine evaluates, O-O within [2, r2f]
+static unsigned int countDimers(const std::vector<double4> & posq, const NeighborList & neighbors, const PeriodicBox & box) {
+    const std::vector<unsigned int> & offsets = neighbors.offsets();
+    const std::vector<unsigned int> & list = neighbors.neighbors();
+    unsigned int count = 0;
+    for (unsigned int i = 0; i + 1 < offsets.size(); i++)
+        for (unsigned int p = offsets[i]; p < offsets[i+1]; p++) {
+            const double4 & a = posq[3*i];
+            const double4 & b = posq[3*list[p]];
+            double3 d = minimumImage(box, make_double3(b.x - a.x, b.y - a.y, b.z - a.z));
+            double r = sqrt(d.x*d.x + d.y*d.y + d.z*d.z);
+            if (r >= 2. && r <= neighbors.getCutoff())
+                count++;
+        }
+    return count;
+}
+
+static void writeKernel(std::ostream & out, const char * name, const char * unit, double ns, bool last) {
+    out << "    {\"name\": \"" << name << "\", \"unit\": \"" << unit << "\", \"ns\": " << ns
+        << ", \"per_s\": " << 1e9/ns << "}" << (last ? "" : ",") << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+        std::vector<int> molecules;
+        molecules.push_back(512);
+        molecules.push_back(4096);
+        std::vector<int> threads;
+        for (int t = 1; t < omp_get_max_threads(); t *= 2)
+            threads.push_back(t);
+        threads.push_back(omp_get_max_threads());
+        double minTime = 0.5;
+        const char * output = NULL;
+        TwoBodyPolynomial::Form form = TwoBodyPolynomial::EXPANDED;
+
+        for (int a = 1; a < argc; a++) {
+            if (!strcmp(argv[a], "--molecules") && a + 1 < argc)
+                molecules = parseList(argv[++a]);
+            else if (!strcmp(argv[a], "--threads") && a + 1 < argc)
+                threads = parseList(argv[++a]);
+            else if (!strcmp(argv[a], "--min-time") && a + 1 < argc)
+                minTime = atof(argv[++a]);
+            else if (!strcmp(argv[a], "--output") && a + 1 < argc)
+                output = argv[++a];
+            else if (!strcmp(argv[a], "--symmetric"))
+                form = TwoBodyPolynomial::SYMMETRIC;
+            else {
+                std::cerr << "Usage: " << argv[0] << " [--molecules 512,4096] [--threads 1,2,4]"
+                          << " [--min-time seconds] [--output file.json] [--symmetric]" << std::endl;
+                return 1;
+            }
+        }
+
+        std::ofstream file;
+        if (output != NULL)
+            file.open(output);
+        std::ostream & out = output != NULL ? file : std::cout;
+
+        out.precision(6);
+        out << "{" << std::endl;
+        out << "  \"config\": {\"poly_batch_size\": " << POLY_BATCH_SIZE
+            << ", \"poly_float_batch_size\": " << POLY_FLOAT_BATCH_SIZE
+            << ", \"max_threads\": " << omp_get_max_threads()
+            << ", \"min_time_s\": " << minTime << "}," << std::endl;
+
+        // Pieces of the interaction on the reference dimer, single threaded
+        std::cerr << "Kernels" << std::endl;
+        double4 posq[6];
+        referenceDimer(posq);
+        const PeriodicBox noBox = makeNonPeriodicBox();
+
+        DimerTerms dimer;
+        computeDimerTerms(0, 3, posq, noBox, &dimer);
+        double3 * sites = dimer.positions;
+
+        double extraPoint = timeCall([&]() {
+            computeExtraPoint(sites + Oa, sites + Ha1, sites + Ha2, sites + Xa1, sites + Xa2);
+            sink += sites[Xa1].x;
+        }, minTime);
+
+        double variables = timeCall([&]() {
+            computeDimerVariables(sites, dimer.exp, dimer.gOO);
+            sink += dimer.exp[30];
+        }, minTime);
+
+        // what the engine computes once per water, then per dimer from those
+        MoleculeTerms waters[2];
+        double moleculeTerms = timeCall([&]() {
+            computeMoleculeTerms(sites + Oa, waters + 0);
+            sink += waters[0].exp[2];
+        }, minTime);
+        computeMoleculeTerms(sites + Ob, waters + 1);
+
+        DimerTerms cachedDimer;
+        double cachedDimerTerms = timeCall([&]() {
+            computeCachedDimerTerms(waters + 0, waters + 1, noBox, &cachedDimer);
+            sink += cachedDimer.exp[30];
+        }, minTime);
+
+        double g[31];
+        double polynomial = timeCall([&]() {
+            sink += poly_2b_v6x_eval<double, true>(poly_2b_v6x_coefficients, dimer.exp, g);
+        }, minTime);
+
+        double polynomialEnergy = timeCall([&]() {
+            sink += poly_2b_v6x_eval<double, false>(poly_2b_v6x_coefficients, dimer.exp, NULL);
+        }, minTime);
+
+        double symmetricTerms[POLY_NUM_SYMMETRIC_TERMS];
+        poly_2b_v6x_symmetric_coefficients(poly_2b_v6x_coefficients, symmetricTerms);
+        double symmetric = timeCall([&]() {
+            sink += poly_2b_v6x_symmetric_eval<double, true>(symmetricTerms, dimer.exp, g);
+        }, minTime);
+
+        double symmetricEnergy = timeCall([&]() {
+            sink += poly_2b_v6x_symmetric_eval<double, false>(symmetricTerms, dimer.exp, (double *) NULL);
+        }, minTime);
+
+        // the engine evaluates POLY_FLOAT_BATCH_SIZE dimers per call, times are per dimer
+        double x[31*POLY_FLOAT_BATCH_SIZE], gb[31*POLY_FLOAT_BATCH_SIZE], e[POLY_FLOAT_BATCH_SIZE];
+        for (int k = 0; k < 31; k++)
+            for (int l = 0; l < POLY_FLOAT_BATCH_SIZE; l++)
+                x[k*POLY_FLOAT_BATCH_SIZE + l] = dimer.exp[k];
+        // mixed precision runs the symmetric scheme in either form
+        TwoBodyPolynomial doublePolynomial, mixedPolynomial(TwoBodyPolynomial::MIXED_PRECISION);
+        TwoBodyPolynomial symmetricPolynomial(TwoBodyPolynomial::DOUBLE_PRECISION, TwoBodyPolynomial::SYMMETRIC);
+
+        double batch = timeCall([&]() {
+            doublePolynomial.evaluate(x, gb, e, POLY_FLOAT_BATCH_SIZE);
+            sink += e[0];
+        }, minTime)/POLY_FLOAT_BATCH_SIZE;
+
+        double mixedBatch = timeCall([&]() {
+            mixedPolynomial.evaluate(x, gb, e, POLY_FLOAT_BATCH_SIZE);
+            sink += e[0];
+        }, minTime)/POLY_FLOAT_BATCH_SIZE;
+
+        double symmetricBatch = timeCall([&]() {
+            symmetricPolynomial.evaluate(x, gb, e, POLY_FLOAT_BATCH_SIZE);
+            sink += e[0];
+        }, minTime)/POLY_FLOAT_BATCH_SIZE;
+
+        double3 forces[10];
+        double interaction = timeCall([&]() {
+            for (int k = 0; k < 10; k++)
+                forces[k] = make_double3(0., 0., 0.);
+            sink += computeInteraction(0, 3, posq, forces, noBox);
+        }, minTime);
+
+        out << "  \"kernels\": [" << std::endl;
+        writeKernel(out, "computeExtraPoint", "water", extraPoint, false);
+        writeKernel(out, "computeDimerVariables", "dimer", variables, false);
+        writeKernel(out, "computeMoleculeTerms", "water", moleculeTerms, false);
+        writeKernel(out, "computeCachedDimerTerms", "dimer", cachedDimerTerms, false);
+        writeKernel(out, "poly_2b_v6x_eval", "dimer", polynomial, false);
+        writeKernel(out, "poly_2b_v6x_eval_energy", "dimer", polynomialEnergy, false);
+        writeKernel(out, "polynomial_batch_double", "dimer", batch, false);
+        writeKernel(out, "poly_2b_v6x_symmetric_eval", "dimer", symmetric, false);
+        writeKernel(out, "poly_2b_v6x_symmetric_eval_energy", "dimer", symmetricEnergy, false);
+        writeKernel(out, "polynomial_batch_mixed", "dimer", mixedBatch, false);
+        writeKernel(out, "polynomial_batch_symmetric", "dimer", symmetricBatch, false);
+        writeKernel(out, "computeInteraction", "dimer", interaction, true);
+        out << "  ]," << std::endl;
+
+        // Whole lattices with forces, the list is built by a first call outside the timing
+        out << "  \"scaling\": [" << std::endl;
+        for (size_t m = 0; m < molecules.size(); m++) {
+            const unsigned int nMolecules = molecules[m];
+            NeighborList neighbors(1.0);
+            std::vector<double4> boxPosq;
+            PeriodicBox box = makeLattice(nMolecules, neighbors, boxPosq);
+            WaterSystem system(boxPosq.data(), nMolecules);
+            std::vector<double3> boxForces(3*nMolecules);
+            double energy;
+            TwoBodyPolynomial mbpol(TwoBodyPolynomial::DOUBLE_PRECISION, form);
+            evaluate_2b_cpu(system, boxForces.data(), &energy, neighbors, box, mbpol);
+            const unsigned int nDimers = countDimers(boxPosq, neighbors, box);
+
+            double baseline = 0.;
+            for (size_t t = 0; t < threads.size(); t++) {
+                std::cerr << "Box of " << nMolecules << " molecules, " << threads[t] << " threads" << std::endl;
+                omp_set_num_threads(threads[t]);
+                double ns = timeCall([&]() {
+                    evaluate_2b_cpu(system, boxForces.data(), &energy, neighbors, box, mbpol);
+                    sink += energy;
+                }, minTime);
+
+                // relative to the first thread count of the sweep, usually 1
+                if (t == 0)
+                    baseline = ns*threads[0];
+                out << "    {\"molecules\": " << nMolecules << ", \"threads\": " << threads[t]
+                    << ", \"periodic\": " << (box.periodic ? "true" : "false")
+                    << ", \"pairs\": " << nDimers << ", \"s\": " << 1e-9*ns;
+                // a box too small to hold a pair has no per pair rate, and inf is not valid JSON
+                if (nDimers > 0)
+                    out << ", \"ns_per_pair\": " << ns/nDimers << ", \"pairs_per_s\": " << 1e9*nDimers/ns;
+                else
+                    out << ", \"ns_per_pair\": null, \"pairs_per_s\": null";
+                out << ", \"parallel_efficiency\": " << baseline/(ns*threads[t]) << "}"
+                    << (m + 1 == molecules.size() && t + 1 == threads.size() ? "" : ",") << std::endl;
+            }
+        }
+        out << "  ]" << std::endl;
+        out << "}" << std::endl;
+}
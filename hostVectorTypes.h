@@ -0,0 +1,60 @@
+#ifndef HOSTVECTORTYPES
+#define HOSTVECTORTYPES
+
+/**
+ * This file lets the CUDA sources (vectorOps.cu, twobodyForceInteraction.cu, twobodyForcePolynomial.cu)
+ * be compiled by a plain C++ compiler. Under nvcc it just pulls in the CUDA headers, otherwise it
+ * defines the vector types, the make_x() constructors and the qualifiers with the same layout as CUDA.
+ */
+
+#ifdef __CUDACC__
+
+#include <vector_functions.hpp>
+
+#else
+
+#include <cmath>
+
+#define __device__
+#define __host__
+#define __global__
+#define __constant__
+#define __forceinline__ inline
+
+struct int2 { int x, y; };
+struct int3 { int x, y, z; };
+struct alignas(16) int4 { int x, y, z, w; };
+
+struct alignas(8)  float2 { float x, y; };
+struct float3 { float x, y, z; };
+struct alignas(16) float4 { float x, y, z, w; };
+
+struct alignas(16) double2 { double x, y; };
+struct double3 { double x, y, z; };
+struct alignas(16) double4 { double x, y, z, w; };
+
+inline int2 make_int2(int x, int y) { int2 t = {x, y}; return t; }
+inline int3 make_int3(int x, int y, int z) { int3 t = {x, y, z}; return t; }
+inline int4 make_int4(int x, int y, int z, int w) { int4 t = {x, y, z, w}; return t; }
+
+inline float2 make_float2(float x, float y) { float2 t = {x, y}; return t; }
+inline float3 make_float3(float x, float y, float z) { float3 t = {x, y, z}; return t; }
+inline float4 make_float4(float x, float y, float z, float w) { float4 t = {x, y, z, w}; return t; }
+
+inline double2 make_double2(double x, double y) { double2 t = {x, y}; return t; }
+inline double3 make_double3(double x, double y, double z) { double3 t = {x, y, z}; return t; }
+inline double4 make_double4(double x, double y, double z, double w) { double4 t = {x, y, z, w}; return t; }
+
+// CUDA math intrinsics used by the kernels
+
+inline float rsqrtf(float a) {
+    return 1.0f/std::sqrt(a);
+}
+
+inline double rsqrt(double a) {
+    return 1.0/std::sqrt(a);
+}
+
+#endif
+
+#endif
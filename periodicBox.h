@@ -0,0 +1,72 @@
+#ifndef PERIODICBOX
+#define PERIODICBOX
+
+#include "hostVectorTypes.h"
+#include <math.h>
+
+/**
+ * Periodic box in the OpenMM reduced form: a = (ax, 0, 0), b = (bx, by, 0), c = (cx, cy, cz),
+ * with |bx| <= ax/2, |cx| <= ax/2 and |cy| <= by/2. Orthorhombic boxes only have the diagonal.
+ * Minimum image distances are exact as long as the cutoff is at most half the smallest box width,
+ * see periodicBoxWidths().
+ */
+typedef struct {
+    double3 a, b, c;
+    double3 invSize;  // 1/ax, 1/by, 1/cz
+    bool periodic;
+} PeriodicBox;
+
+inline __host__ __device__ PeriodicBox makeNonPeriodicBox() {
+    PeriodicBox box;
+    box.a = box.b = box.c = box.invSize = make_double3(0., 0., 0.);
+    box.periodic = false;
+    return box;
+}
+
+inline __host__ __device__ PeriodicBox makeTriclinicBox(double3 a, double3 b, double3 c) {
+    PeriodicBox box;
+    box.a = a;
+    box.b = b;
+    box.c = c;
+    box.invSize = make_double3(1./a.x, 1./b.y, 1./c.z);
+    box.periodic = true;
+    return box;
+}
+
+inline __host__ __device__ PeriodicBox makeOrthorhombicBox(double lx, double ly, double lz) {
+    return makeTriclinicBox(make_double3(lx, 0., 0.), make_double3(0., ly, 0.), make_double3(0., 0., lz));
+}
+
+// Shortest periodic image of a displacement, the identity for a non periodic box
+inline __host__ __device__ double3 minimumImage(const PeriodicBox & box, double3 delta) {
+    if (box.periodic) {
+        double sc = floor(delta.z*box.invSize.z + 0.5);
+        delta.x -= sc*box.c.x; delta.y -= sc*box.c.y; delta.z -= sc*box.c.z;
+        double sb = floor(delta.y*box.invSize.y + 0.5);
+        delta.x -= sb*box.b.x; delta.y -= sb*box.b.y;
+        double sa = floor(delta.x*box.invSize.x + 0.5);
+        delta.x -= sa*box.a.x;
+    }
+    return delta;
+}
+
+// Fractional coordinates of a position along a, b and c
+inline __host__ __device__ double3 fractionalCoordinates(const PeriodicBox & box, double3 r) {
+    double sc = r.z*box.invSize.z;
+    double sb = (r.y - sc*box.c.y)*box.invSize.y;
+    double sa = (r.x - sb*box.b.x - sc*box.c.x)*box.invSize.x;
+    return make_double3(sa, sb, sc);
+}
+
+// Distance between the opposite faces of the box, along a, b and c
+inline __host__ __device__ double3 periodicBoxWidths(const PeriodicBox & box) {
+    double volume = box.a.x*box.b.y*box.c.z;
+    // |b x c|, |c x a| and |a x b|
+    double bc = sqrt((box.b.y*box.c.z)*(box.b.y*box.c.z) + (box.b.x*box.c.z)*(box.b.x*box.c.z)
+                     + (box.b.x*box.c.y - box.b.y*box.c.x)*(box.b.x*box.c.y - box.b.y*box.c.x));
+    double ca = box.a.x*sqrt(box.c.y*box.c.y + box.c.z*box.c.z);
+    double ab = box.a.x*box.b.y;
+    return make_double3(volume/bc, volume/ca, volume/ab);
+}
+
+#endif
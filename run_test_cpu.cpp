@@ -0,0 +1,208 @@
+#include "twobodyForceCPU.h"
+#include "twobodyEngine.h"
+#include "stageTrace.h"
+#include <boost/timer/timer.hpp>
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+static inline int omp_get_max_threads() { return 1; }
+#endif
+
+static void printErrors(const PolynomialErrors & errors) {
+        std::cout << "Errors over " << errors.nDimers << " dimers:" << std::endl;
+        std::cout << "  dimer energy max " << errors.maxEnergyError << ", rms " << errors.rmsEnergyError << " kcal/mol" << std::endl;
+        std::cout << "  gradient max " << errors.maxGradientError << ", rms " << errors.rmsGradientError << " kcal/mol/A" << std::endl;
+        std::cout << "  total energy " << errors.totalEnergyError << " kcal/mol" << std::endl;
+}
+
+// False, with a message, if an error exceeds its bound: per dimer, per gradient component, and on the total
+// energy per dimer compared, as it grows with the size of the system
+static bool checkErrors(const char * name, const PolynomialErrors & errors,
+                        double maxEnergyError, double maxGradientError, double maxTotalErrorPerDimer) {
+        bool within = errors.maxEnergyError <= maxEnergyError && errors.maxGradientError <= maxGradientError
+                      && errors.totalEnergyError <= maxTotalErrorPerDimer*errors.nDimers;
+        if (!within)
+            std::cerr << name << " errors exceed " << maxEnergyError << " kcal/mol per dimer, " << maxGradientError
+                      << " kcal/mol/A per gradient component or " << maxTotalErrorPerDimer
+                      << " kcal/mol per dimer in total" << std::endl;
+        return within;
+}
+
+// Host tester: same dimer as run_test.cpp, then optionally a lattice of nMolecules copies of it
+// to exercise the parallel pair loop, e.g. ./run_test_cpu 4000, and optionally with the coefficients
+// read from a file, e.g. ./run_test_cpu 4000 refit.dat
+int main(int argc, char *argv[]) {
+
+        boost::timer::auto_cpu_timer t;
+
+        const unsigned int N_ATOMS = 6;
+        double4 posq[N_ATOMS];
+        double3 forces[N_ATOMS];
+        double e[1];
+
+        // Define positions from the unit test at:
+        // https://github.com/paesanilab/mbpol_openmm_plugin/blob/master/platforms/cuda/tests/TestCudaMBPolTwoBodyForce.cpp#L60
+
+        posq[0] = make_double4(-1.516074336e+00, -2.023167650e-01,  1.454672917e+00, 0.); //[A]
+        posq[1] = make_double4(-6.218989773e-01, -6.009430735e-01,  1.572437625e+00, 0.);
+        posq[2] = make_double4(-2.017613812e+00, -4.190350349e-01,  2.239642849e+00, 0.);
+        posq[3] = make_double4(-1.763651687e+00, -3.816594649e-01, -1.300353949e+00, 0.);
+        posq[4] = make_double4(-1.903851736e+00, -4.935677617e-01, -3.457810126e-01, 0.);
+        posq[5] = make_double4(-2.527904158e+00, -7.613550077e-01, -1.733803676e+00, 0.);
+
+        std::cout << std::endl << "Evaluate the dimer on the host" << std::endl;
+        t.start();
+        evaluate_2b_cpu(posq, forces, e, 2);
+        t.stop();
+        t.report();
+
+        // the expected energy is given to 8 decimals
+        double expectedEnergy = 6.14207815;
+        const double energyTolerance = 1e-6;
+        std::cout << std::endl << "Energy: " << e[0] << " kcal/mol" << std::endl;
+        std::cout << "Expected Energy: " << expectedEnergy << " kcal/mol" << std::endl;
+        if (!(std::fabs(e[0] - expectedEnergy) <= energyTolerance)) {
+            std::cerr << "Energy differs from the expected one by more than " << energyTolerance << " kcal/mol" << std::endl;
+            return 1;
+        }
+
+        if (argc < 2)
+            return 0;
+
+        // Cubic lattice of the first water, 3 A apart, large enough for nMolecules
+        const unsigned int nMolecules = atoi(argv[1]);
+        unsigned int side = 1;
+        while (side*side*side < nMolecules)
+            side++;
+        const double spacing = 3.0; //[A]
+
+        std::vector<double4> boxPosq(3*nMolecules);
+        std::vector<double3> boxForces(3*nMolecules);
+        for (unsigned int m = 0; m < nMolecules; m++) {
+            double sx = spacing*(m % side);
+            double sy = spacing*((m / side) % side);
+            double sz = spacing*(m / (side*side));
+            for (int k = 0; k < 3; k++)
+                boxPosq[3*m + k] = make_double4(posq[k].x + sx, posq[k].y + sy, posq[k].z + sz, 0.);
+        }
+
+        // Keep the neighbor list across calls, as an MD driver would: the second call
+        // moves every molecule by less than half the skin and reuses the list
+        NeighborList neighbors(1.0);
+
+        // Periodic lattice when the box is at least twice the list cutoff wide
+        PeriodicBox box = makeNonPeriodicBox();
+        if (side*spacing >= 2.*(neighbors.getCutoff() + neighbors.getSkin())) {
+            box = makeOrthorhombicBox(side*spacing, side*spacing, side*spacing);
+            std::cout << std::endl << "Periodic box of " << side*spacing << " A" << std::endl;
+        }
+        for (int step = 0; step < 2; step++) {
+            if (step > 0)
+                for (unsigned int a = 0; a < 3*nMolecules; a++)
+                    boxPosq[a].x += 0.1;
+
+            std::cout << std::endl << "Evaluate " << nMolecules << " molecules on the host" << std::endl;
+            t.start();
+            evaluate_2b_cpu(boxPosq.data(), boxForces.data(), e, nMolecules, neighbors, box);
+            t.stop();
+            t.report();
+            std::cout << std::endl << "Energy: " << e[0] << " kcal/mol" << std::endl;
+            std::cout << "Neighbor pairs: " << neighbors.numPairs() << ", list builds: " << neighbors.numBuilds() << std::endl;
+        }
+
+        // Energy only, as for a Monte Carlo move
+        std::cout << std::endl << "Evaluate the energy only" << std::endl;
+        t.start();
+        evaluate_2b_cpu(boxPosq.data(), NULL, e, nMolecules, neighbors, box);
+        t.stop();
+        t.report();
+        std::cout << std::endl << "Energy: " << e[0] << " kcal/mol" << std::endl;
+
+        // The same steps on an engine created once for the system, as an MD driver would keep it:
+        // the step is started asynchronously and the driver is free until it waits on the handle
+        TwoBodyEngine engine(nMolecules, box);
+        std::cout << std::endl << "Evaluate 10 steps on an engine" << std::endl;
+        t.start();
+        for (int step = 0; step < 10; step++) {
+            engine.setPositions(boxPosq.data());
+            TwoBodyCompletion completion = engine.computeAsync();
+            // other force terms of the step would be evaluated here
+            completion.wait();
+        }
+        t.stop();
+        t.report();
+        engine.getForces(boxForces.data());
+        std::cout << std::endl << "Energy: " << engine.getEnergy() << " kcal/mol" << std::endl;
+
+        // Fixed point accumulation, bitwise identical for any number of threads
+        WaterSystem system(boxPosq.data(), nMolecules);
+        system.setDeterministic(true);
+        std::cout << std::endl << "Evaluate with deterministic accumulation" << std::endl;
+        t.start();
+        evaluate_2b_cpu(system, boxForces.data(), e, neighbors, box, TwoBodyPolynomial());
+        t.stop();
+        t.report();
+        std::cout.precision(17);
+        std::cout << std::endl << "Energy: " << e[0] << " kcal/mol" << std::endl;
+        std::cout.precision(6);
+
+        // same box with 1, 2 and all threads, which must agree bit for bit with the run above
+        std::vector<double3> threadForces(3*nMolecules);
+        const int threadCounts[] = {1, 2, omp_get_max_threads()};
+        for (int nThreads : threadCounts) {
+            double threadEnergy;
+            evaluate_2b_cpu(system, threadForces.data(), &threadEnergy, neighbors, box, TwoBodyPolynomial(), nThreads);
+            bool same = std::memcmp(&threadEnergy, e, sizeof(double)) == 0 &&
+                        std::memcmp(threadForces.data(), boxForces.data(), threadForces.size() * sizeof(double3)) == 0;
+            std::cout << "Deterministic with " << nThreads << " threads: " << (same ? "identical" : "MISMATCH") << std::endl;
+            if (!same) {
+                std::cerr << "Deterministic results differ with " << nThreads << " threads" << std::endl;
+                return 1;
+            }
+        }
+
+        // Mixed precision against the double precision polynomial, with the same coefficients
+        std::vector<double> coefficients = argc > 2 ? readPolyCoefficients(argv[2])
+                                                    : TwoBodyPolynomial().getCoefficients();
+        TwoBodyPolynomial polynomial(coefficients), mixed(coefficients, TwoBodyPolynomial::MIXED_PRECISION);
+
+        std::cout << std::endl << "Evaluate in mixed precision" << std::endl;
+        t.start();
+        evaluate_2b_cpu(boxPosq.data(), boxForces.data(), e, nMolecules, neighbors, box, mixed);
+        t.stop();
+        t.report();
+        std::cout << std::endl << "Energy: " << e[0] << " kcal/mol" << std::endl;
+
+        // within the budget documented in twobodyForcePolynomial.h
+        PolynomialErrors mixedErrors = compare_2b_cpu(boxPosq.data(), nMolecules, neighbors, box, mixed, polynomial);
+        printErrors(mixedErrors);
+        if (!checkErrors("Mixed precision", mixedErrors, 1e-4, 1e-3, 1e-5))
+            return 1;
+
+        // Symmetry reduced form against the expanded polynomial, equal to round-off
+        TwoBodyPolynomial symmetric(coefficients, TwoBodyPolynomial::DOUBLE_PRECISION, TwoBodyPolynomial::SYMMETRIC);
+
+        std::cout << std::endl << "Evaluate the symmetric form of the polynomial" << std::endl;
+        t.start();
+        evaluate_2b_cpu(boxPosq.data(), boxForces.data(), e, nMolecules, neighbors, box, symmetric);
+        t.stop();
+        t.report();
+        std::cout << std::endl << "Energy: " << e[0] << " kcal/mol" << std::endl;
+
+        PolynomialErrors symmetricErrors = compare_2b_cpu(boxPosq.data(), nMolecules, neighbors, box, symmetric, polynomial);
+        printErrors(symmetricErrors);
+        if (!checkErrors("Symmetric form", symmetricErrors, 1e-9, 1e-9, 1e-11))
+            return 1;
+
+        // time of each stage of all the calls above, in a build with -DSTAGE_TRACE=ON
+        if (STAGE_TRACE_ENABLED) {
+            std::cout << std::endl;
+            STAGE_TRACE_SUMMARY(std::cout);
+        }
+}
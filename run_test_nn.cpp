@@ -0,0 +1,163 @@
+#include "twobodyNNFeatures.h"
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// CPU backend of the network, the same code the NN_2L2H2O_poly2d testers run with make cpu
+#define NN_CPU
+#include "NN_2L2H2O_poly2d/readhdf5.hpp"
+#include "NN_2L2H2O_poly2d/network.cu"
+
+// The double precision two-body model, read as runtester() of NN_2L2H2O_poly2d.cu reads it:
+// dense layers and their tanh activations, the activation of the last one made linear
+static void loadModel(const char * filename, Layer_Net_t<double> & model) {
+        H5File file(filename, H5F_ACC_RDONLY);
+        hsize_t dataRank = 0, biasRank = 0;
+        hsize_t * dataDims = nullptr, * biasDims = nullptr;
+        double * data = nullptr, * bias = nullptr;
+
+        std::vector<std::string> layerNames = Read_Attr_Data_By_Seq(file, "/model_weights", "layer_names");
+        for (std::string layerName : layerNames) {
+            std::string layerPath = mkpath("/model_weights", layerName);
+            std::vector<std::string> weightNames = Read_Attr_Data_By_Seq(file, layerPath.c_str(), "weight_names");
+            for (std::string weightName : weightNames) {
+                // dense_1/kernel, else the bias
+                std::string path = mkpath(layerPath, weightName);
+                if (weightName.back() == 'l')
+                    Read_Layer_Data_By_DatName<double>(file, path.c_str(), data, dataRank, dataDims);
+                else
+                    Read_Layer_Data_By_DatName<double>(file, path.c_str(), bias, biasRank, biasDims);
+            }
+            if (dataRank == 2) {
+                model.insert_layer(layerName, dataDims[0], dataDims[1], data, bias);
+                dataRank = 0;
+                biasRank = 0;
+            } else {
+                model.insert_layer(layerName, ActType_t::TANH);
+            }
+        }
+        model.get_layer_by_seq(12)->acttype = ActType_t::LINEAR;
+
+        delete[] data;
+        delete[] bias;
+        delete[] dataDims;
+        delete[] biasDims;
+        file.close();
+}
+
+// Features of the dimer of main() as poly_2d() of BenchMarking_InputGeneration.py computes them in double
+// precision, from the distances of the sites that computeExtraPoint builds
+static const double referenceFeatures[NN_NUM_FEATURES] = {
+        0.53833270715886994, 0.25561994136195554, 0.062540783717209988, 0.25301339054482241,
+        0.26244337805018397, 0.21426694432919804, 0.030006525480260605, 0.075147577552241454,
+        0.11442398976454304, 0.034626938442191488, 0.090825989204068536, 0.067086269345429536,
+        0.16231165068214387, 0.068932763438487865, 0.057038759779231937, 0.067085760908021555,
+        0.38851761911352284, 0.054770903745235001, 0.016413414544650531, 0.0065111970996017737,
+        0.016301959694933105, 0.19225640191934307, 0.036505070635761909, 0.40845319351059423,
+        0.099454543477310184, 0.20574939513124318, 0.019727870038483541, 0.0081505330367911931,
+        0.054212406066409091, 0.0034286727509809708, 0.033670707999089049, 0.026510522024274945,
+        0.026839569102213388, 0.015823655735621715, 0.016039408959644709, 0.11377080155841168,
+        0.04019932664315462, 0.068675811598685285, 0.034492175691817652, 0.015987185413813578,
+        0.1083551833306368, 0.20401112567923912, 0.013925709056642996, 0.19914212152334371,
+        0.011375509117638306, 0.013874086649523176, 0.013400422623039851, 0.10029191876514751,
+        0.032373467847496104, 0.055774766199669999, 0.060362224305688106, 0.032730980907424621,
+        0.033667749406323028, 0.058050211845780172, 0.053614374361968975, 0.16335340745834559,
+        0.056392073233680728, 0.032301800207360953, 0.19229951173342685, 0.015986671466523963,
+        0.016369775196997734, 0.053635913590997883, 0.095055950086844629, 0.055472815624443728,
+        0.016335356575654734, 0.028002714369902249, 0.0080009980038574721, 0.013800567736639057,
+        0.0039113496279628377
+};
+
+// Score of one dimer, features then network
+static double dimerScore(Layer_Net_t<double> & model, const double3 * positions) {
+        double features[NN_NUM_FEATURES];
+        computeNNFeatures(positions, 1, features);
+        double * score = nullptr;
+        unsigned long int outsize = 0;
+        model.predict(features, 1, NN_NUM_FEATURES, score, outsize);
+        double e = score[0];
+        delete[] score;
+        return e;
+}
+
+// NN tester: the same dimer as run_test_cpu.cpp through computeNNFeatures, checked against poly_2d() of the
+// training script, then through the double precision model of NN_2L2H2O_poly2d and back through
+// computeNNFeatureGradients, the atom gradients checked against central differences of the score,
+// e.g. ./run_test_nn NN_2L2H2O_poly2d/32_2b_nn_double.hdf5. Returns 1 on a mismatch.
+int main(int argc, char *argv[]) {
+
+        const char * modelFile = argc > 1 ? argv[1] : "NN_2L2H2O_poly2d/32_2b_nn_double.hdf5";
+
+        // Oa Ha1 Ha2 Ob Hb1 Hb2
+        double3 positions[6];
+        positions[0] = make_double3(-1.516074336e+00, -2.023167650e-01,  1.454672917e+00); //[A]
+        positions[1] = make_double3(-6.218989773e-01, -6.009430735e-01,  1.572437625e+00);
+        positions[2] = make_double3(-2.017613812e+00, -4.190350349e-01,  2.239642849e+00);
+        positions[3] = make_double3(-1.763651687e+00, -3.816594649e-01, -1.300353949e+00);
+        positions[4] = make_double3(-1.903851736e+00, -4.935677617e-01, -3.457810126e-01);
+        positions[5] = make_double3(-2.527904158e+00, -7.613550077e-01, -1.733803676e+00);
+
+        // Features against the training script
+        double features[NN_NUM_FEATURES];
+        computeNNFeatures(positions, 1, features);
+        double maxFeatureError = 0.;
+        for (int k = 0; k < NN_NUM_FEATURES; k++)
+            maxFeatureError = std::max(maxFeatureError, std::fabs(features[k] - referenceFeatures[k])/referenceFeatures[k]);
+        std::cout << "Feature max relative error against poly_2d " << maxFeatureError << std::endl;
+        bool failed = !(maxFeatureError <= 1e-14);
+
+        Layer_Net_t<double> model;
+        try {
+            loadModel(modelFile, model);
+        } catch (const H5::Exception & e) {
+            std::cerr << "Cannot read the model " << modelFile << ": " << e.getDetailMsg() << std::endl;
+            return 1;
+        }
+
+        // Energy and gradients through the chain rule
+        double * score = nullptr, * featureGradients = nullptr;
+        unsigned long int outsize = 0;
+        model.predict_and_gradient(features, 1, NN_NUM_FEATURES, score, outsize, featureGradients);
+        double3 gradients[6];
+        for (int a = 0; a < 6; a++)
+            gradients[a] = make_double3(0., 0., 0.);
+        computeNNFeatureGradients(positions, 1, featureGradients, gradients);
+
+        std::cout.precision(10);
+        std::cout << std::endl << "Score: " << score[0] << std::endl;
+        double predicted = dimerScore(model, positions);
+        if (std::fabs(score[0] - predicted) > 1e-12) {
+            failed = true;
+            std::cout << "  differs from predict() " << predicted << std::endl;
+        }
+
+        // Central differences, the step balances their O(h^2) error against the round-off of the score
+        const double h = 1e-5;               //[A]
+        const double tolerance = 1e-9;
+        double maxError = 0.;
+        for (int a = 0; a < 6; a++) {
+            for (int c = 0; c < 3; c++) {
+                double3 moved[6];
+                for (int k = 0; k < 6; k++)
+                    moved[k] = positions[k];
+                double & x = c == 0 ? moved[a].x : c == 1 ? moved[a].y : moved[a].z;
+                x += h;
+                double ePlus = dimerScore(model, moved);
+                x -= 2*h;
+                double eMinus = dimerScore(model, moved);
+                double numerical = (ePlus - eMinus)/(2*h);
+                double analytical = c == 0 ? gradients[a].x : c == 1 ? gradients[a].y : gradients[a].z;
+                maxError = std::max(maxError, std::fabs(analytical - numerical));
+            }
+            std::cout << "  atom " << a << " gradient " << gradients[a].x << " " << gradients[a].y << " " << gradients[a].z << std::endl;
+        }
+        std::cout << "Gradient max error against central differences " << maxError << ", tolerance " << tolerance << std::endl;
+        failed = failed || !(maxError <= tolerance);
+
+        delete[] score;
+        delete[] featureGradients;
+        std::cout << (failed ? "FAILED" : "PASSED") << std::endl;
+        return failed ? 1 : 0;
+}
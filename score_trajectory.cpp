@@ -0,0 +1,115 @@
+#include "twobodyTrajectory.h"
+#include "stageTrace.h"
+#include <boost/timer/timer.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+// Two-body energies (and optionally forces) of every frame of a trajectory, in frame order:
+//
+//     ./score_trajectory traj.xyz [--energies energies.dat] [--forces forces.xyz] [--batch 64]
+//                                 [--mixed] [--symmetric] [--coefficients refit.dat] [--trace trace.json]
+//
+// or convert a trajectory to the binary format of TrajectoryReader, which is faster to read again:
+//
+//     ./score_trajectory traj.xyz --convert traj.bin
+//
+// Energies are written one frame per line (frame index, kcal/mol), to the standard output by default.
+// Forces are written as XYZ frames with the x, y, z and the forces of each atom in kcal/mol/A, i.e. -dE/dx:
+// what the engine calls forces is the gradient dE/dx, so it is negated here.
+// --symmetric evaluates the symmetry reduced form of the polynomial, equal to round-off and faster.
+// With --trace, in a build with -DSTAGE_TRACE=ON, the time of each stage of the engine is printed as a table
+// and written as a Chrome trace, see stageTrace.h.
+int main(int argc, char *argv[]) {
+
+        if (argc < 2) {
+            std::cerr << "Usage: " << argv[0] << " trajectory [--energies file] [--forces file] [--batch frames]"
+                      << " [--mixed] [--symmetric] [--coefficients file] [--convert file] [--trace file]" << std::endl;
+            return 1;
+        }
+
+        const char * energiesFile = NULL;
+        const char * forcesFile = NULL;
+        const char * coefficientsFile = NULL;
+        const char * convertFile = NULL;
+        const char * traceFile = NULL;
+        int batchSize = 64;
+        TwoBodyPolynomial::Precision precision = TwoBodyPolynomial::DOUBLE_PRECISION;
+        TwoBodyPolynomial::Form form = TwoBodyPolynomial::EXPANDED;
+
+        for (int a = 2; a < argc; a++) {
+            if (!strcmp(argv[a], "--energies") && a + 1 < argc)
+                energiesFile = argv[++a];
+            else if (!strcmp(argv[a], "--forces") && a + 1 < argc)
+                forcesFile = argv[++a];
+            else if (!strcmp(argv[a], "--batch") && a + 1 < argc)
+                batchSize = atoi(argv[++a]);
+            else if (!strcmp(argv[a], "--coefficients") && a + 1 < argc)
+                coefficientsFile = argv[++a];
+            else if (!strcmp(argv[a], "--convert") && a + 1 < argc)
+                convertFile = argv[++a];
+            else if (!strcmp(argv[a], "--trace") && a + 1 < argc)
+                traceFile = argv[++a];
+            else if (!strcmp(argv[a], "--mixed"))
+                precision = TwoBodyPolynomial::MIXED_PRECISION;
+            else if (!strcmp(argv[a], "--symmetric"))
+                form = TwoBodyPolynomial::SYMMETRIC;
+            else {
+                std::cerr << "Unknown option " << argv[a] << std::endl;
+                return 1;
+            }
+        }
+
+        try {
+            TrajectoryReader reader(argv[1]);
+
+            if (convertFile != NULL) {
+                BinaryTrajectoryWriter writer(convertFile);
+                TrajectoryFrame frame;
+                while (reader.read(frame))
+                    writer.write(frame);
+                std::cerr << "Converted " << reader.numFramesRead() << " frames" << std::endl;
+                return 0;
+            }
+
+            const TwoBodyPolynomial polynomial = coefficientsFile != NULL ?
+                TwoBodyPolynomial(readPolyCoefficients(coefficientsFile), precision, form)
+                : TwoBodyPolynomial(precision, form);
+
+            std::ofstream energies, forces;
+            if (energiesFile != NULL)
+                energies.open(energiesFile);
+            std::ostream & energyOut = energiesFile != NULL ? energies : std::cout;
+            energyOut.precision(12);
+            if (forcesFile != NULL) {
+                forces.open(forcesFile);
+                forces.precision(10);
+            }
+
+            boost::timer::cpu_timer timer;
+            size_t nFrames = score_trajectory_cpu(reader, polynomial, forcesFile != NULL, batchSize,
+                [&](size_t index, const TrajectoryFrame & frame, double energy, const double3 * f) {
+                    energyOut << index << " " << energy << "\n";
+                    if (f == NULL)
+                        return;
+                    forces << 3*frame.nMolecules << "\nframe " << index << " energy " << energy << "\n";
+                    for (unsigned int i = 0; i < 3*frame.nMolecules; i++)
+                        forces << (i % 3 == 0 ? "O " : "H ") << frame.posq[i].x << " " << frame.posq[i].y << " "
+                               << frame.posq[i].z << " " << -f[i].x << " " << -f[i].y << " " << -f[i].z << "\n";
+                });
+            std::cerr << "Scored " << nFrames << " frames," << timer.format() << std::flush;
+
+            if (traceFile != NULL) {
+                if (!STAGE_TRACE_ENABLED)
+                    std::cerr << "No stages to trace, build with -DSTAGE_TRACE=ON" << std::endl;
+                STAGE_TRACE_SUMMARY(std::cerr);
+                STAGE_TRACE_WRITE(traceFile);
+            }
+        } catch (const std::exception & e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+        return 0;
+}
@@ -0,0 +1,47 @@
+#ifndef SIMDLANES
+#define SIMDLANES
+
+/**
+ * W values of type T processed lane by lane, on top of the GCC/Clang vector extensions so that
+ * the arithmetic maps to SSE/AVX2/AVX-512 instructions when W*sizeof(T) matches a register.
+ * It supports what the generated polynomial needs: construction from a scalar (broadcast), + - and *
+ * with scalars on either side, so templates written for double can run on W dimers at once.
+ */
+template <typename T, int W>
+struct SimdLanes {
+    typedef T vector_t __attribute__((vector_size(W*sizeof(T))));
+
+    vector_t v;
+
+    SimdLanes() {}
+    SimdLanes(T a) { v = vector_t{} + a; }
+
+    // lane by lane conversion, e.g. to widen float lanes to double
+    template <typename U>
+    explicit SimdLanes(SimdLanes<U, W> a) { v = __builtin_convertvector(a.v, vector_t); }
+
+    static SimdLanes wrap(vector_t a) {
+        SimdLanes r;
+        r.v = a;
+        return r;
+    }
+
+    // unit-stride load and store of W consecutive values
+    static SimdLanes load(const T * p) {
+        SimdLanes r;
+        __builtin_memcpy(&r.v, p, sizeof(vector_t));
+        return r;
+    }
+    void store(T * p) const {
+        __builtin_memcpy(p, &v, sizeof(vector_t));
+    }
+
+    T operator[](int lane) const { return v[lane]; }
+
+    // friends, so that scalars on either side are broadcast by the constructor above
+    friend SimdLanes operator+(SimdLanes a, SimdLanes b) { return wrap(a.v + b.v); }
+    friend SimdLanes operator-(SimdLanes a, SimdLanes b) { return wrap(a.v - b.v); }
+    friend SimdLanes operator*(SimdLanes a, SimdLanes b) { return wrap(a.v * b.v); }
+};
+
+#endif
@@ -0,0 +1,340 @@
+#ifndef STAGETRACE
+#define STAGETRACE
+
+/**
+ * Stage timers and counters for production runs, compiled in with -DSTAGE_TRACE (cmake -DSTAGE_TRACE=ON,
+ * make TRACE=1 in NN_2L2H2O_poly2d) and removed otherwise: the macros then expand to nothing.
+ *
+ *     STAGE_SCOPE("2b.polynomial");        // time until the end of the block, summed per thread
+ *     STAGE_SPAN("2b.evaluate");           // the same, and each call is also an event of the trace
+ *     STAGE_SCOPE_AT("nn.layer", i);       // one row per index i < STAGE_SLOTS, e.g. per layer
+ *     STAGE_COUNT("2b.pairs_inside", 1);   // add to a counter
+ *     STAGE_COUNT_AT("nn.samples", i, n);
+ *
+ * Each thread adds to a table of its own, without locks or atomics, so a scope costs two reads of the time
+ * stamp counter, a few ns; spans also append an event to a per thread vector, keep them for the coarse stages.
+ * STAGE_TRACE_SUMMARY(out) prints the totals of all the threads as a table, STAGE_TRACE_WRITE(filename)
+ * writes the spans and counters as a Chrome trace (JSON, for chrome://tracing or ui.perfetto.dev).
+ * Both read the tables of the other threads: call them once the traced work is done.
+ * Device code (__CUDA_ARCH__) is never traced.
+ */
+
+#if defined(STAGE_TRACE) && !defined(__CUDA_ARCH__)
+
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define STAGE_MAX_STAGES 64           // names, timers and counters together
+#define STAGE_SLOTS      16           // indices of the _AT macros, larger ones go to the last slot
+#define STAGE_MAX_EVENTS (1 << 20)    // spans kept per thread, the next ones are only summed
+
+// Time stamp counter where there is one, ns otherwise. StageTrace converts ticks to ns on export.
+inline unsigned long long stageClock() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// Calls, and ticks or counted values, of one stage and slot in one thread
+typedef struct {
+    unsigned long long calls, sum, min, max;
+} StageTotals;
+
+typedef struct {
+    unsigned long long begin, end;
+    int stage, slot;
+} StageEvent;
+
+// The table of one thread, only written by that thread
+struct StageThreadLog {
+    int thread;
+    unsigned long long dropped;
+    StageTotals totals[STAGE_MAX_STAGES][STAGE_SLOTS];
+    std::vector<StageEvent> events;
+
+    void add(int stage, int slot, unsigned long long begin, unsigned long long end, bool span) {
+        if (stage < 0)
+            return;
+        StageTotals & t = totals[stage][slot];
+        const unsigned long long ticks = end - begin;
+        t.min = (t.calls == 0 || ticks < t.min) ? ticks : t.min;
+        t.max = ticks > t.max ? ticks : t.max;
+        t.calls++;
+        t.sum += ticks;
+        if (span) {
+            if (events.size() < STAGE_MAX_EVENTS) {
+                StageEvent e = { begin, end, stage, slot };
+                events.push_back(e);
+            } else {
+                dropped++;
+            }
+        }
+    }
+
+    void count(int stage, int slot, unsigned long long n) {
+        if (stage < 0)
+            return;
+        totals[stage][slot].calls++;
+        totals[stage][slot].sum += n;
+    }
+};
+
+inline int stageSlot(int index) {
+    return index < 0 ? 0 : (index < STAGE_SLOTS ? index : STAGE_SLOTS - 1);
+}
+
+/**
+ * The stages, registered by name on first use, and the tables of every thread that used them.
+ * The table of a thread that ended stays, and is taken over by the next new thread, so threads started for
+ * each batch (std::async) do not add a table each.
+ */
+class StageTrace {
+public:
+    StageTrace() : startTicks(stageClock()), startTime(std::chrono::steady_clock::now()) {}
+
+    // Id of a stage, the same for every call with that name, -1 once STAGE_MAX_STAGES are taken
+    int stage(const char * name, bool counter, bool indexed) {
+        std::lock_guard<std::mutex> guard(lock);
+        for (size_t s = 0; s < names.size(); s++)
+            if (names[s] == name)
+                return (int) s;
+        if (names.size() == STAGE_MAX_STAGES)
+            return -1;
+        names.push_back(name);
+        counters.push_back(counter);
+        indexedStages.push_back(indexed);
+        return (int) names.size() - 1;
+    }
+
+    // Table for a new thread, see stageThreadLog()
+    StageThreadLog * acquire() {
+        std::lock_guard<std::mutex> guard(lock);
+        if (!released.empty()) {
+            StageThreadLog * log = released.back();
+            released.pop_back();
+            return log;
+        }
+        logs.push_back(std::unique_ptr<StageThreadLog>(new StageThreadLog()));
+        logs.back()->thread = (int) logs.size() - 1;
+        return logs.back().get();
+    }
+
+    void release(StageThreadLog * log) {
+        std::lock_guard<std::mutex> guard(lock);
+        released.push_back(log);
+    }
+
+    // Totals over all the threads: calls, time (ns, min and max of one call) or counted values, and threads
+    void summary(std::ostream & out) {
+        std::lock_guard<std::mutex> guard(lock);
+        const double ns = nsPerTick();
+        out << std::left << std::setw(28) << "stage" << std::right << std::setw(8) << "threads" << std::setw(12) << "calls"
+            << std::setw(14) << "total ms" << std::setw(12) << "mean ns" << std::setw(12) << "min ns"
+            << std::setw(12) << "max ns" << std::endl;
+        for (int pass = 0; pass < 2; pass++) {
+            if (pass == 1)
+                out << std::endl << std::left << std::setw(28) << "counter" << std::right << std::setw(8) << "threads"
+                    << std::setw(12) << "calls" << std::setw(14) << "total" << std::setw(12) << "mean" << std::endl;
+            for (size_t s = 0; s < names.size(); s++) {
+                if (counters[s] != (pass == 1))
+                    continue;
+                for (int slot = 0; slot < STAGE_SLOTS; slot++) {
+                    StageTotals t = { 0, 0, 0, 0 };
+                    int threads = 0;
+                    merge(s, slot, t, threads);
+                    if (t.calls == 0)
+                        continue;
+                    out << std::left << std::setw(28) << label(s, slot) << std::right << std::setw(8) << threads
+                        << std::setw(12) << t.calls << std::fixed << std::setprecision(3);
+                    if (counters[s])
+                        out << std::setw(14) << t.sum << std::setw(12) << (double) t.sum/t.calls;
+                    else
+                        out << std::setw(14) << 1e-6*ns*t.sum << std::setprecision(1) << std::setw(12) << ns*t.sum/t.calls
+                            << std::setw(12) << ns*t.min << std::setw(12) << ns*t.max;
+                    out.unsetf(std::ios::floatfield);
+                    out << std::setprecision(6) << std::endl;
+                }
+            }
+        }
+        unsigned long long dropped = 0;
+        for (size_t l = 0; l < logs.size(); l++)
+            dropped += logs[l]->dropped;
+        if (dropped > 0)
+            out << dropped << " spans beyond " << STAGE_MAX_EVENTS << " per thread are only in the totals" << std::endl;
+    }
+
+    // Chrome trace event format: one complete event per span, one row per thread, and the counters at the end
+    void write(const char * filename) {
+        std::lock_guard<std::mutex> guard(lock);
+        const double ns = nsPerTick();
+        std::ofstream file(filename);
+        file << std::fixed << std::setprecision(3);
+        file << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [" << std::endl;
+        file << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"args\": {\"name\": \"stages\"}}";
+        unsigned long long last = startTicks;
+        for (size_t l = 0; l < logs.size(); l++) {
+            const StageThreadLog & log = *logs[l];
+            file << "," << std::endl << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << log.thread
+                 << ", \"args\": {\"name\": \"thread " << log.thread << "\"}}";
+            for (size_t e = 0; e < log.events.size(); e++) {
+                const StageEvent & event = log.events[e];
+                file << "," << std::endl << "{\"name\": \"" << label(event.stage, event.slot)
+                     << "\", \"cat\": \"stage\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << log.thread
+                     << ", \"ts\": " << 1e-3*ns*(double)(event.begin - startTicks)
+                     << ", \"dur\": " << 1e-3*ns*(double)(event.end - event.begin) << "}";
+                last = event.end > last ? event.end : last;
+            }
+        }
+        for (size_t s = 0; s < names.size(); s++) {
+            if (!counters[s])
+                continue;
+            for (int slot = 0; slot < STAGE_SLOTS; slot++) {
+                StageTotals t = { 0, 0, 0, 0 };
+                int threads = 0;
+                merge(s, slot, t, threads);
+                if (t.calls > 0)
+                    file << "," << std::endl << "{\"name\": \"" << label(s, slot) << "\", \"ph\": \"C\", \"pid\": 1, \"ts\": "
+                         << 1e-3*ns*(double)(last - startTicks) << ", \"args\": {\"total\": " << t.sum << "}}";
+            }
+        }
+        file << std::endl << "]}" << std::endl;
+    }
+
+    // Forget the totals and spans so far, e.g. those of a warm up. No thread may be in a traced stage.
+    void reset() {
+        std::lock_guard<std::mutex> guard(lock);
+        for (size_t l = 0; l < logs.size(); l++) {
+            logs[l]->events.clear();
+            logs[l]->dropped = 0;
+            std::fill(&logs[l]->totals[0][0], &logs[l]->totals[0][0] + STAGE_MAX_STAGES*STAGE_SLOTS, StageTotals());
+        }
+    }
+
+private:
+    // measured over the whole run, the time stamp counter of current processors runs at a constant rate
+    double nsPerTick() const {
+#if defined(__x86_64__) || defined(__i386__)
+        const unsigned long long ticks = stageClock() - startTicks;
+        const double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+        return ticks > 0 ? elapsed/ticks : 1.;
+#else
+        return 1.;
+#endif
+    }
+
+    void merge(size_t s, int slot, StageTotals & t, int & threads) const {
+        for (size_t l = 0; l < logs.size(); l++) {
+            const StageTotals & u = logs[l]->totals[s][slot];
+            if (u.calls == 0)
+                continue;
+            t.min = (t.calls == 0 || u.min < t.min) ? u.min : t.min;
+            t.max = u.max > t.max ? u.max : t.max;
+            t.calls += u.calls;
+            t.sum += u.sum;
+            threads++;
+        }
+    }
+
+    std::string label(size_t s, int slot) const {
+        if (!indexedStages[s])
+            return names[s];
+        char index[16];
+        snprintf(index, sizeof(index), "[%d]", slot);
+        return names[s] + index;
+    }
+
+    std::mutex lock;
+    std::vector<std::string> names;
+    std::vector<bool> counters, indexedStages;
+    std::vector<std::unique_ptr<StageThreadLog> > logs;
+    std::vector<StageThreadLog *> released;
+    const unsigned long long startTicks;
+    const std::chrono::steady_clock::time_point startTime;
+};
+
+inline StageTrace & stageTrace() {
+    static StageTrace trace;
+    return trace;
+}
+
+// Table of the calling thread, handed back when the thread ends
+struct StageLogHolder {
+    StageThreadLog * log;
+    StageLogHolder() : log(NULL) {}
+    ~StageLogHolder() { if (log != NULL) stageTrace().release(log); }
+};
+
+inline StageThreadLog & stageThreadLog() {
+    static thread_local StageLogHolder holder;
+    if (holder.log == NULL)
+        holder.log = stageTrace().acquire();
+    return *holder.log;
+}
+
+// Adds the time from its construction to its destruction to a stage
+class StageTimer {
+public:
+    StageTimer(int stage, int slot, bool span)
+        : log(stageThreadLog()), stage(stage), slot(slot), span(span), begin(stageClock()) {}
+    ~StageTimer() { log.add(stage, slot, begin, stageClock(), span); }
+
+private:
+    StageTimer(const StageTimer &);
+    StageTimer & operator=(const StageTimer &);
+
+    StageThreadLog & log;
+    const int stage, slot;
+    const bool span;
+    const unsigned long long begin;
+};
+
+#define STAGE_CONCAT_(a, b) a##b
+#define STAGE_CONCAT(a, b) STAGE_CONCAT_(a, b)
+#define STAGE_TIMER_(name, index, counter, indexed, span) \
+    static const int STAGE_CONCAT(stageId_, __LINE__) = stageTrace().stage(name, counter, indexed); \
+    StageTimer STAGE_CONCAT(stageTimer_, __LINE__)(STAGE_CONCAT(stageId_, __LINE__), stageSlot(index), span)
+
+#define STAGE_SCOPE(name)            STAGE_TIMER_(name, 0, false, false, false)
+#define STAGE_SCOPE_AT(name, index)  STAGE_TIMER_(name, index, false, true, false)
+#define STAGE_SPAN(name)             STAGE_TIMER_(name, 0, false, false, true)
+#define STAGE_SPAN_AT(name, index)   STAGE_TIMER_(name, index, false, true, true)
+#define STAGE_COUNT(name, n) \
+    do { static const int stageId_ = stageTrace().stage(name, true, false); \
+         stageThreadLog().count(stageId_, 0, n); } while (0)
+#define STAGE_COUNT_AT(name, index, n) \
+    do { static const int stageId_ = stageTrace().stage(name, true, true); \
+         stageThreadLog().count(stageId_, stageSlot(index), n); } while (0)
+#define STAGE_TRACE_SUMMARY(out)     stageTrace().summary(out)
+#define STAGE_TRACE_WRITE(filename)  stageTrace().write(filename)
+#define STAGE_TRACE_RESET()          stageTrace().reset()
+#define STAGE_TRACE_ENABLED          1
+
+#else
+
+#define STAGE_SCOPE(name)
+#define STAGE_SCOPE_AT(name, index)
+#define STAGE_SPAN(name)
+#define STAGE_SPAN_AT(name, index)
+#define STAGE_COUNT(name, n)                 do { } while (0)
+#define STAGE_COUNT_AT(name, index, n)       do { } while (0)
+#define STAGE_TRACE_SUMMARY(out)             do { } while (0)
+#define STAGE_TRACE_WRITE(filename)          do { } while (0)
+#define STAGE_TRACE_RESET()                  do { } while (0)
+#define STAGE_TRACE_ENABLED                  0
+
+#endif
+
+#endif
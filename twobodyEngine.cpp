@@ -0,0 +1,125 @@
+#include "twobodyEngine.h"
+#include <algorithm>
+
+void TwoBodyCompletion::wait() const {
+    if (engine != NULL)
+        engine->waitFor(ticket);
+}
+
+bool TwoBodyCompletion::isReady() const {
+    if (engine == NULL)
+        return true;
+    std::lock_guard<std::mutex> guard(engine->lock);
+    return engine->done >= ticket;
+}
+
+TwoBodyEngine::TwoBodyEngine(
+        unsigned int nMolecules,
+        const PeriodicBox & box,
+        const TwoBodyPolynomial & polynomial,
+        int nThreads,
+        double skin)
+        : system(nMolecules), neighbors(skin), box(box), polynomial(polynomial), nThreads(nThreads),
+          forces(3*nMolecules, make_double3(0., 0., 0.)), energy(0.),
+          submitted(0), done(0), pendingOutputs(0), stopping(false) {
+    // started last, it reads the members above
+    worker = std::thread(&TwoBodyEngine::run, this);
+}
+
+TwoBodyEngine::~TwoBodyEngine() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    requested.notify_all();
+    worker.join();
+}
+
+void TwoBodyEngine::setPositions(const double4* posq) {
+    wait();
+    system.setPositions(posq, system.getNumMolecules());
+}
+
+void TwoBodyEngine::setBox(const PeriodicBox & box) {
+    wait();
+    this->box = box;
+}
+
+void TwoBodyEngine::setDeterministic(bool deterministic) {
+    wait();
+    system.setDeterministic(deterministic);
+}
+
+void TwoBodyEngine::evaluate(int outputs) {
+    evaluate_2b_cpu(system, (outputs & FORCES) ? forces.data() : NULL, &energy, neighbors, box, polynomial, nThreads);
+}
+
+void TwoBodyEngine::compute(int outputs) {
+    wait();
+    evaluate(outputs);
+}
+
+TwoBodyCompletion TwoBodyEngine::computeAsync(int outputs) {
+    wait();
+    unsigned long long ticket;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        pendingOutputs = outputs;
+        ticket = ++submitted;
+    }
+    requested.notify_one();
+    return TwoBodyCompletion(this, ticket);
+}
+
+void TwoBodyEngine::run() {
+    std::unique_lock<std::mutex> guard(lock);
+    for (;;) {
+        // a request in flight when the engine is destroyed is finished first
+        requested.wait(guard, [this] { return stopping || submitted > done; });
+        if (submitted == done)
+            return;
+
+        const int outputs = pendingOutputs;
+        guard.unlock();
+        std::exception_ptr failure;
+        try {
+            evaluate(outputs);
+        } catch (...) {
+            failure = std::current_exception();
+        }
+        guard.lock();
+        error = failure;
+        done = submitted;
+        completed.notify_all();
+    }
+}
+
+void TwoBodyEngine::waitFor(unsigned long long ticket) {
+    std::unique_lock<std::mutex> guard(lock);
+    completed.wait(guard, [this, ticket] { return done >= ticket; });
+    // rethrown once, by whoever waits first
+    if (error) {
+        std::exception_ptr failure = error;
+        error = std::exception_ptr();
+        std::rethrow_exception(failure);
+    }
+}
+
+void TwoBodyEngine::wait() {
+    waitFor(submitted);
+}
+
+double TwoBodyEngine::getEnergy() {
+    wait();
+    return energy;
+}
+
+const double3 * TwoBodyEngine::getForces() {
+    wait();
+    return forces.data();
+}
+
+void TwoBodyEngine::getForces(double3 * forces) {
+    wait();
+    std::copy(this->forces.begin(), this->forces.end(), forces);
+}
@@ -0,0 +1,110 @@
+#ifndef TWOBODYENGINE
+#define TWOBODYENGINE
+
+#include "hostVectorTypes.h"
+#include "periodicBox.h"
+#include "twobodyForceCPU.h"
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class TwoBodyEngine;
+
+// Completion handle of TwoBodyEngine::computeAsync, a plain value that allocates nothing
+class TwoBodyCompletion {
+public:
+    TwoBodyCompletion() : engine(NULL), ticket(0) {}
+
+    // Block until that computation is done, rethrows its exception if it failed
+    void wait() const;
+    bool isReady() const;
+
+private:
+    friend class TwoBodyEngine;
+    TwoBodyCompletion(TwoBodyEngine * engine, unsigned long long ticket) : engine(engine), ticket(ticket) {}
+
+    TwoBodyEngine * engine;
+    unsigned long long ticket;
+};
+
+/**
+ * Two-body evaluation of one system of water molecules across MD steps: created once for a number of
+ * molecules, then setPositions() and compute() each step, and getEnergy() / getForces().
+ * It owns everything the free evaluate_2b_cpu functions take or allocate per call: the aligned structure
+ * of arrays of the positions and the per-thread force buffers (WaterSystem), the neighbor list, the
+ * output forces, and a thread of its own with its OpenMP team for computeAsync(). After the first step
+ * nothing is allocated, and the list is only rebuilt as NeighborList decides.
+ *
+ * computeAsync() returns at once, so a driver can evaluate other force terms while the pairs are
+ * evaluated, then wait on the handle. Calling setPositions(), compute(), getEnergy() or getForces()
+ * first waits for the computation in flight, so the engine can not be changed under it.
+ * An engine is used by one driver thread at a time.
+ */
+class TwoBodyEngine {
+public:
+    // What compute() evaluates, the energy is always computed
+    enum Output { ENERGY = 1, FORCES = 2 };
+
+    // nThreads threads for the pair loop, 0 for the OpenMP default, and the skin of the neighbor list
+    TwoBodyEngine(unsigned int nMolecules,
+                  const PeriodicBox & box = makeNonPeriodicBox(),
+                  const TwoBodyPolynomial & polynomial = TwoBodyPolynomial(),
+                  int nThreads = 0,
+                  double skin = 1.0);
+    ~TwoBodyEngine();
+
+    // Copy 3*getNumMolecules() atoms ordered O, H1, H2 (OpenMM layout)
+    void setPositions(const double4* posq);
+    void setBox(const PeriodicBox & box);
+    void setDeterministic(bool deterministic);
+
+    // Evaluate on the calling thread, outputs is ENERGY or ENERGY | FORCES
+    void compute(int outputs = ENERGY | FORCES);
+
+    // Evaluate on the thread of the engine, returns immediately
+    TwoBodyCompletion computeAsync(int outputs = ENERGY | FORCES);
+
+    // Wait for the last computeAsync(), rethrows its exception if it failed
+    void wait();
+
+    double getEnergy();
+    // 3*getNumMolecules() "forces" of the last compute with FORCES, valid until the next compute.
+    // Like those of evaluate_2b_cpu they are the gradient dE/dx in kcal/mol/A: negate them for an integrator.
+    const double3 * getForces();
+    void getForces(double3 * forces);
+
+    unsigned int getNumMolecules() const { return system.getNumMolecules(); }
+    int getNumThreads() const { return nThreads; }
+    const NeighborList & getNeighborList() const { return neighbors; }
+
+private:
+    friend class TwoBodyCompletion;
+
+    TwoBodyEngine(const TwoBodyEngine &);
+    TwoBodyEngine & operator=(const TwoBodyEngine &);
+
+    void evaluate(int outputs);
+    void run();
+    void waitFor(unsigned long long ticket);
+
+    WaterSystem system;
+    NeighborList neighbors;
+    PeriodicBox box;
+    TwoBodyPolynomial polynomial;
+    int nThreads;
+    std::vector<double3, AlignedAllocator<double3> > forces;
+    double energy;
+
+    // computeAsync requests, numbered from 1. Under lock, except for the results which the request owns.
+    std::mutex lock;
+    std::condition_variable requested, completed;
+    unsigned long long submitted, done;
+    int pendingOutputs;
+    std::exception_ptr error;
+    bool stopping;
+    std::thread worker;
+};
+
+#endif
@@ -3,6 +3,8 @@
 
 #include <vector_functions.hpp>
 
+// Energy of a dimer on the GPU, posq holds its 6 atoms. forces gets the gradient of the energy dE/dx
+// on each atom, not -dE/dx, and the host code keeps this sign.
 void launch_evaluate_2b(
         const double4* __restrict__ posq,
         double3 * forces,
@@ -0,0 +1,321 @@
+#include <vector>
+#include "twobodyForceCPU.h"
+#include "twobodyForceInteraction.cu"
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+static inline int omp_get_max_threads() { return 1; }
+static inline int omp_get_thread_num() { return 0; }
+static inline int omp_get_num_threads() { return 1; }
+static inline int omp_get_active_level() { return 0; }
+static inline int omp_get_max_active_levels() { return 1; }
+#endif
+
+// Threads of a parallel region started here, requested or the OpenMP default: one when called from a parallel
+// region that already uses all the active levels, e.g. frames evaluated in parallel by score_trajectory_cpu
+static int teamSize(int requested) {
+    if (omp_get_active_level() >= omp_get_max_active_levels())
+        return 1;
+    return requested > 0 ? requested : omp_get_max_threads();
+}
+
+// Structure of arrays of the polynomial inputs of n dimers, unused lanes repeat the first dimer
+static void packBatch(const DimerTerms * dimers, const int n, double * x) {
+    for (int k = 0; k < 31; k++)
+        for (int l = 0; l < POLY_FLOAT_BATCH_SIZE; l++)
+            x[k*POLY_FLOAT_BATCH_SIZE + l] = dimers[l < n ? l : 0].exp[k];
+}
+
+// Evaluate the polynomial of n <= POLY_FLOAT_BATCH_SIZE dimers at once, then add their forces to the
+// buffer of this thread unless buffers is NULL: on the atoms of both molecules, and on the sites of each
+// molecule past the nMolecules*3 atoms, see accumulateDimerSiteForces. Returns the energy of the batch,
+// or adds it dimer by dimer to fixedEnergy in deterministic mode.
+static double evaluateBatch(
+        const DimerTerms * dimers,
+        const unsigned int (* pairs)[2],
+        const int n,
+        const unsigned int nMolecules,
+        const TwoBodyPolynomial & polynomial,
+        ForceBuffers * buffers,
+        const int thread,
+        long long * fixedEnergy) {
+
+        double x[31*POLY_FLOAT_BATCH_SIZE], g[31*POLY_FLOAT_BATCH_SIZE], e[POLY_FLOAT_BATCH_SIZE];
+        packBatch(dimers, n, x);
+
+        double batchEnergy = 0.;
+        if (buffers == NULL) {
+            {
+                STAGE_SCOPE("2b.polynomial");
+                polynomial.evaluate(x, NULL, e, n);
+            }
+            for (int l = 0; l < n; l++) {
+                if (fixedEnergy != NULL)
+                    *fixedEnergy += toFixedPoint(dimers[l].sw * e[l]);
+                else
+                    batchEnergy += dimers[l].sw * e[l];
+            }
+            return batchEnergy;
+        }
+
+        {
+            STAGE_SCOPE("2b.polynomial");
+            polynomial.evaluate(x, g, e, n);
+        }
+
+        STAGE_SCOPE("2b.gradient");
+        for (int l = 0; l < n; l++) {
+            double gl[31];
+            for (int k = 0; k < 31; k++)
+                gl[k] = g[k*POLY_FLOAT_BATCH_SIZE + l];
+
+            // O, H1, H2 of both molecules plus the 4 extra points, see the site indices in twobodyForceInteraction.cu
+            double3 pairForces[10], intra[2];
+            for (int k = 0; k < 10; k++)
+                pairForces[k] = make_double3(0.);
+
+            double dimerEnergy = accumulateDimerSiteForces(dimers + l, e[l], gl, pairForces, intra);
+            if (fixedEnergy != NULL)
+                *fixedEnergy += toFixedPoint(dimerEnergy);
+            else
+                batchEnergy += dimerEnergy;
+
+            const unsigned int a = pairs[l][0], b = pairs[l][1];
+            for (int k = 0; k < 3; k++) {
+                buffers->add(thread, 3*a + k, pairForces[Oa + k]);
+                buffers->add(thread, 3*b + k, pairForces[Ob + k]);
+            }
+            const unsigned int sitesA = 3*nMolecules + MOLECULE_SITES*a, sitesB = 3*nMolecules + MOLECULE_SITES*b;
+            buffers->add(thread, sitesA + MOLECULE_X1, pairForces[Xa1]);
+            buffers->add(thread, sitesA + MOLECULE_X2, pairForces[Xa2]);
+            buffers->add(thread, sitesA + MOLECULE_INTRA, intra[0]);
+            buffers->add(thread, sitesB + MOLECULE_X1, pairForces[Xb1]);
+            buffers->add(thread, sitesB + MOLECULE_X2, pairForces[Xb2]);
+            buffers->add(thread, sitesB + MOLECULE_INTRA, intra[1]);
+        }
+        return batchEnergy;
+}
+
+void evaluate_2b_cpu(
+        WaterSystem & system,
+        double3 * forces,
+        double * energy,
+        NeighborList & neighbors,
+        const PeriodicBox & box,
+        const TwoBodyPolynomial & polynomial,
+        int nThreads) {
+
+        STAGE_SPAN("2b.evaluate");
+        const unsigned int nMolecules = system.getNumMolecules();
+        {
+            STAGE_SPAN("2b.neighbors");
+            neighbors.update(system, box);
+        }
+        const unsigned int * offsets = neighbors.offsets().data();
+        const unsigned int * list = neighbors.neighbors().data();
+        const double * x = system.x();
+        const double * y = system.y();
+        const double * z = system.z();
+        MoleculeTerms * molecules = system.getMoleculeTerms().data();
+        double3 * siteForces = system.getSiteForces().data();
+
+        ForceBuffers & buffers = system.getForceBuffers();
+        nThreads = teamSize(nThreads);
+        if (forces != NULL)
+            buffers.resize((3 + MOLECULE_SITES)*nMolecules, nThreads);
+        const bool deterministic = system.isDeterministic();
+
+        double tempEnergy = 0.;
+        long long fixedEnergy = 0;
+
+        #pragma omp parallel num_threads(nThreads) reduction(+:tempEnergy, fixedEnergy)
+        {
+            // each thread adds its pairs to its own buffer, then all of them sum the buffers atom by atom
+            const int thread = omp_get_thread_num();
+            ForceBuffers * threadBuffers = NULL;
+            if (forces != NULL) {
+                buffers.clear(thread);
+                threadBuffers = &buffers;
+            }
+            long long * threadFixedEnergy = deterministic ? &fixedEnergy : NULL;
+
+            // the extra points and intramolecular variables of each molecule, shared by all its dimers
+            {
+                STAGE_SPAN("2b.molecules");
+                #pragma omp for schedule(static)
+                for (int i = 0; i < (int)nMolecules; i++) {
+                    double3 atoms[3];
+                    for (int k = 0; k < 3; k++)
+                        atoms[k] = make_double3(x[3*i + k], y[3*i + k], z[3*i + k]);
+                    computeMoleculeTerms(atoms, molecules + i);
+                }
+            }
+
+            // each thread collects the dimers within the cutoff and evaluates their polynomials in batches
+            {
+                STAGE_SPAN("2b.pairs");
+                DimerTerms dimers[POLY_FLOAT_BATCH_SIZE];
+                unsigned int pairs[POLY_FLOAT_BATCH_SIZE][2];
+                int n = 0;
+
+                // The list holds each pair once, so rows get shorter as i grows, dynamic scheduling keeps the threads balanced
+                #pragma omp for schedule(dynamic, 16) nowait
+                for (int i = 0; i < (int)nMolecules; i++) {
+                    for (unsigned int p = offsets[i]; p < offsets[i+1]; p++) {
+                        const unsigned int j = list[p];
+
+                        // pairs in the skin are beyond r2f
+                        if (!computeCachedDimerTerms(molecules + i, molecules + j, box, dimers + n))
+                            continue;
+                        pairs[n][0] = i;
+                        pairs[n][1] = j;
+
+                        if (++n == POLY_FLOAT_BATCH_SIZE) {
+                            tempEnergy += evaluateBatch(dimers, pairs, n, nMolecules, polynomial, threadBuffers, thread,
+                                                        threadFixedEnergy);
+                            n = 0;
+                        }
+                    }
+                }
+
+                if (n > 0)
+                    tempEnergy += evaluateBatch(dimers, pairs, n, nMolecules, polynomial, threadBuffers, thread,
+                                                threadFixedEnergy);
+            }
+
+            if (forces != NULL) {
+                #pragma omp barrier
+                STAGE_SPAN("2b.reduce");
+                buffers.reduce(siteForces, omp_get_num_threads());
+
+                // then the extra points and intramolecular gradients to the atoms, once per molecule
+                #pragma omp for schedule(static)
+                for (int i = 0; i < (int)nMolecules; i++)
+                    distributeMoleculeForces(molecules + i, siteForces + 3*i,
+                                             siteForces + 3*nMolecules + MOLECULE_SITES*i, forces + 3*i);
+            }
+        }
+
+        energy[0] = deterministic ? fromFixedPoint(fixedEnergy) : tempEnergy;
+}
+
+void evaluate_2b_cpu(
+        const double4* __restrict__ posq,
+        double3 * forces,
+        double * energy,
+        const unsigned int nMolecules,
+        NeighborList & neighbors,
+        const PeriodicBox & box,
+        const TwoBodyPolynomial & polynomial) {
+
+        WaterSystem system(posq, nMolecules);
+        evaluate_2b_cpu(system, forces, energy, neighbors, box, polynomial);
+}
+
+void evaluate_2b_cpu(
+        const double4* __restrict__ posq,
+        double3 * forces,
+        double * energy,
+        const unsigned int nMolecules,
+        NeighborList & neighbors,
+        const PeriodicBox & box) {
+
+        static const TwoBodyPolynomial mbpol;
+        evaluate_2b_cpu(posq, forces, energy, nMolecules, neighbors, box, mbpol);
+}
+
+void evaluate_2b_cpu(
+        const double4* __restrict__ posq,
+        double3 * forces,
+        double * energy,
+        const unsigned int nMolecules) {
+
+        NeighborList neighbors(0.);
+        evaluate_2b_cpu(posq, forces, energy, nMolecules, neighbors);
+}
+
+// Energy differences of n dimers between two polynomials
+static void compareBatch(
+        const DimerTerms * dimers,
+        const int n,
+        const TwoBodyPolynomial & polynomial,
+        const TwoBodyPolynomial & reference,
+        double & maxError,
+        double & sumSquares) {
+
+        double x[31*POLY_FLOAT_BATCH_SIZE], e[POLY_FLOAT_BATCH_SIZE], eReference[POLY_FLOAT_BATCH_SIZE];
+        packBatch(dimers, n, x);
+        polynomial.evaluate(x, NULL, e, n);
+        reference.evaluate(x, NULL, eReference, n);
+
+        for (int l = 0; l < n; l++) {
+            double error = fabs(dimers[l].sw * (e[l] - eReference[l]));
+            maxError = fmax(maxError, error);
+            sumSquares += error*error;
+        }
+}
+
+PolynomialErrors compare_2b_cpu(
+        const double4* __restrict__ posq,
+        const unsigned int nMolecules,
+        NeighborList & neighbors,
+        const PeriodicBox & box,
+        const TwoBodyPolynomial & polynomial,
+        const TwoBodyPolynomial & reference) {
+
+        PolynomialErrors errors;
+
+        // whole system, also updates the list for the loop below
+        WaterSystem system(posq, nMolecules);
+        const int nAtoms = 3*nMolecules;
+        std::vector<double3> gradient(nAtoms), referenceGradient(nAtoms);
+        double energy, referenceEnergy;
+        evaluate_2b_cpu(system, gradient.data(), &energy, neighbors, box, polynomial);
+        evaluate_2b_cpu(system, referenceGradient.data(), &referenceEnergy, neighbors, box, reference);
+        errors.totalEnergyError = fabs(energy - referenceEnergy);
+
+        double maxError = 0., sumSquares = 0.;
+        for (int i = 0; i < nAtoms; i++) {
+            double3 d = gradient[i] - referenceGradient[i];
+            maxError = fmax(maxError, fmax(fabs(d.x), fmax(fabs(d.y), fabs(d.z))));
+            sumSquares += dot(d, d);
+        }
+        errors.maxGradientError = maxError;
+        errors.rmsGradientError = nAtoms > 0 ? sqrt(sumSquares/(3*nAtoms)) : 0.;
+
+        // dimer by dimer, from the molecule terms of the evaluations above
+        const unsigned int * offsets = neighbors.offsets().data();
+        const unsigned int * list = neighbors.neighbors().data();
+        const MoleculeTerms * molecules = system.getMoleculeTerms().data();
+        unsigned int nDimers = 0;
+        maxError = sumSquares = 0.;
+
+        #pragma omp parallel reduction(+:nDimers, sumSquares) reduction(max:maxError)
+        {
+            DimerTerms dimers[POLY_FLOAT_BATCH_SIZE];
+            int n = 0;
+
+            #pragma omp for schedule(dynamic, 16) nowait
+            for (int i = 0; i < (int)nMolecules; i++) {
+                for (unsigned int p = offsets[i]; p < offsets[i+1]; p++) {
+                    if (!computeCachedDimerTerms(molecules + i, molecules + list[p], box, dimers + n))
+                        continue;
+                    nDimers++;
+
+                    if (++n == POLY_FLOAT_BATCH_SIZE) {
+                        compareBatch(dimers, n, polynomial, reference, maxError, sumSquares);
+                        n = 0;
+                    }
+                }
+            }
+
+            if (n > 0)
+                compareBatch(dimers, n, polynomial, reference, maxError, sumSquares);
+        }
+
+        errors.nDimers = nDimers;
+        errors.maxEnergyError = maxError;
+        errors.rmsEnergyError = nDimers > 0 ? sqrt(sumSquares/nDimers) : 0.;
+        return errors;
+}
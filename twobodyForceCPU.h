@@ -0,0 +1,80 @@
+#ifndef TWOBODYFORCECPU
+#define TWOBODYFORCECPU
+
+#include "hostVectorTypes.h"
+#include "twobodyNeighborList.h"
+#include "twobodySystem.h"
+#include "twobodyForcePolynomial.h"
+
+// Host version of launch_evaluate_2b for a whole system of water molecules.
+// posq holds 3*nMolecules atoms, ordered O, H1, H2 for each molecule (OpenMM convention, w is the charge).
+// The pairs of the neighbor list are evaluated in parallel with OpenMP, the list is updated first
+// and only rebuilt once some molecule moved more than half its skin.
+// With a periodic box each pair is taken at the O-O minimum image, positions do not need to be wrapped.
+// forces (3*nMolecules entries) and energy are overwritten. As in launch_evaluate_2b, forces gets the
+// gradient of the energy dE/dx in kcal/mol/A, the opposite of the physical forces.
+// If forces is NULL only the energy is computed, skipping all the gradient work, e.g. for Monte Carlo
+// moves or scans.
+void evaluate_2b_cpu(
+        const double4* __restrict__ posq,
+        double3 * forces,
+        double * energy,
+        const unsigned int nMolecules,
+        NeighborList & neighbors,
+        const PeriodicBox & box = makeNonPeriodicBox());
+
+// Same, with another polynomial than the MB-pol one in double precision, e.g. refitted
+// coefficients or TwoBodyPolynomial::MIXED_PRECISION, forces gets dE/dx as well
+void evaluate_2b_cpu(
+        const double4* __restrict__ posq,
+        double3 * forces,
+        double * energy,
+        const unsigned int nMolecules,
+        NeighborList & neighbors,
+        const PeriodicBox & box,
+        const TwoBodyPolynomial & polynomial);
+
+// Same on a system stored as structures of arrays, which a driver keeps across steps: a first pass computes
+// the extra points and intramolecular terms of each molecule, the pair loop reads them and each thread adds
+// its forces to its own buffer of the system, the buffers are summed in parallel at the end, without atomics,
+// and the forces on the extra points and intramolecular terms are moved to the atoms once per molecule.
+// Here too the "forces" are the gradient dE/dx.
+// The evaluate_2b_cpu above copy posq into a temporary WaterSystem.
+// With system.setDeterministic(true) forces and energy are accumulated in 64 bit fixed point and are
+// bitwise identical for any number of threads.
+// nThreads threads run the pair loop, 0 for the OpenMP default (see TwoBodyEngine for a driver object).
+void evaluate_2b_cpu(
+        WaterSystem & system,
+        double3 * forces,
+        double * energy,
+        NeighborList & neighbors,
+        const PeriodicBox & box,
+        const TwoBodyPolynomial & polynomial,
+        int nThreads = 0);
+
+// Same, with a list built for this call only, forces gets dE/dx
+void evaluate_2b_cpu(
+        const double4* __restrict__ posq,
+        double3 * forces,
+        double * energy,
+        const unsigned int nMolecules);
+
+// Errors of a polynomial against a reference one, usually the same coefficients in double precision
+typedef struct {
+    unsigned int nDimers;                       // dimers within the cutoff
+    double maxEnergyError, rmsEnergyError;      // per dimer, switch included
+    double maxGradientError, rmsGradientError;  // per component of the gradient on the atoms
+    double totalEnergyError;                    // of the two-body energy of the system
+} PolynomialErrors;
+
+// Evaluate the system with both polynomials and compare them dimer by dimer, e.g. to check that
+// mixed precision is accurate enough for a given system before using it.
+PolynomialErrors compare_2b_cpu(
+        const double4* __restrict__ posq,
+        const unsigned int nMolecules,
+        NeighborList & neighbors,
+        const PeriodicBox & box,
+        const TwoBodyPolynomial & polynomial,
+        const TwoBodyPolynomial & reference);
+
+#endif
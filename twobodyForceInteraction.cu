@@ -0,0 +1,465 @@
+/**
+ * Two-body MB-pol interaction between a pair of water molecules.
+ *
+ * These functions are shared by the CUDA kernel (twobodyForce.cu) and the host engine (twobodyForceCPU.cpp),
+ * include hostVectorTypes.h before including this file.
+ */
+
+#include "periodicBox.h"
+#include "vectorOps.cu"
+#ifdef __CUDACC__
+#include "twobodyForcePolynomialCoefficients.cu"
+#include "twobodyForcePolynomial.cu"
+#else
+#include "twobodyForcePolynomial.h"
+#endif
+#include "twobodyForceInteraction.h"
+#include "stageTrace.h"
+
+#define k_HH_intra -6.480884773303821e-01 // A^(-1)
+#define k_OH_intra  1.674518993682975e+00 // A^(-1)
+#define k_HH_coul 1.148231864355956e+00 // A^(-1)
+#define k_OH_coul 1.205989761123099e+00 // A^(-1)
+#define k_OO_coul 1.395357065790959e+00 // A^(-1)
+#define k_XH_main 7.347036852042255e-01 // A^(-1)
+#define k_XO_main 7.998249864422826e-01 // A^(-1)
+#define k_XX_main 7.960663960630585e-01 // A^(-1)
+#define in_plane_gamma  -9.721486914088159e-02
+#define out_of_plane_gamma  9.859272078406150e-02
+#define r2i 4.500000000000000e+00 // A
+#define r2f 6.500000000000000e+00 // A
+#define d_intra 1.0
+#define d_inter 4.0
+
+extern "C" __device__ void computeExtraPoint(double3 * O, double3 * H1, double3 * H2, double3 * X1, double3 * X2) {
+    // the host engine calls this once per molecule, the per pair GPU path through computeInteraction and the
+    // dimer features of twobodyNNFeatures.cpp still recompute oh1 and oh2 for every pair
+    double3 oh1 = *H1 - *O;
+    double3 oh2 = *H2 - *O;
+
+    double3 v = cross(oh1, oh2);
+    double3 in_plane = (*O) + (oh1 + oh2) * 0.5 * in_plane_gamma;
+    double3 out_of_plane = v * out_of_plane_gamma;
+
+    *X1 = in_plane + out_of_plane;
+    *X2 = in_plane - out_of_plane;
+}
+
+extern "C" __device__ void computeExp(double r0, double k, double3 * O1, double3 * O2, double * exp1, double3 * g) {
+    *g = *O1 - *O2;
+
+    double r = sqrt(dot(*g, *g));
+    *exp1 = exp(k*(r0 - r));
+    *g *= -k * (*exp1) / r;
+}
+
+extern "C" __device__ void computeCoul(double r0, double k, double3 * O1, double3 * O2, double * val, double3 * g) {
+    *g = *O1 - *O2;
+
+    double r = sqrt(dot(*g, *g));
+    double exp1 = exp(k * (r0 - r));
+    double rinv = 1.0/r;
+    *val = exp1*rinv;
+    *g *=  - (k + rinv) * (*val) * rinv;
+}
+
+extern "C" __device__ void computeGrads(const double * g, const double3 * gOO, double3 * force1, double3 * force2, double sw) {
+
+    double3 d = *g * (*gOO);
+    *force1 += sw * d;
+    *force2 -= sw * d;
+}
+
+extern "C" __device__ void distributeXpointGrad(const double3 * O, const double3 * H1, const double3 * H2, double3 * forceX1, double3 * forceX2, double3 * forceO, double3 * forceH1, double3 * forceH2, double sw) {
+
+    // once per molecule on the host, per pair on the GPU path through computeInteraction and for the NN features
+    double3 oh1 = *H1 - *O;
+    double3 oh2 = *H2 - *O;
+
+    double3 gm = *forceX1-*forceX2;
+
+    double3 t1 = cross(oh2, gm);
+
+    double3 t2 = cross(oh1, gm);
+
+    double3 gsum = *forceX1 + *forceX2;
+    double3 in_plane = gsum*0.5*in_plane_gamma;
+
+    double3 gh1 = in_plane + t1*out_of_plane_gamma;
+    double3 gh2 = in_plane - t2*out_of_plane_gamma;
+
+    *forceO +=  sw * (gsum - (gh1 + gh2)); // O
+    *forceH1 += sw * gh1; // H1
+    *forceH2 += sw * gh2; // H2
+
+}
+
+extern "C" __device__ void evaluateSwitchFunc(double r, double * sw, double * gsw) {
+
+    if (r > r2f) {
+        *gsw = 0.0;
+        *sw  = 0.0;
+    } else if (r > r2i) {
+        double t1 = M_PI/(r2f - r2i);
+        double x = (r - r2i)*t1;
+        *gsw = - sin(x)*t1/2.0;
+        *sw  = (1.0 + cos(x))/2.0;
+    } else {
+        *gsw = 0.0;
+        *sw = 1.0;
+    }
+}
+
+// The 31 variables of the polynomial and their gradients along the site-site vectors,
+// from the 10 sites of a dimer (extra points included)
+extern "C" __device__ void computeDimerVariables(
+        double3 * positions,
+        double * exp,
+        double3 * gOO) {
+                    int i = 0;
+                    computeExp(d_intra, k_HH_intra, positions +Ha1, positions +Ha2, exp+i, gOO+i); i++;
+                    computeExp(d_intra, k_HH_intra, positions +Hb1, positions +Hb2, exp+i, gOO+i); i++;
+                    computeExp(d_intra, k_OH_intra, positions +Oa,  positions +Ha1, exp+i, gOO+i); i++;
+                    computeExp(d_intra, k_OH_intra, positions +Oa,  positions +Ha2, exp+i, gOO+i); i++;
+                    computeExp(d_intra, k_OH_intra, positions +Ob,  positions +Hb1, exp+i, gOO+i); i++;
+                    computeExp(d_intra, k_OH_intra, positions +Ob,  positions +Hb2, exp+i, gOO+i); i++;
+                    computeInterVariables(positions, exp, gOO);
+}
+
+// Variables 6 to 30, those between the two waters, into the same arrays as computeDimerVariables
+extern "C" __device__ void computeInterVariables(
+        double3 * positions,
+        double * exp,
+        double3 * gOO) {
+                    int i = 6;
+                    computeCoul(d_inter, k_HH_coul, positions +Ha1, positions +Hb1, exp+i, gOO+i); i++;
+                    computeCoul(d_inter, k_HH_coul, positions +Ha1, positions +Hb2, exp+i, gOO+i); i++;
+                    computeCoul(d_inter, k_HH_coul, positions +Ha2, positions +Hb1, exp+i, gOO+i); i++;
+                    computeCoul(d_inter, k_HH_coul, positions +Ha2, positions +Hb2, exp+i, gOO+i); i++;
+                    computeCoul(d_inter, k_OH_coul, positions +Oa,  positions +Hb1, exp+i, gOO+i); i++;
+                    computeCoul(d_inter, k_OH_coul, positions +Oa,  positions +Hb2, exp+i, gOO+i); i++;
+                    computeCoul(d_inter, k_OH_coul, positions +Ob,  positions +Ha1, exp+i, gOO+i); i++;
+                    computeCoul(d_inter, k_OH_coul, positions +Ob,  positions +Ha2, exp+i, gOO+i); i++;
+                    computeCoul(d_inter, k_OO_coul, positions +Oa,  positions +Ob , exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XH_main,  positions +Xa1, positions +Hb1, exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XH_main,  positions +Xa1, positions +Hb2, exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XH_main,  positions +Xa2, positions +Hb1, exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XH_main,  positions +Xa2, positions +Hb2, exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XH_main,  positions +Xb1, positions +Ha1, exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XH_main,  positions +Xb1, positions +Ha2, exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XH_main,  positions +Xb2, positions +Ha1, exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XH_main,  positions +Xb2, positions +Ha2, exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XO_main,  positions +Oa , positions +Xb1, exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XO_main,  positions +Oa , positions +Xb2, exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XO_main,  positions +Ob , positions +Xa1, exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XO_main,  positions +Ob , positions +Xa2, exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XX_main,  positions +Xa1, positions +Xb1, exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XX_main,  positions +Xa1, positions +Xb2, exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XX_main,  positions +Xa2, positions +Xb1, exp+i, gOO+i); i++;
+                    computeExp(d_inter, k_XX_main,  positions +Xa2, positions +Xb2, exp+i, gOO+i); i++;
+}
+
+// Sites and intramolecular variables of one water from its atoms O, H1, H2, for computeCachedDimerTerms
+extern "C" __device__ void computeMoleculeTerms(
+        const double3 * atoms,
+        MoleculeTerms * molecule) {
+                    double3 * sites = molecule->sites;
+                    for (int i = 0; i < 3; i++)
+                        sites[i] = atoms[i];
+                    computeExtraPoint(sites + 0, sites + 1, sites + 2, sites + 3, sites + 4);
+
+                    // H-H, O-H1, O-H2 as in computeDimerVariables
+                    computeExp(d_intra, k_HH_intra, sites + 1, sites + 2, molecule->exp + 0, molecule->gOO + 0);
+                    computeExp(d_intra, k_OH_intra, sites + 0, sites + 1, molecule->exp + 1, molecule->gOO + 1);
+                    computeExp(d_intra, k_OH_intra, sites + 0, sites + 2, molecule->exp + 2, molecule->gOO + 2);
+}
+
+// Atoms of the two waters from posq (OpenMM layout)
+extern "C" __device__ void loadDimerPositions(
+        const unsigned int atom1,
+        const unsigned int atom2,
+        const double4* __restrict__ posq,
+        double3 * positions) {
+                    for (int i = 0; i < 3; i++) {
+                        positions[Oa + i] = make_double3( posq[atom1+i].x,
+                                                        posq[atom1+i].y,
+                                                        posq[atom1+i].z);
+                        positions[Ob + i] = make_double3( posq[atom2+i].x,
+                                                        posq[atom2+i].y,
+                                                        posq[atom2+i].z);
+                    }
+}
+
+// Same from structures of arrays, where the 3 atoms of a water are consecutive in each array
+extern "C" __device__ void loadDimerPositionsSoA(
+        const unsigned int atom1,
+        const unsigned int atom2,
+        const double* __restrict__ x,
+        const double* __restrict__ y,
+        const double* __restrict__ z,
+        double3 * positions) {
+                    for (int i = 0; i < 3; i++) {
+                        positions[Oa + i] = make_double3(x[atom1+i], y[atom1+i], z[atom1+i]);
+                        positions[Ob + i] = make_double3(x[atom2+i], y[atom2+i], z[atom2+i]);
+                    }
+}
+
+// Dimers interact if the O-O distance is within [2, r2f]
+static __device__ bool dimerInteracts(const double rOO) {
+                    if ((rOO > r2f) || (rOO < 2.)) {
+                        STAGE_COUNT("2b.pairs_outside", 1);
+                        return false;
+                    }
+                    STAGE_COUNT("2b.pairs_inside", 1);
+                    if (rOO > r2i)
+                        STAGE_COUNT("2b.pairs_switching", 1);
+                    return true;
+}
+
+// The rest of the dimer once the atoms are in dimer->positions.
+// Returns false if the O-O distance is out of [2, r2f], then the dimer does not interact
+extern "C" __device__ bool computeLoadedDimerTerms(
+        const PeriodicBox box,
+        DimerTerms * dimer) {
+                    double3 * positions = dimer->positions;
+
+                    double3 delta = make_double3(positions[Ob].x-positions[Oa].x, positions[Ob].y-positions[Oa].y, positions[Ob].z-positions[Oa].z);
+
+                    // move the second water next to the first one by the O-O minimum image shift,
+                    // then all the site-site distances below are right without wrapping each of them
+                    if (box.periodic) {
+                        double3 shift = minimumImage(box, delta) - delta;
+                        for (int i = 0; i < 3; i++)
+                            positions[Ob + i] += shift;
+                        delta += shift;
+                    }
+                    double r2 = delta.x*delta.x + delta.y*delta.y + delta.z*delta.z;
+                    double invR = rsqrt(r2);
+                    double rOO = r2*invR;
+
+                    if (!dimerInteracts(rOO))
+                        return false;
+
+                    {
+                        STAGE_SCOPE("2b.extra_points");
+                        computeExtraPoint(positions + Oa, positions + Ha1, positions + Ha2,
+                               positions + Xa1, positions + Xa2);
+                        computeExtraPoint(positions + Ob, positions + Hb1, positions + Hb2,
+                                positions + Xb1, positions + Xb2);
+                    }
+
+                    {
+                        STAGE_SCOPE("2b.variables");
+                        computeDimerVariables(positions, dimer->exp, dimer->gOO);
+                    }
+
+                    // stored after the calls: on the host the compiler merges these stores into one AVX
+                    // register and, before the calls, could leave its upper half dirty for the SSE code
+                    // of the math library, which then ran the 31 exp() about 20 times slower
+                    dimer->delta = delta;
+                    dimer->rOO = rOO;
+                    STAGE_SCOPE("2b.switch");
+                    evaluateSwitchFunc(rOO, &dimer->sw, &dimer->gsw);
+
+                    return true;
+}
+
+// Returns false if the O-O distance is out of [2, r2f], then the dimer does not interact
+extern "C" __device__ bool computeDimerTerms(
+        const unsigned int atom1,
+        const unsigned int atom2,
+        const double4* __restrict__ posq,
+        const PeriodicBox box,
+        DimerTerms * dimer) {
+                    loadDimerPositions(atom1, atom2, posq, dimer->positions);
+                    return computeLoadedDimerTerms(box, dimer);
+}
+
+// Same as computeLoadedDimerTerms from the terms of the two waters computed beforehand, which leaves only the
+// 25 variables between them per dimer. The sites of b are moved to the O-O minimum image of a.
+extern "C" __device__ bool computeCachedDimerTerms(
+        const MoleculeTerms * a,
+        const MoleculeTerms * b,
+        const PeriodicBox box,
+        DimerTerms * dimer) {
+                    double3 * positions = dimer->positions;
+
+                    double3 delta = b->sites[0] - a->sites[0];
+                    double3 shift = make_double3(0., 0., 0.);
+                    if (box.periodic) {
+                        shift = minimumImage(box, delta) - delta;
+                        delta += shift;
+                    }
+                    double r2 = delta.x*delta.x + delta.y*delta.y + delta.z*delta.z;
+                    double invR = rsqrt(r2);
+                    double rOO = r2*invR;
+
+                    if (!dimerInteracts(rOO))
+                        return false;
+
+                    for (int i = 0; i < 3; i++) {
+                        positions[Oa + i] = a->sites[i];
+                        positions[Ob + i] = b->sites[i] + shift;
+                    }
+                    positions[Xa1] = a->sites[3];
+                    positions[Xa2] = a->sites[4];
+                    positions[Xb1] = b->sites[3] + shift;
+                    positions[Xb2] = b->sites[4] + shift;
+
+                    // variables 0 to 5 in the order of computeDimerVariables
+                    const int intraA[3] = {0, 2, 3}, intraB[3] = {1, 4, 5};
+                    for (int i = 0; i < 3; i++) {
+                        dimer->exp[intraA[i]] = a->exp[i];
+                        dimer->gOO[intraA[i]] = a->gOO[i];
+                        dimer->exp[intraB[i]] = b->exp[i];
+                        dimer->gOO[intraB[i]] = b->gOO[i];
+                    }
+
+                    {
+                        STAGE_SCOPE("2b.variables");
+                        computeInterVariables(positions, dimer->exp, dimer->gOO);
+                    }
+
+                    // stored after the call, see computeLoadedDimerTerms
+                    dimer->delta = delta;
+                    dimer->rOO = rOO;
+                    STAGE_SCOPE("2b.switch");
+                    evaluateSwitchFunc(rOO, &dimer->sw, &dimer->gsw);
+
+                    return true;
+}
+
+// Forces of the dimer energy on its 10 sites, given the polynomial gradients g, except for the parts that
+// only depend on one water: the forces on the extra points are not distributed to the atoms, and the
+// switched gradients of the intramolecular variables are returned in intra, (H-H, O-H1, O-H2) of water a
+// then b, unless intra is NULL. Returns the switched energy.
+extern "C" __device__ double accumulateDimerSiteForces(
+        const DimerTerms * dimer,
+        const double tempEnergy,
+        const double * g,
+        double3 * forces,
+        double3 * intra) {
+                    const double3 * gOO = dimer->gOO;
+                    const double sw = dimer->sw;
+
+                    computeGrads(g+6,  gOO+6,  forces + Ha1, forces + Hb1, sw);
+                    computeGrads(g+7,  gOO+7,  forces + Ha1, forces + Hb2, sw);
+                    computeGrads(g+8,  gOO+8,  forces + Ha2, forces + Hb1, sw);
+                    computeGrads(g+9,  gOO+9,  forces + Ha2, forces + Hb2, sw);
+                    computeGrads(g+10, gOO+10, forces + Oa , forces + Hb1, sw);
+                    computeGrads(g+11, gOO+11, forces + Oa , forces + Hb2, sw);
+                    computeGrads(g+12, gOO+12, forces + Ob , forces + Ha1, sw);
+                    computeGrads(g+13, gOO+13, forces + Ob , forces + Ha2, sw);
+                    computeGrads(g+14, gOO+14, forces + Oa , forces + Ob , sw);
+                    computeGrads(g+15, gOO+15, forces + Xa1, forces + Hb1, sw);
+                    computeGrads(g+16, gOO+16, forces + Xa1, forces + Hb2, sw);
+                    computeGrads(g+17, gOO+17, forces + Xa2, forces + Hb1, sw);
+                    computeGrads(g+18, gOO+18, forces + Xa2, forces + Hb2, sw);
+                    computeGrads(g+19, gOO+19, forces + Xb1, forces + Ha1, sw);
+                    computeGrads(g+20, gOO+20, forces + Xb1, forces + Ha2, sw);
+                    computeGrads(g+21, gOO+21, forces + Xb2, forces + Ha1, sw);
+                    computeGrads(g+22, gOO+22, forces + Xb2, forces + Ha2, sw);
+                    computeGrads(g+23, gOO+23, forces + Oa , forces + Xb1, sw);
+                    computeGrads(g+24, gOO+24, forces + Oa , forces + Xb2, sw);
+                    computeGrads(g+25, gOO+25, forces + Ob , forces + Xa1, sw);
+                    computeGrads(g+26, gOO+26, forces + Ob , forces + Xa2, sw);
+                    computeGrads(g+27, gOO+27, forces + Xa1, forces + Xb1, sw);
+                    computeGrads(g+28, gOO+28, forces + Xa1, forces + Xb2, sw);
+                    computeGrads(g+29, gOO+29, forces + Xa2, forces + Xb1, sw);
+                    computeGrads(g+30, gOO+30, forces + Xa2, forces + Xb2, sw);
+
+                    // gradient of the switch, delta points from Oa to Ob
+                    double gsw = dimer->gsw * tempEnergy/dimer->rOO;
+                    double3 d = gsw * dimer->delta;
+                    forces[Oa] -= d;
+                    forces[Ob] += d;
+
+                    if (intra != NULL) {
+                        intra[0] = sw * make_double3(g[0], g[2], g[3]);
+                        intra[1] = sw * make_double3(g[1], g[4], g[5]);
+                    }
+                    return sw * tempEnergy;
+}
+
+// Add the gradients of the dimer energy e, given the polynomial gradients g, to forces (10 sites as in
+// positions) and return the switched energy
+extern "C" __device__ double accumulateDimerForces(
+        const DimerTerms * dimer,
+        const double tempEnergy,
+        const double * g,
+        double3 * forces) {
+                    const double3 * positions = dimer->positions;
+                    const double3 * gOO = dimer->gOO;
+                    const double sw = dimer->sw;
+
+                    computeGrads(g+0,  gOO+0,  forces + Ha1, forces + Ha2, sw);
+                    computeGrads(g+1,  gOO+1,  forces + Hb1, forces + Hb2, sw);
+                    computeGrads(g+2,  gOO+2,  forces + Oa , forces + Ha1, sw);
+                    computeGrads(g+3,  gOO+3,  forces + Oa , forces + Ha2, sw);
+                    computeGrads(g+4,  gOO+4,  forces + Ob , forces + Hb1, sw);
+                    computeGrads(g+5,  gOO+5,  forces + Ob , forces + Hb2, sw);
+                    double energy = accumulateDimerSiteForces(dimer, tempEnergy, g, forces, NULL);
+
+                    // the extra point gradients already carry the switch from computeGrads
+                    distributeXpointGrad(positions + Oa, positions + Ha1, positions + Ha2,
+                            forces + Xa1, forces + Xa2,
+                            forces + Oa, forces + Ha1, forces + Ha2, 1.);
+
+                    distributeXpointGrad(positions + Ob, positions + Hb1, positions + Hb2,
+                            forces + Xb1, forces + Xb2,
+                            forces + Ob, forces + Hb1, forces + Hb2, 1.);
+
+                    return energy;
+}
+
+// The other half of accumulateDimerSiteForces, once per water: the forces on its 3 atoms from those summed
+// over all its dimers on the atoms (atomForces), and on its extra points and intramolecular variables
+// (siteForces, MOLECULE_SITES entries as laid out by MOLECULE_X1, MOLECULE_X2 and MOLECULE_INTRA)
+extern "C" __device__ void distributeMoleculeForces(
+        const MoleculeTerms * molecule,
+        const double3 * atomForces,
+        const double3 * siteForces,
+        double3 * forces) {
+                    const double3 * sites = molecule->sites;
+                    const double3 intra = siteForces[MOLECULE_INTRA];
+                    double3 forceX1 = siteForces[MOLECULE_X1];
+                    double3 forceX2 = siteForces[MOLECULE_X2];
+
+                    for (int i = 0; i < 3; i++)
+                        forces[i] = atomForces[i];
+                    computeGrads(&intra.x, molecule->gOO + 0, forces + 1, forces + 2, 1.);
+                    computeGrads(&intra.y, molecule->gOO + 1, forces + 0, forces + 1, 1.);
+                    computeGrads(&intra.z, molecule->gOO + 2, forces + 0, forces + 2, 1.);
+
+                    distributeXpointGrad(sites + 0, sites + 1, sites + 2, &forceX1, &forceX2,
+                            forces + 0, forces + 1, forces + 2, 1.);
+}
+
+extern "C" __device__ double computeInteraction(
+        const unsigned int atom1,
+        const unsigned int atom2,
+        const double4* __restrict__ posq,
+        double3 * forces,
+        const PeriodicBox box) {
+                    DimerTerms dimer;
+                    if (!computeDimerTerms(atom1, atom2, posq, box, &dimer))
+                        return 0.;
+
+                    double g[31];
+                    double tempEnergy = poly_2b_v6x_eval<double, true>(poly_2b_v6x_coefficients, dimer.exp, g);
+
+                    return accumulateDimerForces(&dimer, tempEnergy, g, forces);
+}
+
+// Same as computeInteraction without any of the gradient work, for energy only evaluations
+extern "C" __device__ double computeInteractionEnergy(
+        const unsigned int atom1,
+        const unsigned int atom2,
+        const double4* __restrict__ posq,
+        const PeriodicBox box) {
+                    DimerTerms dimer;
+                    if (!computeDimerTerms(atom1, atom2, posq, box, &dimer))
+                        return 0.;
+
+                    return dimer.sw * poly_2b_v6x_eval<double, false>(poly_2b_v6x_coefficients, dimer.exp, NULL);
+}
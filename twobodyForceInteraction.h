@@ -0,0 +1,88 @@
+#ifndef TWOBODYFORCEINTERACTION
+#define TWOBODYFORCEINTERACTION
+
+#include "hostVectorTypes.h"
+#include "periodicBox.h"
+
+// Types and declarations of twobodyForceInteraction.cu, for host code that calls the pieces of the
+// interaction on their own (e.g. benchmark_2b.cpp) while the definitions are compiled in the engine.
+
+typedef struct {
+    double x, y, z;
+    double fx, fy, fz;
+} AtomData;
+
+#define CAL2JOULE 4.184
+#define Oa  0
+#define Ha1 1
+#define Ha2 2
+#define Ob  3
+#define Hb1 4
+#define Hb2 5
+#define Xa1 6
+#define Xa2 7
+#define Xb1 8
+#define Xb2 9
+
+// Geometry of a dimer inside the cutoff: the sites, the switch and the 31 variables of the polynomial
+// with their gradients. Everything computeInteraction needs around the call to the polynomial,
+// so that the host engine can evaluate the polynomial of several dimers at once.
+typedef struct {
+    // 2 water molecules and extra positions, the second water at the O-O minimum image
+    double3 positions[10];
+    double3 delta;
+    double rOO, sw, gsw;
+    double exp[31];
+    double3 gOO[31];
+} DimerTerms;
+
+// What the dimers of one water share, computed once per evaluation by computeMoleculeTerms:
+// its sites and its 3 intramolecular variables (H-H, O-H1, O-H2) with their gradients
+typedef struct {
+    // O, H1, H2, X1, X2
+    double3 sites[5];
+    double exp[3];
+    double3 gOO[3];
+} MoleculeTerms;
+
+// Sites of a water beyond its 3 atoms in the force buffers of the host engine, see accumulateDimerSiteForces
+#define MOLECULE_X1 0
+#define MOLECULE_X2 1
+#define MOLECULE_INTRA 2
+#define MOLECULE_SITES 3
+
+extern "C" {
+__device__ void computeExtraPoint(double3 * O, double3 * H1, double3 * H2, double3 * X1, double3 * X2);
+__device__ void computeExp(double r0, double k, double3 * O1, double3 * O2, double * exp1, double3 * g);
+__device__ void computeCoul(double r0, double k, double3 * O1, double3 * O2, double * val, double3 * g);
+__device__ void computeGrads(const double * g, const double3 * gOO, double3 * force1, double3 * force2, double sw);
+__device__ void distributeXpointGrad(const double3 * O, const double3 * H1, const double3 * H2,
+                                     double3 * forceX1, double3 * forceX2,
+                                     double3 * forceO, double3 * forceH1, double3 * forceH2, double sw);
+__device__ void evaluateSwitchFunc(double r, double * sw, double * gsw);
+__device__ void computeDimerVariables(double3 * positions, double * exp, double3 * gOO);
+__device__ void computeInterVariables(double3 * positions, double * exp, double3 * gOO);
+__device__ void computeMoleculeTerms(const double3 * atoms, MoleculeTerms * molecule);
+__device__ void loadDimerPositions(const unsigned int atom1, const unsigned int atom2,
+                                   const double4* __restrict__ posq, double3 * positions);
+__device__ void loadDimerPositionsSoA(const unsigned int atom1, const unsigned int atom2,
+                                      const double* __restrict__ x, const double* __restrict__ y,
+                                      const double* __restrict__ z, double3 * positions);
+__device__ bool computeLoadedDimerTerms(const PeriodicBox box, DimerTerms * dimer);
+__device__ bool computeDimerTerms(const unsigned int atom1, const unsigned int atom2,
+                                  const double4* __restrict__ posq, const PeriodicBox box, DimerTerms * dimer);
+__device__ bool computeCachedDimerTerms(const MoleculeTerms * a, const MoleculeTerms * b, const PeriodicBox box,
+                                        DimerTerms * dimer);
+__device__ double accumulateDimerSiteForces(const DimerTerms * dimer, const double tempEnergy,
+                                            const double * g, double3 * forces, double3 * intra);
+__device__ double accumulateDimerForces(const DimerTerms * dimer, const double tempEnergy,
+                                        const double * g, double3 * forces);
+__device__ void distributeMoleculeForces(const MoleculeTerms * molecule, const double3 * atomForces,
+                                         const double3 * siteForces, double3 * forces);
+__device__ double computeInteraction(const unsigned int atom1, const unsigned int atom2,
+                                     const double4* __restrict__ posq, double3 * forces, const PeriodicBox box);
+__device__ double computeInteractionEnergy(const unsigned int atom1, const unsigned int atom2,
+                                           const double4* __restrict__ posq, const PeriodicBox box);
+}
+
+#endif
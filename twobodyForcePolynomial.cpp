@@ -0,0 +1,135 @@
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <stdlib.h>
+#include "hostVectorTypes.h"
+#include "twobodyForcePolynomial.h"
+#include "twobodyForcePolynomialCoefficients.cu"
+#include "twobodyForcePolynomial.cu"
+
+template double poly_2b_v6x_eval<double, true>(const double * __restrict__ a, const double x[31], double g[31]);
+template double poly_2b_v6x_eval<double, false>(const double * __restrict__ a, const double x[31], double g[31]);
+template PolyBatch poly_2b_v6x_eval<PolyBatch, true>(const double * __restrict__ a, const PolyBatch x[31], PolyBatch g[31]);
+template PolyBatch poly_2b_v6x_eval<PolyBatch, false>(const double * __restrict__ a, const PolyBatch x[31], PolyBatch g[31]);
+
+// One register of dimers, with the expanded polynomial or its symmetric form
+template <bool gradient>
+static PolyBatch evaluateBatch(TwoBodyPolynomial::Form form, const double * a, const PolyBatch x[31], PolyBatch g[31]) {
+    if (form == TwoBodyPolynomial::SYMMETRIC)
+        return poly_2b_v6x_symmetric_eval<PolyBatch, gradient>(a, x, g);
+    return poly_2b_v6x_eval<PolyBatch, gradient>(a, x, g);
+}
+
+TwoBodyPolynomial::TwoBodyPolynomial(Precision precision, Form form) :
+    precision(precision),
+    form(form),
+    coefficients(poly_2b_v6x_coefficients, poly_2b_v6x_coefficients + POLY_NUM_COEFFICIENTS) {
+
+    fold();
+}
+
+TwoBodyPolynomial::TwoBodyPolynomial(const std::vector<double> & coefficients, Precision precision, Form form) :
+    precision(precision),
+    form(form),
+    coefficients(coefficients) {
+
+    if (coefficients.size() != POLY_NUM_COEFFICIENTS)
+        throw std::runtime_error("TwoBodyPolynomial: wrong number of coefficients");
+    fold();
+}
+
+void TwoBodyPolynomial::fold() {
+    // mixed precision runs the symmetric scheme in either form
+    if (form == SYMMETRIC || precision == MIXED_PRECISION) {
+        evaluated.resize(POLY_NUM_SYMMETRIC_TERMS);
+        poly_2b_v6x_symmetric_coefficients(coefficients.data(), evaluated.data());
+    } else {
+        evaluated = coefficients;
+    }
+}
+
+void TwoBodyPolynomial::evaluate(
+        const double * __restrict__ x,
+        double * __restrict__ g,
+        double * __restrict__ energy,
+        const int n) const {
+
+        if (precision == MIXED_PRECISION) {
+            // only the inputs are rounded to float, the sums and so the energies and gradients are double
+            float xf[POLY_FLOAT_BATCH_SIZE];
+            double ed[POLY_FLOAT_BATCH_SIZE];
+            PolyFloatBatch xb[31];
+            PolyMixedBatch gb[31];
+            for (int k = 0; k < 31; k++) {
+                for (int l = 0; l < POLY_FLOAT_BATCH_SIZE; l++)
+                    xf[l] = (float) x[k*POLY_FLOAT_BATCH_SIZE + l];
+                xb[k] = PolyFloatBatch::load(xf);
+            }
+
+            if (g == NULL) {
+                poly_2b_v6x_symmetric_eval<PolyFloatBatch, false>(evaluated.data(), xb, (PolyMixedBatch *) NULL).store(ed);
+            } else {
+                poly_2b_v6x_symmetric_eval<PolyFloatBatch, true>(evaluated.data(), xb, gb).store(ed);
+                for (int k = 0; k < 31; k++)
+                    for (int l = 0; l < n; l++)
+                        g[k*POLY_FLOAT_BATCH_SIZE + l] = gb[k][l];
+            }
+            for (int l = 0; l < n; l++)
+                energy[l] = ed[l];
+            return;
+        }
+
+        // double precision, in as many registers as the n dimers need
+        for (int first = 0; first < n; first += POLY_BATCH_SIZE) {
+            PolyBatch xb[31], gb[31];
+            for (int k = 0; k < 31; k++)
+                xb[k] = PolyBatch::load(x + k*POLY_FLOAT_BATCH_SIZE + first);
+
+            if (g == NULL) {
+                evaluateBatch<false>(form, evaluated.data(), xb, (PolyBatch *) NULL).store(energy + first);
+                continue;
+            }
+
+            PolyBatch e = evaluateBatch<true>(form, evaluated.data(), xb, gb);
+            for (int k = 0; k < 31; k++)
+                gb[k].store(g + k*POLY_FLOAT_BATCH_SIZE + first);
+            e.store(energy + first);
+        }
+}
+
+std::vector<double> readPolyCoefficients(const char * filename) {
+    std::ifstream file(filename);
+    if (!file)
+        throw std::runtime_error(std::string("readPolyCoefficients: cannot open ") + filename);
+
+    std::vector<double> coefficients;
+    std::string line;
+    for (int lineNumber = 1; std::getline(file, line); lineNumber++) {
+        line = line.substr(0, std::min(line.find('#'), line.find("//")));
+        for (size_t i = 0; i < line.size(); i++)
+            if (line[i] == ',')
+                line[i] = ' ';
+
+        std::istringstream tokens(line);
+        std::string token;
+        while (tokens >> token) {
+            char * end;
+            double value = strtod(token.c_str(), &end);
+            if (*end != '\0') {
+                std::ostringstream message;
+                message << "readPolyCoefficients: " << filename << ":" << lineNumber << ": not a number: " << token;
+                throw std::runtime_error(message.str());
+            }
+            coefficients.push_back(value);
+        }
+    }
+
+    if (coefficients.size() != POLY_NUM_COEFFICIENTS) {
+        std::ostringstream message;
+        message << "readPolyCoefficients: " << filename << " has " << coefficients.size()
+                << " coefficients instead of " << POLY_NUM_COEFFICIENTS;
+        throw std::runtime_error(message.str());
+    }
+    return coefficients;
+}
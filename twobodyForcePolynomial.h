@@ -0,0 +1,109 @@
+#ifndef TWOBODYFORCEPOLYNOMIAL
+#define TWOBODYFORCEPOLYNOMIAL
+
+#include <vector>
+#include "simdLanes.h"
+
+// Host declarations of the polynomial in twobodyForcePolynomial.cu, which is compiled once
+// in twobodyForcePolynomial.cpp since the generated code takes a while to build, and of its
+// symmetry reduced form in twobodyForcePolynomialSymmetric.cu, compiled in twobodyForcePolynomialSymmetric.cpp.
+
+#define POLY_NUM_COEFFICIENTS 1153
+
+// Terms of the symmetry reduced form, see twobodyForcePolynomialSymmetric.py
+#define POLY_NUM_SYMMETRIC_TERMS 1732
+
+// MB-pol fit, see twobodyForcePolynomialCoefficients.cu
+extern double poly_2b_v6x_coefficients[POLY_NUM_COEFFICIENTS];
+
+// Number of dimers evaluated together in double precision, a full AVX-512 or AVX2 register of doubles
+#if defined(__AVX512F__)
+#define POLY_BATCH_SIZE 8
+#else
+#define POLY_BATCH_SIZE 4
+#endif
+
+// The same register holds twice as many floats
+#define POLY_FLOAT_BATCH_SIZE (2*POLY_BATCH_SIZE)
+
+typedef SimdLanes<double, POLY_BATCH_SIZE> PolyBatch;
+// Mixed precision: the coordinates and their products in float, the sums weighted by the coefficients in double
+typedef SimdLanes<float, POLY_FLOAT_BATCH_SIZE> PolyFloatBatch;
+typedef SimdLanes<double, POLY_FLOAT_BATCH_SIZE> PolyMixedBatch;
+
+template <typename real, bool gradient, typename coefficient>
+real poly_2b_v6x_eval(const coefficient * __restrict__ a, const real x[31], real g[31]);
+
+extern template double poly_2b_v6x_eval<double, true>(const double * __restrict__ a, const double x[31], double g[31]);
+extern template double poly_2b_v6x_eval<double, false>(const double * __restrict__ a, const double x[31], double g[31]);
+extern template PolyBatch poly_2b_v6x_eval<PolyBatch, true>(const double * __restrict__ a, const PolyBatch x[31], PolyBatch g[31]);
+extern template PolyBatch poly_2b_v6x_eval<PolyBatch, false>(const double * __restrict__ a, const PolyBatch x[31], PolyBatch g[31]);
+
+// The same energy and gradient from POLY_NUM_SYMMETRIC_TERMS coefficients c, folded from the 1153 ones.
+// The sums are evaluated in accum, which may be wider than the coordinates and their products in real.
+template <typename real, bool gradient, typename coefficient, typename accum = real>
+accum poly_2b_v6x_symmetric_eval(const coefficient * __restrict__ c, const real x[31], accum g[31]);
+void poly_2b_v6x_symmetric_coefficients(const double * a, double * c);
+
+extern template double poly_2b_v6x_symmetric_eval<double, true>(const double * __restrict__ c, const double x[31], double g[31]);
+extern template double poly_2b_v6x_symmetric_eval<double, false>(const double * __restrict__ c, const double x[31], double g[31]);
+extern template PolyBatch poly_2b_v6x_symmetric_eval<PolyBatch, true>(const double * __restrict__ c, const PolyBatch x[31], PolyBatch g[31]);
+extern template PolyBatch poly_2b_v6x_symmetric_eval<PolyBatch, false>(const double * __restrict__ c, const PolyBatch x[31], PolyBatch g[31]);
+extern template PolyMixedBatch poly_2b_v6x_symmetric_eval<PolyFloatBatch, true, double, PolyMixedBatch>(const double * __restrict__ c, const PolyFloatBatch x[31], PolyMixedBatch g[31]);
+extern template PolyMixedBatch poly_2b_v6x_symmetric_eval<PolyFloatBatch, false, double, PolyMixedBatch>(const double * __restrict__ c, const PolyFloatBatch x[31], PolyMixedBatch g[31]);
+
+/**
+ * Coefficients and precision of the polynomial used by the host engine.
+ * In MIXED_PRECISION the coordinates and the monomials built from them are float, while the coefficients
+ * and every sum weighted by them (energy, inner sums of the scheme, gradient) are double, as are the inputs,
+ * outputs and everything the engine accumulates. The Maple code interleaves the coefficients with the
+ * products, so mixed precision always evaluates the symmetric scheme, whatever the form. On the 1728 molecule
+ * lattice of run_test_cpu it is off by up to 5e-5 kcal/mol per dimer, 6e-4 kcal/mol/A per gradient component
+ * and 0.08 kcal/mol in total, mostly from rounding the inputs to float. run_test_cpu fails beyond 1e-4, 1e-3
+ * and 1e-5 kcal/mol per dimer in total.
+ * The SYMMETRIC form evaluates the same polynomial in symmetry adapted coordinates, with about a quarter
+ * of the operations of the EXPANDED Maple code, and agrees with it to round-off.
+ */
+class TwoBodyPolynomial {
+public:
+    enum Precision { DOUBLE_PRECISION, MIXED_PRECISION };
+    enum Form { EXPANDED, SYMMETRIC };
+
+    // MB-pol coefficients
+    TwoBodyPolynomial(Precision precision = DOUBLE_PRECISION, Form form = EXPANDED);
+    // Any other set of POLY_NUM_COEFFICIENTS coefficients, e.g. from readPolyCoefficients()
+    TwoBodyPolynomial(const std::vector<double> & coefficients, Precision precision = DOUBLE_PRECISION,
+                      Form form = EXPANDED);
+
+    // Evaluate n <= POLY_FLOAT_BATCH_SIZE dimers. x and g are structures of arrays, variable k of dimer l
+    // is x[k*POLY_FLOAT_BATCH_SIZE + l], energy gets one value per dimer. Lanes from n on must hold valid
+    // inputs too (e.g. copies of the first dimer), their results are meaningless.
+    // If g is NULL only the energies are computed.
+    void evaluate(
+            const double * __restrict__ x,
+            double * __restrict__ g,
+            double * __restrict__ energy,
+            const int n) const;
+
+    Precision getPrecision() const { return precision; }
+    Form getForm() const { return form; }
+    // The POLY_NUM_COEFFICIENTS coefficients, whatever the form
+    const std::vector<double> & getCoefficients() const { return coefficients; }
+
+private:
+    void fold();
+
+    Precision precision;
+    Form form;
+    std::vector<double> coefficients;
+    // what the form and precision evaluate: the coefficients, or the terms folded from them
+    std::vector<double> evaluated;
+};
+
+// Read POLY_NUM_COEFFICIENTS coefficients from a text file, separated by white space or commas.
+// Comments starting with # or // are skipped, so the lines between the braces of
+// twobodyForcePolynomialCoefficients.cu are a valid file.
+// Throws std::runtime_error if the file cannot be read or has the wrong count.
+std::vector<double> readPolyCoefficients(const char * filename);
+
+#endif
@@ -0,0 +1,11 @@
+#include "hostVectorTypes.h"
+#include "twobodyForcePolynomial.h"
+#include "twobodyForcePolynomialSymmetric.cu"
+
+// The symmetric form builds quickly, all its instantiations are here
+template double poly_2b_v6x_symmetric_eval<double, true>(const double * __restrict__ c, const double x[31], double g[31]);
+template double poly_2b_v6x_symmetric_eval<double, false>(const double * __restrict__ c, const double x[31], double g[31]);
+template PolyBatch poly_2b_v6x_symmetric_eval<PolyBatch, true>(const double * __restrict__ c, const PolyBatch x[31], PolyBatch g[31]);
+template PolyBatch poly_2b_v6x_symmetric_eval<PolyBatch, false>(const double * __restrict__ c, const PolyBatch x[31], PolyBatch g[31]);
+template PolyMixedBatch poly_2b_v6x_symmetric_eval<PolyFloatBatch, true, double, PolyMixedBatch>(const double * __restrict__ c, const PolyFloatBatch x[31], PolyMixedBatch g[31]);
+template PolyMixedBatch poly_2b_v6x_symmetric_eval<PolyFloatBatch, false, double, PolyMixedBatch>(const double * __restrict__ c, const PolyFloatBatch x[31], PolyMixedBatch g[31]);
@@ -0,0 +1,5127 @@
+// code generated by twobodyForcePolynomialSymmetric.py from the Maple code of twobodyForcePolynomial.cu,
+// do not edit
+
+// Symmetry reduced form of poly_2b_v6x_eval: 1732 terms in the coordinates z instead of 12725 monomials
+// in the variables x, see twobodyForcePolynomialSymmetric.py. c are the POLY_NUM_SYMMETRIC_TERMS
+// coefficients of poly_2b_v6x_symmetric_coefficients(). The energy and the gradient equal those
+// of poly_2b_v6x_eval to round-off. real holds the coordinates and the products of them, accum the sums
+// weighted by the coefficients (the scheme, the energy and the gradient): both double, or float lanes
+// and double lanes for the mixed precision of TwoBodyPolynomial.
+template <typename real, bool gradient, typename coefficient, typename accum>
+__device__ accum poly_2b_v6x_symmetric_eval(
+                         const coefficient * __restrict__ c,
+                         const real x[31],
+                               accum g[31])
+{
+    // sums and differences over the hydrogen and lone pair swaps
+    const real y2 = x[2]+x[3];
+    const real y3 = x[2]-x[3];
+    const real y4 = x[4]+x[5];
+    const real y5 = x[4]-x[5];
+    const real y6 = x[6]+x[7]+x[8]+x[9];
+    const real y7 = x[6]+x[7]-x[8]-x[9];
+    const real y8 = x[6]-x[7]+x[8]-x[9];
+    const real y9 = x[6]-x[7]-x[8]+x[9];
+    const real y10 = x[10]+x[11];
+    const real y11 = x[10]-x[11];
+    const real y12 = x[12]+x[13];
+    const real y13 = x[12]-x[13];
+    const real y15 = x[15]+x[16]+x[17]+x[18];
+    const real y16 = x[15]+x[16]-x[17]-x[18];
+    const real y17 = x[15]-x[16]+x[17]-x[18];
+    const real y18 = x[15]-x[16]-x[17]+x[18];
+    const real y19 = x[19]+x[20]+x[21]+x[22];
+    const real y20 = x[19]+x[20]-x[21]-x[22];
+    const real y21 = x[19]-x[20]+x[21]-x[22];
+    const real y22 = x[19]-x[20]-x[21]+x[22];
+    const real y23 = x[23]+x[24];
+    const real y24 = x[23]-x[24];
+    const real y25 = x[25]+x[26];
+    const real y26 = x[25]-x[26];
+    const real y27 = x[27]+x[28]+x[29]+x[30];
+    const real y28 = x[27]+x[28]-x[29]-x[30];
+    const real y29 = x[27]-x[28]+x[29]-x[30];
+    const real y30 = x[27]-x[28]-x[29]+x[30];
+    // then over the monomer swap
+    const real z0 = x[0]+x[1];
+    const real z1 = x[0]-x[1];
+    const real z2 = y2+y4;
+    const real z3 = y3+y5;
+    const real z4 = y2-y4;
+    const real z5 = y3-y5;
+    const real z6 = y6;
+    const real z7 = y7+y8;
+    const real z8 = y7-y8;
+    const real z9 = y9;
+    const real z10 = y10+y12;
+    const real z11 = y11+y13;
+    const real z12 = y10-y12;
+    const real z13 = y11-y13;
+    const real z14 = x[14];
+    const real z15 = y15+y19;
+    const real z16 = y16+y20;
+    const real z17 = y17+y21;
+    const real z18 = y18+y22;
+    const real z19 = y15-y19;
+    const real z20 = y16-y20;
+    const real z21 = y17-y21;
+    const real z22 = y18-y22;
+    const real z23 = y23+y25;
+    const real z24 = y24+y26;
+    const real z25 = y23-y25;
+    const real z26 = y24-y26;
+    const real z27 = y27;
+    const real z28 = y28+y29;
+    const real z29 = y28-y29;
+    const real z30 = y30;
+
+    // nested Horner scheme of the terms
+    const accum s0 = c[309]+accum(z6)*c[1480]+accum(z10)*c[1481]+accum(z14)*c[1483]+accum(z15)*c[1485]
+        +accum(z23)*c[1482]+accum(z27)*c[1484];
+    const accum s1 = accum(z7)*c[1459];
+    const accum s2 = accum(z8)*c[1460]+accum(z13)*c[1461]+accum(z21)*c[1462];
+    const accum s3 = accum(z9)*c[1477];
+    const accum s4 = c[310]+accum(z10)*c[1486]+accum(z14)*c[1488]+accum(z15)*c[1490]+accum(z23)*c[1487]
+        +accum(z27)*c[1489];
+    const accum s5 = accum(z7)*c[1456]+accum(z11)*c[1454]+accum(z17)*c[1455];
+    const accum s6 = accum(z12)*c[1471];
+    const accum s7 = accum(z13)*c[1463]+accum(z21)*c[1464];
+    const accum s8 = c[312]+accum(z14)*c[1495]+accum(z15)*c[1497]+accum(z27)*c[1496];
+    const accum s9 = c[314]+accum(z15)*c[1500];
+    const accum s10 = accum(z16)*c[1448]+accum(z24)*c[1449]+accum(z28)*c[1450];
+    const accum s11 = accum(z7)*c[1458]+accum(z17)*c[1457];
+    const accum s12 = accum(z12)*c[1468]+accum(z19)*c[1466]+accum(z25)*c[1467];
+    const accum s13 = accum(z20)*c[1472]+accum(z26)*c[1474]+accum(z29)*c[1473];
+    const accum s14 = accum(z21)*c[1465];
+    const accum s15 = c[311]+accum(z14)*c[1492]+accum(z15)*c[1494]+accum(z23)*c[1491]+accum(z27)*c[1493];
+    const accum s16 = accum(z24)*c[1451]+accum(z28)*c[1452];
+    const accum s17 = accum(z12)*c[1470]+accum(z25)*c[1469];
+    const accum s18 = accum(z26)*c[1478];
+    const accum s19 = c[313]+accum(z15)*c[1499]+accum(z27)*c[1498];
+    const accum s20 = accum(z28)*c[1453];
+    const accum s21 = accum(z26)*c[1476]+accum(z29)*c[1475];
+    const accum s22 = accum(z30)*c[1479];
+    const accum s23 = accum(z6)*s0+accum(z7)*s1+accum(z8)*s2+accum(z9)*s3+accum(z10)*s4+accum(z11)*s5
+        +accum(z12)*s6+accum(z13)*s7+accum(z14)*s8+accum(z15)*s9+accum(z16)*s10+accum(z17)*s11+accum(z19)*s12
+        +accum(z20)*s13+accum(z21)*s14+accum(z23)*s15+accum(z24)*s16+accum(z25)*s17+accum(z26)*s18
+        +accum(z27)*s19+accum(z28)*s20+accum(z29)*s21+accum(z30)*s22;
+    const accum s24 = c[330]+accum(z0)*c[1532]+accum(z2)*c[1531];
+    const accum s25 = c[331]+accum(z0)*c[1534]+accum(z2)*c[1533];
+    const accum s26 = c[332]+accum(z0)*c[1536]+accum(z2)*c[1535];
+    const accum s27 = accum(z8)*s24+accum(z13)*s25+accum(z21)*s26;
+    const accum s28 = c[324]+accum(z0)*c[1520]+accum(z2)*c[1519];
+    const accum s29 = c[325]+accum(z0)*c[1522]+accum(z2)*c[1521];
+    const accum s30 = c[326]+accum(z0)*c[1524]+accum(z2)*c[1523];
+    const accum s31 = accum(z8)*s28+accum(z13)*s29+accum(z21)*s30;
+    const accum s32 = c[349]+accum(z0)*c[1562]+accum(z2)*c[1561];
+    const accum s33 = c[350]+accum(z0)*c[1564]+accum(z2)*c[1563];
+    const accum s34 = c[352]+accum(z0)*c[1568]+accum(z2)*c[1567];
+    const accum s35 = c[354]+accum(z0)*c[1572]+accum(z2)*c[1571];
+    const accum s36 = c[351]+accum(z0)*c[1566]+accum(z2)*c[1565];
+    const accum s37 = c[353]+accum(z0)*c[1570]+accum(z2)*c[1569];
+    const accum s38 = c[19]+accum(z0)*c[356]+accum(z2)*c[355]+accum(z6)*s32+accum(z10)*s33+accum(z14)*s34
+        +accum(z15)*s35+accum(z23)*s36+accum(z27)*s37;
+    const accum s39 = c[315]+accum(z0)*c[1502]+accum(z2)*c[1501];
+    const accum s40 = c[317]+accum(z0)*c[1506]+accum(z2)*c[1505];
+    const accum s41 = c[316]+accum(z0)*c[1504]+accum(z2)*c[1503];
+    const accum s42 = accum(z20)*s39+accum(z26)*s40+accum(z29)*s41;
+    const accum s43 = c[327]+accum(z0)*c[1526]+accum(z2)*c[1525];
+    const accum s44 = c[328]+accum(z0)*c[1528]+accum(z2)*c[1527];
+    const accum s45 = c[329]+accum(z0)*c[1530]+accum(z2)*c[1529];
+    const accum s46 = accum(z8)*s43+accum(z13)*s44+accum(z21)*s45;
+    const accum s47 = c[333]+accum(z0)*c[1538]+accum(z2)*c[1537];
+    const accum s48 = c[334]+accum(z0)*c[1540]+accum(z2)*c[1539];
+    const accum s49 = c[336]+accum(z0)*c[1544]+accum(z2)*c[1543];
+    const accum s50 = c[338]+accum(z0)*c[1548]+accum(z2)*c[1547];
+    const accum s51 = c[335]+accum(z0)*c[1542]+accum(z2)*c[1541];
+    const accum s52 = c[337]+accum(z0)*c[1546]+accum(z2)*c[1545];
+    const accum s53 = c[17]+accum(z0)*c[340]+accum(z2)*c[339]+accum(z6)*s47+accum(z10)*s48+accum(z14)*s49
+        +accum(z15)*s50+accum(z23)*s51+accum(z27)*s52;
+    const accum s54 = c[318]+accum(z0)*c[1508]+accum(z2)*c[1507];
+    const accum s55 = c[320]+accum(z0)*c[1512]+accum(z2)*c[1511];
+    const accum s56 = c[319]+accum(z0)*c[1510]+accum(z2)*c[1509];
+    const accum s57 = accum(z20)*s54+accum(z26)*s55+accum(z29)*s56;
+    const accum s58 = c[341]+accum(z0)*c[1550]+accum(z2)*c[1549];
+    const accum s59 = c[342]+accum(z0)*c[1552]+accum(z2)*c[1551];
+    const accum s60 = c[344]+accum(z0)*c[1556]+accum(z2)*c[1555];
+    const accum s61 = c[346]+accum(z0)*c[1560]+accum(z2)*c[1559];
+    const accum s62 = c[343]+accum(z0)*c[1554]+accum(z2)*c[1553];
+    const accum s63 = c[345]+accum(z0)*c[1558]+accum(z2)*c[1557];
+    const accum s64 = c[18]+accum(z0)*c[348]+accum(z2)*c[347]+accum(z6)*s58+accum(z10)*s59+accum(z14)*s60
+        +accum(z15)*s61+accum(z23)*s62+accum(z27)*s63;
+    const accum s65 = c[321]+accum(z0)*c[1514]+accum(z2)*c[1513];
+    const accum s66 = c[323]+accum(z0)*c[1518]+accum(z2)*c[1517];
+    const accum s67 = c[322]+accum(z0)*c[1516]+accum(z2)*c[1515];
+    const accum s68 = accum(z20)*s65+accum(z26)*s66+accum(z29)*s67;
+    const accum s69 = accum(z1)*s23+accum(z7)*s27+accum(z11)*s31+accum(z12)*s38+accum(z16)*s42+accum(z17)*s46
+        +accum(z19)*s53+accum(z24)*s57+accum(z25)*s64+accum(z28)*s68;
+    const accum s70 = accum(z12)*c[967]+accum(z19)*c[965]+accum(z25)*c[966];
+    const accum s71 = c[104]+accum(z6)*c[969]+accum(z9)*c[968]+accum(z10)*c[970]+accum(z14)*c[972]
+        +accum(z15)*c[974]+accum(z23)*c[971]+accum(z27)*c[973];
+    const accum s72 = accum(z12)*c[961]+accum(z19)*c[959]+accum(z25)*c[960];
+    const accum s73 = c[105]+accum(z6)*c[976]+accum(z9)*c[975]+accum(z10)*c[977]+accum(z14)*c[979]
+        +accum(z15)*c[981]+accum(z23)*c[978]+accum(z27)*c[980];
+    const accum s74 = accum(z12)*c[964]+accum(z19)*c[962]+accum(z25)*c[963];
+    const accum s75 = c[106]+accum(z6)*c[983]+accum(z9)*c[982]+accum(z10)*c[984]+accum(z14)*c[986]
+        +accum(z15)*c[988]+accum(z23)*c[985]+accum(z27)*c[987];
+    const accum s76 = accum(z7)*s70+accum(z8)*s71+accum(z11)*s72+accum(z13)*s73+accum(z17)*s74+accum(z21)*s75;
+    const accum s77 = c[86]+accum(z6)*c[847]+accum(z10)*c[848]+accum(z14)*c[850]+accum(z15)*c[852]
+        +accum(z23)*c[849]+accum(z27)*c[851];
+    const accum s78 = accum(z7)*c[820];
+    const accum s79 = accum(z8)*c[821]+accum(z13)*c[822]+accum(z21)*c[823];
+    const accum s80 = c[85]+accum(z6)*c[839]+accum(z9)*c[838]+accum(z10)*c[840]+accum(z14)*c[842]
+        +accum(z15)*c[844]+accum(z23)*c[841]+accum(z27)*c[843];
+    const accum s81 = c[87]+accum(z10)*c[853]+accum(z14)*c[855]+accum(z15)*c[857]+accum(z23)*c[854]
+        +accum(z27)*c[856];
+    const accum s82 = accum(z7)*c[817]+accum(z11)*c[815]+accum(z17)*c[816];
+    const accum s83 = accum(z12)*c[832];
+    const accum s84 = accum(z13)*c[824]+accum(z21)*c[825];
+    const accum s85 = c[89]+accum(z14)*c[862]+accum(z15)*c[864]+accum(z27)*c[863];
+    const accum s86 = c[91]+accum(z15)*c[867];
+    const accum s87 = accum(z16)*c[809]+accum(z24)*c[810]+accum(z28)*c[811];
+    const accum s88 = accum(z7)*c[819]+accum(z17)*c[818];
+    const accum s89 = accum(z18)*c[808];
+    const accum s90 = accum(z12)*c[829]+accum(z19)*c[827]+accum(z25)*c[828];
+    const accum s91 = accum(z20)*c[833]+accum(z26)*c[835]+accum(z29)*c[834];
+    const accum s92 = accum(z21)*c[826];
+    const accum s93 = accum(z22)*c[807];
+    const accum s94 = c[88]+accum(z14)*c[859]+accum(z15)*c[861]+accum(z23)*c[858]+accum(z27)*c[860];
+    const accum s95 = accum(z24)*c[812]+accum(z28)*c[813];
+    const accum s96 = accum(z12)*c[831]+accum(z25)*c[830];
+    const accum s97 = accum(z26)*c[845];
+    const accum s98 = c[90]+accum(z15)*c[866]+accum(z27)*c[865];
+    const accum s99 = accum(z28)*c[814];
+    const accum s100 = accum(z26)*c[837]+accum(z29)*c[836];
+    const accum s101 = accum(z30)*c[846];
+    const accum s102 = accum(z6)*s77+accum(z7)*s78+accum(z8)*s79+accum(z9)*s80+accum(z10)*s81+accum(z11)*s82
+        +accum(z12)*s83+accum(z13)*s84+accum(z14)*s85+accum(z15)*s86+accum(z16)*s87+accum(z17)*s88
+        +accum(z18)*s89+accum(z19)*s90+accum(z20)*s91+accum(z21)*s92+accum(z22)*s93+accum(z23)*s94
+        +accum(z24)*s95+accum(z25)*s96+accum(z26)*s97+accum(z27)*s98+accum(z28)*s99+accum(z29)*s100
+        +accum(z30)*s101;
+    const accum s103 = accum(z12)*c[937]+accum(z19)*c[935]+accum(z25)*c[936];
+    const accum s104 = c[101]+accum(z6)*c[939]+accum(z9)*c[938]+accum(z10)*c[940]+accum(z14)*c[942]
+        +accum(z15)*c[944]+accum(z23)*c[941]+accum(z27)*c[943];
+    const accum s105 = accum(z12)*c[931]+accum(z19)*c[929]+accum(z25)*c[930];
+    const accum s106 = c[102]+accum(z6)*c[946]+accum(z9)*c[945]+accum(z10)*c[947]+accum(z14)*c[949]
+        +accum(z15)*c[951]+accum(z23)*c[948]+accum(z27)*c[950];
+    const accum s107 = accum(z12)*c[934]+accum(z19)*c[932]+accum(z25)*c[933];
+    const accum s108 = c[103]+accum(z6)*c[953]+accum(z9)*c[952]+accum(z10)*c[954]+accum(z14)*c[956]
+        +accum(z15)*c[958]+accum(z23)*c[955]+accum(z27)*c[957];
+    const accum s109 = accum(z7)*s103+accum(z8)*s104+accum(z11)*s105+accum(z13)*s106+accum(z17)*s107
+        +accum(z21)*s108;
+    const accum s110 = accum(z8)*c[896]+accum(z13)*c[897]+accum(z21)*c[898];
+    const accum s111 = accum(z8)*c[890]+accum(z13)*c[891]+accum(z21)*c[892];
+    const accum s112 = c[97]+accum(z6)*c[911]+accum(z10)*c[912]+accum(z14)*c[914]+accum(z15)*c[916]
+        +accum(z23)*c[913]+accum(z27)*c[915];
+    const accum s113 = accum(z20)*c[881]+accum(z26)*c[883]+accum(z29)*c[882];
+    const accum s114 = accum(z8)*c[893]+accum(z13)*c[894]+accum(z21)*c[895];
+    const accum s115 = c[95]+accum(z6)*c[899]+accum(z10)*c[900]+accum(z14)*c[902]+accum(z15)*c[904]
+        +accum(z23)*c[901]+accum(z27)*c[903];
+    const accum s116 = accum(z20)*c[884]+accum(z26)*c[886]+accum(z29)*c[885];
+    const accum s117 = c[96]+accum(z6)*c[905]+accum(z10)*c[906]+accum(z14)*c[908]+accum(z15)*c[910]
+        +accum(z23)*c[907]+accum(z27)*c[909];
+    const accum s118 = accum(z20)*c[887]+accum(z26)*c[889]+accum(z29)*c[888];
+    const accum s119 = accum(z7)*s110+accum(z11)*s111+accum(z12)*s112+accum(z16)*s113+accum(z17)*s114
+        +accum(z19)*s115+accum(z24)*s116+accum(z25)*s117+accum(z28)*s118;
+    const accum s120 = c[126]+accum(z0)*c[1020]+accum(z2)*c[1019];
+    const accum s121 = c[125]+accum(z0)*c[1018]+accum(z2)*c[1017];
+    const accum s122 = c[127]+accum(z0)*c[1022]+accum(z2)*c[1021];
+    const accum s123 = c[129]+accum(z0)*c[1026]+accum(z2)*c[1025];
+    const accum s124 = c[131]+accum(z0)*c[1030]+accum(z2)*c[1029];
+    const accum s125 = c[128]+accum(z0)*c[1024]+accum(z2)*c[1023];
+    const accum s126 = c[130]+accum(z0)*c[1028]+accum(z2)*c[1027];
+    const accum s127 = c[8]+accum(z0)*c[133]+accum(z2)*c[132]+accum(z6)*s120+accum(z9)*s121+accum(z10)*s122
+        +accum(z14)*s123+accum(z15)*s124+accum(z23)*s125+accum(z27)*s126;
+    const accum s128 = c[136]+accum(z0)*c[1036]+accum(z2)*c[1035];
+    const accum s129 = c[134]+accum(z0)*c[1032]+accum(z2)*c[1031];
+    const accum s130 = c[135]+accum(z0)*c[1034]+accum(z2)*c[1033];
+    const accum s131 = accum(z12)*s128+accum(z19)*s129+accum(z25)*s130;
+    const accum s132 = c[108]+accum(z0)*c[992]+accum(z2)*c[991];
+    const accum s133 = c[107]+accum(z0)*c[990]+accum(z2)*c[989];
+    const accum s134 = c[109]+accum(z0)*c[994]+accum(z2)*c[993];
+    const accum s135 = c[111]+accum(z0)*c[998]+accum(z2)*c[997];
+    const accum s136 = c[113]+accum(z0)*c[1002]+accum(z2)*c[1001];
+    const accum s137 = c[110]+accum(z0)*c[996]+accum(z2)*c[995];
+    const accum s138 = c[112]+accum(z0)*c[1000]+accum(z2)*c[999];
+    const accum s139 = c[6]+accum(z0)*c[115]+accum(z2)*c[114]+accum(z6)*s132+accum(z9)*s133+accum(z10)*s134
+        +accum(z14)*s135+accum(z15)*s136+accum(z23)*s137+accum(z27)*s138;
+    const accum s140 = c[139]+accum(z0)*c[1042]+accum(z2)*c[1041];
+    const accum s141 = c[137]+accum(z0)*c[1038]+accum(z2)*c[1037];
+    const accum s142 = c[138]+accum(z0)*c[1040]+accum(z2)*c[1039];
+    const accum s143 = accum(z12)*s140+accum(z19)*s141+accum(z25)*s142;
+    const accum s144 = c[117]+accum(z0)*c[1006]+accum(z2)*c[1005];
+    const accum s145 = c[116]+accum(z0)*c[1004]+accum(z2)*c[1003];
+    const accum s146 = c[118]+accum(z0)*c[1008]+accum(z2)*c[1007];
+    const accum s147 = c[120]+accum(z0)*c[1012]+accum(z2)*c[1011];
+    const accum s148 = c[122]+accum(z0)*c[1016]+accum(z2)*c[1015];
+    const accum s149 = c[119]+accum(z0)*c[1010]+accum(z2)*c[1009];
+    const accum s150 = c[121]+accum(z0)*c[1014]+accum(z2)*c[1013];
+    const accum s151 = c[7]+accum(z0)*c[124]+accum(z2)*c[123]+accum(z6)*s144+accum(z9)*s145+accum(z10)*s146
+        +accum(z14)*s147+accum(z15)*s148+accum(z23)*s149+accum(z27)*s150;
+    const accum s152 = accum(z20)*c[920]+accum(z26)*c[922]+accum(z29)*c[921];
+    const accum s153 = accum(z20)*c[917]+accum(z26)*c[919]+accum(z29)*c[918];
+    const accum s154 = c[98]+accum(z0)*c[924]+accum(z2)*c[923];
+    const accum s155 = c[99]+accum(z0)*c[926]+accum(z2)*c[925];
+    const accum s156 = c[100]+accum(z0)*c[928]+accum(z2)*c[927];
+    const accum s157 = accum(z1)*s152+accum(z4)*s153+accum(z16)*s154+accum(z24)*s155+accum(z28)*s156;
+    const accum s158 = c[142]+accum(z0)*c[1048]+accum(z2)*c[1047];
+    const accum s159 = c[140]+accum(z0)*c[1044]+accum(z2)*c[1043];
+    const accum s160 = c[141]+accum(z0)*c[1046]+accum(z2)*c[1045];
+    const accum s161 = accum(z12)*s158+accum(z19)*s159+accum(z25)*s160;
+    const accum s162 = accum(z16)*c[872]+accum(z24)*c[873]+accum(z28)*c[874];
+    const accum s163 = accum(z16)*c[869]+accum(z24)*c[870]+accum(z28)*c[871];
+    const accum s164 = accum(z18)*c[868];
+    const accum s165 = c[92]+accum(z0)*c[876]+accum(z2)*c[875];
+    const accum s166 = c[94]+accum(z0)*c[880]+accum(z2)*c[879];
+    const accum s167 = c[93]+accum(z0)*c[878]+accum(z2)*c[877];
+    const accum s168 = accum(z1)*s162+accum(z4)*s163+accum(z5)*s164+accum(z20)*s165+accum(z26)*s166
+        +accum(z29)*s167;
+    const accum s169 = accum(z1)*s76+accum(z3)*s102+accum(z4)*s109+accum(z5)*s119+accum(z7)*s127
+        +accum(z8)*s131+accum(z11)*s139+accum(z13)*s143+accum(z17)*s151+accum(z18)*s157+accum(z21)*s161
+        +accum(z22)*s168;
+    const accum s170 = c[261]+accum(z6)*c[1355]+accum(z10)*c[1356]+accum(z14)*c[1358]+accum(z15)*c[1360]
+        +accum(z23)*c[1357]+accum(z27)*c[1359];
+    const accum s171 = accum(z7)*c[1334];
+    const accum s172 = accum(z8)*c[1335]+accum(z13)*c[1336]+accum(z21)*c[1337];
+    const accum s173 = accum(z9)*c[1352];
+    const accum s174 = c[262]+accum(z10)*c[1361]+accum(z14)*c[1363]+accum(z15)*c[1365]+accum(z23)*c[1362]
+        +accum(z27)*c[1364];
+    const accum s175 = accum(z7)*c[1331]+accum(z11)*c[1329]+accum(z17)*c[1330];
+    const accum s176 = accum(z12)*c[1346];
+    const accum s177 = accum(z13)*c[1338]+accum(z21)*c[1339];
+    const accum s178 = c[264]+accum(z14)*c[1370]+accum(z15)*c[1372]+accum(z27)*c[1371];
+    const accum s179 = c[266]+accum(z15)*c[1375];
+    const accum s180 = accum(z16)*c[1323]+accum(z24)*c[1324]+accum(z28)*c[1325];
+    const accum s181 = accum(z7)*c[1333]+accum(z17)*c[1332];
+    const accum s182 = accum(z12)*c[1343]+accum(z19)*c[1341]+accum(z25)*c[1342];
+    const accum s183 = accum(z20)*c[1347]+accum(z26)*c[1349]+accum(z29)*c[1348];
+    const accum s184 = accum(z21)*c[1340];
+    const accum s185 = c[263]+accum(z14)*c[1367]+accum(z15)*c[1369]+accum(z23)*c[1366]+accum(z27)*c[1368];
+    const accum s186 = accum(z24)*c[1326]+accum(z28)*c[1327];
+    const accum s187 = accum(z12)*c[1345]+accum(z25)*c[1344];
+    const accum s188 = accum(z26)*c[1353];
+    const accum s189 = c[265]+accum(z15)*c[1374]+accum(z27)*c[1373];
+    const accum s190 = accum(z28)*c[1328];
+    const accum s191 = accum(z26)*c[1351]+accum(z29)*c[1350];
+    const accum s192 = accum(z30)*c[1354];
+    const accum s193 = accum(z6)*s170+accum(z7)*s171+accum(z8)*s172+accum(z9)*s173+accum(z10)*s174
+        +accum(z11)*s175+accum(z12)*s176+accum(z13)*s177+accum(z14)*s178+accum(z15)*s179+accum(z16)*s180
+        +accum(z17)*s181+accum(z19)*s182+accum(z20)*s183+accum(z21)*s184+accum(z23)*s185+accum(z24)*s186
+        +accum(z25)*s187+accum(z26)*s188+accum(z27)*s189+accum(z28)*s190+accum(z29)*s191+accum(z30)*s192;
+    const accum s194 = c[255]+accum(z6)*c[1302]+accum(z10)*c[1303]+accum(z14)*c[1305]+accum(z15)*c[1307]
+        +accum(z23)*c[1304]+accum(z27)*c[1306];
+    const accum s195 = accum(z7)*c[1281];
+    const accum s196 = accum(z8)*c[1282]+accum(z13)*c[1283]+accum(z21)*c[1284];
+    const accum s197 = accum(z9)*c[1299];
+    const accum s198 = c[256]+accum(z10)*c[1308]+accum(z14)*c[1310]+accum(z15)*c[1312]+accum(z23)*c[1309]
+        +accum(z27)*c[1311];
+    const accum s199 = accum(z7)*c[1278]+accum(z11)*c[1276]+accum(z17)*c[1277];
+    const accum s200 = accum(z12)*c[1293];
+    const accum s201 = accum(z13)*c[1285]+accum(z21)*c[1286];
+    const accum s202 = c[258]+accum(z14)*c[1317]+accum(z15)*c[1319]+accum(z27)*c[1318];
+    const accum s203 = c[260]+accum(z15)*c[1322];
+    const accum s204 = accum(z16)*c[1270]+accum(z24)*c[1271]+accum(z28)*c[1272];
+    const accum s205 = accum(z7)*c[1280]+accum(z17)*c[1279];
+    const accum s206 = accum(z12)*c[1290]+accum(z19)*c[1288]+accum(z25)*c[1289];
+    const accum s207 = accum(z20)*c[1294]+accum(z26)*c[1296]+accum(z29)*c[1295];
+    const accum s208 = accum(z21)*c[1287];
+    const accum s209 = c[257]+accum(z14)*c[1314]+accum(z15)*c[1316]+accum(z23)*c[1313]+accum(z27)*c[1315];
+    const accum s210 = accum(z24)*c[1273]+accum(z28)*c[1274];
+    const accum s211 = accum(z12)*c[1292]+accum(z25)*c[1291];
+    const accum s212 = accum(z26)*c[1300];
+    const accum s213 = c[259]+accum(z15)*c[1321]+accum(z27)*c[1320];
+    const accum s214 = accum(z28)*c[1275];
+    const accum s215 = accum(z26)*c[1298]+accum(z29)*c[1297];
+    const accum s216 = accum(z30)*c[1301];
+    const accum s217 = accum(z6)*s194+accum(z7)*s195+accum(z8)*s196+accum(z9)*s197+accum(z10)*s198
+        +accum(z11)*s199+accum(z12)*s200+accum(z13)*s201+accum(z14)*s202+accum(z15)*s203+accum(z16)*s204
+        +accum(z17)*s205+accum(z19)*s206+accum(z20)*s207+accum(z21)*s208+accum(z23)*s209+accum(z24)*s210
+        +accum(z25)*s211+accum(z26)*s212+accum(z27)*s213+accum(z28)*s214+accum(z29)*s215+accum(z30)*s216;
+    const accum s218 = c[282]+accum(z0)*c[1407]+accum(z2)*c[1406];
+    const accum s219 = c[283]+accum(z0)*c[1409]+accum(z2)*c[1408];
+    const accum s220 = c[284]+accum(z0)*c[1411]+accum(z2)*c[1410];
+    const accum s221 = accum(z8)*s218+accum(z13)*s219+accum(z21)*s220;
+    const accum s222 = c[276]+accum(z0)*c[1395]+accum(z2)*c[1394];
+    const accum s223 = c[277]+accum(z0)*c[1397]+accum(z2)*c[1396];
+    const accum s224 = c[278]+accum(z0)*c[1399]+accum(z2)*c[1398];
+    const accum s225 = accum(z8)*s222+accum(z13)*s223+accum(z21)*s224;
+    const accum s226 = c[301]+accum(z0)*c[1437]+accum(z2)*c[1436];
+    const accum s227 = c[302]+accum(z0)*c[1439]+accum(z2)*c[1438];
+    const accum s228 = c[304]+accum(z0)*c[1443]+accum(z2)*c[1442];
+    const accum s229 = c[306]+accum(z0)*c[1447]+accum(z2)*c[1446];
+    const accum s230 = c[303]+accum(z0)*c[1441]+accum(z2)*c[1440];
+    const accum s231 = c[305]+accum(z0)*c[1445]+accum(z2)*c[1444];
+    const accum s232 = c[16]+accum(z0)*c[308]+accum(z2)*c[307]+accum(z6)*s226+accum(z10)*s227+accum(z14)*s228
+        +accum(z15)*s229+accum(z23)*s230+accum(z27)*s231;
+    const accum s233 = c[267]+accum(z0)*c[1377]+accum(z2)*c[1376];
+    const accum s234 = c[269]+accum(z0)*c[1381]+accum(z2)*c[1380];
+    const accum s235 = c[268]+accum(z0)*c[1379]+accum(z2)*c[1378];
+    const accum s236 = accum(z20)*s233+accum(z26)*s234+accum(z29)*s235;
+    const accum s237 = c[279]+accum(z0)*c[1401]+accum(z2)*c[1400];
+    const accum s238 = c[280]+accum(z0)*c[1403]+accum(z2)*c[1402];
+    const accum s239 = c[281]+accum(z0)*c[1405]+accum(z2)*c[1404];
+    const accum s240 = accum(z8)*s237+accum(z13)*s238+accum(z21)*s239;
+    const accum s241 = c[285]+accum(z0)*c[1413]+accum(z2)*c[1412];
+    const accum s242 = c[286]+accum(z0)*c[1415]+accum(z2)*c[1414];
+    const accum s243 = c[288]+accum(z0)*c[1419]+accum(z2)*c[1418];
+    const accum s244 = c[290]+accum(z0)*c[1423]+accum(z2)*c[1422];
+    const accum s245 = c[287]+accum(z0)*c[1417]+accum(z2)*c[1416];
+    const accum s246 = c[289]+accum(z0)*c[1421]+accum(z2)*c[1420];
+    const accum s247 = c[14]+accum(z0)*c[292]+accum(z2)*c[291]+accum(z6)*s241+accum(z10)*s242+accum(z14)*s243
+        +accum(z15)*s244+accum(z23)*s245+accum(z27)*s246;
+    const accum s248 = c[270]+accum(z0)*c[1383]+accum(z2)*c[1382];
+    const accum s249 = c[272]+accum(z0)*c[1387]+accum(z2)*c[1386];
+    const accum s250 = c[271]+accum(z0)*c[1385]+accum(z2)*c[1384];
+    const accum s251 = accum(z20)*s248+accum(z26)*s249+accum(z29)*s250;
+    const accum s252 = c[293]+accum(z0)*c[1425]+accum(z2)*c[1424];
+    const accum s253 = c[294]+accum(z0)*c[1427]+accum(z2)*c[1426];
+    const accum s254 = c[296]+accum(z0)*c[1431]+accum(z2)*c[1430];
+    const accum s255 = c[298]+accum(z0)*c[1435]+accum(z2)*c[1434];
+    const accum s256 = c[295]+accum(z0)*c[1429]+accum(z2)*c[1428];
+    const accum s257 = c[297]+accum(z0)*c[1433]+accum(z2)*c[1432];
+    const accum s258 = c[15]+accum(z0)*c[300]+accum(z2)*c[299]+accum(z6)*s252+accum(z10)*s253+accum(z14)*s254
+        +accum(z15)*s255+accum(z23)*s256+accum(z27)*s257;
+    const accum s259 = c[273]+accum(z0)*c[1389]+accum(z2)*c[1388];
+    const accum s260 = c[275]+accum(z0)*c[1393]+accum(z2)*c[1392];
+    const accum s261 = c[274]+accum(z0)*c[1391]+accum(z2)*c[1390];
+    const accum s262 = accum(z20)*s259+accum(z26)*s260+accum(z29)*s261;
+    const accum s263 = accum(z1)*s193+accum(z4)*s217+accum(z7)*s221+accum(z11)*s225+accum(z12)*s232
+        +accum(z16)*s236+accum(z17)*s240+accum(z19)*s247+accum(z24)*s251+accum(z25)*s258+accum(z28)*s262;
+    const accum s264 = c[192]+accum(z6)*c[1189]+accum(z9)*c[1188]+accum(z10)*c[1190]+accum(z14)*c[1192]
+        +accum(z15)*c[1194]+accum(z23)*c[1191]+accum(z27)*c[1193];
+    const accum s265 = accum(z12)*c[1197]+accum(z19)*c[1195]+accum(z25)*c[1196];
+    const accum s266 = c[190]+accum(z6)*c[1175]+accum(z9)*c[1174]+accum(z10)*c[1176]+accum(z14)*c[1178]
+        +accum(z15)*c[1180]+accum(z23)*c[1177]+accum(z27)*c[1179];
+    const accum s267 = accum(z12)*c[1200]+accum(z19)*c[1198]+accum(z25)*c[1199];
+    const accum s268 = c[191]+accum(z6)*c[1182]+accum(z9)*c[1181]+accum(z10)*c[1183]+accum(z14)*c[1185]
+        +accum(z15)*c[1187]+accum(z23)*c[1184]+accum(z27)*c[1186];
+    const accum s269 = accum(z12)*c[1203]+accum(z19)*c[1201]+accum(z25)*c[1202];
+    const accum s270 = accum(z7)*s264+accum(z8)*s265+accum(z11)*s266+accum(z13)*s267+accum(z17)*s268
+        +accum(z21)*s269;
+    const accum s271 = c[189]+accum(z6)*c[1159]+accum(z9)*c[1158]+accum(z10)*c[1160]+accum(z14)*c[1162]
+        +accum(z15)*c[1164]+accum(z23)*c[1161]+accum(z27)*c[1163];
+    const accum s272 = accum(z12)*c[1167]+accum(z19)*c[1165]+accum(z25)*c[1166];
+    const accum s273 = c[187]+accum(z6)*c[1145]+accum(z9)*c[1144]+accum(z10)*c[1146]+accum(z14)*c[1148]
+        +accum(z15)*c[1150]+accum(z23)*c[1147]+accum(z27)*c[1149];
+    const accum s274 = accum(z12)*c[1170]+accum(z19)*c[1168]+accum(z25)*c[1169];
+    const accum s275 = c[188]+accum(z6)*c[1152]+accum(z9)*c[1151]+accum(z10)*c[1153]+accum(z14)*c[1155]
+        +accum(z15)*c[1157]+accum(z23)*c[1154]+accum(z27)*c[1156];
+    const accum s276 = accum(z12)*c[1173]+accum(z19)*c[1171]+accum(z25)*c[1172];
+    const accum s277 = accum(z7)*s271+accum(z8)*s272+accum(z11)*s273+accum(z13)*s274+accum(z17)*s275
+        +accum(z21)*s276;
+    const accum s278 = c[178]+accum(z6)*c[1111]+accum(z10)*c[1112]+accum(z14)*c[1114]+accum(z15)*c[1116]
+        +accum(z23)*c[1113]+accum(z27)*c[1115];
+    const accum s279 = accum(z7)*c[1084];
+    const accum s280 = accum(z8)*c[1085]+accum(z13)*c[1086]+accum(z21)*c[1087];
+    const accum s281 = c[177]+accum(z6)*c[1103]+accum(z9)*c[1102]+accum(z10)*c[1104]+accum(z14)*c[1106]
+        +accum(z15)*c[1108]+accum(z23)*c[1105]+accum(z27)*c[1107];
+    const accum s282 = c[179]+accum(z10)*c[1117]+accum(z14)*c[1119]+accum(z15)*c[1121]+accum(z23)*c[1118]
+        +accum(z27)*c[1120];
+    const accum s283 = accum(z7)*c[1081]+accum(z11)*c[1079]+accum(z17)*c[1080];
+    const accum s284 = accum(z12)*c[1096];
+    const accum s285 = accum(z13)*c[1088]+accum(z21)*c[1089];
+    const accum s286 = c[181]+accum(z14)*c[1126]+accum(z15)*c[1128]+accum(z27)*c[1127];
+    const accum s287 = c[183]+accum(z15)*c[1131];
+    const accum s288 = accum(z16)*c[1073]+accum(z24)*c[1074]+accum(z28)*c[1075];
+    const accum s289 = accum(z7)*c[1083]+accum(z17)*c[1082];
+    const accum s290 = accum(z18)*c[1072];
+    const accum s291 = accum(z12)*c[1093]+accum(z19)*c[1091]+accum(z25)*c[1092];
+    const accum s292 = accum(z20)*c[1097]+accum(z26)*c[1099]+accum(z29)*c[1098];
+    const accum s293 = accum(z21)*c[1090];
+    const accum s294 = c[180]+accum(z14)*c[1123]+accum(z15)*c[1125]+accum(z23)*c[1122]+accum(z27)*c[1124];
+    const accum s295 = accum(z24)*c[1076]+accum(z28)*c[1077];
+    const accum s296 = accum(z12)*c[1095]+accum(z25)*c[1094];
+    const accum s297 = accum(z26)*c[1109];
+    const accum s298 = c[182]+accum(z15)*c[1130]+accum(z27)*c[1129];
+    const accum s299 = accum(z28)*c[1078];
+    const accum s300 = accum(z26)*c[1101]+accum(z29)*c[1100];
+    const accum s301 = accum(z30)*c[1110];
+    const accum s302 = accum(z6)*s278+accum(z7)*s279+accum(z8)*s280+accum(z9)*s281+accum(z10)*s282
+        +accum(z11)*s283+accum(z12)*s284+accum(z13)*s285+accum(z14)*s286+accum(z15)*s287+accum(z16)*s288
+        +accum(z17)*s289+accum(z18)*s290+accum(z19)*s291+accum(z20)*s292+accum(z21)*s293+accum(z23)*s294
+        +accum(z24)*s295+accum(z25)*s296+accum(z26)*s297+accum(z27)*s298+accum(z28)*s299+accum(z29)*s300
+        +accum(z30)*s301;
+    const accum s303 = c[201]+accum(z0)*c[1221]+accum(z2)*c[1220];
+    const accum s304 = c[199]+accum(z0)*c[1217]+accum(z2)*c[1216];
+    const accum s305 = c[200]+accum(z0)*c[1219]+accum(z2)*c[1218];
+    const accum s306 = accum(z12)*s303+accum(z19)*s304+accum(z25)*s305;
+    const accum s307 = c[203]+accum(z0)*c[1225]+accum(z2)*c[1224];
+    const accum s308 = c[202]+accum(z0)*c[1223]+accum(z2)*c[1222];
+    const accum s309 = c[204]+accum(z0)*c[1227]+accum(z2)*c[1226];
+    const accum s310 = c[206]+accum(z0)*c[1231]+accum(z2)*c[1230];
+    const accum s311 = c[208]+accum(z0)*c[1235]+accum(z2)*c[1234];
+    const accum s312 = c[205]+accum(z0)*c[1229]+accum(z2)*c[1228];
+    const accum s313 = c[207]+accum(z0)*c[1233]+accum(z2)*c[1232];
+    const accum s314 = c[10]+accum(z0)*c[210]+accum(z2)*c[209]+accum(z6)*s307+accum(z9)*s308+accum(z10)*s309
+        +accum(z14)*s310+accum(z15)*s311+accum(z23)*s312+accum(z27)*s313;
+    const accum s315 = c[195]+accum(z0)*c[1209]+accum(z2)*c[1208];
+    const accum s316 = c[193]+accum(z0)*c[1205]+accum(z2)*c[1204];
+    const accum s317 = c[194]+accum(z0)*c[1207]+accum(z2)*c[1206];
+    const accum s318 = accum(z12)*s315+accum(z19)*s316+accum(z25)*s317;
+    const accum s319 = c[212]+accum(z0)*c[1239]+accum(z2)*c[1238];
+    const accum s320 = c[211]+accum(z0)*c[1237]+accum(z2)*c[1236];
+    const accum s321 = c[213]+accum(z0)*c[1241]+accum(z2)*c[1240];
+    const accum s322 = c[215]+accum(z0)*c[1245]+accum(z2)*c[1244];
+    const accum s323 = c[217]+accum(z0)*c[1249]+accum(z2)*c[1248];
+    const accum s324 = c[214]+accum(z0)*c[1243]+accum(z2)*c[1242];
+    const accum s325 = c[216]+accum(z0)*c[1247]+accum(z2)*c[1246];
+    const accum s326 = c[11]+accum(z0)*c[219]+accum(z2)*c[218]+accum(z6)*s319+accum(z9)*s320+accum(z10)*s321
+        +accum(z14)*s322+accum(z15)*s323+accum(z23)*s324+accum(z27)*s325;
+    const accum s327 = c[198]+accum(z0)*c[1215]+accum(z2)*c[1214];
+    const accum s328 = c[196]+accum(z0)*c[1211]+accum(z2)*c[1210];
+    const accum s329 = c[197]+accum(z0)*c[1213]+accum(z2)*c[1212];
+    const accum s330 = accum(z12)*s327+accum(z19)*s328+accum(z25)*s329;
+    const accum s331 = accum(z16)*c[1135]+accum(z24)*c[1136]+accum(z28)*c[1137];
+    const accum s332 = accum(z16)*c[1132]+accum(z24)*c[1133]+accum(z28)*c[1134];
+    const accum s333 = c[184]+accum(z0)*c[1139]+accum(z2)*c[1138];
+    const accum s334 = c[186]+accum(z0)*c[1143]+accum(z2)*c[1142];
+    const accum s335 = c[185]+accum(z0)*c[1141]+accum(z2)*c[1140];
+    const accum s336 = accum(z1)*s331+accum(z4)*s332+accum(z20)*s333+accum(z26)*s334+accum(z29)*s335;
+    const accum s337 = c[221]+accum(z0)*c[1253]+accum(z2)*c[1252];
+    const accum s338 = c[220]+accum(z0)*c[1251]+accum(z2)*c[1250];
+    const accum s339 = c[222]+accum(z0)*c[1255]+accum(z2)*c[1254];
+    const accum s340 = c[224]+accum(z0)*c[1259]+accum(z2)*c[1258];
+    const accum s341 = c[226]+accum(z0)*c[1263]+accum(z2)*c[1262];
+    const accum s342 = c[223]+accum(z0)*c[1257]+accum(z2)*c[1256];
+    const accum s343 = c[225]+accum(z0)*c[1261]+accum(z2)*c[1260];
+    const accum s344 = c[12]+accum(z0)*c[228]+accum(z2)*c[227]+accum(z6)*s337+accum(z9)*s338+accum(z10)*s339
+        +accum(z14)*s340+accum(z15)*s341+accum(z23)*s342+accum(z27)*s343;
+    const accum s345 = accum(z1)*s270+accum(z4)*s277+accum(z5)*s302+accum(z7)*s306+accum(z8)*s314
+        +accum(z11)*s318+accum(z13)*s326+accum(z17)*s330+accum(z18)*s336+accum(z21)*s344;
+    const accum s346 = c[59]+accum(z0)*c[726];
+    const accum s347 = c[58]+accum(z0)*c[725]+accum(z2)*c[724];
+    const accum s348 = c[698]+accum(z0)*c[1671];
+    const accum s349 = c[697]+accum(z0)*c[1670]+accum(z2)*c[1669];
+    const accum s350 = c[52]+accum(z0)*s348+accum(z2)*s349+accum(z6)*c[691]+accum(z10)*c[692]
+        +accum(z14)*c[694]+accum(z15)*c[696]+accum(z23)*c[693]+accum(z27)*c[695];
+    const accum s351 = c[705]+accum(z0)*c[1674];
+    const accum s352 = c[704]+accum(z0)*c[1673]+accum(z2)*c[1672];
+    const accum s353 = c[53]+accum(z0)*s351+accum(z2)*s352+accum(z10)*c[699]+accum(z14)*c[701]
+        +accum(z15)*c[703]+accum(z23)*c[700]+accum(z27)*c[702];
+    const accum s354 = c[716]+accum(z0)*c[1680];
+    const accum s355 = c[715]+accum(z0)*c[1679]+accum(z2)*c[1678];
+    const accum s356 = c[55]+accum(z0)*s354+accum(z2)*s355+accum(z14)*c[712]+accum(z15)*c[714]
+        +accum(z27)*c[713];
+    const accum s357 = c[723]+accum(z0)*c[1686];
+    const accum s358 = c[722]+accum(z0)*c[1685]+accum(z2)*c[1684];
+    const accum s359 = c[57]+accum(z0)*s357+accum(z2)*s358+accum(z15)*c[721];
+    const accum s360 = c[711]+accum(z0)*c[1677];
+    const accum s361 = c[710]+accum(z0)*c[1676]+accum(z2)*c[1675];
+    const accum s362 = c[54]+accum(z0)*s360+accum(z2)*s361+accum(z14)*c[707]+accum(z15)*c[709]
+        +accum(z23)*c[706]+accum(z27)*c[708];
+    const accum s363 = c[720]+accum(z0)*c[1683];
+    const accum s364 = c[719]+accum(z0)*c[1682]+accum(z2)*c[1681];
+    const accum s365 = c[56]+accum(z0)*s363+accum(z2)*s364+accum(z15)*c[718]+accum(z27)*c[717];
+    const accum s366 = c[0]+accum(z0)*s346+accum(z2)*s347+accum(z6)*s350+accum(z10)*s353+accum(z14)*s356
+        +accum(z15)*s359+accum(z23)*s362+accum(z27)*s365;
+    const accum s367 = c[509]+accum(z0)*c[1608];
+    const accum s368 = c[508]+accum(z0)*c[1607]+accum(z2)*c[1606];
+    const accum s369 = c[31]+accum(z0)*s367+accum(z2)*s368+accum(z6)*c[502]+accum(z9)*c[501]+accum(z10)*c[503]
+        +accum(z14)*c[505]+accum(z15)*c[507]+accum(z23)*c[504]+accum(z27)*c[506];
+    const accum s370 = accum(z12)*c[512]+accum(z19)*c[510]+accum(z25)*c[511];
+    const accum s371 = accum(z12)*c[515]+accum(z19)*c[513]+accum(z25)*c[514];
+    const accum s372 = accum(z12)*c[518]+accum(z19)*c[516]+accum(z25)*c[517];
+    const accum s373 = accum(z7)*s369+accum(z8)*s370+accum(z13)*s371+accum(z21)*s372;
+    const accum s374 = c[527]+accum(z0)*c[1611];
+    const accum s375 = c[526]+accum(z0)*c[1610]+accum(z2)*c[1609];
+    const accum s376 = c[32]+accum(z0)*s374+accum(z2)*s375+accum(z6)*c[520]+accum(z9)*c[519]+accum(z10)*c[521]
+        +accum(z14)*c[523]+accum(z15)*c[525]+accum(z23)*c[522]+accum(z27)*c[524];
+    const accum s377 = c[536]+accum(z0)*c[1614];
+    const accum s378 = c[535]+accum(z0)*c[1613]+accum(z2)*c[1612];
+    const accum s379 = c[33]+accum(z0)*s377+accum(z2)*s378+accum(z6)*c[529]+accum(z9)*c[528]+accum(z10)*c[530]
+        +accum(z14)*c[532]+accum(z15)*c[534]+accum(z23)*c[531]+accum(z27)*c[533];
+    const accum s380 = c[545]+accum(z0)*c[1617];
+    const accum s381 = c[544]+accum(z0)*c[1616]+accum(z2)*c[1615];
+    const accum s382 = c[34]+accum(z0)*s380+accum(z2)*s381+accum(z6)*c[538]+accum(z9)*c[537]+accum(z10)*c[539]
+        +accum(z14)*c[541]+accum(z15)*c[543]+accum(z23)*c[540]+accum(z27)*c[542];
+    const accum s383 = accum(z8)*s376+accum(z13)*s379+accum(z21)*s382;
+    const accum s384 = c[673]+accum(z0)*c[1662];
+    const accum s385 = c[672]+accum(z0)*c[1661]+accum(z2)*c[1660];
+    const accum s386 = c[49]+accum(z0)*s384+accum(z2)*s385+accum(z6)*c[666]+accum(z10)*c[667]
+        +accum(z14)*c[669]+accum(z15)*c[671]+accum(z23)*c[668]+accum(z27)*c[670];
+    const accum s387 = accum(z9)*s386;
+    const accum s388 = c[66]+accum(z0)*c[754];
+    const accum s389 = c[65]+accum(z0)*c[753]+accum(z2)*c[752];
+    const accum s390 = c[733]+accum(z0)*c[1689];
+    const accum s391 = c[732]+accum(z0)*c[1688]+accum(z2)*c[1687];
+    const accum s392 = c[60]+accum(z0)*s390+accum(z2)*s391+accum(z10)*c[727]+accum(z14)*c[729]
+        +accum(z15)*c[731]+accum(z23)*c[728]+accum(z27)*c[730];
+    const accum s393 = c[744]+accum(z0)*c[1695];
+    const accum s394 = c[743]+accum(z0)*c[1694]+accum(z2)*c[1693];
+    const accum s395 = c[62]+accum(z0)*s393+accum(z2)*s394+accum(z14)*c[740]+accum(z15)*c[742]
+        +accum(z27)*c[741];
+    const accum s396 = c[751]+accum(z0)*c[1701];
+    const accum s397 = c[750]+accum(z0)*c[1700]+accum(z2)*c[1699];
+    const accum s398 = c[64]+accum(z0)*s396+accum(z2)*s397+accum(z15)*c[749];
+    const accum s399 = c[739]+accum(z0)*c[1692];
+    const accum s400 = c[738]+accum(z0)*c[1691]+accum(z2)*c[1690];
+    const accum s401 = c[61]+accum(z0)*s399+accum(z2)*s400+accum(z14)*c[735]+accum(z15)*c[737]
+        +accum(z23)*c[734]+accum(z27)*c[736];
+    const accum s402 = c[748]+accum(z0)*c[1698];
+    const accum s403 = c[747]+accum(z0)*c[1697]+accum(z2)*c[1696];
+    const accum s404 = c[63]+accum(z0)*s402+accum(z2)*s403+accum(z15)*c[746]+accum(z27)*c[745];
+    const accum s405 = c[1]+accum(z0)*s388+accum(z2)*s389+accum(z10)*s392+accum(z14)*s395+accum(z15)*s398
+        +accum(z23)*s401+accum(z27)*s404;
+    const accum s406 = c[464]+accum(z0)*c[1599];
+    const accum s407 = c[463]+accum(z0)*c[1598]+accum(z2)*c[1597];
+    const accum s408 = c[28]+accum(z0)*s406+accum(z2)*s407+accum(z6)*c[457]+accum(z9)*c[456]+accum(z10)*c[458]
+        +accum(z14)*c[460]+accum(z15)*c[462]+accum(z23)*c[459]+accum(z27)*c[461];
+    const accum s409 = accum(z12)*c[467]+accum(z19)*c[465]+accum(z25)*c[466];
+    const accum s410 = c[446]+accum(z0)*c[1593];
+    const accum s411 = c[445]+accum(z0)*c[1592]+accum(z2)*c[1591];
+    const accum s412 = c[26]+accum(z0)*s410+accum(z2)*s411+accum(z6)*c[439]+accum(z9)*c[438]+accum(z10)*c[440]
+        +accum(z14)*c[442]+accum(z15)*c[444]+accum(z23)*c[441]+accum(z27)*c[443];
+    const accum s413 = accum(z12)*c[470]+accum(z19)*c[468]+accum(z25)*c[469];
+    const accum s414 = c[455]+accum(z0)*c[1596];
+    const accum s415 = c[454]+accum(z0)*c[1595]+accum(z2)*c[1594];
+    const accum s416 = c[27]+accum(z0)*s414+accum(z2)*s415+accum(z6)*c[448]+accum(z9)*c[447]+accum(z10)*c[449]
+        +accum(z14)*c[451]+accum(z15)*c[453]+accum(z23)*c[450]+accum(z27)*c[452];
+    const accum s417 = accum(z12)*c[473]+accum(z19)*c[471]+accum(z25)*c[472];
+    const accum s418 = accum(z7)*s408+accum(z8)*s409+accum(z11)*s412+accum(z13)*s413+accum(z17)*s416
+        +accum(z21)*s417;
+    const accum s419 = c[620]+accum(z0)*c[1644];
+    const accum s420 = c[619]+accum(z0)*c[1643]+accum(z2)*c[1642];
+    const accum s421 = c[43]+accum(z0)*s419+accum(z2)*s420+accum(z6)*c[613]+accum(z10)*c[614]
+        +accum(z14)*c[616]+accum(z15)*c[618]+accum(z23)*c[615]+accum(z27)*c[617];
+    const accum s422 = accum(z12)*s421;
+    const accum s423 = c[554]+accum(z0)*c[1620];
+    const accum s424 = c[553]+accum(z0)*c[1619]+accum(z2)*c[1618];
+    const accum s425 = c[35]+accum(z0)*s423+accum(z2)*s424+accum(z6)*c[547]+accum(z9)*c[546]+accum(z10)*c[548]
+        +accum(z14)*c[550]+accum(z15)*c[552]+accum(z23)*c[549]+accum(z27)*c[551];
+    const accum s426 = c[563]+accum(z0)*c[1623];
+    const accum s427 = c[562]+accum(z0)*c[1622]+accum(z2)*c[1621];
+    const accum s428 = c[36]+accum(z0)*s426+accum(z2)*s427+accum(z6)*c[556]+accum(z9)*c[555]+accum(z10)*c[557]
+        +accum(z14)*c[559]+accum(z15)*c[561]+accum(z23)*c[558]+accum(z27)*c[560];
+    const accum s429 = accum(z13)*s425+accum(z21)*s428;
+    const accum s430 = c[77]+accum(z0)*c[790];
+    const accum s431 = c[76]+accum(z0)*c[789]+accum(z2)*c[788];
+    const accum s432 = c[780]+accum(z0)*c[1716];
+    const accum s433 = c[779]+accum(z0)*c[1715]+accum(z2)*c[1714];
+    const accum s434 = c[73]+accum(z0)*s432+accum(z2)*s433+accum(z14)*c[776]+accum(z15)*c[778]
+        +accum(z27)*c[777];
+    const accum s435 = c[787]+accum(z0)*c[1722];
+    const accum s436 = c[786]+accum(z0)*c[1721]+accum(z2)*c[1720];
+    const accum s437 = c[75]+accum(z0)*s435+accum(z2)*s436+accum(z15)*c[785];
+    const accum s438 = c[784]+accum(z0)*c[1719];
+    const accum s439 = c[783]+accum(z0)*c[1718]+accum(z2)*c[1717];
+    const accum s440 = c[74]+accum(z0)*s438+accum(z2)*s439+accum(z15)*c[782]+accum(z27)*c[781];
+    const accum s441 = c[3]+accum(z0)*s430+accum(z2)*s431+accum(z14)*s434+accum(z15)*s437+accum(z27)*s440;
+    const accum s442 = c[84]+accum(z0)*c[806];
+    const accum s443 = c[83]+accum(z0)*c[805]+accum(z2)*c[804];
+    const accum s444 = c[803]+accum(z0)*c[1731];
+    const accum s445 = c[802]+accum(z0)*c[1730]+accum(z2)*c[1729];
+    const accum s446 = c[82]+accum(z0)*s444+accum(z2)*s445+accum(z15)*c[801];
+    const accum s447 = c[5]+accum(z0)*s442+accum(z2)*s443+accum(z15)*s446;
+    const accum s448 = accum(z20)*c[390]+accum(z26)*c[392]+accum(z29)*c[391];
+    const accum s449 = c[365]+accum(z0)*c[1575];
+    const accum s450 = c[364]+accum(z0)*c[1574]+accum(z2)*c[1573];
+    const accum s451 = c[20]+accum(z0)*s449+accum(z2)*s450+accum(z6)*c[358]+accum(z10)*c[359]
+        +accum(z14)*c[361]+accum(z15)*c[363]+accum(z23)*c[360]+accum(z27)*c[362]+accum(z30)*c[357];
+    const accum s452 = accum(z20)*c[384]+accum(z26)*c[386]+accum(z29)*c[385];
+    const accum s453 = c[374]+accum(z0)*c[1578];
+    const accum s454 = c[373]+accum(z0)*c[1577]+accum(z2)*c[1576];
+    const accum s455 = c[21]+accum(z0)*s453+accum(z2)*s454+accum(z6)*c[367]+accum(z10)*c[368]
+        +accum(z14)*c[370]+accum(z15)*c[372]+accum(z23)*c[369]+accum(z27)*c[371]+accum(z30)*c[366];
+    const accum s456 = accum(z20)*c[387]+accum(z26)*c[389]+accum(z29)*c[388];
+    const accum s457 = c[383]+accum(z0)*c[1581];
+    const accum s458 = c[382]+accum(z0)*c[1580]+accum(z2)*c[1579];
+    const accum s459 = c[22]+accum(z0)*s457+accum(z2)*s458+accum(z6)*c[376]+accum(z10)*c[377]
+        +accum(z14)*c[379]+accum(z15)*c[381]+accum(z23)*c[378]+accum(z27)*c[380]+accum(z30)*c[375];
+    const accum s460 = accum(z12)*s448+accum(z16)*s451+accum(z19)*s452+accum(z24)*s455+accum(z25)*s456
+        +accum(z28)*s459;
+    const accum s461 = c[491]+accum(z0)*c[1605];
+    const accum s462 = c[490]+accum(z0)*c[1604]+accum(z2)*c[1603];
+    const accum s463 = c[30]+accum(z0)*s461+accum(z2)*s462+accum(z6)*c[484]+accum(z9)*c[483]+accum(z10)*c[485]
+        +accum(z14)*c[487]+accum(z15)*c[489]+accum(z23)*c[486]+accum(z27)*c[488];
+    const accum s464 = accum(z12)*c[494]+accum(z19)*c[492]+accum(z25)*c[493];
+    const accum s465 = accum(z12)*c[497]+accum(z19)*c[495]+accum(z25)*c[496];
+    const accum s466 = c[482]+accum(z0)*c[1602];
+    const accum s467 = c[481]+accum(z0)*c[1601]+accum(z2)*c[1600];
+    const accum s468 = c[29]+accum(z0)*s466+accum(z2)*s467+accum(z6)*c[475]+accum(z9)*c[474]+accum(z10)*c[476]
+        +accum(z14)*c[478]+accum(z15)*c[480]+accum(z23)*c[477]+accum(z27)*c[479];
+    const accum s469 = accum(z12)*c[500]+accum(z19)*c[498]+accum(z25)*c[499];
+    const accum s470 = accum(z7)*s463+accum(z8)*s464+accum(z13)*s465+accum(z17)*s468+accum(z21)*s469;
+    const accum s471 = accum(z20)*c[246]+accum(z26)*c[248]+accum(z29)*c[247];
+    const accum s472 = accum(z20)*c[249]+accum(z26)*c[251]+accum(z29)*c[250];
+    const accum s473 = accum(z7)*c[239]+accum(z11)*c[237]+accum(z17)*c[238];
+    const accum s474 = c[236]+accum(z0)*c[1269];
+    const accum s475 = accum(z1)*c[1266];
+    const accum s476 = c[235]+accum(z0)*c[1268]+accum(z2)*c[1267];
+    const accum s477 = accum(z1)*c[1265]+accum(z4)*c[1264];
+    const accum s478 = c[13]+accum(z0)*s474+accum(z1)*s475+accum(z2)*s476+accum(z4)*s477+accum(z6)*c[229]
+        +accum(z10)*c[230]+accum(z14)*c[232]+accum(z15)*c[234]+accum(z23)*c[231]+accum(z27)*c[233];
+    const accum s479 = accum(z20)*c[252]+accum(z26)*c[254]+accum(z29)*c[253];
+    const accum s480 = accum(z7)*c[242]+accum(z11)*c[240]+accum(z17)*c[241];
+    const accum s481 = accum(z7)*c[245]+accum(z11)*c[243]+accum(z17)*c[244];
+    const accum s482 = accum(z8)*s471+accum(z13)*s472+accum(z16)*s473+accum(z18)*s478+accum(z21)*s479
+        +accum(z24)*s480+accum(z28)*s481;
+    const accum s483 = c[596]+accum(z0)*c[1635];
+    const accum s484 = c[595]+accum(z0)*c[1634]+accum(z2)*c[1633];
+    const accum s485 = c[40]+accum(z0)*s483+accum(z2)*s484+accum(z6)*c[589]+accum(z10)*c[590]
+        +accum(z14)*c[592]+accum(z15)*c[594]+accum(z23)*c[591]+accum(z27)*c[593];
+    const accum s486 = c[580]+accum(z0)*c[1629];
+    const accum s487 = c[579]+accum(z0)*c[1628]+accum(z2)*c[1627];
+    const accum s488 = c[38]+accum(z0)*s486+accum(z2)*s487+accum(z6)*c[573]+accum(z10)*c[574]
+        +accum(z14)*c[576]+accum(z15)*c[578]+accum(z23)*c[575]+accum(z27)*c[577];
+    const accum s489 = c[588]+accum(z0)*c[1632];
+    const accum s490 = c[587]+accum(z0)*c[1631]+accum(z2)*c[1630];
+    const accum s491 = c[39]+accum(z0)*s489+accum(z2)*s490+accum(z6)*c[581]+accum(z10)*c[582]
+        +accum(z14)*c[584]+accum(z15)*c[586]+accum(z23)*c[583]+accum(z27)*c[585];
+    const accum s492 = accum(z12)*s485+accum(z19)*s488+accum(z25)*s491;
+    const accum s493 = c[629]+accum(z0)*c[1647];
+    const accum s494 = c[628]+accum(z0)*c[1646]+accum(z2)*c[1645];
+    const accum s495 = c[44]+accum(z0)*s493+accum(z2)*s494+accum(z6)*c[622]+accum(z10)*c[623]
+        +accum(z14)*c[625]+accum(z15)*c[627]+accum(z23)*c[624]+accum(z27)*c[626]+accum(z30)*c[621];
+    const accum s496 = c[647]+accum(z0)*c[1653];
+    const accum s497 = c[646]+accum(z0)*c[1652]+accum(z2)*c[1651];
+    const accum s498 = c[46]+accum(z0)*s496+accum(z2)*s497+accum(z6)*c[640]+accum(z10)*c[641]
+        +accum(z14)*c[643]+accum(z15)*c[645]+accum(z23)*c[642]+accum(z27)*c[644]+accum(z30)*c[639];
+    const accum s499 = c[638]+accum(z0)*c[1650];
+    const accum s500 = c[637]+accum(z0)*c[1649]+accum(z2)*c[1648];
+    const accum s501 = c[45]+accum(z0)*s499+accum(z2)*s500+accum(z6)*c[631]+accum(z10)*c[632]
+        +accum(z14)*c[634]+accum(z15)*c[636]+accum(z23)*c[633]+accum(z27)*c[635]+accum(z30)*c[630];
+    const accum s502 = accum(z20)*s495+accum(z26)*s498+accum(z29)*s501;
+    const accum s503 = c[572]+accum(z0)*c[1626];
+    const accum s504 = c[571]+accum(z0)*c[1625]+accum(z2)*c[1624];
+    const accum s505 = c[37]+accum(z0)*s503+accum(z2)*s504+accum(z6)*c[565]+accum(z9)*c[564]+accum(z10)*c[566]
+        +accum(z14)*c[568]+accum(z15)*c[570]+accum(z23)*c[567]+accum(z27)*c[569];
+    const accum s506 = accum(z21)*s505;
+    const accum s507 = accum(z20)*c[1059]+accum(z26)*c[1061]+accum(z29)*c[1060];
+    const accum s508 = accum(z20)*c[1056]+accum(z26)*c[1058]+accum(z29)*c[1057];
+    const accum s509 = c[151]+accum(z0)*c[1063]+accum(z2)*c[1062];
+    const accum s510 = c[152]+accum(z0)*c[1065]+accum(z2)*c[1064];
+    const accum s511 = c[153]+accum(z0)*c[1067]+accum(z2)*c[1066];
+    const accum s512 = accum(z1)*s507+accum(z4)*s508+accum(z16)*s509+accum(z24)*s510+accum(z28)*s511;
+    const accum s513 = accum(z20)*c[174]+accum(z26)*c[176]+accum(z29)*c[175];
+    const accum s514 = accum(z20)*c[168]+accum(z26)*c[170]+accum(z29)*c[169];
+    const accum s515 = accum(z8)*c[159]+accum(z13)*c[160]+accum(z21)*c[161];
+    const accum s516 = accum(z20)*c[171]+accum(z26)*c[173]+accum(z29)*c[172];
+    const accum s517 = c[155]+accum(z0)*c[1071]+accum(z2)*c[1070];
+    const accum s518 = c[154]+accum(z0)*c[1069]+accum(z2)*c[1068];
+    const accum s519 = accum(z1)*s517+accum(z4)*s518+accum(z12)*c[158]+accum(z19)*c[156]+accum(z25)*c[157];
+    const accum s520 = c[150]+accum(z0)*c[1055];
+    const accum s521 = accum(z1)*c[1052];
+    const accum s522 = c[149]+accum(z0)*c[1054]+accum(z2)*c[1053];
+    const accum s523 = accum(z1)*c[1051]+accum(z4)*c[1050];
+    const accum s524 = accum(z5)*c[1049];
+    const accum s525 = c[9]+accum(z0)*s520+accum(z1)*s521+accum(z2)*s522+accum(z4)*s523+accum(z5)*s524
+        +accum(z6)*c[143]+accum(z10)*c[144]+accum(z14)*c[146]+accum(z15)*c[148]+accum(z23)*c[145]
+        +accum(z27)*c[147];
+    const accum s526 = accum(z8)*c[162]+accum(z13)*c[163]+accum(z21)*c[164];
+    const accum s527 = accum(z8)*c[165]+accum(z13)*c[166]+accum(z21)*c[167];
+    const accum s528 = accum(z5)*s512+accum(z7)*s513+accum(z11)*s514+accum(z16)*s515+accum(z17)*s516
+        +accum(z18)*s519+accum(z22)*s525+accum(z24)*s526+accum(z28)*s527;
+    const accum s529 = c[72]+accum(z0)*c[775];
+    const accum s530 = c[71]+accum(z0)*c[774]+accum(z2)*c[773];
+    const accum s531 = c[765]+accum(z0)*c[1707];
+    const accum s532 = c[764]+accum(z0)*c[1706]+accum(z2)*c[1705];
+    const accum s533 = c[68]+accum(z0)*s531+accum(z2)*s532+accum(z14)*c[761]+accum(z15)*c[763]
+        +accum(z27)*c[762];
+    const accum s534 = c[772]+accum(z0)*c[1713];
+    const accum s535 = c[771]+accum(z0)*c[1712]+accum(z2)*c[1711];
+    const accum s536 = c[70]+accum(z0)*s534+accum(z2)*s535+accum(z15)*c[770];
+    const accum s537 = c[760]+accum(z0)*c[1704];
+    const accum s538 = c[759]+accum(z0)*c[1703]+accum(z2)*c[1702];
+    const accum s539 = c[67]+accum(z0)*s537+accum(z2)*s538+accum(z14)*c[756]+accum(z15)*c[758]
+        +accum(z23)*c[755]+accum(z27)*c[757];
+    const accum s540 = c[769]+accum(z0)*c[1710];
+    const accum s541 = c[768]+accum(z0)*c[1709]+accum(z2)*c[1708];
+    const accum s542 = c[69]+accum(z0)*s540+accum(z2)*s541+accum(z15)*c[767]+accum(z27)*c[766];
+    const accum s543 = c[2]+accum(z0)*s529+accum(z2)*s530+accum(z14)*s533+accum(z15)*s536+accum(z23)*s539
+        +accum(z27)*s542;
+    const accum s544 = accum(z20)*c[417]+accum(z26)*c[419]+accum(z29)*c[418];
+    const accum s545 = accum(z20)*c[411]+accum(z26)*c[413]+accum(z29)*c[412];
+    const accum s546 = c[401]+accum(z0)*c[1584];
+    const accum s547 = c[400]+accum(z0)*c[1583]+accum(z2)*c[1582];
+    const accum s548 = c[23]+accum(z0)*s546+accum(z2)*s547+accum(z6)*c[394]+accum(z10)*c[395]
+        +accum(z14)*c[397]+accum(z15)*c[399]+accum(z23)*c[396]+accum(z27)*c[398]+accum(z30)*c[393];
+    const accum s549 = accum(z20)*c[414]+accum(z26)*c[416]+accum(z29)*c[415];
+    const accum s550 = c[410]+accum(z0)*c[1587];
+    const accum s551 = c[409]+accum(z0)*c[1586]+accum(z2)*c[1585];
+    const accum s552 = c[24]+accum(z0)*s550+accum(z2)*s551+accum(z6)*c[403]+accum(z10)*c[404]
+        +accum(z14)*c[406]+accum(z15)*c[408]+accum(z23)*c[405]+accum(z27)*c[407]+accum(z30)*c[402];
+    const accum s553 = accum(z12)*s544+accum(z19)*s545+accum(z24)*s548+accum(z25)*s549+accum(z28)*s552;
+    const accum s554 = c[612]+accum(z0)*c[1641];
+    const accum s555 = c[611]+accum(z0)*c[1640]+accum(z2)*c[1639];
+    const accum s556 = c[42]+accum(z0)*s554+accum(z2)*s555+accum(z6)*c[605]+accum(z10)*c[606]
+        +accum(z14)*c[608]+accum(z15)*c[610]+accum(z23)*c[607]+accum(z27)*c[609];
+    const accum s557 = c[604]+accum(z0)*c[1638];
+    const accum s558 = c[603]+accum(z0)*c[1637]+accum(z2)*c[1636];
+    const accum s559 = c[41]+accum(z0)*s557+accum(z2)*s558+accum(z6)*c[597]+accum(z10)*c[598]
+        +accum(z14)*c[600]+accum(z15)*c[602]+accum(z23)*c[599]+accum(z27)*c[601];
+    const accum s560 = accum(z12)*s556+accum(z25)*s559;
+    const accum s561 = c[682]+accum(z0)*c[1665];
+    const accum s562 = c[681]+accum(z0)*c[1664]+accum(z2)*c[1663];
+    const accum s563 = c[50]+accum(z0)*s561+accum(z2)*s562+accum(z6)*c[675]+accum(z10)*c[676]
+        +accum(z14)*c[678]+accum(z15)*c[680]+accum(z23)*c[677]+accum(z27)*c[679]+accum(z30)*c[674];
+    const accum s564 = accum(z26)*s563;
+    const accum s565 = c[81]+accum(z0)*c[800];
+    const accum s566 = c[80]+accum(z0)*c[799]+accum(z2)*c[798];
+    const accum s567 = c[797]+accum(z0)*c[1728];
+    const accum s568 = c[796]+accum(z0)*c[1727]+accum(z2)*c[1726];
+    const accum s569 = c[79]+accum(z0)*s567+accum(z2)*s568+accum(z15)*c[795];
+    const accum s570 = c[794]+accum(z0)*c[1725];
+    const accum s571 = c[793]+accum(z0)*c[1724]+accum(z2)*c[1723];
+    const accum s572 = c[78]+accum(z0)*s570+accum(z2)*s571+accum(z15)*c[792]+accum(z27)*c[791];
+    const accum s573 = c[4]+accum(z0)*s565+accum(z2)*s566+accum(z15)*s569+accum(z27)*s572;
+    const accum s574 = accum(z20)*c[435]+accum(z26)*c[437]+accum(z29)*c[436];
+    const accum s575 = accum(z20)*c[429]+accum(z26)*c[431]+accum(z29)*c[430];
+    const accum s576 = accum(z20)*c[432]+accum(z26)*c[434]+accum(z29)*c[433];
+    const accum s577 = c[428]+accum(z0)*c[1590];
+    const accum s578 = c[427]+accum(z0)*c[1589]+accum(z2)*c[1588];
+    const accum s579 = c[25]+accum(z0)*s577+accum(z2)*s578+accum(z6)*c[421]+accum(z10)*c[422]
+        +accum(z14)*c[424]+accum(z15)*c[426]+accum(z23)*c[423]+accum(z27)*c[425]+accum(z30)*c[420];
+    const accum s580 = accum(z12)*s574+accum(z19)*s575+accum(z25)*s576+accum(z28)*s579;
+    const accum s581 = c[665]+accum(z0)*c[1659];
+    const accum s582 = c[664]+accum(z0)*c[1658]+accum(z2)*c[1657];
+    const accum s583 = c[48]+accum(z0)*s581+accum(z2)*s582+accum(z6)*c[658]+accum(z10)*c[659]
+        +accum(z14)*c[661]+accum(z15)*c[663]+accum(z23)*c[660]+accum(z27)*c[662]+accum(z30)*c[657];
+    const accum s584 = c[656]+accum(z0)*c[1656];
+    const accum s585 = c[655]+accum(z0)*c[1655]+accum(z2)*c[1654];
+    const accum s586 = c[47]+accum(z0)*s584+accum(z2)*s585+accum(z6)*c[649]+accum(z10)*c[650]
+        +accum(z14)*c[652]+accum(z15)*c[654]+accum(z23)*c[651]+accum(z27)*c[653]+accum(z30)*c[648];
+    const accum s587 = accum(z26)*s583+accum(z29)*s586;
+    const accum s588 = c[690]+accum(z0)*c[1668];
+    const accum s589 = c[689]+accum(z0)*c[1667]+accum(z2)*c[1666];
+    const accum s590 = c[51]+accum(z0)*s588+accum(z2)*s589+accum(z6)*c[683]+accum(z10)*c[684]
+        +accum(z14)*c[686]+accum(z15)*c[688]+accum(z23)*c[685]+accum(z27)*c[687];
+    const accum s591 = accum(z30)*s590;
+    const accum energy = accum(z1)*s69+accum(z3)*s169+accum(z4)*s263+accum(z5)*s345+accum(z6)*s366
+        +accum(z7)*s373+accum(z8)*s383+accum(z9)*s387+accum(z10)*s405+accum(z11)*s418+accum(z12)*s422
+        +accum(z13)*s429+accum(z14)*s441+accum(z15)*s447+accum(z16)*s460+accum(z17)*s470+accum(z18)*s482
+        +accum(z19)*s492+accum(z20)*s502+accum(z21)*s506+accum(z22)*s528+accum(z23)*s543+accum(z24)*s553
+        +accum(z25)*s560+accum(z26)*s564+accum(z27)*s573+accum(z28)*s580+accum(z29)*s587+accum(z30)*s591;
+
+    if (!gradient)
+        return energy;
+
+    // adjoints of the inner sums, the products of their factors
+    const real p0 = z1*z1;
+    const real p1 = p0*z6;
+    const real p2 = p0*z7;
+    const real p3 = p0*z8;
+    const real p4 = p0*z9;
+    const real p5 = p0*z10;
+    const real p6 = p0*z11;
+    const real p7 = p0*z12;
+    const real p8 = p0*z13;
+    const real p9 = p0*z14;
+    const real p10 = p0*z15;
+    const real p11 = p0*z16;
+    const real p12 = p0*z17;
+    const real p13 = p0*z19;
+    const real p14 = p0*z20;
+    const real p15 = p0*z21;
+    const real p16 = p0*z23;
+    const real p17 = p0*z24;
+    const real p18 = p0*z25;
+    const real p19 = p0*z26;
+    const real p20 = p0*z27;
+    const real p21 = p0*z28;
+    const real p22 = p0*z29;
+    const real p23 = p0*z30;
+    const real p24 = z1*z7;
+    const real p25 = p24*z8;
+    const real p26 = p24*z13;
+    const real p27 = p24*z21;
+    const real p28 = z1*z11;
+    const real p29 = p28*z8;
+    const real p30 = p28*z13;
+    const real p31 = p28*z21;
+    const real p32 = z1*z12;
+    const real p33 = p32*z6;
+    const real p34 = p32*z10;
+    const real p35 = p32*z14;
+    const real p36 = p32*z15;
+    const real p37 = p32*z23;
+    const real p38 = p32*z27;
+    const real p39 = z1*z16;
+    const real p40 = p39*z20;
+    const real p41 = p39*z26;
+    const real p42 = p39*z29;
+    const real p43 = z1*z17;
+    const real p44 = p43*z8;
+    const real p45 = p43*z13;
+    const real p46 = p43*z21;
+    const real p47 = z1*z19;
+    const real p48 = p47*z6;
+    const real p49 = p47*z10;
+    const real p50 = p47*z14;
+    const real p51 = p47*z15;
+    const real p52 = p47*z23;
+    const real p53 = p47*z27;
+    const real p54 = z1*z24;
+    const real p55 = p54*z20;
+    const real p56 = p54*z26;
+    const real p57 = p54*z29;
+    const real p58 = z1*z25;
+    const real p59 = p58*z6;
+    const real p60 = p58*z10;
+    const real p61 = p58*z14;
+    const real p62 = p58*z15;
+    const real p63 = p58*z23;
+    const real p64 = p58*z27;
+    const real p65 = z1*z28;
+    const real p66 = p65*z20;
+    const real p67 = p65*z26;
+    const real p68 = p65*z29;
+    const real p69 = z3*z1;
+    const real p70 = p69*z7;
+    const real p71 = p69*z8;
+    const real p72 = p69*z11;
+    const real p73 = p69*z13;
+    const real p74 = p69*z17;
+    const real p75 = p69*z21;
+    const real p76 = z3*z3;
+    const real p77 = p76*z6;
+    const real p78 = p76*z7;
+    const real p79 = p76*z8;
+    const real p80 = p76*z9;
+    const real p81 = p76*z10;
+    const real p82 = p76*z11;
+    const real p83 = p76*z12;
+    const real p84 = p76*z13;
+    const real p85 = p76*z14;
+    const real p86 = p76*z15;
+    const real p87 = p76*z16;
+    const real p88 = p76*z17;
+    const real p89 = p76*z18;
+    const real p90 = p76*z19;
+    const real p91 = p76*z20;
+    const real p92 = p76*z21;
+    const real p93 = p76*z22;
+    const real p94 = p76*z23;
+    const real p95 = p76*z24;
+    const real p96 = p76*z25;
+    const real p97 = p76*z26;
+    const real p98 = p76*z27;
+    const real p99 = p76*z28;
+    const real p100 = p76*z29;
+    const real p101 = p76*z30;
+    const real p102 = z3*z4;
+    const real p103 = p102*z7;
+    const real p104 = p102*z8;
+    const real p105 = p102*z11;
+    const real p106 = p102*z13;
+    const real p107 = p102*z17;
+    const real p108 = p102*z21;
+    const real p109 = z3*z5;
+    const real p110 = p109*z7;
+    const real p111 = p109*z11;
+    const real p112 = p109*z12;
+    const real p113 = p109*z16;
+    const real p114 = p109*z17;
+    const real p115 = p109*z19;
+    const real p116 = p109*z24;
+    const real p117 = p109*z25;
+    const real p118 = p109*z28;
+    const real p119 = z3*z7;
+    const real p120 = p119*z6;
+    const real p121 = p119*z9;
+    const real p122 = p119*z10;
+    const real p123 = p119*z14;
+    const real p124 = p119*z15;
+    const real p125 = p119*z23;
+    const real p126 = p119*z27;
+    const real p127 = z3*z8;
+    const real p128 = p127*z12;
+    const real p129 = p127*z19;
+    const real p130 = p127*z25;
+    const real p131 = z3*z11;
+    const real p132 = p131*z6;
+    const real p133 = p131*z9;
+    const real p134 = p131*z10;
+    const real p135 = p131*z14;
+    const real p136 = p131*z15;
+    const real p137 = p131*z23;
+    const real p138 = p131*z27;
+    const real p139 = z3*z13;
+    const real p140 = p139*z12;
+    const real p141 = p139*z19;
+    const real p142 = p139*z25;
+    const real p143 = z3*z17;
+    const real p144 = p143*z6;
+    const real p145 = p143*z9;
+    const real p146 = p143*z10;
+    const real p147 = p143*z14;
+    const real p148 = p143*z15;
+    const real p149 = p143*z23;
+    const real p150 = p143*z27;
+    const real p151 = z3*z18;
+    const real p152 = p151*z1;
+    const real p153 = p151*z4;
+    const real p154 = p151*z16;
+    const real p155 = p151*z24;
+    const real p156 = p151*z28;
+    const real p157 = z3*z21;
+    const real p158 = p157*z12;
+    const real p159 = p157*z19;
+    const real p160 = p157*z25;
+    const real p161 = z3*z22;
+    const real p162 = p161*z1;
+    const real p163 = p161*z4;
+    const real p164 = p161*z5;
+    const real p165 = p161*z20;
+    const real p166 = p161*z26;
+    const real p167 = p161*z29;
+    const real p168 = z4*z1;
+    const real p169 = p168*z6;
+    const real p170 = p168*z7;
+    const real p171 = p168*z8;
+    const real p172 = p168*z9;
+    const real p173 = p168*z10;
+    const real p174 = p168*z11;
+    const real p175 = p168*z12;
+    const real p176 = p168*z13;
+    const real p177 = p168*z14;
+    const real p178 = p168*z15;
+    const real p179 = p168*z16;
+    const real p180 = p168*z17;
+    const real p181 = p168*z19;
+    const real p182 = p168*z20;
+    const real p183 = p168*z21;
+    const real p184 = p168*z23;
+    const real p185 = p168*z24;
+    const real p186 = p168*z25;
+    const real p187 = p168*z26;
+    const real p188 = p168*z27;
+    const real p189 = p168*z28;
+    const real p190 = p168*z29;
+    const real p191 = p168*z30;
+    const real p192 = z4*z4;
+    const real p193 = p192*z6;
+    const real p194 = p192*z7;
+    const real p195 = p192*z8;
+    const real p196 = p192*z9;
+    const real p197 = p192*z10;
+    const real p198 = p192*z11;
+    const real p199 = p192*z12;
+    const real p200 = p192*z13;
+    const real p201 = p192*z14;
+    const real p202 = p192*z15;
+    const real p203 = p192*z16;
+    const real p204 = p192*z17;
+    const real p205 = p192*z19;
+    const real p206 = p192*z20;
+    const real p207 = p192*z21;
+    const real p208 = p192*z23;
+    const real p209 = p192*z24;
+    const real p210 = p192*z25;
+    const real p211 = p192*z26;
+    const real p212 = p192*z27;
+    const real p213 = p192*z28;
+    const real p214 = p192*z29;
+    const real p215 = p192*z30;
+    const real p216 = z4*z7;
+    const real p217 = p216*z8;
+    const real p218 = p216*z13;
+    const real p219 = p216*z21;
+    const real p220 = z4*z11;
+    const real p221 = p220*z8;
+    const real p222 = p220*z13;
+    const real p223 = p220*z21;
+    const real p224 = z4*z12;
+    const real p225 = p224*z6;
+    const real p226 = p224*z10;
+    const real p227 = p224*z14;
+    const real p228 = p224*z15;
+    const real p229 = p224*z23;
+    const real p230 = p224*z27;
+    const real p231 = z4*z16;
+    const real p232 = p231*z20;
+    const real p233 = p231*z26;
+    const real p234 = p231*z29;
+    const real p235 = z4*z17;
+    const real p236 = p235*z8;
+    const real p237 = p235*z13;
+    const real p238 = p235*z21;
+    const real p239 = z4*z19;
+    const real p240 = p239*z6;
+    const real p241 = p239*z10;
+    const real p242 = p239*z14;
+    const real p243 = p239*z15;
+    const real p244 = p239*z23;
+    const real p245 = p239*z27;
+    const real p246 = z4*z24;
+    const real p247 = p246*z20;
+    const real p248 = p246*z26;
+    const real p249 = p246*z29;
+    const real p250 = z4*z25;
+    const real p251 = p250*z6;
+    const real p252 = p250*z10;
+    const real p253 = p250*z14;
+    const real p254 = p250*z15;
+    const real p255 = p250*z23;
+    const real p256 = p250*z27;
+    const real p257 = z4*z28;
+    const real p258 = p257*z20;
+    const real p259 = p257*z26;
+    const real p260 = p257*z29;
+    const real p261 = z5*z1;
+    const real p262 = p261*z7;
+    const real p263 = p261*z8;
+    const real p264 = p261*z11;
+    const real p265 = p261*z13;
+    const real p266 = p261*z17;
+    const real p267 = p261*z21;
+    const real p268 = z5*z4;
+    const real p269 = p268*z7;
+    const real p270 = p268*z8;
+    const real p271 = p268*z11;
+    const real p272 = p268*z13;
+    const real p273 = p268*z17;
+    const real p274 = p268*z21;
+    const real p275 = z5*z5;
+    const real p276 = p275*z6;
+    const real p277 = p275*z7;
+    const real p278 = p275*z8;
+    const real p279 = p275*z9;
+    const real p280 = p275*z10;
+    const real p281 = p275*z11;
+    const real p282 = p275*z12;
+    const real p283 = p275*z13;
+    const real p284 = p275*z14;
+    const real p285 = p275*z15;
+    const real p286 = p275*z16;
+    const real p287 = p275*z17;
+    const real p288 = p275*z18;
+    const real p289 = p275*z19;
+    const real p290 = p275*z20;
+    const real p291 = p275*z21;
+    const real p292 = p275*z23;
+    const real p293 = p275*z24;
+    const real p294 = p275*z25;
+    const real p295 = p275*z26;
+    const real p296 = p275*z27;
+    const real p297 = p275*z28;
+    const real p298 = p275*z29;
+    const real p299 = p275*z30;
+    const real p300 = z5*z7;
+    const real p301 = p300*z12;
+    const real p302 = p300*z19;
+    const real p303 = p300*z25;
+    const real p304 = z5*z8;
+    const real p305 = p304*z6;
+    const real p306 = p304*z9;
+    const real p307 = p304*z10;
+    const real p308 = p304*z14;
+    const real p309 = p304*z15;
+    const real p310 = p304*z23;
+    const real p311 = p304*z27;
+    const real p312 = z5*z11;
+    const real p313 = p312*z12;
+    const real p314 = p312*z19;
+    const real p315 = p312*z25;
+    const real p316 = z5*z13;
+    const real p317 = p316*z6;
+    const real p318 = p316*z9;
+    const real p319 = p316*z10;
+    const real p320 = p316*z14;
+    const real p321 = p316*z15;
+    const real p322 = p316*z23;
+    const real p323 = p316*z27;
+    const real p324 = z5*z17;
+    const real p325 = p324*z12;
+    const real p326 = p324*z19;
+    const real p327 = p324*z25;
+    const real p328 = z5*z18;
+    const real p329 = p328*z1;
+    const real p330 = p328*z4;
+    const real p331 = p328*z20;
+    const real p332 = p328*z26;
+    const real p333 = p328*z29;
+    const real p334 = z5*z21;
+    const real p335 = p334*z6;
+    const real p336 = p334*z9;
+    const real p337 = p334*z10;
+    const real p338 = p334*z14;
+    const real p339 = p334*z15;
+    const real p340 = p334*z23;
+    const real p341 = p334*z27;
+    const real p342 = z6*z0;
+    const real p343 = z6*z2;
+    const real p344 = z6*z6;
+    const real p345 = p344*z0;
+    const real p346 = p344*z2;
+    const real p347 = z6*z10;
+    const real p348 = p347*z0;
+    const real p349 = p347*z2;
+    const real p350 = z6*z14;
+    const real p351 = p350*z0;
+    const real p352 = p350*z2;
+    const real p353 = z6*z15;
+    const real p354 = p353*z0;
+    const real p355 = p353*z2;
+    const real p356 = z6*z23;
+    const real p357 = p356*z0;
+    const real p358 = p356*z2;
+    const real p359 = z6*z27;
+    const real p360 = p359*z0;
+    const real p361 = p359*z2;
+    const real p362 = z7*z7;
+    const real p363 = p362*z0;
+    const real p364 = p362*z2;
+    const real p365 = z7*z8;
+    const real p366 = z7*z13;
+    const real p367 = z7*z21;
+    const real p368 = z8*z8;
+    const real p369 = p368*z0;
+    const real p370 = p368*z2;
+    const real p371 = z8*z13;
+    const real p372 = p371*z0;
+    const real p373 = p371*z2;
+    const real p374 = z8*z21;
+    const real p375 = p374*z0;
+    const real p376 = p374*z2;
+    const real p377 = z9*z9;
+    const real p378 = p377*z0;
+    const real p379 = p377*z2;
+    const real p380 = z10*z0;
+    const real p381 = z10*z2;
+    const real p382 = z10*z10;
+    const real p383 = p382*z0;
+    const real p384 = p382*z2;
+    const real p385 = z10*z14;
+    const real p386 = p385*z0;
+    const real p387 = p385*z2;
+    const real p388 = z10*z15;
+    const real p389 = p388*z0;
+    const real p390 = p388*z2;
+    const real p391 = z10*z23;
+    const real p392 = p391*z0;
+    const real p393 = p391*z2;
+    const real p394 = z10*z27;
+    const real p395 = p394*z0;
+    const real p396 = p394*z2;
+    const real p397 = z11*z7;
+    const real p398 = p397*z0;
+    const real p399 = p397*z2;
+    const real p400 = z11*z8;
+    const real p401 = z11*z11;
+    const real p402 = p401*z0;
+    const real p403 = p401*z2;
+    const real p404 = z11*z13;
+    const real p405 = z11*z17;
+    const real p406 = p405*z0;
+    const real p407 = p405*z2;
+    const real p408 = z11*z21;
+    const real p409 = z12*z12;
+    const real p410 = p409*z0;
+    const real p411 = p409*z2;
+    const real p412 = z13*z13;
+    const real p413 = p412*z0;
+    const real p414 = p412*z2;
+    const real p415 = z13*z21;
+    const real p416 = p415*z0;
+    const real p417 = p415*z2;
+    const real p418 = z14*z0;
+    const real p419 = z14*z2;
+    const real p420 = z14*z14;
+    const real p421 = p420*z0;
+    const real p422 = p420*z2;
+    const real p423 = z14*z15;
+    const real p424 = p423*z0;
+    const real p425 = p423*z2;
+    const real p426 = z14*z27;
+    const real p427 = p426*z0;
+    const real p428 = p426*z2;
+    const real p429 = z15*z0;
+    const real p430 = z15*z2;
+    const real p431 = z15*z15;
+    const real p432 = p431*z0;
+    const real p433 = p431*z2;
+    const real p434 = z16*z12;
+    const real p435 = z16*z16;
+    const real p436 = p435*z0;
+    const real p437 = p435*z2;
+    const real p438 = z16*z19;
+    const real p439 = z16*z24;
+    const real p440 = p439*z0;
+    const real p441 = p439*z2;
+    const real p442 = z16*z25;
+    const real p443 = z16*z28;
+    const real p444 = p443*z0;
+    const real p445 = p443*z2;
+    const real p446 = z17*z7;
+    const real p447 = p446*z0;
+    const real p448 = p446*z2;
+    const real p449 = z17*z8;
+    const real p450 = z17*z13;
+    const real p451 = z17*z17;
+    const real p452 = p451*z0;
+    const real p453 = p451*z2;
+    const real p454 = z17*z21;
+    const real p455 = z18*z8;
+    const real p456 = z18*z13;
+    const real p457 = z18*z16;
+    const real p458 = z18*z18;
+    const real p459 = p458*z0;
+    const real p460 = p458*z1;
+    const real p461 = p458*z2;
+    const real p462 = p458*z4;
+    const real p463 = z18*z21;
+    const real p464 = z18*z24;
+    const real p465 = z18*z28;
+    const real p466 = z19*z12;
+    const real p467 = p466*z0;
+    const real p468 = p466*z2;
+    const real p469 = z19*z19;
+    const real p470 = p469*z0;
+    const real p471 = p469*z2;
+    const real p472 = z19*z25;
+    const real p473 = p472*z0;
+    const real p474 = p472*z2;
+    const real p475 = z20*z20;
+    const real p476 = p475*z0;
+    const real p477 = p475*z2;
+    const real p478 = z20*z26;
+    const real p479 = p478*z0;
+    const real p480 = p478*z2;
+    const real p481 = z20*z29;
+    const real p482 = p481*z0;
+    const real p483 = p481*z2;
+    const real p484 = z21*z21;
+    const real p485 = p484*z0;
+    const real p486 = p484*z2;
+    const real p487 = z22*z5;
+    const real p488 = p487*z1;
+    const real p489 = p487*z4;
+    const real p490 = p487*z16;
+    const real p491 = p487*z24;
+    const real p492 = p487*z28;
+    const real p493 = z22*z7;
+    const real p494 = z22*z11;
+    const real p495 = z22*z16;
+    const real p496 = z22*z17;
+    const real p497 = z22*z18;
+    const real p498 = p497*z1;
+    const real p499 = p497*z4;
+    const real p500 = z22*z22;
+    const real p501 = p500*z0;
+    const real p502 = p500*z1;
+    const real p503 = p500*z2;
+    const real p504 = p500*z4;
+    const real p505 = p500*z5;
+    const real p506 = z22*z24;
+    const real p507 = z22*z28;
+    const real p508 = z23*z0;
+    const real p509 = z23*z2;
+    const real p510 = z23*z14;
+    const real p511 = p510*z0;
+    const real p512 = p510*z2;
+    const real p513 = z23*z15;
+    const real p514 = p513*z0;
+    const real p515 = p513*z2;
+    const real p516 = z23*z23;
+    const real p517 = p516*z0;
+    const real p518 = p516*z2;
+    const real p519 = z23*z27;
+    const real p520 = p519*z0;
+    const real p521 = p519*z2;
+    const real p522 = z24*z12;
+    const real p523 = z24*z19;
+    const real p524 = z24*z24;
+    const real p525 = p524*z0;
+    const real p526 = p524*z2;
+    const real p527 = z24*z25;
+    const real p528 = z24*z28;
+    const real p529 = p528*z0;
+    const real p530 = p528*z2;
+    const real p531 = z25*z12;
+    const real p532 = p531*z0;
+    const real p533 = p531*z2;
+    const real p534 = z25*z25;
+    const real p535 = p534*z0;
+    const real p536 = p534*z2;
+    const real p537 = z26*z26;
+    const real p538 = p537*z0;
+    const real p539 = p537*z2;
+    const real p540 = z27*z0;
+    const real p541 = z27*z2;
+    const real p542 = z27*z15;
+    const real p543 = p542*z0;
+    const real p544 = p542*z2;
+    const real p545 = z27*z27;
+    const real p546 = p545*z0;
+    const real p547 = p545*z2;
+    const real p548 = z28*z12;
+    const real p549 = z28*z19;
+    const real p550 = z28*z25;
+    const real p551 = z28*z28;
+    const real p552 = p551*z0;
+    const real p553 = p551*z2;
+    const real p554 = z29*z26;
+    const real p555 = p554*z0;
+    const real p556 = p554*z2;
+    const real p557 = z29*z29;
+    const real p558 = p557*z0;
+    const real p559 = p557*z2;
+    const real p560 = z30*z30;
+    const real p561 = p560*z0;
+    const real p562 = p560*z2;
+
+    // gradient with respect to z
+    const accum gz0 = accum(p25)*c[1532]+accum(p26)*c[1534]+accum(p27)*c[1536]+accum(p29)*c[1520]
+        +accum(p30)*c[1522]+accum(p31)*c[1524]+accum(p32)*c[356]+accum(p33)*c[1562]+accum(p34)*c[1564]
+        +accum(p35)*c[1568]+accum(p36)*c[1572]+accum(p37)*c[1566]+accum(p38)*c[1570]+accum(p40)*c[1502]
+        +accum(p41)*c[1506]+accum(p42)*c[1504]+accum(p44)*c[1526]+accum(p45)*c[1528]+accum(p46)*c[1530]
+        +accum(p47)*c[340]+accum(p48)*c[1538]+accum(p49)*c[1540]+accum(p50)*c[1544]+accum(p51)*c[1548]
+        +accum(p52)*c[1542]+accum(p53)*c[1546]+accum(p55)*c[1508]+accum(p56)*c[1512]+accum(p57)*c[1510]
+        +accum(p58)*c[348]+accum(p59)*c[1550]+accum(p60)*c[1552]+accum(p61)*c[1556]+accum(p62)*c[1560]
+        +accum(p63)*c[1554]+accum(p64)*c[1558]+accum(p66)*c[1514]+accum(p67)*c[1518]+accum(p68)*c[1516]
+        +accum(p119)*c[133]+accum(p120)*c[1020]+accum(p121)*c[1018]+accum(p122)*c[1022]+accum(p123)*c[1026]
+        +accum(p124)*c[1030]+accum(p125)*c[1024]+accum(p126)*c[1028]+accum(p128)*c[1036]+accum(p129)*c[1032]
+        +accum(p130)*c[1034]+accum(p131)*c[115]+accum(p132)*c[992]+accum(p133)*c[990]+accum(p134)*c[994]
+        +accum(p135)*c[998]+accum(p136)*c[1002]+accum(p137)*c[996]+accum(p138)*c[1000]+accum(p140)*c[1042]
+        +accum(p141)*c[1038]+accum(p142)*c[1040]+accum(p143)*c[124]+accum(p144)*c[1006]+accum(p145)*c[1004]
+        +accum(p146)*c[1008]+accum(p147)*c[1012]+accum(p148)*c[1016]+accum(p149)*c[1010]+accum(p150)*c[1014]
+        +accum(p154)*c[924]+accum(p155)*c[926]+accum(p156)*c[928]+accum(p158)*c[1048]+accum(p159)*c[1044]
+        +accum(p160)*c[1046]+accum(p165)*c[876]+accum(p166)*c[880]+accum(p167)*c[878]+accum(p217)*c[1407]
+        +accum(p218)*c[1409]+accum(p219)*c[1411]+accum(p221)*c[1395]+accum(p222)*c[1397]+accum(p223)*c[1399]
+        +accum(p224)*c[308]+accum(p225)*c[1437]+accum(p226)*c[1439]+accum(p227)*c[1443]+accum(p228)*c[1447]
+        +accum(p229)*c[1441]+accum(p230)*c[1445]+accum(p232)*c[1377]+accum(p233)*c[1381]+accum(p234)*c[1379]
+        +accum(p236)*c[1401]+accum(p237)*c[1403]+accum(p238)*c[1405]+accum(p239)*c[292]+accum(p240)*c[1413]
+        +accum(p241)*c[1415]+accum(p242)*c[1419]+accum(p243)*c[1423]+accum(p244)*c[1417]+accum(p245)*c[1421]
+        +accum(p247)*c[1383]+accum(p248)*c[1387]+accum(p249)*c[1385]+accum(p250)*c[300]+accum(p251)*c[1425]
+        +accum(p252)*c[1427]+accum(p253)*c[1431]+accum(p254)*c[1435]+accum(p255)*c[1429]+accum(p256)*c[1433]
+        +accum(p258)*c[1389]+accum(p259)*c[1393]+accum(p260)*c[1391]+accum(p301)*c[1221]+accum(p302)*c[1217]
+        +accum(p303)*c[1219]+accum(p304)*c[210]+accum(p305)*c[1225]+accum(p306)*c[1223]+accum(p307)*c[1227]
+        +accum(p308)*c[1231]+accum(p309)*c[1235]+accum(p310)*c[1229]+accum(p311)*c[1233]+accum(p313)*c[1209]
+        +accum(p314)*c[1205]+accum(p315)*c[1207]+accum(p316)*c[219]+accum(p317)*c[1239]+accum(p318)*c[1237]
+        +accum(p319)*c[1241]+accum(p320)*c[1245]+accum(p321)*c[1249]+accum(p322)*c[1243]+accum(p323)*c[1247]
+        +accum(p325)*c[1215]+accum(p326)*c[1211]+accum(p327)*c[1213]+accum(p331)*c[1139]+accum(p332)*c[1143]
+        +accum(p333)*c[1141]+accum(p334)*c[228]+accum(p335)*c[1253]+accum(p336)*c[1251]+accum(p337)*c[1255]
+        +accum(p338)*c[1259]+accum(p339)*c[1263]+accum(p340)*c[1257]+accum(p341)*c[1261]+accum(z6)*s346
+        +accum(p342)*c[726]+accum(p343)*c[725]+accum(p344)*s348+accum(p345)*c[1671]+accum(p346)*c[1670]
+        +accum(p347)*s351+accum(p348)*c[1674]+accum(p349)*c[1673]+accum(p350)*s354+accum(p351)*c[1680]
+        +accum(p352)*c[1679]+accum(p353)*s357+accum(p354)*c[1686]+accum(p355)*c[1685]+accum(p356)*s360
+        +accum(p357)*c[1677]+accum(p358)*c[1676]+accum(p359)*s363+accum(p360)*c[1683]+accum(p361)*c[1682]
+        +accum(p362)*s367+accum(p363)*c[1608]+accum(p364)*c[1607]+accum(p368)*s374+accum(p369)*c[1611]
+        +accum(p370)*c[1610]+accum(p371)*s377+accum(p372)*c[1614]+accum(p373)*c[1613]+accum(p374)*s380
+        +accum(p375)*c[1617]+accum(p376)*c[1616]+accum(p377)*s384+accum(p378)*c[1662]+accum(p379)*c[1661]
+        +accum(z10)*s388+accum(p380)*c[754]+accum(p381)*c[753]+accum(p382)*s390+accum(p383)*c[1689]
+        +accum(p384)*c[1688]+accum(p385)*s393+accum(p386)*c[1695]+accum(p387)*c[1694]+accum(p388)*s396
+        +accum(p389)*c[1701]+accum(p390)*c[1700]+accum(p391)*s399+accum(p392)*c[1692]+accum(p393)*c[1691]
+        +accum(p394)*s402+accum(p395)*c[1698]+accum(p396)*c[1697]+accum(p397)*s406+accum(p398)*c[1599]
+        +accum(p399)*c[1598]+accum(p401)*s410+accum(p402)*c[1593]+accum(p403)*c[1592]+accum(p405)*s414
+        +accum(p406)*c[1596]+accum(p407)*c[1595]+accum(p409)*s419+accum(p410)*c[1644]+accum(p411)*c[1643]
+        +accum(p412)*s423+accum(p413)*c[1620]+accum(p414)*c[1619]+accum(p415)*s426+accum(p416)*c[1623]
+        +accum(p417)*c[1622]+accum(z14)*s430+accum(p418)*c[790]+accum(p419)*c[789]+accum(p420)*s432
+        +accum(p421)*c[1716]+accum(p422)*c[1715]+accum(p423)*s435+accum(p424)*c[1722]+accum(p425)*c[1721]
+        +accum(p426)*s438+accum(p427)*c[1719]+accum(p428)*c[1718]+accum(z15)*s442+accum(p429)*c[806]
+        +accum(p430)*c[805]+accum(p431)*s444+accum(p432)*c[1731]+accum(p433)*c[1730]+accum(p435)*s449
+        +accum(p436)*c[1575]+accum(p437)*c[1574]+accum(p439)*s453+accum(p440)*c[1578]+accum(p441)*c[1577]
+        +accum(p443)*s457+accum(p444)*c[1581]+accum(p445)*c[1580]+accum(p446)*s461+accum(p447)*c[1605]
+        +accum(p448)*c[1604]+accum(p451)*s466+accum(p452)*c[1602]+accum(p453)*c[1601]+accum(p458)*s474
+        +accum(p459)*c[1269]+accum(p461)*c[1268]+accum(p466)*s483+accum(p467)*c[1635]+accum(p468)*c[1634]
+        +accum(p469)*s486+accum(p470)*c[1629]+accum(p471)*c[1628]+accum(p472)*s489+accum(p473)*c[1632]
+        +accum(p474)*c[1631]+accum(p475)*s493+accum(p476)*c[1647]+accum(p477)*c[1646]+accum(p478)*s496
+        +accum(p479)*c[1653]+accum(p480)*c[1652]+accum(p481)*s499+accum(p482)*c[1650]+accum(p483)*c[1649]
+        +accum(p484)*s503+accum(p485)*c[1626]+accum(p486)*c[1625]+accum(p490)*c[1063]+accum(p491)*c[1065]
+        +accum(p492)*c[1067]+accum(p498)*c[1071]+accum(p499)*c[1069]+accum(p500)*s520+accum(p501)*c[1055]
+        +accum(p503)*c[1054]+accum(z23)*s529+accum(p508)*c[775]+accum(p509)*c[774]+accum(p510)*s531
+        +accum(p511)*c[1707]+accum(p512)*c[1706]+accum(p513)*s534+accum(p514)*c[1713]+accum(p515)*c[1712]
+        +accum(p516)*s537+accum(p517)*c[1704]+accum(p518)*c[1703]+accum(p519)*s540+accum(p520)*c[1710]
+        +accum(p521)*c[1709]+accum(p524)*s546+accum(p525)*c[1584]+accum(p526)*c[1583]+accum(p528)*s550
+        +accum(p529)*c[1587]+accum(p530)*c[1586]+accum(p531)*s554+accum(p532)*c[1641]+accum(p533)*c[1640]
+        +accum(p534)*s557+accum(p535)*c[1638]+accum(p536)*c[1637]+accum(p537)*s561+accum(p538)*c[1665]
+        +accum(p539)*c[1664]+accum(z27)*s565+accum(p540)*c[800]+accum(p541)*c[799]+accum(p542)*s567
+        +accum(p543)*c[1728]+accum(p544)*c[1727]+accum(p545)*s570+accum(p546)*c[1725]+accum(p547)*c[1724]
+        +accum(p551)*s577+accum(p552)*c[1590]+accum(p553)*c[1589]+accum(p554)*s581+accum(p555)*c[1659]
+        +accum(p556)*c[1658]+accum(p557)*s584+accum(p558)*c[1656]+accum(p559)*c[1655]+accum(p560)*s588
+        +accum(p561)*c[1668]+accum(p562)*c[1667];
+    const accum gz1 = s69+accum(z1)*s23+accum(z3)*s76+accum(p151)*s152+accum(p161)*s162+accum(z4)*s193
+        +accum(z5)*s270+accum(p328)*s331+accum(p458)*s475+accum(p460)*c[1266]+accum(p462)*c[1265]
+        +accum(p487)*s507+accum(p497)*s517+accum(p500)*s521+accum(p502)*c[1052]+accum(p504)*c[1051];
+    const accum gz2 = accum(p25)*c[1531]+accum(p26)*c[1533]+accum(p27)*c[1535]+accum(p29)*c[1519]
+        +accum(p30)*c[1521]+accum(p31)*c[1523]+accum(p32)*c[355]+accum(p33)*c[1561]+accum(p34)*c[1563]
+        +accum(p35)*c[1567]+accum(p36)*c[1571]+accum(p37)*c[1565]+accum(p38)*c[1569]+accum(p40)*c[1501]
+        +accum(p41)*c[1505]+accum(p42)*c[1503]+accum(p44)*c[1525]+accum(p45)*c[1527]+accum(p46)*c[1529]
+        +accum(p47)*c[339]+accum(p48)*c[1537]+accum(p49)*c[1539]+accum(p50)*c[1543]+accum(p51)*c[1547]
+        +accum(p52)*c[1541]+accum(p53)*c[1545]+accum(p55)*c[1507]+accum(p56)*c[1511]+accum(p57)*c[1509]
+        +accum(p58)*c[347]+accum(p59)*c[1549]+accum(p60)*c[1551]+accum(p61)*c[1555]+accum(p62)*c[1559]
+        +accum(p63)*c[1553]+accum(p64)*c[1557]+accum(p66)*c[1513]+accum(p67)*c[1517]+accum(p68)*c[1515]
+        +accum(p119)*c[132]+accum(p120)*c[1019]+accum(p121)*c[1017]+accum(p122)*c[1021]+accum(p123)*c[1025]
+        +accum(p124)*c[1029]+accum(p125)*c[1023]+accum(p126)*c[1027]+accum(p128)*c[1035]+accum(p129)*c[1031]
+        +accum(p130)*c[1033]+accum(p131)*c[114]+accum(p132)*c[991]+accum(p133)*c[989]+accum(p134)*c[993]
+        +accum(p135)*c[997]+accum(p136)*c[1001]+accum(p137)*c[995]+accum(p138)*c[999]+accum(p140)*c[1041]
+        +accum(p141)*c[1037]+accum(p142)*c[1039]+accum(p143)*c[123]+accum(p144)*c[1005]+accum(p145)*c[1003]
+        +accum(p146)*c[1007]+accum(p147)*c[1011]+accum(p148)*c[1015]+accum(p149)*c[1009]+accum(p150)*c[1013]
+        +accum(p154)*c[923]+accum(p155)*c[925]+accum(p156)*c[927]+accum(p158)*c[1047]+accum(p159)*c[1043]
+        +accum(p160)*c[1045]+accum(p165)*c[875]+accum(p166)*c[879]+accum(p167)*c[877]+accum(p217)*c[1406]
+        +accum(p218)*c[1408]+accum(p219)*c[1410]+accum(p221)*c[1394]+accum(p222)*c[1396]+accum(p223)*c[1398]
+        +accum(p224)*c[307]+accum(p225)*c[1436]+accum(p226)*c[1438]+accum(p227)*c[1442]+accum(p228)*c[1446]
+        +accum(p229)*c[1440]+accum(p230)*c[1444]+accum(p232)*c[1376]+accum(p233)*c[1380]+accum(p234)*c[1378]
+        +accum(p236)*c[1400]+accum(p237)*c[1402]+accum(p238)*c[1404]+accum(p239)*c[291]+accum(p240)*c[1412]
+        +accum(p241)*c[1414]+accum(p242)*c[1418]+accum(p243)*c[1422]+accum(p244)*c[1416]+accum(p245)*c[1420]
+        +accum(p247)*c[1382]+accum(p248)*c[1386]+accum(p249)*c[1384]+accum(p250)*c[299]+accum(p251)*c[1424]
+        +accum(p252)*c[1426]+accum(p253)*c[1430]+accum(p254)*c[1434]+accum(p255)*c[1428]+accum(p256)*c[1432]
+        +accum(p258)*c[1388]+accum(p259)*c[1392]+accum(p260)*c[1390]+accum(p301)*c[1220]+accum(p302)*c[1216]
+        +accum(p303)*c[1218]+accum(p304)*c[209]+accum(p305)*c[1224]+accum(p306)*c[1222]+accum(p307)*c[1226]
+        +accum(p308)*c[1230]+accum(p309)*c[1234]+accum(p310)*c[1228]+accum(p311)*c[1232]+accum(p313)*c[1208]
+        +accum(p314)*c[1204]+accum(p315)*c[1206]+accum(p316)*c[218]+accum(p317)*c[1238]+accum(p318)*c[1236]
+        +accum(p319)*c[1240]+accum(p320)*c[1244]+accum(p321)*c[1248]+accum(p322)*c[1242]+accum(p323)*c[1246]
+        +accum(p325)*c[1214]+accum(p326)*c[1210]+accum(p327)*c[1212]+accum(p331)*c[1138]+accum(p332)*c[1142]
+        +accum(p333)*c[1140]+accum(p334)*c[227]+accum(p335)*c[1252]+accum(p336)*c[1250]+accum(p337)*c[1254]
+        +accum(p338)*c[1258]+accum(p339)*c[1262]+accum(p340)*c[1256]+accum(p341)*c[1260]+accum(z6)*s347
+        +accum(p343)*c[724]+accum(p344)*s349+accum(p346)*c[1669]+accum(p347)*s352+accum(p349)*c[1672]
+        +accum(p350)*s355+accum(p352)*c[1678]+accum(p353)*s358+accum(p355)*c[1684]+accum(p356)*s361
+        +accum(p358)*c[1675]+accum(p359)*s364+accum(p361)*c[1681]+accum(p362)*s368+accum(p364)*c[1606]
+        +accum(p368)*s375+accum(p370)*c[1609]+accum(p371)*s378+accum(p373)*c[1612]+accum(p374)*s381
+        +accum(p376)*c[1615]+accum(p377)*s385+accum(p379)*c[1660]+accum(z10)*s389+accum(p381)*c[752]
+        +accum(p382)*s391+accum(p384)*c[1687]+accum(p385)*s394+accum(p387)*c[1693]+accum(p388)*s397
+        +accum(p390)*c[1699]+accum(p391)*s400+accum(p393)*c[1690]+accum(p394)*s403+accum(p396)*c[1696]
+        +accum(p397)*s407+accum(p399)*c[1597]+accum(p401)*s411+accum(p403)*c[1591]+accum(p405)*s415
+        +accum(p407)*c[1594]+accum(p409)*s420+accum(p411)*c[1642]+accum(p412)*s424+accum(p414)*c[1618]
+        +accum(p415)*s427+accum(p417)*c[1621]+accum(z14)*s431+accum(p419)*c[788]+accum(p420)*s433
+        +accum(p422)*c[1714]+accum(p423)*s436+accum(p425)*c[1720]+accum(p426)*s439+accum(p428)*c[1717]
+        +accum(z15)*s443+accum(p430)*c[804]+accum(p431)*s445+accum(p433)*c[1729]+accum(p435)*s450
+        +accum(p437)*c[1573]+accum(p439)*s454+accum(p441)*c[1576]+accum(p443)*s458+accum(p445)*c[1579]
+        +accum(p446)*s462+accum(p448)*c[1603]+accum(p451)*s467+accum(p453)*c[1600]+accum(p458)*s476
+        +accum(p461)*c[1267]+accum(p466)*s484+accum(p468)*c[1633]+accum(p469)*s487+accum(p471)*c[1627]
+        +accum(p472)*s490+accum(p474)*c[1630]+accum(p475)*s494+accum(p477)*c[1645]+accum(p478)*s497
+        +accum(p480)*c[1651]+accum(p481)*s500+accum(p483)*c[1648]+accum(p484)*s504+accum(p486)*c[1624]
+        +accum(p490)*c[1062]+accum(p491)*c[1064]+accum(p492)*c[1066]+accum(p498)*c[1070]+accum(p499)*c[1068]
+        +accum(p500)*s522+accum(p503)*c[1053]+accum(z23)*s530+accum(p509)*c[773]+accum(p510)*s532
+        +accum(p512)*c[1705]+accum(p513)*s535+accum(p515)*c[1711]+accum(p516)*s538+accum(p518)*c[1702]
+        +accum(p519)*s541+accum(p521)*c[1708]+accum(p524)*s547+accum(p526)*c[1582]+accum(p528)*s551
+        +accum(p530)*c[1585]+accum(p531)*s555+accum(p533)*c[1639]+accum(p534)*s558+accum(p536)*c[1636]
+        +accum(p537)*s562+accum(p539)*c[1663]+accum(z27)*s566+accum(p541)*c[798]+accum(p542)*s568
+        +accum(p544)*c[1726]+accum(p545)*s571+accum(p547)*c[1723]+accum(p551)*s578+accum(p553)*c[1588]
+        +accum(p554)*s582+accum(p556)*c[1657]+accum(p557)*s585+accum(p559)*c[1654]+accum(p560)*s589
+        +accum(p562)*c[1666];
+    const accum gz3 = s169+accum(z3)*s102;
+    const accum gz4 = accum(z3)*s109+accum(p151)*s153+accum(p161)*s163+s263+accum(z4)*s217+accum(z5)*s277
+        +accum(p328)*s332+accum(p458)*s477+accum(p462)*c[1264]+accum(p487)*s508+accum(p497)*s518
+        +accum(p500)*s523+accum(p504)*c[1050];
+    const accum gz5 = accum(z3)*s119+accum(p161)*s164+s345+accum(z5)*s302+accum(z22)*s512+accum(p500)*s524
+        +accum(p505)*c[1049];
+    const accum gz6 = accum(p0)*s0+accum(p1)*c[1480]+accum(p32)*s32+accum(p47)*s47+accum(p58)*s58
+        +accum(p71)*c[969]+accum(p73)*c[976]+accum(p75)*c[983]+accum(p76)*s77+accum(p77)*c[847]
+        +accum(p80)*c[839]+accum(p104)*c[939]+accum(p106)*c[946]+accum(p108)*c[953]+accum(p112)*c[911]
+        +accum(p115)*c[899]+accum(p117)*c[905]+accum(p119)*s120+accum(p131)*s132+accum(p143)*s144
+        +accum(p168)*s170+accum(p169)*c[1355]+accum(p192)*s194+accum(p193)*c[1302]+accum(p224)*s226
+        +accum(p239)*s241+accum(p250)*s252+accum(p262)*c[1189]+accum(p264)*c[1175]+accum(p266)*c[1182]
+        +accum(p269)*c[1159]+accum(p271)*c[1145]+accum(p273)*c[1152]+accum(p275)*s278+accum(p276)*c[1111]
+        +accum(p279)*c[1103]+accum(p304)*s307+accum(p316)*s319+accum(p334)*s337+s366+accum(z6)*s350
+        +accum(p344)*c[691]+accum(p362)*c[502]+accum(p368)*c[520]+accum(p371)*c[529]+accum(p374)*c[538]
+        +accum(p377)*c[666]+accum(p397)*c[457]+accum(p401)*c[439]+accum(p405)*c[448]+accum(p409)*c[613]
+        +accum(p412)*c[547]+accum(p415)*c[556]+accum(p435)*c[358]+accum(p439)*c[367]+accum(p443)*c[376]
+        +accum(p446)*c[484]+accum(p451)*c[475]+accum(p458)*c[229]+accum(p466)*c[589]+accum(p469)*c[573]
+        +accum(p472)*c[581]+accum(p475)*c[622]+accum(p478)*c[640]+accum(p481)*c[631]+accum(p484)*c[565]
+        +accum(p500)*c[143]+accum(p524)*c[394]+accum(p528)*c[403]+accum(p531)*c[605]+accum(p534)*c[597]
+        +accum(p537)*c[675]+accum(p551)*c[421]+accum(p554)*c[658]+accum(p557)*c[649]+accum(p560)*c[683];
+    const accum gz7 = accum(p0)*s1+accum(p2)*c[1459]+accum(p6)*c[1456]+accum(p12)*c[1458]+accum(z1)*s27
+        +accum(p69)*s70+accum(p76)*s78+accum(p78)*c[820]+accum(p82)*c[817]+accum(p88)*c[819]+accum(p102)*s103
+        +accum(p109)*s110+accum(z3)*s127+accum(p168)*s171+accum(p170)*c[1334]+accum(p174)*c[1331]
+        +accum(p180)*c[1333]+accum(p192)*s195+accum(p194)*c[1281]+accum(p198)*c[1278]+accum(p204)*c[1280]
+        +accum(z4)*s221+accum(p261)*s264+accum(p268)*s271+accum(p275)*s279+accum(p277)*c[1084]
+        +accum(p281)*c[1081]+accum(p287)*c[1083]+accum(z5)*s306+s373+accum(z7)*s369+accum(z11)*s408
+        +accum(z17)*s463+accum(p457)*c[239]+accum(p464)*c[242]+accum(p465)*c[245]+accum(z22)*s513;
+    const accum gz8 = accum(p0)*s2+accum(p3)*c[1460]+accum(p24)*s24+accum(p28)*s28+accum(p43)*s43
+        +accum(p69)*s71+accum(p76)*s79+accum(p79)*c[821]+accum(p102)*s104+accum(p110)*c[896]
+        +accum(p111)*c[890]+accum(p114)*c[893]+accum(z3)*s131+accum(p168)*s172+accum(p171)*c[1335]
+        +accum(p192)*s196+accum(p195)*c[1282]+accum(p216)*s218+accum(p220)*s222+accum(p235)*s237
+        +accum(p261)*s265+accum(p268)*s272+accum(p275)*s280+accum(p278)*c[1085]+accum(z5)*s314+accum(z7)*s370
+        +s383+accum(z8)*s376+accum(z11)*s409+accum(z17)*s464+accum(z18)*s471+accum(p495)*c[159]
+        +accum(p506)*c[162]+accum(p507)*c[165];
+    const accum gz9 = accum(p0)*s3+accum(p4)*c[1477]+accum(p71)*c[968]+accum(p73)*c[975]+accum(p75)*c[982]
+        +accum(p76)*s80+accum(p80)*c[838]+accum(p104)*c[938]+accum(p106)*c[945]+accum(p108)*c[952]
+        +accum(p119)*s121+accum(p131)*s133+accum(p143)*s145+accum(p168)*s173+accum(p172)*c[1352]
+        +accum(p192)*s197+accum(p196)*c[1299]+accum(p262)*c[1188]+accum(p264)*c[1174]+accum(p266)*c[1181]
+        +accum(p269)*c[1158]+accum(p271)*c[1144]+accum(p273)*c[1151]+accum(p275)*s281+accum(p279)*c[1102]
+        +accum(p304)*s308+accum(p316)*s320+accum(p334)*s338+accum(p362)*c[501]+accum(p368)*c[519]
+        +accum(p371)*c[528]+accum(p374)*c[537]+s387+accum(z9)*s386+accum(p397)*c[456]+accum(p401)*c[438]
+        +accum(p405)*c[447]+accum(p412)*c[546]+accum(p415)*c[555]+accum(p446)*c[483]+accum(p451)*c[474]
+        +accum(p484)*c[564];
+    const accum gz10 = accum(p1)*c[1481]+accum(p0)*s4+accum(p5)*c[1486]+accum(p32)*s33+accum(p47)*s48
+        +accum(p58)*s59+accum(p71)*c[970]+accum(p73)*c[977]+accum(p75)*c[984]+accum(p77)*c[848]
+        +accum(p80)*c[840]+accum(p76)*s81+accum(p81)*c[853]+accum(p104)*c[940]+accum(p106)*c[947]
+        +accum(p108)*c[954]+accum(p112)*c[912]+accum(p115)*c[900]+accum(p117)*c[906]+accum(p119)*s122
+        +accum(p131)*s134+accum(p143)*s146+accum(p169)*c[1356]+accum(p168)*s174+accum(p173)*c[1361]
+        +accum(p193)*c[1303]+accum(p192)*s198+accum(p197)*c[1308]+accum(p224)*s227+accum(p239)*s242
+        +accum(p250)*s253+accum(p262)*c[1190]+accum(p264)*c[1176]+accum(p266)*c[1183]+accum(p269)*c[1160]
+        +accum(p271)*c[1146]+accum(p273)*c[1153]+accum(p276)*c[1112]+accum(p279)*c[1104]+accum(p275)*s282
+        +accum(p280)*c[1117]+accum(p304)*s309+accum(p316)*s321+accum(p334)*s339+accum(p344)*c[692]
+        +accum(z6)*s353+accum(p347)*c[699]+accum(p362)*c[503]+accum(p368)*c[521]+accum(p371)*c[530]
+        +accum(p374)*c[539]+accum(p377)*c[667]+s405+accum(z10)*s392+accum(p382)*c[727]+accum(p397)*c[458]
+        +accum(p401)*c[440]+accum(p405)*c[449]+accum(p409)*c[614]+accum(p412)*c[548]+accum(p415)*c[557]
+        +accum(p435)*c[359]+accum(p439)*c[368]+accum(p443)*c[377]+accum(p446)*c[485]+accum(p451)*c[476]
+        +accum(p458)*c[230]+accum(p466)*c[590]+accum(p469)*c[574]+accum(p472)*c[582]+accum(p475)*c[623]
+        +accum(p478)*c[641]+accum(p481)*c[632]+accum(p484)*c[566]+accum(p500)*c[144]+accum(p524)*c[395]
+        +accum(p528)*c[404]+accum(p531)*c[606]+accum(p534)*c[598]+accum(p537)*c[676]+accum(p551)*c[422]
+        +accum(p554)*c[659]+accum(p557)*c[650]+accum(p560)*c[684];
+    const accum gz11 = accum(p0)*s5+accum(p6)*c[1454]+accum(z1)*s31+accum(p69)*s72+accum(p76)*s82
+        +accum(p82)*c[815]+accum(p102)*s105+accum(p109)*s111+accum(z3)*s139+accum(p168)*s175
+        +accum(p174)*c[1329]+accum(p192)*s199+accum(p198)*c[1276]+accum(z4)*s225+accum(p261)*s266
+        +accum(p268)*s273+accum(p275)*s283+accum(p281)*c[1079]+accum(z5)*s318+s418+accum(z11)*s412
+        +accum(p457)*c[237]+accum(p464)*c[240]+accum(p465)*c[243]+accum(z22)*s514;
+    const accum gz12 = accum(p0)*s6+accum(p7)*c[1471]+accum(p13)*c[1468]+accum(p18)*c[1470]+accum(z1)*s38
+        +accum(p70)*c[967]+accum(p72)*c[961]+accum(p74)*c[964]+accum(p76)*s83+accum(p83)*c[832]
+        +accum(p90)*c[829]+accum(p96)*c[831]+accum(p103)*c[937]+accum(p105)*c[931]+accum(p107)*c[934]
+        +accum(p109)*s112+accum(p127)*s128+accum(p139)*s140+accum(p157)*s158+accum(p168)*s176
+        +accum(p175)*c[1346]+accum(p181)*c[1343]+accum(p186)*c[1345]+accum(p192)*s200+accum(p199)*c[1293]
+        +accum(p205)*c[1290]+accum(p210)*c[1292]+accum(z4)*s232+accum(p263)*c[1197]+accum(p265)*c[1200]
+        +accum(p267)*c[1203]+accum(p270)*c[1167]+accum(p272)*c[1170]+accum(p274)*c[1173]+accum(p275)*s284
+        +accum(p282)*c[1096]+accum(p289)*c[1093]+accum(p294)*c[1095]+accum(p300)*s303+accum(p312)*s315
+        +accum(p324)*s327+accum(p365)*c[512]+accum(p366)*c[515]+accum(p367)*c[518]+accum(p400)*c[467]
+        +accum(p404)*c[470]+accum(p408)*c[473]+s422+accum(z12)*s421+accum(z16)*s448+accum(p449)*c[494]
+        +accum(p450)*c[497]+accum(p454)*c[500]+accum(z19)*s485+accum(p497)*c[158]+accum(z24)*s544
+        +accum(z25)*s556+accum(z28)*s574;
+    const accum gz13 = accum(p3)*c[1461]+accum(p0)*s7+accum(p8)*c[1463]+accum(p24)*s25+accum(p28)*s29
+        +accum(p43)*s44+accum(p69)*s73+accum(p79)*c[822]+accum(p76)*s84+accum(p84)*c[824]+accum(p102)*s106
+        +accum(p110)*c[897]+accum(p111)*c[891]+accum(p114)*c[894]+accum(z3)*s143+accum(p171)*c[1336]
+        +accum(p168)*s177+accum(p176)*c[1338]+accum(p195)*c[1283]+accum(p192)*s201+accum(p200)*c[1285]
+        +accum(p216)*s219+accum(p220)*s223+accum(p235)*s238+accum(p261)*s267+accum(p268)*s274
+        +accum(p278)*c[1086]+accum(p275)*s285+accum(p283)*c[1088]+accum(z5)*s326+accum(z7)*s371+accum(z8)*s379
+        +accum(z11)*s413+s429+accum(z13)*s425+accum(z17)*s465+accum(z18)*s472+accum(p495)*c[160]
+        +accum(p506)*c[163]+accum(p507)*c[166];
+    const accum gz14 = accum(p1)*c[1483]+accum(p5)*c[1488]+accum(p0)*s8+accum(p9)*c[1495]+accum(p16)*c[1492]
+        +accum(p32)*s34+accum(p47)*s49+accum(p58)*s60+accum(p71)*c[972]+accum(p73)*c[979]+accum(p75)*c[986]
+        +accum(p77)*c[850]+accum(p80)*c[842]+accum(p81)*c[855]+accum(p76)*s85+accum(p85)*c[862]
+        +accum(p94)*c[859]+accum(p104)*c[942]+accum(p106)*c[949]+accum(p108)*c[956]+accum(p112)*c[914]
+        +accum(p115)*c[902]+accum(p117)*c[908]+accum(p119)*s123+accum(p131)*s135+accum(p143)*s147
+        +accum(p169)*c[1358]+accum(p173)*c[1363]+accum(p168)*s178+accum(p177)*c[1370]+accum(p184)*c[1367]
+        +accum(p193)*c[1305]+accum(p197)*c[1310]+accum(p192)*s202+accum(p201)*c[1317]+accum(p208)*c[1314]
+        +accum(p224)*s228+accum(p239)*s243+accum(p250)*s254+accum(p262)*c[1192]+accum(p264)*c[1178]
+        +accum(p266)*c[1185]+accum(p269)*c[1162]+accum(p271)*c[1148]+accum(p273)*c[1155]+accum(p276)*c[1114]
+        +accum(p279)*c[1106]+accum(p280)*c[1119]+accum(p275)*s286+accum(p284)*c[1126]+accum(p292)*c[1123]
+        +accum(p304)*s310+accum(p316)*s322+accum(p334)*s340+accum(p344)*c[694]+accum(p347)*c[701]
+        +accum(z6)*s356+accum(p350)*c[712]+accum(p356)*c[707]+accum(p362)*c[505]+accum(p368)*c[523]
+        +accum(p371)*c[532]+accum(p374)*c[541]+accum(p377)*c[669]+accum(p382)*c[729]+accum(z10)*s395
+        +accum(p385)*c[740]+accum(p391)*c[735]+accum(p397)*c[460]+accum(p401)*c[442]+accum(p405)*c[451]
+        +accum(p409)*c[616]+accum(p412)*c[550]+accum(p415)*c[559]+s441+accum(z14)*s434+accum(p420)*c[776]
+        +accum(p435)*c[361]+accum(p439)*c[370]+accum(p443)*c[379]+accum(p446)*c[487]+accum(p451)*c[478]
+        +accum(p458)*c[232]+accum(p466)*c[592]+accum(p469)*c[576]+accum(p472)*c[584]+accum(p475)*c[625]
+        +accum(p478)*c[643]+accum(p481)*c[634]+accum(p484)*c[568]+accum(p500)*c[146]+accum(z23)*s533
+        +accum(p510)*c[761]+accum(p516)*c[756]+accum(p524)*c[397]+accum(p528)*c[406]+accum(p531)*c[608]
+        +accum(p534)*c[600]+accum(p537)*c[678]+accum(p551)*c[424]+accum(p554)*c[661]+accum(p557)*c[652]
+        +accum(p560)*c[686];
+    const accum gz15 = accum(p1)*c[1485]+accum(p5)*c[1490]+accum(p9)*c[1497]+accum(p0)*s9+accum(p10)*c[1500]
+        +accum(p16)*c[1494]+accum(p20)*c[1499]+accum(p32)*s35+accum(p47)*s50+accum(p58)*s61+accum(p71)*c[974]
+        +accum(p73)*c[981]+accum(p75)*c[988]+accum(p77)*c[852]+accum(p80)*c[844]+accum(p81)*c[857]
+        +accum(p85)*c[864]+accum(p76)*s86+accum(p86)*c[867]+accum(p94)*c[861]+accum(p98)*c[866]
+        +accum(p104)*c[944]+accum(p106)*c[951]+accum(p108)*c[958]+accum(p112)*c[916]+accum(p115)*c[904]
+        +accum(p117)*c[910]+accum(p119)*s124+accum(p131)*s136+accum(p143)*s148+accum(p169)*c[1360]
+        +accum(p173)*c[1365]+accum(p177)*c[1372]+accum(p168)*s179+accum(p178)*c[1375]+accum(p184)*c[1369]
+        +accum(p188)*c[1374]+accum(p193)*c[1307]+accum(p197)*c[1312]+accum(p201)*c[1319]+accum(p192)*s203
+        +accum(p202)*c[1322]+accum(p208)*c[1316]+accum(p212)*c[1321]+accum(p224)*s229+accum(p239)*s244
+        +accum(p250)*s255+accum(p262)*c[1194]+accum(p264)*c[1180]+accum(p266)*c[1187]+accum(p269)*c[1164]
+        +accum(p271)*c[1150]+accum(p273)*c[1157]+accum(p276)*c[1116]+accum(p279)*c[1108]+accum(p280)*c[1121]
+        +accum(p284)*c[1128]+accum(p275)*s287+accum(p285)*c[1131]+accum(p292)*c[1125]+accum(p296)*c[1130]
+        +accum(p304)*s311+accum(p316)*s323+accum(p334)*s341+accum(p344)*c[696]+accum(p347)*c[703]
+        +accum(p350)*c[714]+accum(z6)*s359+accum(p353)*c[721]+accum(p356)*c[709]+accum(p359)*c[718]
+        +accum(p362)*c[507]+accum(p368)*c[525]+accum(p371)*c[534]+accum(p374)*c[543]+accum(p377)*c[671]
+        +accum(p382)*c[731]+accum(p385)*c[742]+accum(z10)*s398+accum(p388)*c[749]+accum(p391)*c[737]
+        +accum(p394)*c[746]+accum(p397)*c[462]+accum(p401)*c[444]+accum(p405)*c[453]+accum(p409)*c[618]
+        +accum(p412)*c[552]+accum(p415)*c[561]+accum(p420)*c[778]+accum(z14)*s437+accum(p423)*c[785]
+        +accum(p426)*c[782]+s447+accum(z15)*s446+accum(p431)*c[801]+accum(p435)*c[363]+accum(p439)*c[372]
+        +accum(p443)*c[381]+accum(p446)*c[489]+accum(p451)*c[480]+accum(p458)*c[234]+accum(p466)*c[594]
+        +accum(p469)*c[578]+accum(p472)*c[586]+accum(p475)*c[627]+accum(p478)*c[645]+accum(p481)*c[636]
+        +accum(p484)*c[570]+accum(p500)*c[148]+accum(p510)*c[763]+accum(z23)*s536+accum(p513)*c[770]
+        +accum(p516)*c[758]+accum(p519)*c[767]+accum(p524)*c[399]+accum(p528)*c[408]+accum(p531)*c[610]
+        +accum(p534)*c[602]+accum(p537)*c[680]+accum(z27)*s569+accum(p542)*c[795]+accum(p545)*c[792]
+        +accum(p551)*c[426]+accum(p554)*c[663]+accum(p557)*c[654]+accum(p560)*c[688];
+    const accum gz16 = accum(p0)*s10+accum(p11)*c[1448]+accum(z1)*s42+accum(p76)*s87+accum(p87)*c[809]
+        +accum(p109)*s113+accum(p151)*s154+accum(p162)*c[872]+accum(p163)*c[869]+accum(p168)*s180
+        +accum(p179)*c[1323]+accum(p192)*s204+accum(p203)*c[1270]+accum(z4)*s236+accum(p275)*s288
+        +accum(p286)*c[1073]+accum(p329)*c[1135]+accum(p330)*c[1132]+s460+accum(z16)*s451+accum(z18)*s473
+        +accum(p487)*s509+accum(z22)*s515;
+    const accum gz17 = accum(p6)*c[1455]+accum(p0)*s11+accum(p12)*c[1457]+accum(z1)*s46+accum(p69)*s74
+        +accum(p82)*c[816]+accum(p76)*s88+accum(p88)*c[818]+accum(p102)*s107+accum(p109)*s114+accum(z3)*s151
+        +accum(p174)*c[1330]+accum(p168)*s181+accum(p180)*c[1332]+accum(p198)*c[1277]+accum(p192)*s205
+        +accum(p204)*c[1279]+accum(z4)*s240+accum(p261)*s268+accum(p268)*s275+accum(p281)*c[1080]
+        +accum(p275)*s289+accum(p287)*c[1082]+accum(z5)*s330+accum(z11)*s416+s470+accum(z17)*s468
+        +accum(p457)*c[238]+accum(p464)*c[241]+accum(p465)*c[244]+accum(z22)*s516;
+    const accum gz18 = accum(p76)*s89+accum(p89)*c[808]+accum(z3)*s157+accum(p164)*c[868]+accum(p275)*s290
+        +accum(p288)*c[1072]+accum(z5)*s336+s482+accum(z18)*s478+accum(z22)*s519;
+    const accum gz19 = accum(p0)*s12+accum(p13)*c[1466]+accum(z1)*s53+accum(p70)*c[965]+accum(p72)*c[959]
+        +accum(p74)*c[962]+accum(p76)*s90+accum(p90)*c[827]+accum(p103)*c[935]+accum(p105)*c[929]
+        +accum(p107)*c[932]+accum(p109)*s115+accum(p127)*s129+accum(p139)*s141+accum(p157)*s159
+        +accum(p168)*s182+accum(p181)*c[1341]+accum(p192)*s206+accum(p205)*c[1288]+accum(z4)*s247
+        +accum(p263)*c[1195]+accum(p265)*c[1198]+accum(p267)*c[1201]+accum(p270)*c[1165]+accum(p272)*c[1168]
+        +accum(p274)*c[1171]+accum(p275)*s291+accum(p289)*c[1091]+accum(p300)*s304+accum(p312)*s316
+        +accum(p324)*s328+accum(p365)*c[510]+accum(p366)*c[513]+accum(p367)*c[516]+accum(p400)*c[465]
+        +accum(p404)*c[468]+accum(p408)*c[471]+accum(z16)*s452+accum(p449)*c[492]+accum(p450)*c[495]
+        +accum(p454)*c[498]+s492+accum(z19)*s488+accum(p497)*c[156]+accum(z24)*s545+accum(z28)*s575;
+    const accum gz20 = accum(p0)*s13+accum(p14)*c[1472]+accum(p39)*s39+accum(p54)*s54+accum(p65)*s65
+        +accum(p76)*s91+accum(p91)*c[833]+accum(p113)*c[881]+accum(p116)*c[884]+accum(p118)*c[887]
+        +accum(p152)*c[920]+accum(p153)*c[917]+accum(p161)*s165+accum(p168)*s183+accum(p182)*c[1347]
+        +accum(p192)*s207+accum(p206)*c[1294]+accum(p231)*s233+accum(p246)*s248+accum(p257)*s259
+        +accum(p275)*s292+accum(p290)*c[1097]+accum(p328)*s333+accum(p434)*c[390]+accum(p438)*c[384]
+        +accum(p442)*c[387]+accum(p455)*c[246]+accum(p456)*c[249]+accum(p463)*c[252]+s502+accum(z20)*s495
+        +accum(p488)*c[1059]+accum(p489)*c[1056]+accum(p493)*c[174]+accum(p494)*c[168]+accum(p496)*c[171]
+        +accum(p522)*c[417]+accum(p523)*c[411]+accum(p527)*c[414]+accum(p548)*c[435]+accum(p549)*c[429]
+        +accum(p550)*c[432];
+    const accum gz21 = accum(p3)*c[1462]+accum(p8)*c[1464]+accum(p0)*s14+accum(p15)*c[1465]+accum(p24)*s26
+        +accum(p28)*s30+accum(p43)*s45+accum(p69)*s75+accum(p79)*c[823]+accum(p84)*c[825]+accum(p76)*s92
+        +accum(p92)*c[826]+accum(p102)*s108+accum(p110)*c[898]+accum(p111)*c[892]+accum(p114)*c[895]
+        +accum(z3)*s161+accum(p171)*c[1337]+accum(p176)*c[1339]+accum(p168)*s184+accum(p183)*c[1340]
+        +accum(p195)*c[1284]+accum(p200)*c[1286]+accum(p192)*s208+accum(p207)*c[1287]+accum(p216)*s220
+        +accum(p220)*s224+accum(p235)*s239+accum(p261)*s269+accum(p268)*s276+accum(p278)*c[1087]
+        +accum(p283)*c[1089]+accum(p275)*s293+accum(p291)*c[1090]+accum(z5)*s344+accum(z7)*s372+accum(z8)*s382
+        +accum(z11)*s417+accum(z13)*s428+accum(z17)*s469+accum(z18)*s479+s506+accum(z21)*s505
+        +accum(p495)*c[161]+accum(p506)*c[164]+accum(p507)*c[167];
+    const accum gz22 = accum(p76)*s93+accum(p93)*c[807]+accum(z3)*s168+s528+accum(z22)*s525;
+    const accum gz23 = accum(p1)*c[1482]+accum(p5)*c[1487]+accum(p0)*s15+accum(p16)*c[1491]+accum(p32)*s36
+        +accum(p47)*s51+accum(p58)*s62+accum(p71)*c[971]+accum(p73)*c[978]+accum(p75)*c[985]+accum(p77)*c[849]
+        +accum(p80)*c[841]+accum(p81)*c[854]+accum(p76)*s94+accum(p94)*c[858]+accum(p104)*c[941]
+        +accum(p106)*c[948]+accum(p108)*c[955]+accum(p112)*c[913]+accum(p115)*c[901]+accum(p117)*c[907]
+        +accum(p119)*s125+accum(p131)*s137+accum(p143)*s149+accum(p169)*c[1357]+accum(p173)*c[1362]
+        +accum(p168)*s185+accum(p184)*c[1366]+accum(p193)*c[1304]+accum(p197)*c[1309]+accum(p192)*s209
+        +accum(p208)*c[1313]+accum(p224)*s230+accum(p239)*s245+accum(p250)*s256+accum(p262)*c[1191]
+        +accum(p264)*c[1177]+accum(p266)*c[1184]+accum(p269)*c[1161]+accum(p271)*c[1147]+accum(p273)*c[1154]
+        +accum(p276)*c[1113]+accum(p279)*c[1105]+accum(p280)*c[1118]+accum(p275)*s294+accum(p292)*c[1122]
+        +accum(p304)*s312+accum(p316)*s324+accum(p334)*s342+accum(p344)*c[693]+accum(p347)*c[700]
+        +accum(z6)*s362+accum(p356)*c[706]+accum(p362)*c[504]+accum(p368)*c[522]+accum(p371)*c[531]
+        +accum(p374)*c[540]+accum(p377)*c[668]+accum(p382)*c[728]+accum(z10)*s401+accum(p391)*c[734]
+        +accum(p397)*c[459]+accum(p401)*c[441]+accum(p405)*c[450]+accum(p409)*c[615]+accum(p412)*c[549]
+        +accum(p415)*c[558]+accum(p435)*c[360]+accum(p439)*c[369]+accum(p443)*c[378]+accum(p446)*c[486]
+        +accum(p451)*c[477]+accum(p458)*c[231]+accum(p466)*c[591]+accum(p469)*c[575]+accum(p472)*c[583]
+        +accum(p475)*c[624]+accum(p478)*c[642]+accum(p481)*c[633]+accum(p484)*c[567]+accum(p500)*c[145]+s543
+        +accum(z23)*s539+accum(p516)*c[755]+accum(p524)*c[396]+accum(p528)*c[405]+accum(p531)*c[607]
+        +accum(p534)*c[599]+accum(p537)*c[677]+accum(p551)*c[423]+accum(p554)*c[660]+accum(p557)*c[651]
+        +accum(p560)*c[685];
+    const accum gz24 = accum(p11)*c[1449]+accum(p0)*s16+accum(p17)*c[1451]+accum(z1)*s57+accum(p87)*c[810]
+        +accum(p76)*s95+accum(p95)*c[812]+accum(p109)*s116+accum(p151)*s155+accum(p162)*c[873]
+        +accum(p163)*c[870]+accum(p179)*c[1324]+accum(p168)*s186+accum(p185)*c[1326]+accum(p203)*c[1271]
+        +accum(p192)*s210+accum(p209)*c[1273]+accum(z4)*s251+accum(p286)*c[1074]+accum(p275)*s295
+        +accum(p293)*c[1076]+accum(p329)*c[1136]+accum(p330)*c[1133]+accum(z16)*s455+accum(z18)*s480
+        +accum(p487)*s510+accum(z22)*s526+s553+accum(z24)*s548;
+    const accum gz25 = accum(p13)*c[1467]+accum(p0)*s17+accum(p18)*c[1469]+accum(z1)*s64+accum(p70)*c[966]
+        +accum(p72)*c[960]+accum(p74)*c[963]+accum(p90)*c[828]+accum(p76)*s96+accum(p96)*c[830]
+        +accum(p103)*c[936]+accum(p105)*c[930]+accum(p107)*c[933]+accum(p109)*s117+accum(p127)*s130
+        +accum(p139)*s142+accum(p157)*s160+accum(p181)*c[1342]+accum(p168)*s187+accum(p186)*c[1344]
+        +accum(p205)*c[1289]+accum(p192)*s211+accum(p210)*c[1291]+accum(z4)*s258+accum(p263)*c[1196]
+        +accum(p265)*c[1199]+accum(p267)*c[1202]+accum(p270)*c[1166]+accum(p272)*c[1169]+accum(p274)*c[1172]
+        +accum(p289)*c[1092]+accum(p275)*s296+accum(p294)*c[1094]+accum(p300)*s305+accum(p312)*s317
+        +accum(p324)*s329+accum(p365)*c[511]+accum(p366)*c[514]+accum(p367)*c[517]+accum(p400)*c[466]
+        +accum(p404)*c[469]+accum(p408)*c[472]+accum(z16)*s456+accum(p449)*c[493]+accum(p450)*c[496]
+        +accum(p454)*c[499]+accum(z19)*s491+accum(p497)*c[157]+accum(z24)*s549+s560+accum(z25)*s559
+        +accum(z28)*s576;
+    const accum gz26 = accum(p14)*c[1474]+accum(p0)*s18+accum(p19)*c[1478]+accum(p22)*c[1476]+accum(p39)*s40
+        +accum(p54)*s55+accum(p65)*s66+accum(p91)*c[835]+accum(p76)*s97+accum(p97)*c[845]+accum(p100)*c[837]
+        +accum(p113)*c[883]+accum(p116)*c[886]+accum(p118)*c[889]+accum(p152)*c[922]+accum(p153)*c[919]
+        +accum(p161)*s166+accum(p182)*c[1349]+accum(p168)*s188+accum(p187)*c[1353]+accum(p190)*c[1351]
+        +accum(p206)*c[1296]+accum(p192)*s212+accum(p211)*c[1300]+accum(p214)*c[1298]+accum(p231)*s234
+        +accum(p246)*s249+accum(p257)*s260+accum(p290)*c[1099]+accum(p275)*s297+accum(p295)*c[1109]
+        +accum(p298)*c[1101]+accum(p328)*s334+accum(p434)*c[392]+accum(p438)*c[386]+accum(p442)*c[389]
+        +accum(p455)*c[248]+accum(p456)*c[251]+accum(p463)*c[254]+accum(z20)*s498+accum(p488)*c[1061]
+        +accum(p489)*c[1058]+accum(p493)*c[176]+accum(p494)*c[170]+accum(p496)*c[173]+accum(p522)*c[419]
+        +accum(p523)*c[413]+accum(p527)*c[416]+s564+accum(z26)*s563+accum(p548)*c[437]+accum(p549)*c[431]
+        +accum(p550)*c[434]+accum(z29)*s583;
+    const accum gz27 = accum(p1)*c[1484]+accum(p5)*c[1489]+accum(p9)*c[1496]+accum(p16)*c[1493]+accum(p0)*s19
+        +accum(p20)*c[1498]+accum(p32)*s37+accum(p47)*s52+accum(p58)*s63+accum(p71)*c[973]+accum(p73)*c[980]
+        +accum(p75)*c[987]+accum(p77)*c[851]+accum(p80)*c[843]+accum(p81)*c[856]+accum(p85)*c[863]
+        +accum(p94)*c[860]+accum(p76)*s98+accum(p98)*c[865]+accum(p104)*c[943]+accum(p106)*c[950]
+        +accum(p108)*c[957]+accum(p112)*c[915]+accum(p115)*c[903]+accum(p117)*c[909]+accum(p119)*s126
+        +accum(p131)*s138+accum(p143)*s150+accum(p169)*c[1359]+accum(p173)*c[1364]+accum(p177)*c[1371]
+        +accum(p184)*c[1368]+accum(p168)*s189+accum(p188)*c[1373]+accum(p193)*c[1306]+accum(p197)*c[1311]
+        +accum(p201)*c[1318]+accum(p208)*c[1315]+accum(p192)*s213+accum(p212)*c[1320]+accum(p224)*s231
+        +accum(p239)*s246+accum(p250)*s257+accum(p262)*c[1193]+accum(p264)*c[1179]+accum(p266)*c[1186]
+        +accum(p269)*c[1163]+accum(p271)*c[1149]+accum(p273)*c[1156]+accum(p276)*c[1115]+accum(p279)*c[1107]
+        +accum(p280)*c[1120]+accum(p284)*c[1127]+accum(p292)*c[1124]+accum(p275)*s298+accum(p296)*c[1129]
+        +accum(p304)*s313+accum(p316)*s325+accum(p334)*s343+accum(p344)*c[695]+accum(p347)*c[702]
+        +accum(p350)*c[713]+accum(p356)*c[708]+accum(z6)*s365+accum(p359)*c[717]+accum(p362)*c[506]
+        +accum(p368)*c[524]+accum(p371)*c[533]+accum(p374)*c[542]+accum(p377)*c[670]+accum(p382)*c[730]
+        +accum(p385)*c[741]+accum(p391)*c[736]+accum(z10)*s404+accum(p394)*c[745]+accum(p397)*c[461]
+        +accum(p401)*c[443]+accum(p405)*c[452]+accum(p409)*c[617]+accum(p412)*c[551]+accum(p415)*c[560]
+        +accum(p420)*c[777]+accum(z14)*s440+accum(p426)*c[781]+accum(p435)*c[362]+accum(p439)*c[371]
+        +accum(p443)*c[380]+accum(p446)*c[488]+accum(p451)*c[479]+accum(p458)*c[233]+accum(p466)*c[593]
+        +accum(p469)*c[577]+accum(p472)*c[585]+accum(p475)*c[626]+accum(p478)*c[644]+accum(p481)*c[635]
+        +accum(p484)*c[569]+accum(p500)*c[147]+accum(p510)*c[762]+accum(p516)*c[757]+accum(z23)*s542
+        +accum(p519)*c[766]+accum(p524)*c[398]+accum(p528)*c[407]+accum(p531)*c[609]+accum(p534)*c[601]
+        +accum(p537)*c[679]+s573+accum(z27)*s572+accum(p545)*c[791]+accum(p551)*c[425]+accum(p554)*c[662]
+        +accum(p557)*c[653]+accum(p560)*c[687];
+    const accum gz28 = accum(p11)*c[1450]+accum(p17)*c[1452]+accum(p0)*s20+accum(p21)*c[1453]+accum(z1)*s68
+        +accum(p87)*c[811]+accum(p95)*c[813]+accum(p76)*s99+accum(p99)*c[814]+accum(p109)*s118
+        +accum(p151)*s156+accum(p162)*c[874]+accum(p163)*c[871]+accum(p179)*c[1325]+accum(p185)*c[1327]
+        +accum(p168)*s190+accum(p189)*c[1328]+accum(p203)*c[1272]+accum(p209)*c[1274]+accum(p192)*s214
+        +accum(p213)*c[1275]+accum(z4)*s262+accum(p286)*c[1075]+accum(p293)*c[1077]+accum(p275)*s299
+        +accum(p297)*c[1078]+accum(p329)*c[1137]+accum(p330)*c[1134]+accum(z16)*s459+accum(z18)*s481
+        +accum(p487)*s511+accum(z22)*s527+accum(z24)*s552+s580+accum(z28)*s579;
+    const accum gz29 = accum(p14)*c[1473]+accum(p0)*s21+accum(p22)*c[1475]+accum(p39)*s41+accum(p54)*s56
+        +accum(p65)*s67+accum(p91)*c[834]+accum(p76)*s100+accum(p100)*c[836]+accum(p113)*c[882]
+        +accum(p116)*c[885]+accum(p118)*c[888]+accum(p152)*c[921]+accum(p153)*c[918]+accum(p161)*s167
+        +accum(p182)*c[1348]+accum(p168)*s191+accum(p190)*c[1350]+accum(p206)*c[1295]+accum(p192)*s215
+        +accum(p214)*c[1297]+accum(p231)*s235+accum(p246)*s250+accum(p257)*s261+accum(p290)*c[1098]
+        +accum(p275)*s300+accum(p298)*c[1100]+accum(p328)*s335+accum(p434)*c[391]+accum(p438)*c[385]
+        +accum(p442)*c[388]+accum(p455)*c[247]+accum(p456)*c[250]+accum(p463)*c[253]+accum(z20)*s501
+        +accum(p488)*c[1060]+accum(p489)*c[1057]+accum(p493)*c[175]+accum(p494)*c[169]+accum(p496)*c[172]
+        +accum(p522)*c[418]+accum(p523)*c[412]+accum(p527)*c[415]+accum(p548)*c[436]+accum(p549)*c[430]
+        +accum(p550)*c[433]+s587+accum(z29)*s586;
+    const accum gz30 = accum(p0)*s22+accum(p23)*c[1479]+accum(p76)*s101+accum(p101)*c[846]+accum(p168)*s192
+        +accum(p191)*c[1354]+accum(p192)*s216+accum(p215)*c[1301]+accum(p275)*s301+accum(p299)*c[1110]
+        +accum(p435)*c[357]+accum(p439)*c[366]+accum(p443)*c[375]+accum(p475)*c[621]+accum(p478)*c[639]
+        +accum(p481)*c[630]+accum(p524)*c[393]+accum(p528)*c[402]+accum(p537)*c[674]+accum(p551)*c[420]
+        +accum(p554)*c[657]+accum(p557)*c[648]+s591+accum(z30)*s590;
+
+    // back through the monomer swap
+    const accum gy0 = gz0+gz1;
+    const accum gy1 = gz0-gz1;
+    const accum gy2 = gz2+gz4;
+    const accum gy4 = gz2-gz4;
+    const accum gy3 = gz3+gz5;
+    const accum gy5 = gz3-gz5;
+    const accum gy7 = gz7+gz8;
+    const accum gy8 = gz7-gz8;
+    const accum gy10 = gz10+gz12;
+    const accum gy12 = gz10-gz12;
+    const accum gy11 = gz11+gz13;
+    const accum gy13 = gz11-gz13;
+    const accum gy15 = gz15+gz19;
+    const accum gy19 = gz15-gz19;
+    const accum gy16 = gz16+gz20;
+    const accum gy20 = gz16-gz20;
+    const accum gy17 = gz17+gz21;
+    const accum gy21 = gz17-gz21;
+    const accum gy18 = gz18+gz22;
+    const accum gy22 = gz18-gz22;
+    const accum gy23 = gz23+gz25;
+    const accum gy25 = gz23-gz25;
+    const accum gy24 = gz24+gz26;
+    const accum gy26 = gz24-gz26;
+    const accum gy28 = gz28+gz29;
+    const accum gy29 = gz28-gz29;
+    // and the hydrogen and lone pair swaps
+    g[0] = gy0;
+    g[1] = gy1;
+    g[2] = gy2+gy3;
+    g[3] = gy2-gy3;
+    g[4] = gy4+gy5;
+    g[5] = gy4-gy5;
+    g[6] = gz6+gy7+gy8+gz9;
+    g[7] = gz6+gy7-gy8-gz9;
+    g[8] = gz6-gy7+gy8-gz9;
+    g[9] = gz6-gy7-gy8+gz9;
+    g[10] = gy10+gy11;
+    g[11] = gy10-gy11;
+    g[12] = gy12+gy13;
+    g[13] = gy12-gy13;
+    g[14] = gz14;
+    g[15] = gy15+gy16+gy17+gy18;
+    g[16] = gy15+gy16-gy17-gy18;
+    g[17] = gy15-gy16+gy17-gy18;
+    g[18] = gy15-gy16-gy17+gy18;
+    g[19] = gy19+gy20+gy21+gy22;
+    g[20] = gy19+gy20-gy21-gy22;
+    g[21] = gy19-gy20+gy21-gy22;
+    g[22] = gy19-gy20-gy21+gy22;
+    g[23] = gy23+gy24;
+    g[24] = gy23-gy24;
+    g[25] = gy25+gy26;
+    g[26] = gy25-gy26;
+    g[27] = gz27+gy28+gy29+gz30;
+    g[28] = gz27+gy28-gy29-gz30;
+    g[29] = gz27-gy28+gy29-gz30;
+    g[30] = gz27-gy28-gy29+gz30;
+
+    return energy;
+}
+
+// Coefficients of the 1732 terms of poly_2b_v6x_symmetric_eval from the 1153 of poly_2b_v6x_eval,
+// each a sum of 13169 exact binary fractions of them in all
+void poly_2b_v6x_symmetric_coefficients(const double * a, double * c)
+{
+    // term, coefficient, weight
+    static const struct { short term, index; double weight; } links[13169] = {
+        {0,5,1.0}, {1,4,1.0}, {2,3,1.0}, {3,2,1.0},
+        {4,1,1.0}, {5,0,1.0}, {6,24,0.25}, {6,47,-0.25},
+        {7,25,-0.25}, {7,41,0.25}, {8,12,0.25}, {8,55,-0.25},
+        {9,6,-0.0625}, {9,45,-0.0625}, {9,50,0.125}, {9,67,0.0625},
+        {10,12,0.25}, {10,55,-0.25}, {11,24,-0.25}, {11,47,0.25},
+        {12,25,0.25}, {12,41,-0.25}, {13,6,-0.0625}, {13,45,-0.0625},
+        {13,50,0.125}, {13,67,0.0625}, {14,23,0.5}, {14,25,-0.25},
+        {14,41,-0.25}, {15,21,-0.5}, {15,58,0.5}, {16,24,-0.25},
+        {16,43,0.5}, {16,47,-0.25}, {17,8,-0.5}, {17,35,0.5},
+        {18,54,-0.5}, {18,61,0.5}, {19,49,-0.5}, {19,63,0.5},
+        {20,6,-0.0625}, {20,45,0.0625}, {20,50,0.125}, {20,67,-0.0625},
+        {21,9,0.25}, {21,38,-0.25}, {22,13,0.25}, {22,37,-0.25},
+        {23,34,0.25}, {23,66,-0.125}, {24,48,0.25}, {24,57,-0.25},
+        {25,27,-0.0625}, {25,60,0.125}, {26,19,-0.125}, {26,65,0.25},
+        {27,32,-0.25}, {27,53,0.25}, {28,22,0.25}, {28,26,-0.25},
+        {29,6,0.0625}, {29,45,-0.0625}, {29,50,0.125}, {29,67,-0.0625},
+        {30,7,0.25}, {30,36,-0.25}, {31,20,0.125}, {31,29,-0.0625},
+        {32,20,0.125}, {32,29,-0.0625}, {33,22,-0.25}, {33,26,0.25},
+        {34,7,-0.25}, {34,36,0.25}, {35,19,-0.125}, {35,65,0.25},
+        {36,32,-0.25}, {36,53,0.25}, {37,6,0.0625}, {37,45,-0.0625},
+        {37,50,0.125}, {37,67,-0.0625}, {38,6,0.0625}, {38,14,-0.25},
+        {38,45,0.0625}, {38,50,0.125}, {38,67,0.0625}, {39,9,-0.25},
+        {39,11,0.5}, {39,38,-0.25}, {40,32,0.25}, {40,53,0.25},
+        {40,56,-0.5}, {41,34,0.25}, {41,39,-0.25}, {41,66,0.125},
+        {42,30,-0.5}, {42,51,0.5}, {43,19,0.125}, {43,42,-0.25},
+        {43,65,0.25}, {44,6,-0.0625}, {44,45,0.0625}, {44,50,0.125},
+        {44,67,-0.0625}, {45,13,0.25}, {45,37,-0.25}, {46,9,-0.25},
+        {46,38,0.25}, {47,27,-0.0625}, {47,60,0.125}, {48,48,-0.25},
+        {48,57,0.25}, {49,20,0.25}, {49,29,0.125}, {49,44,-0.25},
+        {50,34,0.25}, {50,66,-0.125}, {51,27,0.125}, {51,60,0.25},
+        {51,64,-0.25}, {52,20,0.25}, {52,29,0.125}, {52,44,0.25},
+        {53,22,0.5}, {53,26,0.5}, {54,28,1.0}, {55,46,1.0},
+        {56,17,1.0}, {57,7,0.5}, {57,36,0.5}, {58,12,0.5},
+        {58,55,0.5}, {59,10,1.0}, {60,19,0.125}, {60,42,0.25},
+        {60,65,0.25}, {61,30,0.5}, {61,51,0.5}, {62,18,1.0},
+        {63,15,1.0}, {64,32,0.25}, {64,53,0.25}, {64,56,0.5},
+        {65,24,0.25}, {65,43,0.5}, {65,47,0.25}, {66,49,0.5},
+        {66,63,0.5}, {67,34,0.25}, {67,39,0.25}, {67,66,0.125},
+        {68,33,1.0}, {69,48,0.5}, {69,57,0.5}, {70,9,0.25},
+        {70,11,0.5}, {70,38,0.25}, {71,21,0.5}, {71,58,0.5},
+        {72,54,0.5}, {72,61,0.5}, {73,68,1.0}, {74,59,1.0},
+        {75,52,1.0}, {76,62,1.0}, {77,31,1.0}, {78,27,0.125},
+        {78,60,0.25}, {78,64,0.25}, {79,13,0.5}, {79,37,0.5},
+        {80,16,1.0}, {81,40,1.0}, {82,6,0.0625}, {82,14,0.25},
+        {82,45,0.0625}, {82,50,0.125}, {82,67,0.0625}, {83,23,0.5},
+        {83,25,0.25}, {83,41,0.25}, {84,8,0.5}, {84,35,0.5},
+        {85,97,-0.125}, {85,381,0.0625}, {85,552,0.0625}, {86,131,0.125},
+        {86,276,-0.125}, {86,525,0.125}, {87,113,0.125}, {87,257,-0.0625},
+        {87,435,0.0625}, {87,484,-0.0625}, {87,554,0.0625}, {88,127,0.125},
+        {88,181,0.125}, {88,256,-0.0625}, {88,282,-0.0625}, {89,555,-0.125},
+        {89,558,0.25}, {90,241,0.25}, {90,478,-0.125}, {91,212,-0.0625},
+        {91,270,0.125}, {91,272,0.0625}, {91,287,0.0625}, {91,428,-0.0625},
+        {92,222,0.0625}, {92,335,-0.0625}, {92,393,0.03125}, {92,549,-0.03125},
+        {93,151,0.0625}, {93,166,0.0625}, {93,267,-0.0625}, {93,375,-0.0625},
+        {94,249,-0.0625}, {94,323,-0.0625}, {94,389,0.0625}, {94,410,0.0625},
+        {95,212,0.125}, {95,270,0.25}, {95,272,-0.125}, {95,287,-0.125},
+        {95,428,-0.125}, {96,127,-0.25}, {96,181,0.25}, {96,256,-0.125},
+        {96,282,0.125}, {97,113,0.25}, {97,257,0.125}, {97,435,-0.125},
+        {97,484,-0.125}, {97,554,-0.125}, {98,222,0.0625}, {98,335,-0.0625},
+        {98,393,0.03125}, {98,549,-0.03125}, {99,249,0.0625}, {99,323,0.0625},
+        {99,389,-0.0625}, {99,410,-0.0625}, {100,151,0.0625}, {100,166,0.0625},
+        {100,267,-0.0625}, {100,375,-0.0625}, {101,131,0.125}, {101,381,0.0625},
+        {101,525,-0.125}, {101,552,-0.0625}, {102,245,-0.125}, {102,365,0.125},
+        {102,435,0.125}, {102,554,-0.125}, {103,178,-0.125}, {103,272,-0.125},
+        {103,287,0.125}, {103,326,0.125}, {104,106,0.125}, {104,161,-0.125},
+        {104,242,0.125}, {104,469,-0.125}, {105,218,0.125}, {105,320,0.125},
+        {105,390,-0.125}, {105,515,-0.125}, {106,128,-0.125}, {106,246,0.125},
+        {106,490,0.125}, {106,493,-0.125}, {107,296,-0.125}, {107,374,-0.125},
+        {107,398,0.125}, {107,541,0.125}, {108,72,-0.125}, {108,99,-0.125},
+        {108,134,0.125}, {108,409,0.125}, {109,159,-0.125}, {109,211,-0.125},
+        {109,283,0.125}, {109,527,0.125}, {110,71,0.125}, {110,380,-0.125},
+        {110,414,0.125}, {110,512,-0.125}, {111,121,-0.25}, {111,383,0.25},
+        {112,453,-0.25}, {112,510,0.25}, {113,100,-0.125}, {113,261,-0.0625},
+        {113,321,0.0625}, {113,404,0.125}, {113,481,-0.0625}, {113,495,0.0625},
+        {114,245,-0.125}, {114,365,0.125}, {114,435,-0.125}, {114,554,0.125},
+        {115,218,-0.125}, {115,320,0.125}, {115,390,-0.125}, {115,515,0.125},
+        {116,176,-0.125}, {116,224,-0.125}, {116,405,0.125}, {116,438,0.125},
+        {117,73,0.125}, {117,115,-0.125}, {117,251,-0.125}, {117,263,0.125},
+        {118,172,-0.125}, {118,261,-0.0625}, {118,321,-0.0625}, {118,336,0.125},
+        {118,481,0.0625}, {118,495,0.0625}, {119,191,-0.125}, {119,193,0.125},
+        {119,249,-0.0625}, {119,323,0.0625}, {119,389,-0.0625}, {119,410,0.0625},
+        {120,118,0.25}, {120,543,-0.25}, {121,151,0.125}, {121,166,-0.125},
+        {121,267,0.125}, {121,375,-0.125}, {122,157,0.125}, {122,194,-0.125},
+        {122,222,0.0625}, {122,335,-0.0625}, {122,393,-0.03125}, {122,549,0.03125},
+        {123,178,-0.125}, {123,272,0.125}, {123,287,-0.125}, {123,326,0.125},
+        {124,128,0.125}, {124,246,0.125}, {124,490,-0.125}, {124,493,-0.125},
+        {125,461,-0.125}, {125,523,-0.0625}, {125,529,0.0625}, {125,532,0.125},
+        {126,461,-0.125}, {126,523,0.0625}, {126,529,-0.0625}, {126,532,0.125},
+        {127,72,0.0625}, {127,99,-0.0625}, {127,134,0.0625}, {127,296,-0.0625},
+        {127,374,0.0625}, {127,398,0.0625}, {127,409,-0.0625}, {127,541,-0.0625},
+        {128,104,-0.125}, {128,202,-0.125}, {128,291,0.125}, {128,463,0.125},
+        {129,91,0.25}, {129,433,-0.25}, {130,87,-0.25}, {130,370,0.25},
+        {131,73,-0.0625}, {131,115,0.0625}, {131,176,-0.0625}, {131,224,0.0625},
+        {131,251,-0.0625}, {131,263,0.0625}, {131,405,0.0625}, {131,438,-0.0625},
+        {132,131,0.125}, {132,381,-0.0625}, {132,525,-0.125}, {132,552,0.0625},
+        {133,106,-0.125}, {133,161,-0.125}, {133,242,0.125}, {133,469,0.125},
+        {134,73,0.0625}, {134,115,-0.0625}, {134,176,-0.0625}, {134,224,0.0625},
+        {134,251,0.0625}, {134,263,-0.0625}, {134,405,0.0625}, {134,438,-0.0625},
+        {135,104,-0.125}, {135,202,0.125}, {135,291,-0.125}, {135,463,0.125},
+        {136,72,-0.0625}, {136,99,0.0625}, {136,134,-0.0625}, {136,296,-0.0625},
+        {136,374,0.0625}, {136,398,0.0625}, {136,409,0.0625}, {136,541,-0.0625},
+        {137,100,0.125}, {137,261,-0.0625}, {137,321,0.0625}, {137,404,-0.125},
+        {137,481,-0.0625}, {137,495,0.0625}, {138,71,-0.125}, {138,380,0.125},
+        {138,414,0.125}, {138,512,-0.125}, {139,159,0.125}, {139,211,-0.125},
+        {139,283,-0.125}, {139,527,0.125}, {140,157,-0.125}, {140,194,0.125},
+        {140,222,0.0625}, {140,335,-0.0625}, {140,393,-0.03125}, {140,549,0.03125},
+        {141,191,-0.125}, {141,193,0.125}, {141,249,0.0625}, {141,323,-0.0625},
+        {141,389,0.0625}, {141,410,-0.0625}, {142,172,0.125}, {142,261,-0.0625},
+        {142,321,-0.0625}, {142,336,-0.125}, {142,481,0.0625}, {142,495,0.0625},
+        {143,122,0.0625}, {143,174,-0.03125}, {143,203,0.0625}, {143,206,-0.0625},
+        {143,290,0.0625}, {143,340,-0.03125}, {144,86,0.03125}, {144,230,0.03125},
+        {144,234,0.03125}, {144,239,-0.015625}, {144,262,-0.03125}, {144,309,-0.03125},
+        {144,350,0.0625}, {144,424,0.03125}, {144,467,-0.015625}, {144,507,-0.03125},
+        {145,111,-0.03125}, {145,141,0.03125}, {145,279,-0.015625}, {145,312,0.0625},
+        {145,421,0.03125}, {145,427,0.03125}, {145,445,0.03125}, {145,460,-0.03125},
+        {145,473,-0.015625}, {145,491,-0.03125}, {146,120,0.125}, {146,475,-0.0625},
+        {146,501,-0.0625}, {146,536,0.0625}, {147,126,-0.0625}, {147,137,0.0625},
+        {147,143,-0.03125}, {147,150,0.0625}, {147,183,-0.03125}, {147,208,0.0625},
+        {148,79,0.03125}, {148,84,-0.03125}, {148,255,0.0625}, {148,259,-0.015625},
+        {148,354,-0.03125}, {148,382,0.046875}, {148,417,-0.015625}, {148,425,-0.015625},
+        {148,457,0.046875}, {149,89,0.03125}, {149,109,-0.03125}, {149,222,0.03125},
+        {149,335,0.03125}, {149,373,-0.03125}, {149,393,-0.015625}, {149,413,0.0625},
+        {149,489,0.03125}, {149,535,-0.03125}, {149,549,-0.015625}, {150,144,0.0625},
+        {150,273,0.03125}, {150,355,-0.03125}, {150,384,-0.03125}, {150,385,-0.03125},
+        {150,397,-0.03125}, {150,419,0.03125}, {150,423,0.0625}, {151,222,-0.0625},
+        {151,335,0.0625}, {151,393,-0.03125}, {151,549,0.03125}, {152,249,-0.0625},
+        {152,323,-0.0625}, {152,389,0.0625}, {152,410,0.0625}, {153,151,-0.0625},
+        {153,166,-0.0625}, {153,267,0.0625}, {153,375,0.0625}, {154,89,-0.0625},
+        {154,109,0.0625}, {154,222,-0.0625}, {154,335,-0.0625}, {154,373,-0.0625},
+        {154,393,0.03125}, {154,413,0.125}, {154,489,0.0625}, {154,535,-0.0625},
+        {154,549,0.03125}, {155,144,0.125}, {155,273,0.0625}, {155,355,-0.0625},
+        {155,384,0.0625}, {155,385,-0.0625}, {155,397,0.0625}, {155,419,-0.0625},
+        {155,423,-0.125}, {156,79,-0.0625}, {156,84,0.0625}, {156,255,-0.125},
+        {156,259,-0.03125}, {156,354,0.0625}, {156,382,0.09375}, {156,417,-0.03125},
+        {156,425,-0.03125}, {156,457,0.09375}, {157,111,0.0625}, {157,141,-0.0625},
+        {157,279,0.03125}, {157,312,0.125}, {157,421,-0.0625}, {157,427,-0.0625},
+        {157,445,0.0625}, {157,460,-0.0625}, {157,473,0.03125}, {157,491,-0.0625},
+        {158,86,0.0625}, {158,230,0.0625}, {158,234,-0.0625}, {158,239,-0.03125},
+        {158,262,0.0625}, {158,309,-0.0625}, {158,350,-0.125}, {158,424,0.0625},
+        {158,467,-0.03125}, {158,507,0.0625}, {159,122,-0.0625}, {159,174,0.03125},
+        {159,203,0.0625}, {159,340,-0.03125}, {160,86,0.0625}, {160,230,-0.0625},
+        {160,239,-0.03125}, {160,467,0.03125}, {161,259,-0.03125}, {161,382,0.09375},
+        {161,417,-0.03125}, {161,425,0.03125}, {161,457,-0.03125}, {162,154,-0.0625},
+        {162,189,-0.0625}, {162,333,0.0625}, {162,358,0.0625}, {163,85,-0.0625},
+        {163,95,-0.0625}, {163,227,0.0625}, {163,391,0.0625}, {164,141,-0.0625},
+        {164,279,0.03125}, {164,427,0.0625}, {164,473,-0.03125}, {165,108,-0.0625},
+        {165,162,0.0625}, {165,201,-0.0625}, {165,210,0.0625}, {166,69,0.0625},
+        {166,116,-0.0625}, {166,125,0.0625}, {166,324,-0.0625}, {167,137,-0.0625},
+        {167,143,0.03125}, {167,150,0.0625}, {167,183,-0.03125}, {168,86,0.0625},
+        {168,230,-0.0625}, {168,239,-0.03125}, {168,467,0.03125}, {169,69,0.0625},
+        {169,116,-0.0625}, {169,125,0.0625}, {169,324,-0.0625}, {170,85,0.0625},
+        {170,95,0.0625}, {170,227,-0.0625}, {170,391,-0.0625}, {171,259,-0.03125},
+        {171,382,0.09375}, {171,417,-0.03125}, {171,425,0.03125}, {171,457,-0.03125},
+        {172,137,-0.0625}, {172,143,0.03125}, {172,150,0.0625}, {172,183,-0.03125},
+        {173,141,0.0625}, {173,279,-0.03125}, {173,427,-0.0625}, {173,473,0.03125},
+        {174,122,0.0625}, {174,174,-0.03125}, {174,203,-0.0625}, {174,340,0.03125},
+        {175,108,0.0625}, {175,162,-0.0625}, {175,201,0.0625}, {175,210,-0.0625},
+        {176,154,-0.0625}, {176,189,-0.0625}, {176,333,0.0625}, {176,358,0.0625},
+        {177,97,0.125}, {177,381,-0.0625}, {177,552,-0.0625}, {178,131,0.125},
+        {178,276,-0.125}, {178,525,0.125}, {179,113,0.125}, {179,257,-0.0625},
+        {179,435,0.0625}, {179,484,-0.0625}, {179,554,0.0625}, {180,127,0.125},
+        {180,181,0.125}, {180,256,-0.0625}, {180,282,-0.0625}, {181,555,-0.125},
+        {181,558,0.25}, {182,241,0.25}, {182,478,-0.125}, {183,212,-0.0625},
+        {183,270,0.125}, {183,272,0.0625}, {183,287,0.0625}, {183,428,-0.0625},
+        {184,222,-0.0625}, {184,335,0.0625}, {184,393,-0.03125}, {184,549,0.03125},
+        {185,151,-0.0625}, {185,166,-0.0625}, {185,267,0.0625}, {185,375,0.0625},
+        {186,249,0.0625}, {186,323,0.0625}, {186,389,-0.0625}, {186,410,-0.0625},
+        {187,245,0.125}, {187,365,-0.125}, {187,435,-0.125}, {187,554,0.125},
+        {188,178,0.125}, {188,272,0.125}, {188,287,-0.125}, {188,326,-0.125},
+        {189,131,0.125}, {189,381,0.0625}, {189,525,-0.125}, {189,552,-0.0625},
+        {190,218,-0.125}, {190,320,-0.125}, {190,390,0.125}, {190,515,0.125},
+        {191,128,0.125}, {191,246,-0.125}, {191,490,-0.125}, {191,493,0.125},
+        {192,106,0.125}, {192,161,-0.125}, {192,242,0.125}, {192,469,-0.125},
+        {193,100,-0.125}, {193,261,0.0625}, {193,321,-0.0625}, {193,404,0.125},
+        {193,481,0.0625}, {193,495,-0.0625}, {194,71,0.125}, {194,380,-0.125},
+        {194,414,-0.125}, {194,512,0.125}, {195,159,-0.125}, {195,211,0.125},
+        {195,283,0.125}, {195,527,-0.125}, {196,157,0.125}, {196,194,-0.125},
+        {196,222,-0.0625}, {196,335,0.0625}, {196,393,0.03125}, {196,549,-0.03125},
+        {197,191,0.125}, {197,193,-0.125}, {197,249,-0.0625}, {197,323,0.0625},
+        {197,389,-0.0625}, {197,410,0.0625}, {198,172,-0.125}, {198,261,0.0625},
+        {198,321,0.0625}, {198,336,0.125}, {198,481,-0.0625}, {198,495,-0.0625},
+        {199,73,0.0625}, {199,115,-0.0625}, {199,176,-0.0625}, {199,224,0.0625},
+        {199,251,0.0625}, {199,263,-0.0625}, {199,405,0.0625}, {199,438,-0.0625},
+        {200,104,-0.125}, {200,202,0.125}, {200,291,-0.125}, {200,463,0.125},
+        {201,72,-0.0625}, {201,99,0.0625}, {201,134,-0.0625}, {201,296,-0.0625},
+        {201,374,0.0625}, {201,398,0.0625}, {201,409,0.0625}, {201,541,-0.0625},
+        {202,461,0.125}, {202,523,0.0625}, {202,529,-0.0625}, {202,532,-0.125},
+        {203,461,-0.125}, {203,523,0.0625}, {203,529,-0.0625}, {203,532,0.125},
+        {204,72,0.0625}, {204,99,-0.0625}, {204,134,0.0625}, {204,296,-0.0625},
+        {204,374,0.0625}, {204,398,0.0625}, {204,409,-0.0625}, {204,541,-0.0625},
+        {205,104,-0.125}, {205,202,-0.125}, {205,291,0.125}, {205,463,0.125},
+        {206,91,0.25}, {206,433,-0.25}, {207,87,-0.25}, {207,370,0.25},
+        {208,73,-0.0625}, {208,115,0.0625}, {208,176,-0.0625}, {208,224,0.0625},
+        {208,251,-0.0625}, {208,263,0.0625}, {208,405,0.0625}, {208,438,-0.0625},
+        {209,131,0.125}, {209,381,-0.0625}, {209,525,-0.125}, {209,552,0.0625},
+        {210,106,-0.125}, {210,161,-0.125}, {210,242,0.125}, {210,469,0.125},
+        {211,296,-0.125}, {211,374,-0.125}, {211,398,0.125}, {211,541,0.125},
+        {212,72,0.125}, {212,99,0.125}, {212,134,-0.125}, {212,409,-0.125},
+        {213,159,0.125}, {213,211,0.125}, {213,283,-0.125}, {213,527,-0.125},
+        {214,71,-0.125}, {214,380,0.125}, {214,414,-0.125}, {214,512,0.125},
+        {215,121,0.25}, {215,383,-0.25}, {216,453,0.25}, {216,510,-0.25},
+        {217,100,0.125}, {217,261,0.0625}, {217,321,-0.0625}, {217,404,-0.125},
+        {217,481,0.0625}, {217,495,-0.0625}, {218,245,0.125}, {218,365,-0.125},
+        {218,435,0.125}, {218,554,-0.125}, {219,218,0.125}, {219,320,-0.125},
+        {219,390,0.125}, {219,515,-0.125}, {220,176,-0.125}, {220,224,-0.125},
+        {220,405,0.125}, {220,438,0.125}, {221,73,-0.125}, {221,115,0.125},
+        {221,251,0.125}, {221,263,-0.125}, {222,172,0.125}, {222,261,0.0625},
+        {222,321,0.0625}, {222,336,-0.125}, {222,481,-0.0625}, {222,495,-0.0625},
+        {223,191,0.125}, {223,193,-0.125}, {223,249,0.0625}, {223,323,-0.0625},
+        {223,389,0.0625}, {223,410,-0.0625}, {224,118,-0.25}, {224,543,0.25},
+        {225,151,-0.125}, {225,166,0.125}, {225,267,-0.125}, {225,375,0.125},
+        {226,157,-0.125}, {226,194,0.125}, {226,222,-0.0625}, {226,335,0.0625},
+        {226,393,0.03125}, {226,549,-0.03125}, {227,178,0.125}, {227,272,-0.125},
+        {227,287,0.125}, {227,326,-0.125}, {228,128,-0.125}, {228,246,-0.125},
+        {228,490,0.125}, {228,493,0.125}, {229,122,0.0625}, {229,174,-0.03125},
+        {229,203,0.0625}, {229,206,-0.0625}, {229,290,0.0625}, {229,340,-0.03125},
+        {230,86,0.03125}, {230,230,0.03125}, {230,234,0.03125}, {230,239,-0.015625},
+        {230,262,-0.03125}, {230,309,-0.03125}, {230,350,0.0625}, {230,424,0.03125},
+        {230,467,-0.015625}, {230,507,-0.03125}, {231,111,-0.03125}, {231,141,0.03125},
+        {231,279,-0.015625}, {231,312,0.0625}, {231,421,0.03125}, {231,427,0.03125},
+        {231,445,0.03125}, {231,460,-0.03125}, {231,473,-0.015625}, {231,491,-0.03125},
+        {232,120,0.125}, {232,475,-0.0625}, {232,501,-0.0625}, {232,536,0.0625},
+        {233,126,-0.0625}, {233,137,0.0625}, {233,143,-0.03125}, {233,150,0.0625},
+        {233,183,-0.03125}, {233,208,0.0625}, {234,79,0.03125}, {234,84,-0.03125},
+        {234,255,0.0625}, {234,259,-0.015625}, {234,354,-0.03125}, {234,382,0.046875},
+        {234,417,-0.015625}, {234,425,-0.015625}, {234,457,0.046875}, {235,89,0.03125},
+        {235,109,-0.03125}, {235,222,0.03125}, {235,335,0.03125}, {235,373,-0.03125},
+        {235,393,-0.015625}, {235,413,0.0625}, {235,489,0.03125}, {235,535,-0.03125},
+        {235,549,-0.015625}, {236,144,0.0625}, {236,273,0.03125}, {236,355,-0.03125},
+        {236,384,-0.03125}, {236,385,-0.03125}, {236,397,-0.03125}, {236,419,0.03125},
+        {236,423,0.0625}, {237,86,0.0625}, {237,230,-0.0625}, {237,239,-0.03125},
+        {237,467,0.03125}, {238,259,-0.03125}, {238,382,0.09375}, {238,417,-0.03125},
+        {238,425,0.03125}, {238,457,-0.03125}, {239,122,0.0625}, {239,174,-0.03125},
+        {239,203,-0.0625}, {239,340,0.03125}, {240,85,-0.0625}, {240,95,-0.0625},
+        {240,227,0.0625}, {240,391,0.0625}, {241,141,-0.0625}, {241,279,0.03125},
+        {241,427,0.0625}, {241,473,-0.03125}, {242,154,0.0625}, {242,189,0.0625},
+        {242,333,-0.0625}, {242,358,-0.0625}, {243,69,0.0625}, {243,116,-0.0625},
+        {243,125,0.0625}, {243,324,-0.0625}, {244,137,-0.0625}, {244,143,0.03125},
+        {244,150,0.0625}, {244,183,-0.03125}, {245,108,0.0625}, {245,162,-0.0625},
+        {245,201,0.0625}, {245,210,-0.0625}, {246,122,-0.0625}, {246,174,0.03125},
+        {246,203,0.0625}, {246,340,-0.03125}, {247,108,-0.0625}, {247,162,0.0625},
+        {247,201,-0.0625}, {247,210,0.0625}, {248,154,0.0625}, {248,189,0.0625},
+        {248,333,-0.0625}, {248,358,-0.0625}, {249,86,0.0625}, {249,230,-0.0625},
+        {249,239,-0.03125}, {249,467,0.03125}, {250,69,0.0625}, {250,116,-0.0625},
+        {250,125,0.0625}, {250,324,-0.0625}, {251,85,0.0625}, {251,95,0.0625},
+        {251,227,-0.0625}, {251,391,-0.0625}, {252,259,-0.03125}, {252,382,0.09375},
+        {252,417,-0.03125}, {252,425,0.03125}, {252,457,-0.03125}, {253,137,-0.0625},
+        {253,143,0.03125}, {253,150,0.0625}, {253,183,-0.03125}, {254,141,0.0625},
+        {254,279,-0.03125}, {254,427,-0.0625}, {254,473,0.03125}, {255,97,-0.125},
+        {255,131,0.125}, {255,276,0.125}, {255,381,-0.0625}, {255,525,0.125},
+        {255,552,-0.0625}, {256,113,0.125}, {256,245,-0.125}, {256,257,0.0625},
+        {256,365,-0.125}, {256,435,0.0625}, {256,484,0.0625}, {256,554,0.0625},
+        {257,127,0.125}, {257,181,0.125}, {257,256,0.0625}, {257,282,0.0625},
+        {257,329,-0.25}, {258,395,-0.25}, {258,555,0.125}, {258,558,0.25},
+        {259,231,-0.25}, {259,241,0.25}, {259,478,0.125}, {260,178,-0.125},
+        {260,212,0.0625}, {260,270,0.125}, {260,272,0.0625}, {260,287,0.0625},
+        {260,326,-0.125}, {260,428,0.0625}, {261,106,-0.25}, {261,161,0.25},
+        {261,242,0.25}, {261,469,-0.25}, {262,167,0.25}, {262,218,0.125},
+        {262,248,-0.25}, {262,320,-0.125}, {262,390,-0.125}, {262,515,0.125},
+        {263,81,0.25}, {263,213,-0.25}, {263,268,-0.25}, {263,277,0.25},
+        {264,298,0.5}, {264,557,-0.5}, {265,289,0.5}, {265,437,-0.5},
+        {266,128,0.125}, {266,246,-0.125}, {266,332,-0.25}, {266,434,0.25},
+        {266,490,0.125}, {266,493,-0.125}, {267,89,0.0625}, {267,109,-0.0625},
+        {267,222,-0.0625}, {267,335,-0.0625}, {267,373,0.0625}, {267,393,0.03125},
+        {267,413,0.125}, {267,489,-0.0625}, {267,535,-0.0625}, {267,549,0.03125},
+        {268,151,-0.0625}, {268,166,0.0625}, {268,168,-0.125}, {268,267,0.0625},
+        {268,286,0.125}, {268,375,-0.0625}, {269,142,-0.125}, {269,249,-0.0625},
+        {269,323,0.0625}, {269,389,0.0625}, {269,407,0.125}, {269,410,-0.0625},
+        {270,142,0.125}, {270,249,0.0625}, {270,323,-0.0625}, {270,389,-0.0625},
+        {270,407,-0.125}, {270,410,0.0625}, {271,147,0.125}, {271,204,0.125},
+        {271,253,-0.125}, {271,388,-0.125}, {272,235,0.25}, {272,307,-0.25},
+        {272,347,-0.125}, {272,539,0.125}, {273,151,-0.0625}, {273,166,0.0625},
+        {273,168,-0.125}, {273,267,0.0625}, {273,286,0.125}, {273,375,-0.0625},
+        {274,207,0.125}, {274,229,-0.125}, {275,147,-0.125}, {275,204,-0.125},
+        {275,253,0.125}, {275,388,0.125}, {276,72,-0.0625}, {276,99,0.0625},
+        {276,134,0.0625}, {276,296,-0.0625}, {276,374,0.0625}, {276,398,-0.0625},
+        {276,409,-0.0625}, {276,541,0.0625}, {277,182,0.25}, {277,211,-0.125},
+        {277,341,-0.125}, {277,446,0.125}, {277,527,-0.125}, {278,186,0.125},
+        {278,261,-0.0625}, {278,305,-0.125}, {278,321,0.0625}, {278,481,0.0625},
+        {278,495,-0.0625}, {279,73,-0.0625}, {279,115,-0.0625}, {279,176,-0.0625},
+        {279,224,0.0625}, {279,251,0.0625}, {279,263,0.0625}, {279,405,-0.0625},
+        {279,438,0.0625}, {280,186,0.125}, {280,261,-0.0625}, {280,305,-0.125},
+        {280,321,0.0625}, {280,481,0.0625}, {280,495,-0.0625}, {281,89,0.0625},
+        {281,109,0.0625}, {281,222,-0.0625}, {281,335,-0.0625}, {281,373,-0.0625},
+        {281,393,-0.03125}, {281,413,0.125}, {281,489,-0.0625}, {281,535,0.0625},
+        {281,549,-0.03125}, {282,319,-0.125}, {282,523,0.0625}, {282,529,0.0625},
+        {283,72,0.0625}, {283,99,-0.0625}, {283,134,-0.0625}, {283,296,0.0625},
+        {283,374,-0.0625}, {283,398,0.0625}, {283,409,0.0625}, {283,541,-0.0625},
+        {284,73,0.0625}, {284,115,0.0625}, {284,176,0.0625}, {284,224,-0.0625},
+        {284,251,-0.0625}, {284,263,-0.0625}, {284,405,0.0625}, {284,438,-0.0625},
+        {285,73,-0.125}, {285,115,-0.125}, {285,176,0.125}, {285,224,0.125},
+        {285,251,-0.125}, {285,263,-0.125}, {285,405,0.125}, {285,438,0.125},
+        {286,100,0.125}, {286,172,-0.125}, {286,186,0.125}, {286,261,-0.0625},
+        {286,305,0.125}, {286,321,-0.0625}, {286,336,-0.125}, {286,404,0.125},
+        {286,481,-0.0625}, {286,495,-0.0625}, {287,142,0.125}, {287,191,-0.125},
+        {287,193,-0.125}, {287,249,-0.0625}, {287,323,-0.0625}, {287,389,-0.0625},
+        {287,407,0.125}, {287,410,-0.0625}, {287,432,0.25}, {288,118,-0.25},
+        {288,351,0.5}, {288,543,-0.25}, {289,151,-0.125}, {289,166,-0.125},
+        {289,168,0.25}, {289,267,-0.125}, {289,286,0.25}, {289,375,-0.125},
+        {290,89,-0.0625}, {290,109,-0.0625}, {290,222,-0.0625}, {290,335,-0.0625},
+        {290,373,0.0625}, {290,393,-0.03125}, {290,413,0.125}, {290,489,0.0625},
+        {290,535,0.0625}, {290,549,-0.03125}, {291,212,-0.125}, {291,270,0.25},
+        {291,272,-0.125}, {291,287,-0.125}, {291,428,0.125}, {292,128,-0.125},
+        {292,246,-0.125}, {292,332,0.25}, {292,434,0.25}, {292,490,-0.125},
+        {292,493,-0.125}, {293,104,0.25}, {293,202,-0.25}, {293,291,-0.25},
+        {293,463,0.25}, {294,71,0.125}, {294,148,-0.25}, {294,343,0.25},
+        {294,380,0.125}, {294,414,-0.125}, {294,512,-0.125}, {295,235,0.25},
+        {295,307,-0.25}, {295,347,0.125}, {295,539,-0.125}, {296,240,-0.5},
+        {296,349,0.5}, {297,147,0.25}, {297,204,-0.25}, {297,253,-0.25},
+        {297,388,0.25}, {298,142,-0.125}, {298,191,-0.125}, {298,193,-0.125},
+        {298,249,0.0625}, {298,323,0.0625}, {298,389,0.0625}, {298,407,-0.125},
+        {298,410,0.0625}, {298,432,0.25}, {299,127,-0.25}, {299,181,0.25},
+        {299,256,0.125}, {299,282,-0.125}, {300,81,0.25}, {300,213,0.25},
+        {300,268,-0.25}, {300,277,-0.25}, {301,72,-0.125}, {301,99,-0.125},
+        {301,134,-0.125}, {301,296,0.125}, {301,374,0.125}, {301,398,0.125},
+        {301,409,-0.125}, {301,541,0.125}, {302,182,0.25}, {302,211,-0.125},
+        {302,341,0.125}, {302,446,-0.125}, {302,527,-0.125}, {303,71,-0.125},
+        {303,148,0.25}, {303,343,0.25}, {303,380,-0.125}, {303,414,-0.125},
+        {303,512,-0.125}, {304,121,-0.25}, {304,228,0.5}, {304,383,-0.25},
+        {305,348,0.5}, {305,453,-0.25}, {305,510,-0.25}, {306,100,-0.125},
+        {306,172,0.125}, {306,186,0.125}, {306,261,-0.0625}, {306,305,0.125},
+        {306,321,-0.0625}, {306,336,0.125}, {306,404,-0.125}, {306,481,-0.0625},
+        {306,495,-0.0625}, {307,113,0.25}, {307,257,-0.125}, {307,435,-0.125},
+        {307,484,0.125}, {307,554,-0.125}, {308,167,0.25}, {308,218,-0.125},
+        {308,248,0.25}, {308,320,-0.125}, {308,390,-0.125}, {308,515,-0.125},
+        {309,214,-0.25}, {309,315,0.5}, {310,442,0.25}, {310,520,0.25},
+        {310,521,-0.25}, {311,448,-0.25}, {311,502,0.25}, {311,547,0.25},
+        {312,526,-0.25}, {312,556,0.5}, {313,209,0.5}, {313,517,-0.25},
+        {314,94,-0.25}, {314,392,0.25}, {314,462,0.25}, {315,144,0.125},
+        {315,273,-0.0625}, {315,355,-0.0625}, {315,384,-0.0625}, {315,385,0.0625},
+        {315,397,0.0625}, {315,419,0.0625}, {315,423,-0.125}, {316,173,0.125},
+        {316,195,0.125}, {316,363,-0.125}, {316,430,-0.125}, {317,165,-0.125},
+        {317,170,0.125}, {317,216,0.125}, {317,530,-0.125}, {318,165,0.125},
+        {318,170,-0.125}, {318,216,-0.125}, {318,530,0.125}, {319,92,-0.125},
+        {319,233,-0.125}, {319,456,0.125}, {319,504,0.125}, {320,80,-0.25},
+        {320,477,0.25}, {320,516,-0.125}, {320,518,0.125}, {321,173,0.125},
+        {321,195,0.125}, {321,363,-0.125}, {321,430,-0.125}, {322,90,-0.125},
+        {322,175,0.125}, {323,92,0.125}, {323,233,0.125}, {323,456,-0.125},
+        {323,504,-0.125}, {324,369,-0.125}, {324,408,-0.125}, {324,436,0.125},
+        {324,553,0.125}, {325,243,-0.25}, {325,505,0.25}, {325,511,-0.125},
+        {325,559,0.125}, {326,101,0.125}, {326,132,0.125}, {326,318,-0.125},
+        {326,356,-0.125}, {327,280,-0.125}, {327,284,-0.125}, {327,331,0.125},
+        {327,443,0.125}, {328,101,0.125}, {328,132,0.125}, {328,318,-0.125},
+        {328,356,-0.125}, {329,144,0.125}, {329,273,-0.0625}, {329,355,0.0625},
+        {329,384,0.0625}, {329,385,-0.0625}, {329,397,-0.0625}, {329,419,0.0625},
+        {329,423,-0.125}, {330,179,-0.125}, {330,426,0.125}, {331,369,0.125},
+        {331,408,0.125}, {331,436,-0.125}, {331,553,-0.125}, {332,280,0.125},
+        {332,284,0.125}, {332,331,-0.125}, {332,443,-0.125}, {333,280,0.25},
+        {333,284,-0.25}, {333,331,-0.25}, {333,443,0.25}, {334,101,-0.125},
+        {334,103,-0.25}, {334,132,0.125}, {334,160,0.25}, {334,318,-0.125},
+        {334,356,0.125}, {335,165,-0.125}, {335,170,0.125}, {335,216,-0.125},
+        {335,297,0.25}, {335,441,-0.25}, {335,530,0.125}, {336,238,0.5},
+        {336,372,-0.5}, {337,173,0.25}, {337,195,-0.25}, {337,363,0.25},
+        {337,430,-0.25}, {338,144,0.125}, {338,273,0.0625}, {338,355,0.0625},
+        {338,384,-0.0625}, {338,385,0.0625}, {338,397,-0.0625}, {338,419,-0.0625},
+        {338,423,-0.125}, {339,128,-0.125}, {339,246,0.125}, {339,332,-0.25},
+        {339,434,0.25}, {339,490,-0.125}, {339,493,0.125}, {340,392,0.5},
+        {340,462,-0.5}, {341,196,0.5}, {341,368,-0.5}, {342,322,-0.25},
+        {342,334,0.25}, {342,357,-0.25}, {342,429,0.25}, {343,80,-0.25},
+        {343,477,0.25}, {343,516,0.125}, {343,518,-0.125}, {344,464,-0.5},
+        {344,534,0.5}, {345,92,-0.25}, {345,233,0.25}, {345,456,0.25},
+        {345,504,-0.25}, {346,165,0.125}, {346,170,-0.125}, {346,216,0.125},
+        {346,297,0.25}, {346,441,-0.25}, {346,530,-0.125}, {347,81,0.25},
+        {347,213,-0.25}, {347,268,0.25}, {347,277,-0.25}, {348,502,-0.5},
+        {348,547,0.5}, {349,369,-0.25}, {349,408,0.25}, {349,436,-0.25},
+        {349,553,0.25}, {350,243,-0.25}, {350,505,0.25}, {350,511,0.125},
+        {350,559,-0.125}, {351,322,-0.25}, {351,334,0.25}, {351,357,0.25},
+        {351,429,-0.25}, {352,352,0.5}, {352,542,-0.5}, {353,292,0.5},
+        {353,403,-0.5}, {354,101,-0.125}, {354,103,0.25}, {354,132,0.125},
+        {354,160,-0.25}, {354,318,-0.125}, {354,356,0.125}, {355,167,0.25},
+        {355,218,-0.125}, {355,248,-0.25}, {355,320,0.125}, {355,390,0.125},
+        {355,515,-0.125}, {356,442,-0.5}, {356,520,0.5}, {357,83,-0.125},
+        {357,139,0.0625}, {357,274,0.0625}, {358,122,0.0625}, {358,174,-0.03125},
+        {358,203,0.0625}, {358,206,0.0625}, {358,290,-0.0625}, {358,340,-0.03125},
+        {359,86,0.03125}, {359,230,0.03125}, {359,234,-0.03125}, {359,239,-0.015625},
+        {359,262,0.03125}, {359,309,0.03125}, {359,350,0.0625}, {359,424,-0.03125},
+        {359,467,-0.015625}, {359,507,-0.03125}, {360,111,-0.03125}, {360,141,0.03125},
+        {360,279,0.015625}, {360,312,0.0625}, {360,421,-0.03125}, {360,427,0.03125},
+        {360,445,-0.03125}, {360,460,0.03125}, {360,473,0.015625}, {360,491,-0.03125},
+        {361,120,0.125}, {361,475,0.0625}, {361,501,-0.0625}, {361,536,-0.0625},
+        {362,126,-0.0625}, {362,137,0.0625}, {362,143,0.03125}, {362,150,0.0625},
+        {362,183,0.03125}, {362,208,-0.0625}, {363,79,-0.03125}, {363,84,0.03125},
+        {363,255,0.0625}, {363,259,-0.015625}, {363,354,-0.03125}, {363,382,0.046875},
+        {363,417,0.046875}, {363,425,-0.015625}, {363,457,-0.015625}, {364,89,-0.03125},
+        {364,109,0.03125}, {364,222,0.03125}, {364,335,0.03125}, {364,373,0.03125},
+        {364,393,-0.015625}, {364,413,0.0625}, {364,489,-0.03125}, {364,535,-0.03125},
+        {364,549,-0.015625}, {365,144,0.0625}, {365,273,-0.03125}, {365,355,-0.03125},
+        {365,384,0.03125}, {365,385,0.03125}, {365,397,-0.03125}, {365,419,-0.03125},
+        {365,423,0.0625}, {366,107,0.125}, {366,247,0.125}, {366,387,-0.125},
+        {366,431,-0.125}, {367,154,0.125}, {367,189,-0.125}, {367,333,0.125},
+        {367,358,-0.125}, {368,85,0.0625}, {368,95,-0.0625}, {368,158,-0.125},
+        {368,227,0.0625}, {368,269,0.125}, {368,391,-0.0625}, {369,278,-0.125},
+        {369,338,0.125}, {369,472,-0.125}, {369,509,0.125}, {370,459,0.25},
+        {370,519,-0.25}, {371,129,0.125}, {371,264,-0.125}, {371,306,0.125},
+        {371,325,-0.125}, {372,96,-0.125}, {372,141,-0.0625}, {372,200,0.125},
+        {372,279,-0.03125}, {372,427,0.0625}, {372,473,0.03125}, {373,142,0.125},
+        {373,249,-0.0625}, {373,323,0.0625}, {373,389,0.0625}, {373,407,-0.125},
+        {373,410,-0.0625}, {374,165,-0.125}, {374,170,-0.125}, {374,216,0.125},
+        {374,530,0.125}, {375,198,0.0625}, {375,223,-0.0625}, {375,316,-0.125},
+        {375,497,0.125}, {376,108,0.125}, {376,162,-0.125}, {376,201,-0.125},
+        {376,210,0.125}, {377,69,0.0625}, {377,116,0.0625}, {377,125,-0.0625},
+        {377,205,0.125}, {377,324,-0.0625}, {377,342,-0.125}, {378,107,-0.0625},
+        {378,129,0.0625}, {378,247,0.0625}, {378,264,-0.0625}, {378,306,-0.0625},
+        {378,325,0.0625}, {378,387,0.0625}, {378,431,-0.0625}, {379,138,0.25},
+        {379,362,-0.25}, {380,198,-0.0625}, {380,223,0.0625}, {380,316,-0.125},
+        {380,497,0.125}, {381,137,-0.0625}, {381,139,-0.0625}, {381,143,-0.03125},
+        {381,150,0.0625}, {381,183,0.03125}, {381,274,0.0625}, {382,151,0.0625},
+        {382,166,-0.0625}, {382,168,-0.125}, {382,267,-0.0625}, {382,286,0.125},
+        {382,375,0.0625}, {383,173,0.125}, {383,195,-0.125}, {383,363,-0.125},
+        {383,430,0.125}, {384,79,0.0625}, {384,84,-0.0625}, {384,255,-0.125},
+        {384,259,-0.03125}, {384,354,0.0625}, {384,382,0.09375}, {384,417,0.09375},
+        {384,425,-0.03125}, {384,457,-0.03125}, {385,137,-0.0625}, {385,139,0.0625},
+        {385,143,-0.03125}, {385,150,0.0625}, {385,183,0.03125}, {385,274,-0.0625},
+        {386,96,-0.125}, {386,141,0.0625}, {386,200,0.125}, {386,279,0.03125},
+        {386,427,-0.0625}, {386,473,-0.03125}, {387,111,0.0625}, {387,141,-0.0625},
+        {387,279,-0.03125}, {387,312,0.125}, {387,421,0.0625}, {387,427,-0.0625},
+        {387,445,-0.0625}, {387,460,0.0625}, {387,473,-0.03125}, {387,491,-0.0625},
+        {388,107,-0.0625}, {388,129,-0.0625}, {388,247,0.0625}, {388,264,0.0625},
+        {388,306,0.0625}, {388,325,-0.0625}, {388,387,0.0625}, {388,431,-0.0625},
+        {389,278,0.125}, {389,338,-0.125}, {389,472,-0.125}, {389,509,0.125},
+        {390,86,0.0625}, {390,230,0.0625}, {390,234,0.0625}, {390,239,-0.03125},
+        {390,262,-0.0625}, {390,309,0.0625}, {390,350,-0.125}, {390,424,-0.0625},
+        {390,467,-0.03125}, {390,507,0.0625}, {391,69,0.0625}, {391,116,0.0625},
+        {391,125,-0.0625}, {391,205,-0.125}, {391,324,-0.0625}, {391,342,0.125},
+        {392,85,-0.0625}, {392,95,0.0625}, {392,158,-0.125}, {392,227,-0.0625},
+        {392,269,0.125}, {392,391,0.0625}, {393,330,-0.125}, {393,476,0.0625},
+        {393,498,0.0625}, {394,359,0.25}, {394,378,-0.125}, {395,140,0.125},
+        {395,496,-0.0625}, {395,522,-0.0625}, {395,538,0.125}, {396,117,0.1875},
+        {396,447,0.125}, {396,487,-0.0625}, {396,545,-0.0625}, {397,337,0.25},
+        {397,537,-0.125}, {398,311,0.125}, {398,449,0.125}, {398,466,-0.125},
+        {399,110,0.125}, {399,299,-0.0625}, {399,472,0.0625}, {399,509,0.0625},
+        {399,524,-0.0625}, {400,235,0.125}, {400,307,0.125}, {400,347,-0.0625},
+        {400,539,-0.0625}, {401,80,0.125}, {401,477,0.125}, {401,516,-0.0625},
+        {401,518,-0.0625}, {402,236,-0.0625}, {402,314,0.125}, {402,465,0.0625},
+        {402,474,-0.125}, {403,135,0.25}, {403,187,-0.25}, {404,98,-0.125},
+        {404,123,0.125}, {404,156,0.125}, {404,444,-0.125}, {405,311,0.125},
+        {405,449,-0.125}, {405,476,-0.0625}, {405,498,0.0625}, {406,400,-0.25},
+        {406,482,0.25}, {407,236,0.0625}, {407,314,0.125}, {407,465,-0.0625},
+        {407,474,-0.125}, {408,107,-0.0625}, {408,129,0.0625}, {408,247,0.0625},
+        {408,264,0.0625}, {408,306,-0.0625}, {408,325,-0.0625}, {408,387,-0.0625},
+        {408,431,0.0625}, {409,147,-0.125}, {409,204,0.125}, {409,253,-0.125},
+        {409,388,0.125}, {410,92,-0.125}, {410,233,0.125}, {410,456,-0.125},
+        {410,504,0.125}, {411,96,0.125}, {411,141,-0.0625}, {411,200,-0.125},
+        {411,279,-0.03125}, {411,427,0.0625}, {411,473,0.03125}, {412,107,0.0625},
+        {412,129,0.0625}, {412,247,-0.0625}, {412,264,0.0625}, {412,306,-0.0625},
+        {412,325,-0.0625}, {412,387,0.0625}, {412,431,-0.0625}, {413,110,0.25},
+        {413,299,-0.125}, {413,472,-0.125}, {413,509,-0.125}, {413,524,0.125},
+        {414,278,-0.125}, {414,338,0.125}, {414,472,0.125}, {414,509,-0.125},
+        {415,311,-0.125}, {415,449,0.125}, {415,476,-0.0625}, {415,498,0.0625},
+        {416,117,0.375}, {416,447,-0.25}, {416,487,-0.125}, {416,545,0.125},
+        {417,85,0.0625}, {417,95,-0.0625}, {417,158,0.125}, {417,227,0.0625},
+        {417,269,-0.125}, {417,391,-0.0625}, {418,98,-0.125}, {418,123,-0.125},
+        {418,156,0.125}, {418,444,0.125}, {419,140,0.25}, {419,496,0.125},
+        {419,522,-0.125}, {419,538,-0.25}, {420,146,-0.03125}, {420,396,0.03125},
+        {420,399,-0.0625}, {420,471,0.09375}, {421,105,0.125}, {421,367,-0.0625},
+        {422,77,0.125}, {422,265,-0.0625}, {423,314,0.0625}, {423,454,-0.0625},
+        {423,474,0.0625}, {424,220,-0.0625}, {424,293,0.125}, {425,146,-0.03125},
+        {425,396,-0.03125}, {425,399,0.0625}, {425,471,0.09375}, {426,316,0.0625},
+        {426,492,-0.0625}, {426,497,0.0625}, {427,184,0.125}, {427,406,-0.0625},
+        {428,285,-0.0625}, {428,360,0.125}, {429,137,-0.0625}, {429,139,0.0625},
+        {429,143,-0.03125}, {429,150,0.0625}, {429,183,0.03125}, {429,274,-0.0625},
+        {430,198,0.0625}, {430,223,0.0625}, {430,415,-0.125}, {431,107,-0.0625},
+        {431,129,-0.0625}, {431,247,0.0625}, {431,264,-0.0625}, {431,306,0.0625},
+        {431,325,0.0625}, {431,387,-0.0625}, {431,431,0.0625}, {432,107,-0.0625},
+        {432,129,-0.0625}, {432,247,0.0625}, {432,264,0.0625}, {432,306,0.0625},
+        {432,325,-0.0625}, {432,387,0.0625}, {432,431,-0.0625}, {433,226,0.125},
+        {433,236,-0.0625}, {433,465,-0.0625}, {434,311,0.125}, {434,449,-0.125},
+        {434,476,0.0625}, {434,498,-0.0625}, {435,69,0.0625}, {435,116,0.0625},
+        {435,125,-0.0625}, {435,205,-0.125}, {435,324,-0.0625}, {435,342,0.125},
+        {436,455,-0.125}, {436,488,0.125}, {437,98,0.125}, {437,123,0.125},
+        {437,156,-0.125}, {437,444,-0.125}, {438,153,-0.125}, {438,533,0.0625},
+        {438,551,0.0625}, {439,215,-0.125}, {439,371,0.125}, {439,483,0.125},
+        {440,416,0.125}, {440,499,-0.0625}, {440,513,0.1875}, {440,514,-0.0625},
+        {441,163,0.125}, {441,225,0.125}, {441,377,-0.0625}, {441,550,-0.0625},
+        {442,394,0.25}, {442,531,-0.125}, {443,254,-0.125}, {443,258,0.25},
+        {444,114,0.125}, {444,136,-0.0625}, {444,149,0.0625}, {444,221,0.0625},
+        {444,439,-0.0625}, {445,182,0.125}, {445,211,0.0625}, {445,341,-0.0625},
+        {445,446,-0.0625}, {445,527,0.0625}, {446,243,0.125}, {446,505,0.125},
+        {446,511,-0.0625}, {446,559,-0.0625}, {447,260,-0.125}, {447,376,0.125},
+        {447,412,-0.125}, {447,422,0.125}, {448,155,0.125}, {448,301,-0.125},
+        {448,302,0.125}, {448,386,-0.125}, {449,149,-0.125}, {449,171,-0.125},
+        {449,221,0.125}, {449,339,0.125}, {450,70,0.125}, {450,85,-0.0625},
+        {450,95,0.0625}, {450,112,-0.125}, {450,227,0.0625}, {450,391,-0.0625},
+        {451,452,0.25}, {451,540,-0.25}, {452,69,0.125}, {452,116,-0.125},
+        {452,125,-0.125}, {452,324,0.125}, {453,74,0.125}, {453,86,0.0625},
+        {453,230,-0.0625}, {453,239,0.03125}, {453,295,-0.125}, {453,467,-0.03125},
+        {454,186,0.125}, {454,261,0.0625}, {454,305,-0.125}, {454,321,-0.0625},
+        {454,481,-0.0625}, {454,495,0.0625}, {455,101,-0.125}, {455,132,0.125},
+        {455,318,0.125}, {455,356,-0.125}, {456,244,0.0625}, {456,353,0.125},
+        {456,401,-0.0625}, {456,418,-0.125}, {457,244,-0.0625}, {457,353,0.125},
+        {457,401,0.0625}, {457,418,-0.125}, {458,371,0.125}, {458,483,-0.125},
+        {458,533,-0.0625}, {458,551,0.0625}, {459,124,-0.125}, {459,190,-0.125},
+        {459,232,0.125}, {459,366,0.125}, {460,237,0.25}, {460,480,-0.25},
+        {461,75,0.25}, {461,133,-0.25}, {462,155,-0.0625}, {462,260,-0.0625},
+        {462,301,-0.0625}, {462,302,0.0625}, {462,376,0.0625}, {462,386,0.0625},
+        {462,412,0.0625}, {462,422,-0.0625}, {463,72,-0.0625}, {463,99,0.0625},
+        {463,134,0.0625}, {463,296,0.0625}, {463,374,-0.0625}, {463,398,0.0625},
+        {463,409,-0.0625}, {463,541,-0.0625}, {464,369,-0.125}, {464,408,0.125},
+        {464,436,0.125}, {464,553,-0.125}, {465,155,0.0625}, {465,260,-0.0625},
+        {465,301,0.0625}, {465,302,-0.0625}, {465,376,0.0625}, {465,386,-0.0625},
+        {465,412,0.0625}, {465,422,-0.0625}, {466,124,-0.125}, {466,190,0.125},
+        {466,232,0.125}, {466,366,-0.125}, {467,371,-0.125}, {467,483,0.125},
+        {467,533,-0.0625}, {467,551,0.0625}, {468,114,-0.25}, {468,136,0.125},
+        {468,149,0.125}, {468,221,0.125}, {468,439,-0.125}, {469,163,-0.25},
+        {469,225,0.25}, {469,377,-0.125}, {469,550,0.125}, {470,416,-0.25},
+        {470,499,-0.125}, {470,513,0.375}, {470,514,0.125}, {471,74,-0.125},
+        {471,86,0.0625}, {471,230,-0.0625}, {471,239,0.03125}, {471,295,0.125},
+        {471,467,-0.03125}, {472,70,0.125}, {472,85,0.0625}, {472,95,-0.0625},
+        {472,112,-0.125}, {472,227,-0.0625}, {472,391,0.0625}, {473,149,-0.125},
+        {473,171,0.125}, {473,221,0.125}, {473,339,-0.125}, {474,78,0.0625},
+        {474,119,0.0625}, {474,361,-0.125}, {475,122,0.0625}, {475,174,0.03125},
+        {475,203,0.0625}, {475,206,-0.0625}, {475,290,-0.0625}, {475,340,0.03125},
+        {476,86,0.03125}, {476,230,0.03125}, {476,234,-0.03125}, {476,239,0.015625},
+        {476,262,-0.03125}, {476,309,-0.03125}, {476,350,0.0625}, {476,424,-0.03125},
+        {476,467,0.015625}, {476,507,0.03125}, {477,111,0.03125}, {477,141,0.03125},
+        {477,279,-0.015625}, {477,312,0.0625}, {477,421,-0.03125}, {477,427,0.03125},
+        {477,445,-0.03125}, {477,460,-0.03125}, {477,473,-0.015625}, {477,491,0.03125},
+        {478,120,0.125}, {478,475,-0.0625}, {478,501,0.0625}, {478,536,-0.0625},
+        {479,126,0.0625}, {479,137,0.0625}, {479,143,-0.03125}, {479,150,0.0625},
+        {479,183,-0.03125}, {479,208,-0.0625}, {480,79,-0.03125}, {480,84,-0.03125},
+        {480,255,0.0625}, {480,259,0.046875}, {480,354,0.03125}, {480,382,0.046875},
+        {480,417,-0.015625}, {480,425,-0.015625}, {480,457,-0.015625}, {481,89,-0.03125},
+        {481,109,-0.03125}, {481,222,0.03125}, {481,335,0.03125}, {481,373,-0.03125},
+        {481,393,0.015625}, {481,413,0.0625}, {481,489,-0.03125}, {481,535,0.03125},
+        {481,549,0.015625}, {482,144,0.0625}, {482,273,-0.03125}, {482,355,0.03125},
+        {482,384,-0.03125}, {482,385,-0.03125}, {482,397,0.03125}, {482,419,-0.03125},
+        {482,423,0.0625}, {483,82,-0.125}, {483,185,0.125}, {483,192,-0.0625},
+        {483,506,0.0625}, {484,82,-0.125}, {484,185,0.125}, {484,192,0.0625},
+        {484,506,-0.0625}, {485,155,-0.0625}, {485,260,0.0625}, {485,301,0.0625},
+        {485,302,0.0625}, {485,376,0.0625}, {485,386,-0.0625}, {485,412,-0.0625},
+        {485,422,-0.0625}, {486,154,0.0625}, {486,189,-0.0625}, {486,250,-0.125},
+        {486,303,0.125}, {486,333,-0.0625}, {486,358,0.0625}, {487,217,0.25},
+        {487,271,-0.25}, {488,108,0.125}, {488,162,0.125}, {488,201,-0.125},
+        {488,210,-0.125}, {489,78,0.0625}, {489,119,-0.0625}, {489,122,0.0625},
+        {489,174,0.03125}, {489,203,-0.0625}, {489,340,-0.03125}, {490,73,-0.0625},
+        {490,115,-0.0625}, {490,176,0.0625}, {490,224,-0.0625}, {490,251,0.0625},
+        {490,263,0.0625}, {490,405,0.0625}, {490,438,-0.0625}, {491,280,0.125},
+        {491,284,-0.125}, {491,331,0.125}, {491,443,-0.125}, {492,78,0.0625},
+        {492,119,-0.0625}, {492,122,-0.0625}, {492,174,-0.03125}, {492,203,0.0625},
+        {492,340,0.03125}, {493,154,0.0625}, {493,189,-0.0625}, {493,250,0.125},
+        {493,303,-0.125}, {493,333,-0.0625}, {493,358,0.0625}, {494,155,0.0625},
+        {494,260,0.0625}, {494,301,-0.0625}, {494,302,-0.0625}, {494,376,0.0625},
+        {494,386,0.0625}, {494,412,-0.0625}, {494,422,-0.0625}, {495,74,-0.125},
+        {495,86,0.0625}, {495,230,-0.0625}, {495,239,0.03125}, {495,295,0.125},
+        {495,467,-0.03125}, {496,70,0.125}, {496,85,0.0625}, {496,95,-0.0625},
+        {496,112,-0.125}, {496,227,-0.0625}, {496,391,0.0625}, {497,149,-0.125},
+        {497,171,0.125}, {497,221,0.125}, {497,339,-0.125}, {498,79,0.0625},
+        {498,84,0.0625}, {498,255,-0.125}, {498,259,0.09375}, {498,354,-0.0625},
+        {498,382,0.09375}, {498,417,-0.03125}, {498,425,-0.03125}, {498,457,-0.03125},
+        {499,111,-0.0625}, {499,141,-0.0625}, {499,279,0.03125}, {499,312,0.125},
+        {499,421,0.0625}, {499,427,-0.0625}, {499,445,-0.0625}, {499,460,-0.0625},
+        {499,473,0.03125}, {499,491,0.0625}, {500,86,0.0625}, {500,230,0.0625},
+        {500,234,0.0625}, {500,239,0.03125}, {500,262,0.0625}, {500,309,-0.0625},
+        {500,350,-0.125}, {500,424,-0.0625}, {500,467,0.03125}, {500,507,-0.0625},
+        {501,288,0.09375}, {501,402,0.03125}, {501,451,-0.03125}, {501,494,-0.0625},
+        {502,288,0.09375}, {502,402,-0.03125}, {502,451,-0.03125}, {502,494,0.0625},
+        {503,281,-0.0625}, {503,353,0.0625}, {503,418,0.0625}, {504,345,0.125},
+        {504,364,-0.0625}, {505,145,-0.0625}, {505,468,0.125}, {506,328,0.125},
+        {506,500,-0.0625}, {507,82,0.0625}, {507,185,0.0625}, {507,188,-0.0625},
+        {508,440,-0.0625}, {508,461,0.0625}, {508,532,0.0625}, {509,420,0.125},
+        {509,544,-0.0625}, {510,192,-0.0625}, {510,219,0.125}, {510,506,-0.0625},
+        {511,197,-0.125}, {511,304,0.125}, {512,244,-0.0625}, {512,310,0.125},
+        {512,401,-0.0625}, {513,155,-0.0625}, {513,260,0.0625}, {513,301,-0.0625},
+        {513,302,0.0625}, {513,376,-0.0625}, {513,386,0.0625}, {513,412,-0.0625},
+        {513,422,0.0625}, {514,124,0.125}, {514,190,-0.125}, {514,232,-0.125},
+        {514,366,0.125}, {515,371,0.125}, {515,483,-0.125}, {515,533,0.0625},
+        {515,551,-0.0625}, {516,78,-0.0625}, {516,119,0.0625}, {516,122,0.0625},
+        {516,174,0.03125}, {516,203,-0.0625}, {516,340,-0.03125}, {517,154,-0.0625},
+        {517,189,0.0625}, {517,250,-0.125}, {517,303,0.125}, {517,333,0.0625},
+        {517,358,-0.0625}, {518,155,-0.0625}, {518,260,-0.0625}, {518,301,0.0625},
+        {518,302,0.0625}, {518,376,-0.0625}, {518,386,-0.0625}, {518,412,0.0625},
+        {518,422,0.0625}, {519,288,-0.09375}, {519,402,-0.03125}, {519,451,0.03125},
+        {519,494,0.0625}, {520,288,0.09375}, {520,402,-0.03125}, {520,451,-0.03125},
+        {520,494,0.0625}, {521,281,-0.0625}, {521,353,0.0625}, {521,418,0.0625},
+        {522,345,0.125}, {522,364,-0.0625}, {523,145,-0.0625}, {523,468,0.125},
+        {524,328,0.125}, {524,500,-0.0625}, {525,82,0.0625}, {525,185,0.0625},
+        {525,188,-0.0625}, {526,440,-0.0625}, {526,461,0.0625}, {526,532,0.0625},
+        {527,420,0.125}, {527,544,-0.0625}, {528,244,0.0625}, {528,353,0.125},
+        {528,401,-0.0625}, {528,418,-0.125}, {529,244,0.0625}, {529,353,-0.125},
+        {529,401,-0.0625}, {529,418,0.125}, {530,371,-0.125}, {530,483,0.125},
+        {530,533,0.0625}, {530,551,-0.0625}, {531,124,0.125}, {531,190,0.125},
+        {531,232,-0.125}, {531,366,-0.125}, {532,237,-0.25}, {532,480,0.25},
+        {533,75,-0.25}, {533,133,0.25}, {534,155,0.0625}, {534,260,0.0625},
+        {534,301,0.0625}, {534,302,-0.0625}, {534,376,-0.0625}, {534,386,-0.0625},
+        {534,412,-0.0625}, {534,422,0.0625}, {535,72,0.0625}, {535,99,-0.0625},
+        {535,134,-0.0625}, {535,296,-0.0625}, {535,374,0.0625}, {535,398,-0.0625},
+        {535,409,0.0625}, {535,541,0.0625}, {536,369,0.125}, {536,408,-0.125},
+        {536,436,-0.125}, {536,553,0.125}, {537,82,-0.125}, {537,185,0.125},
+        {537,192,-0.0625}, {537,506,0.0625}, {538,82,0.125}, {538,185,-0.125},
+        {538,192,-0.0625}, {538,506,0.0625}, {539,155,0.0625}, {539,260,-0.0625},
+        {539,301,-0.0625}, {539,302,-0.0625}, {539,376,-0.0625}, {539,386,0.0625},
+        {539,412,0.0625}, {539,422,0.0625}, {540,154,-0.0625}, {540,189,0.0625},
+        {540,250,0.125}, {540,303,-0.125}, {540,333,0.0625}, {540,358,-0.0625},
+        {541,217,-0.25}, {541,271,0.25}, {542,108,-0.125}, {542,162,-0.125},
+        {542,201,0.125}, {542,210,0.125}, {543,78,-0.0625}, {543,119,0.0625},
+        {543,122,-0.0625}, {543,174,-0.03125}, {543,203,0.0625}, {543,340,0.03125},
+        {544,73,0.0625}, {544,115,0.0625}, {544,176,-0.0625}, {544,224,0.0625},
+        {544,251,-0.0625}, {544,263,-0.0625}, {544,405,-0.0625}, {544,438,0.0625},
+        {545,280,-0.125}, {545,284,0.125}, {545,331,-0.125}, {545,443,0.125},
+        {546,153,0.125}, {546,533,-0.0625}, {546,551,-0.0625}, {547,215,-0.125},
+        {547,371,0.125}, {547,483,0.125}, {548,416,0.125}, {548,499,-0.0625},
+        {548,513,0.1875}, {548,514,-0.0625}, {549,163,0.125}, {549,225,0.125},
+        {549,377,-0.0625}, {549,550,-0.0625}, {550,394,0.25}, {550,531,-0.125},
+        {551,254,-0.125}, {551,258,0.25}, {552,114,0.125}, {552,136,-0.0625},
+        {552,149,0.0625}, {552,221,0.0625}, {552,439,-0.0625}, {553,182,0.125},
+        {553,211,0.0625}, {553,341,-0.0625}, {553,446,-0.0625}, {553,527,0.0625},
+        {554,243,0.125}, {554,505,0.125}, {554,511,-0.0625}, {554,559,-0.0625},
+        {555,260,0.125}, {555,376,-0.125}, {555,412,0.125}, {555,422,-0.125},
+        {556,155,0.125}, {556,301,-0.125}, {556,302,0.125}, {556,386,-0.125},
+        {557,149,-0.125}, {557,171,-0.125}, {557,221,0.125}, {557,339,0.125},
+        {558,70,0.125}, {558,85,-0.0625}, {558,95,0.0625}, {558,112,-0.125},
+        {558,227,0.0625}, {558,391,-0.0625}, {559,452,0.25}, {559,540,-0.25},
+        {560,69,0.125}, {560,116,-0.125}, {560,125,-0.125}, {560,324,0.125},
+        {561,74,0.125}, {561,86,0.0625}, {561,230,-0.0625}, {561,239,0.03125},
+        {561,295,-0.125}, {561,467,-0.03125}, {562,186,0.125}, {562,261,0.0625},
+        {562,305,-0.125}, {562,321,-0.0625}, {562,481,-0.0625}, {562,495,0.0625},
+        {563,101,-0.125}, {563,132,0.125}, {563,318,0.125}, {563,356,-0.125},
+        {564,78,-0.0625}, {564,119,-0.0625}, {564,361,0.125}, {565,122,0.0625},
+        {565,174,0.03125}, {565,203,0.0625}, {565,206,-0.0625}, {565,290,-0.0625},
+        {565,340,0.03125}, {566,86,0.03125}, {566,230,0.03125}, {566,234,-0.03125},
+        {566,239,0.015625}, {566,262,-0.03125}, {566,309,-0.03125}, {566,350,0.0625},
+        {566,424,-0.03125}, {566,467,0.015625}, {566,507,0.03125}, {567,111,0.03125},
+        {567,141,0.03125}, {567,279,-0.015625}, {567,312,0.0625}, {567,421,-0.03125},
+        {567,427,0.03125}, {567,445,-0.03125}, {567,460,-0.03125}, {567,473,-0.015625},
+        {567,491,0.03125}, {568,120,0.125}, {568,475,-0.0625}, {568,501,0.0625},
+        {568,536,-0.0625}, {569,126,0.0625}, {569,137,0.0625}, {569,143,-0.03125},
+        {569,150,0.0625}, {569,183,-0.03125}, {569,208,-0.0625}, {570,79,-0.03125},
+        {570,84,-0.03125}, {570,255,0.0625}, {570,259,0.046875}, {570,354,0.03125},
+        {570,382,0.046875}, {570,417,-0.015625}, {570,425,-0.015625}, {570,457,-0.015625},
+        {571,89,-0.03125}, {571,109,-0.03125}, {571,222,0.03125}, {571,335,0.03125},
+        {571,373,-0.03125}, {571,393,0.015625}, {571,413,0.0625}, {571,489,-0.03125},
+        {571,535,0.03125}, {571,549,0.015625}, {572,144,0.0625}, {572,273,-0.03125},
+        {572,355,0.03125}, {572,384,-0.03125}, {572,385,-0.03125}, {572,397,0.03125},
+        {572,419,-0.03125}, {572,423,0.0625}, {573,78,-0.0625}, {573,119,-0.0625},
+        {573,122,0.0625}, {573,174,0.03125}, {573,203,0.0625}, {573,206,0.0625},
+        {573,290,0.0625}, {573,340,0.03125}, {573,361,-0.125}, {574,74,-0.125},
+        {574,86,0.03125}, {574,230,0.03125}, {574,234,0.03125}, {574,239,0.015625},
+        {574,262,0.03125}, {574,295,-0.125}, {574,309,0.03125}, {574,350,0.0625},
+        {574,424,0.03125}, {574,467,0.015625}, {574,507,0.03125}, {575,96,-0.125},
+        {575,111,0.03125}, {575,141,0.03125}, {575,200,-0.125}, {575,279,0.015625},
+        {575,312,0.0625}, {575,421,0.03125}, {575,427,0.03125}, {575,445,0.03125},
+        {575,460,0.03125}, {575,473,0.015625}, {575,491,0.03125}, {576,120,0.125},
+        {576,164,-0.25}, {576,475,0.0625}, {576,501,0.0625}, {576,536,0.0625},
+        {577,83,-0.125}, {577,126,0.0625}, {577,137,0.0625}, {577,139,-0.0625},
+        {577,143,0.03125}, {577,150,0.0625}, {577,183,0.03125}, {577,208,0.0625},
+        {577,274,-0.0625}, {578,79,-0.03125}, {578,84,-0.03125}, {578,255,-0.0625},
+        {578,259,0.046875}, {578,354,-0.03125}, {578,382,0.046875}, {578,417,0.046875},
+        {578,425,0.046875}, {578,457,0.046875}, {579,89,0.03125}, {579,109,0.03125},
+        {579,157,-0.125}, {579,194,-0.125}, {579,222,0.03125}, {579,335,0.03125},
+        {579,373,0.03125}, {579,393,0.015625}, {579,413,0.0625}, {579,489,0.03125},
+        {579,535,0.03125}, {579,549,0.015625}, {580,144,0.0625}, {580,273,0.03125},
+        {580,300,-0.25}, {580,355,0.03125}, {580,384,0.03125}, {580,385,0.03125},
+        {580,397,0.03125}, {580,419,0.03125}, {580,423,0.0625}, {581,154,-0.125},
+        {581,189,-0.125}, {581,250,0.25}, {581,303,0.25}, {581,333,-0.125},
+        {581,358,-0.125}, {582,70,0.125}, {582,85,-0.0625}, {582,95,-0.0625},
+        {582,112,0.125}, {582,158,-0.125}, {582,180,0.25}, {582,227,-0.0625},
+        {582,269,-0.125}, {582,391,-0.0625}, {583,110,0.25}, {583,299,0.125},
+        {583,472,-0.125}, {583,509,-0.125}, {583,524,-0.125}, {584,317,0.5},
+        {584,459,-0.25}, {584,519,-0.25}, {585,107,0.125}, {585,129,-0.125},
+        {585,247,0.125}, {585,264,-0.125}, {585,306,-0.125}, {585,325,-0.125},
+        {585,387,0.125}, {585,431,0.125}, {586,111,-0.0625}, {586,141,-0.0625},
+        {586,279,-0.03125}, {586,312,0.125}, {586,421,-0.0625}, {586,427,-0.0625},
+        {586,445,0.0625}, {586,460,0.0625}, {586,473,-0.03125}, {586,491,0.0625},
+        {587,142,-0.125}, {587,191,0.125}, {587,193,0.125}, {587,249,-0.0625},
+        {587,323,-0.0625}, {587,389,-0.0625}, {587,407,-0.125}, {587,410,-0.0625},
+        {587,432,0.25}, {588,165,-0.125}, {588,170,-0.125}, {588,216,-0.125},
+        {588,297,0.25}, {588,441,0.25}, {588,530,-0.125}, {589,155,0.125},
+        {589,260,-0.125}, {589,301,0.125}, {589,302,0.125}, {589,376,-0.125},
+        {589,386,0.125}, {589,412,-0.125}, {589,422,-0.125}, {590,114,-0.25},
+        {590,136,-0.125}, {590,149,0.125}, {590,221,0.125}, {590,439,0.125},
+        {591,70,0.125}, {591,85,0.0625}, {591,95,0.0625}, {591,112,0.125},
+        {591,158,-0.125}, {591,180,-0.25}, {591,227,0.0625}, {591,269,-0.125},
+        {591,391,0.0625}, {592,93,-0.5}, {592,452,0.25}, {592,540,0.25},
+        {593,69,0.125}, {593,116,0.125}, {593,125,0.125}, {593,205,-0.25},
+        {593,324,0.125}, {593,342,-0.25}, {594,86,0.0625}, {594,230,0.0625},
+        {594,234,-0.0625}, {594,239,0.03125}, {594,262,-0.0625}, {594,309,0.0625},
+        {594,350,-0.125}, {594,424,0.0625}, {594,467,0.03125}, {594,507,-0.0625},
+        {595,100,-0.125}, {595,172,-0.125}, {595,186,0.125}, {595,261,0.0625},
+        {595,305,0.125}, {595,321,0.0625}, {595,336,-0.125}, {595,404,-0.125},
+        {595,481,0.0625}, {595,495,0.0625}, {596,101,0.125}, {596,103,-0.25},
+        {596,132,0.125}, {596,160,-0.25}, {596,318,0.125}, {596,356,0.125},
+        {597,275,-0.25}, {597,359,0.25}, {597,378,0.125}, {598,140,0.125},
+        {598,252,-0.25}, {598,496,0.0625}, {598,522,0.0625}, {598,538,0.125},
+        {599,117,0.1875}, {599,447,-0.125}, {599,487,0.1875}, {599,545,-0.0625},
+        {600,177,-0.25}, {600,337,0.25}, {600,537,0.125}, {601,311,0.125},
+        {601,330,-0.125}, {601,449,0.125}, {601,466,0.125}, {601,476,-0.0625},
+        {601,498,-0.0625}, {602,110,0.125}, {602,278,-0.125}, {602,299,0.0625},
+        {602,338,-0.125}, {602,472,0.0625}, {602,509,0.0625}, {602,524,0.0625},
+        {603,235,0.125}, {603,294,-0.25}, {603,307,0.125}, {603,347,0.0625},
+        {603,539,0.0625}, {604,80,0.125}, {604,477,0.125}, {604,516,0.0625},
+        {604,518,0.0625}, {604,528,-0.25}, {605,124,-0.25}, {605,190,0.25},
+        {605,232,-0.25}, {605,366,0.25}, {606,163,-0.25}, {606,225,0.25},
+        {606,377,0.125}, {606,550,-0.125}, {607,140,0.25}, {607,496,-0.125},
+        {607,522,0.125}, {607,538,-0.25}, {608,130,0.5}, {608,152,-0.5},
+        {609,98,-0.25}, {609,123,0.25}, {609,156,-0.25}, {609,444,0.25},
+        {610,70,0.125}, {610,85,-0.0625}, {610,95,-0.0625}, {610,112,0.125},
+        {610,158,0.125}, {610,180,-0.25}, {610,227,-0.0625}, {610,269,0.125},
+        {610,391,-0.0625}, {611,71,-0.125}, {611,148,-0.25}, {611,343,0.25},
+        {611,380,-0.125}, {611,414,0.125}, {611,512,0.125}, {612,322,0.25},
+        {612,334,0.25}, {612,357,-0.25}, {612,429,-0.25}, {613,153,-0.125},
+        {613,215,0.125}, {613,371,0.125}, {613,483,0.125}, {613,533,-0.0625},
+        {613,551,-0.0625}, {614,416,-0.125}, {614,499,0.1875}, {614,513,0.1875},
+        {614,514,-0.0625}, {615,88,-0.25}, {615,163,0.125}, {615,225,0.125},
+        {615,377,0.0625}, {615,550,0.0625}, {616,266,-0.25}, {616,394,0.25},
+        {616,531,0.125}, {617,254,0.125}, {617,258,0.25}, {617,313,-0.25},
+        {618,114,0.125}, {618,136,0.0625}, {618,149,0.0625}, {618,171,-0.125},
+        {618,221,0.0625}, {618,339,-0.125}, {618,439,0.0625}, {619,159,-0.125},
+        {619,182,0.125}, {619,211,0.0625}, {619,283,-0.125}, {619,341,0.0625},
+        {619,446,0.0625}, {619,527,0.0625}, {620,243,0.125}, {620,486,-0.25},
+        {620,505,0.125}, {620,511,0.0625}, {620,559,0.0625}, {621,83,0.125},
+        {621,139,-0.0625}, {621,274,-0.0625}, {622,122,0.0625}, {622,174,-0.03125},
+        {622,203,0.0625}, {622,206,0.0625}, {622,290,-0.0625}, {622,340,-0.03125},
+        {623,86,0.03125}, {623,230,0.03125}, {623,234,-0.03125}, {623,239,-0.015625},
+        {623,262,0.03125}, {623,309,0.03125}, {623,350,0.0625}, {623,424,-0.03125},
+        {623,467,-0.015625}, {623,507,-0.03125}, {624,111,-0.03125}, {624,141,0.03125},
+        {624,279,0.015625}, {624,312,0.0625}, {624,421,-0.03125}, {624,427,0.03125},
+        {624,445,-0.03125}, {624,460,0.03125}, {624,473,0.015625}, {624,491,-0.03125},
+        {625,120,0.125}, {625,475,0.0625}, {625,501,-0.0625}, {625,536,-0.0625},
+        {626,126,-0.0625}, {626,137,0.0625}, {626,143,0.03125}, {626,150,0.0625},
+        {626,183,0.03125}, {626,208,-0.0625}, {627,79,-0.03125}, {627,84,0.03125},
+        {627,255,0.0625}, {627,259,-0.015625}, {627,354,-0.03125}, {627,382,0.046875},
+        {627,417,0.046875}, {627,425,-0.015625}, {627,457,-0.015625}, {628,89,-0.03125},
+        {628,109,0.03125}, {628,222,0.03125}, {628,335,0.03125}, {628,373,0.03125},
+        {628,393,-0.015625}, {628,413,0.0625}, {628,489,-0.03125}, {628,535,-0.03125},
+        {628,549,-0.015625}, {629,144,0.0625}, {629,273,-0.03125}, {629,355,-0.03125},
+        {629,384,0.03125}, {629,385,0.03125}, {629,397,-0.03125}, {629,419,-0.03125},
+        {629,423,0.0625}, {630,198,-0.0625}, {630,223,0.0625}, {630,316,0.125},
+        {630,497,-0.125}, {631,108,0.125}, {631,162,-0.125}, {631,201,-0.125},
+        {631,210,0.125}, {632,69,0.0625}, {632,116,0.0625}, {632,125,-0.0625},
+        {632,205,0.125}, {632,324,-0.0625}, {632,342,-0.125}, {633,107,-0.0625},
+        {633,129,0.0625}, {633,247,0.0625}, {633,264,-0.0625}, {633,306,-0.0625},
+        {633,325,0.0625}, {633,387,0.0625}, {633,431,-0.0625}, {634,138,0.25},
+        {634,362,-0.25}, {635,198,-0.0625}, {635,223,0.0625}, {635,316,-0.125},
+        {635,497,0.125}, {636,137,-0.0625}, {636,139,-0.0625}, {636,143,-0.03125},
+        {636,150,0.0625}, {636,183,0.03125}, {636,274,0.0625}, {637,151,0.0625},
+        {637,166,-0.0625}, {637,168,-0.125}, {637,267,-0.0625}, {637,286,0.125},
+        {637,375,0.0625}, {638,173,0.125}, {638,195,-0.125}, {638,363,-0.125},
+        {638,430,0.125}, {639,107,0.125}, {639,247,0.125}, {639,387,-0.125},
+        {639,431,-0.125}, {640,154,-0.125}, {640,189,0.125}, {640,333,-0.125},
+        {640,358,0.125}, {641,85,-0.0625}, {641,95,0.0625}, {641,158,0.125},
+        {641,227,-0.0625}, {641,269,-0.125}, {641,391,0.0625}, {642,278,0.125},
+        {642,338,-0.125}, {642,472,0.125}, {642,509,-0.125}, {643,459,-0.25},
+        {643,519,0.25}, {644,129,-0.125}, {644,264,0.125}, {644,306,-0.125},
+        {644,325,0.125}, {645,96,0.125}, {645,141,0.0625}, {645,200,-0.125},
+        {645,279,0.03125}, {645,427,-0.0625}, {645,473,-0.03125}, {646,142,-0.125},
+        {646,249,0.0625}, {646,323,-0.0625}, {646,389,-0.0625}, {646,407,0.125},
+        {646,410,0.0625}, {647,165,0.125}, {647,170,0.125}, {647,216,-0.125},
+        {647,530,-0.125}, {648,146,0.03125}, {648,396,-0.03125}, {648,399,0.0625},
+        {648,471,-0.09375}, {649,105,0.125}, {649,367,-0.0625}, {650,77,0.125},
+        {650,265,-0.0625}, {651,314,0.0625}, {651,454,-0.0625}, {651,474,0.0625},
+        {652,220,-0.0625}, {652,293,0.125}, {653,146,-0.03125}, {653,396,-0.03125},
+        {653,399,0.0625}, {653,471,0.09375}, {654,316,0.0625}, {654,492,-0.0625},
+        {654,497,0.0625}, {655,184,0.125}, {655,406,-0.0625}, {656,285,-0.0625},
+        {656,360,0.125}, {657,236,-0.0625}, {657,314,0.125}, {657,465,0.0625},
+        {657,474,-0.125}, {658,135,-0.25}, {658,187,0.25}, {659,98,0.125},
+        {659,123,-0.125}, {659,156,-0.125}, {659,444,0.125}, {660,311,-0.125},
+        {660,449,0.125}, {660,476,0.0625}, {660,498,-0.0625}, {661,400,0.25},
+        {661,482,-0.25}, {662,236,-0.0625}, {662,314,-0.125}, {662,465,0.0625},
+        {662,474,0.125}, {663,107,0.0625}, {663,129,-0.0625}, {663,247,-0.0625},
+        {663,264,-0.0625}, {663,306,0.0625}, {663,325,0.0625}, {663,387,0.0625},
+        {663,431,-0.0625}, {664,147,0.125}, {664,204,-0.125}, {664,253,0.125},
+        {664,388,-0.125}, {665,92,0.125}, {665,233,-0.125}, {665,456,0.125},
+        {665,504,-0.125}, {666,288,0.1875}, {666,402,-0.0625}, {666,451,0.1875},
+        {666,494,-0.125}, {667,244,-0.0625}, {667,281,0.125}, {667,310,-0.125},
+        {667,353,0.125}, {667,401,-0.0625}, {667,418,0.125}, {668,197,-0.125},
+        {668,304,-0.125}, {668,345,0.25}, {668,364,0.125}, {669,145,0.125},
+        {669,468,0.25}, {669,479,-0.25}, {670,327,-0.25}, {670,328,0.25},
+        {670,500,0.125}, {671,82,0.125}, {671,185,0.125}, {671,188,0.125},
+        {671,192,-0.0625}, {671,219,-0.125}, {671,506,-0.0625}, {672,319,-0.125},
+        {672,440,0.125}, {672,461,0.125}, {672,523,-0.0625}, {672,529,-0.0625},
+        {672,532,0.125}, {673,179,-0.125}, {673,420,0.25}, {673,426,-0.125},
+        {673,544,0.125}, {674,330,0.125}, {674,476,-0.0625}, {674,498,-0.0625},
+        {675,359,0.25}, {675,378,-0.125}, {676,140,0.125}, {676,496,-0.0625},
+        {676,522,-0.0625}, {676,538,0.125}, {677,117,0.1875}, {677,447,0.125},
+        {677,487,-0.0625}, {677,545,-0.0625}, {678,337,0.25}, {678,537,-0.125},
+        {679,311,0.125}, {679,449,0.125}, {679,466,-0.125}, {680,110,0.125},
+        {680,299,-0.0625}, {680,472,0.0625}, {680,509,0.0625}, {680,524,-0.0625},
+        {681,235,0.125}, {681,307,0.125}, {681,347,-0.0625}, {681,539,-0.0625},
+        {682,80,0.125}, {682,477,0.125}, {682,516,-0.0625}, {682,518,-0.0625},
+        {683,105,0.25}, {683,367,0.125}, {683,458,-0.25}, {684,77,0.25},
+        {684,265,0.125}, {684,455,-0.125}, {684,488,-0.125}, {685,226,-0.125},
+        {685,236,-0.0625}, {685,314,0.125}, {685,454,0.125}, {685,465,-0.0625},
+        {685,474,0.125}, {686,220,0.125}, {686,293,0.25}, {686,548,-0.25},
+        {687,146,0.1875}, {687,396,-0.0625}, {687,399,-0.125}, {687,471,0.1875},
+        {688,198,-0.0625}, {688,223,-0.0625}, {688,316,0.125}, {688,415,-0.125},
+        {688,492,0.125}, {688,497,0.125}, {689,184,0.25}, {689,207,-0.125},
+        {689,229,-0.125}, {689,406,0.125}, {690,90,-0.125}, {690,175,-0.125},
+        {690,285,0.125}, {690,360,0.25}, {691,288,0.0625}, {691,402,0.0625},
+        {691,451,0.0625}, {691,494,0.125}, {692,244,0.0625}, {692,281,0.125},
+        {692,310,0.125}, {692,353,0.125}, {692,401,0.0625}, {692,418,0.125},
+        {693,197,0.125}, {693,304,0.125}, {693,345,0.25}, {693,364,0.125},
+        {694,145,0.125}, {694,468,0.25}, {694,479,0.25}, {695,327,0.25},
+        {695,328,0.25}, {695,500,0.125}, {696,82,0.125}, {696,185,0.125},
+        {696,188,0.125}, {696,192,0.0625}, {696,219,0.125}, {696,506,0.0625},
+        {697,319,0.125}, {697,440,0.125}, {697,461,0.125}, {697,523,0.0625},
+        {697,529,0.0625}, {697,532,0.125}, {698,179,0.125}, {698,420,0.25},
+        {698,426,0.125}, {698,544,0.125}, {699,153,0.125}, {699,215,0.125},
+        {699,371,0.125}, {699,483,0.125}, {699,533,0.0625}, {699,551,0.0625},
+        {700,124,0.25}, {700,190,0.25}, {700,232,0.25}, {700,366,0.25},
+        {701,237,0.5}, {701,480,0.5}, {702,75,0.5}, {702,133,0.5},
+        {703,155,0.125}, {703,260,0.125}, {703,301,0.125}, {703,302,0.125},
+        {703,376,0.125}, {703,386,0.125}, {703,412,0.125}, {703,422,0.125},
+        {704,72,0.125}, {704,99,0.125}, {704,134,0.125}, {704,296,0.125},
+        {704,374,0.125}, {704,398,0.125}, {704,409,0.125}, {704,541,0.125},
+        {705,369,0.25}, {705,408,0.25}, {705,436,0.25}, {705,553,0.25},
+        {706,275,0.25}, {706,359,0.25}, {706,378,0.125}, {707,379,1.0},
+        {708,135,0.5}, {708,187,0.5}, {709,154,0.125}, {709,189,0.125},
+        {709,250,0.25}, {709,303,0.25}, {709,333,0.125}, {709,358,0.125},
+        {710,104,0.25}, {710,202,0.25}, {710,291,0.25}, {710,463,0.25},
+        {711,196,0.5}, {711,368,0.5}, {712,470,1.0}, {713,344,1.0},
+        {714,217,0.5}, {714,271,0.5}, {715,91,0.5}, {715,433,0.5},
+        {716,102,1.0}, {717,105,0.25}, {717,367,0.125}, {717,458,0.25},
+        {718,108,0.25}, {718,162,0.25}, {718,201,0.25}, {718,210,0.25},
+        {719,87,0.5}, {719,370,0.5}, {720,308,1.0}, {721,78,0.0625},
+        {721,119,0.0625}, {721,122,0.0625}, {721,174,0.03125}, {721,203,0.0625},
+        {721,206,0.0625}, {721,290,0.0625}, {721,340,0.03125}, {721,361,0.125},
+        {722,73,0.125}, {722,115,0.125}, {722,176,0.125}, {722,224,0.125},
+        {722,251,0.125}, {722,263,0.125}, {722,405,0.125}, {722,438,0.125},
+        {723,280,0.25}, {723,284,0.25}, {723,331,0.25}, {723,443,0.25},
+        {724,97,0.125}, {724,131,0.125}, {724,276,0.125}, {724,381,0.0625},
+        {724,525,0.125}, {724,552,0.0625}, {725,106,0.25}, {725,161,0.25},
+        {725,242,0.25}, {725,469,0.25}, {726,214,0.25}, {726,315,0.5},
+        {727,416,0.125}, {727,499,0.0625}, {727,513,0.0625}, {727,514,0.0625},
+        {728,88,0.25}, {728,163,0.125}, {728,225,0.125}, {728,377,0.0625},
+        {728,550,0.0625}, {729,266,0.25}, {729,394,0.25}, {729,531,0.125},
+        {730,254,0.125}, {730,258,0.25}, {730,313,0.25}, {731,114,0.125},
+        {731,136,0.0625}, {731,149,0.0625}, {731,171,0.125}, {731,221,0.0625},
+        {731,339,0.125}, {731,439,0.0625}, {732,159,0.125}, {732,182,0.125},
+        {732,211,0.0625}, {732,283,0.125}, {732,341,0.0625}, {732,446,0.0625},
+        {732,527,0.0625}, {733,243,0.125}, {733,486,0.25}, {733,505,0.125},
+        {733,511,0.0625}, {733,559,0.0625}, {734,140,0.125}, {734,252,0.25},
+        {734,496,0.0625}, {734,522,0.0625}, {734,538,0.125}, {735,130,0.5},
+        {735,152,0.5}, {736,98,0.25}, {736,123,0.25}, {736,156,0.25},
+        {736,444,0.25}, {737,70,0.125}, {737,85,0.0625}, {737,95,0.0625},
+        {737,112,0.125}, {737,158,0.125}, {737,180,0.25}, {737,227,0.0625},
+        {737,269,0.125}, {737,391,0.0625}, {738,71,0.125}, {738,148,0.25},
+        {738,343,0.25}, {738,380,0.125}, {738,414,0.125}, {738,512,0.125},
+        {739,322,0.25}, {739,334,0.25}, {739,357,0.25}, {739,429,0.25},
+        {740,503,1.0}, {741,169,1.0}, {742,93,0.5}, {742,452,0.25},
+        {742,540,0.25}, {743,121,0.25}, {743,228,0.5}, {743,383,0.25},
+        {744,352,0.5}, {744,542,0.5}, {745,77,0.25}, {745,265,0.125},
+        {745,455,0.125}, {745,488,0.125}, {746,69,0.125}, {746,116,0.125},
+        {746,125,0.125}, {746,205,0.25}, {746,324,0.125}, {746,342,0.25},
+        {747,348,0.5}, {747,453,0.25}, {747,510,0.25}, {748,292,0.5},
+        {748,403,0.5}, {749,74,0.125}, {749,86,0.03125}, {749,230,0.03125},
+        {749,234,0.03125}, {749,239,0.015625}, {749,262,0.03125}, {749,295,0.125},
+        {749,309,0.03125}, {749,350,0.0625}, {749,424,0.03125}, {749,467,0.015625},
+        {749,507,0.03125}, {750,100,0.125}, {750,172,0.125}, {750,186,0.125},
+        {750,261,0.0625}, {750,305,0.125}, {750,321,0.0625}, {750,336,0.125},
+        {750,404,0.125}, {750,481,0.0625}, {750,495,0.0625}, {751,101,0.125},
+        {751,103,0.25}, {751,132,0.125}, {751,160,0.25}, {751,318,0.125},
+        {751,356,0.125}, {752,113,0.125}, {752,245,0.125}, {752,257,0.0625},
+        {752,365,0.125}, {752,435,0.0625}, {752,484,0.0625}, {752,554,0.0625},
+        {753,167,0.25}, {753,218,0.125}, {753,248,0.25}, {753,320,0.125},
+        {753,390,0.125}, {753,515,0.125}, {754,442,0.25}, {754,520,0.25},
+        {754,521,0.25}, {755,117,0.0625}, {755,447,0.125}, {755,487,0.0625},
+        {755,545,0.0625}, {756,177,0.25}, {756,337,0.25}, {756,537,0.125},
+        {757,311,0.125}, {757,330,0.125}, {757,449,0.125}, {757,466,0.125},
+        {757,476,0.0625}, {757,498,0.0625}, {758,110,0.125}, {758,278,0.125},
+        {758,299,0.0625}, {758,338,0.125}, {758,472,0.0625}, {758,509,0.0625},
+        {758,524,0.0625}, {759,235,0.125}, {759,294,0.25}, {759,307,0.125},
+        {759,347,0.0625}, {759,539,0.0625}, {760,80,0.125}, {760,477,0.125},
+        {760,516,0.0625}, {760,518,0.0625}, {760,528,0.25}, {761,450,1.0},
+        {762,400,0.5}, {762,482,0.5}, {763,317,0.5}, {763,459,0.25},
+        {763,519,0.25}, {764,240,0.5}, {764,349,0.5}, {765,464,0.5},
+        {765,534,0.5}, {766,226,0.125}, {766,236,0.0625}, {766,314,0.125},
+        {766,454,0.125}, {766,465,0.0625}, {766,474,0.125}, {767,107,0.125},
+        {767,129,0.125}, {767,247,0.125}, {767,264,0.125}, {767,306,0.125},
+        {767,325,0.125}, {767,387,0.125}, {767,431,0.125}, {768,147,0.25},
+        {768,204,0.25}, {768,253,0.25}, {768,388,0.25}, {769,92,0.25},
+        {769,233,0.25}, {769,456,0.25}, {769,504,0.25}, {770,96,0.125},
+        {770,111,0.03125}, {770,141,0.03125}, {770,200,0.125}, {770,279,0.015625},
+        {770,312,0.0625}, {770,421,0.03125}, {770,427,0.03125}, {770,445,0.03125},
+        {770,460,0.03125}, {770,473,0.015625}, {770,491,0.03125}, {771,142,0.125},
+        {771,191,0.125}, {771,193,0.125}, {771,249,0.0625}, {771,323,0.0625},
+        {771,389,0.0625}, {771,407,0.125}, {771,410,0.0625}, {771,432,0.25},
+        {772,165,0.125}, {772,170,0.125}, {772,216,0.125}, {772,297,0.25},
+        {772,441,0.25}, {772,530,0.125}, {773,127,0.125}, {773,181,0.125},
+        {773,256,0.0625}, {773,282,0.0625}, {773,329,0.25}, {774,81,0.25},
+        {774,213,0.25}, {774,268,0.25}, {774,277,0.25}, {775,448,0.25},
+        {775,502,0.25}, {775,547,0.25}, {776,508,1.0}, {777,199,1.0},
+        {778,346,1.0}, {779,546,1.0}, {780,485,1.0}, {781,220,0.125},
+        {781,293,0.25}, {781,548,0.25}, {782,138,0.5}, {782,362,0.5},
+        {783,76,1.0}, {784,411,1.0}, {785,120,0.125}, {785,164,0.25},
+        {785,475,0.0625}, {785,501,0.0625}, {785,536,0.0625}, {786,118,0.25},
+        {786,351,0.5}, {786,543,0.25}, {787,238,0.5}, {787,372,0.5},
+        {788,395,0.25}, {788,555,0.125}, {788,558,0.25}, {789,298,0.5},
+        {789,557,0.5}, {790,526,0.25}, {790,556,0.5}, {791,146,0.0625},
+        {791,396,0.0625}, {791,399,0.125}, {791,471,0.0625}, {792,198,0.0625},
+        {792,223,0.0625}, {792,316,0.125}, {792,415,0.125}, {792,492,0.125},
+        {792,497,0.125}, {793,184,0.25}, {793,207,0.125}, {793,229,0.125},
+        {793,406,0.125}, {794,90,0.125}, {794,175,0.125}, {794,285,0.125},
+        {794,360,0.25}, {795,83,0.125}, {795,126,0.0625}, {795,137,0.0625},
+        {795,139,0.0625}, {795,143,0.03125}, {795,150,0.0625}, {795,183,0.03125},
+        {795,208,0.0625}, {795,274,0.0625}, {796,151,0.125}, {796,166,0.125},
+        {796,168,0.25}, {796,267,0.125}, {796,286,0.25}, {796,375,0.125},
+        {797,173,0.25}, {797,195,0.25}, {797,363,0.25}, {797,430,0.25},
+        {798,231,0.25}, {798,241,0.25}, {798,478,0.125}, {799,289,0.5},
+        {799,437,0.5}, {800,209,0.5}, {800,517,0.25}, {801,79,0.03125},
+        {801,84,0.03125}, {801,255,0.0625}, {801,259,0.015625}, {801,354,0.03125},
+        {801,382,0.015625}, {801,417,0.015625}, {801,425,0.015625}, {801,457,0.015625},
+        {802,89,0.03125}, {802,109,0.03125}, {802,157,0.125}, {802,194,0.125},
+        {802,222,0.03125}, {802,335,0.03125}, {802,373,0.03125}, {802,393,0.015625},
+        {802,413,0.0625}, {802,489,0.03125}, {802,535,0.03125}, {802,549,0.015625},
+        {803,144,0.0625}, {803,273,0.03125}, {803,300,0.25}, {803,355,0.03125},
+        {803,384,0.03125}, {803,385,0.03125}, {803,397,0.03125}, {803,419,0.03125},
+        {803,423,0.0625}, {804,178,0.125}, {804,212,0.0625}, {804,270,0.125},
+        {804,272,0.0625}, {804,287,0.0625}, {804,326,0.125}, {804,428,0.0625},
+        {805,128,0.125}, {805,246,0.125}, {805,332,0.25}, {805,434,0.25},
+        {805,490,0.125}, {805,493,0.125}, {806,94,0.25}, {806,392,0.25},
+        {806,462,0.25}, {807,560,-0.0078125}, {807,621,0.0078125}, {807,632,0.0078125},
+        {807,652,0.0078125}, {807,670,0.00390625}, {807,766,-0.00390625}, {807,799,-0.0078125},
+        {807,847,0.00390625}, {807,854,-0.0078125}, {807,863,0.0078125}, {807,867,0.00390625},
+        {807,885,0.015625}, {807,914,-0.00390625}, {807,1058,-0.00390625}, {807,1087,-0.0078125},
+        {807,1102,0.00390625}, {807,1115,-0.0078125}, {807,1136,-0.00390625}, {808,560,-0.0078125},
+        {808,621,0.0078125}, {808,632,0.0078125}, {808,652,0.0078125}, {808,670,0.00390625},
+        {808,766,-0.00390625}, {808,799,-0.0078125}, {808,847,0.00390625}, {808,854,-0.0078125},
+        {808,863,0.0078125}, {808,867,0.00390625}, {808,885,0.015625}, {808,914,-0.00390625},
+        {808,1058,-0.00390625}, {808,1087,-0.0078125}, {808,1102,0.00390625}, {808,1115,-0.0078125},
+        {808,1136,-0.00390625}, {809,560,-0.0078125}, {809,621,-0.0078125}, {809,632,0.0078125},
+        {809,652,0.0078125}, {809,670,-0.00390625}, {809,766,-0.00390625}, {809,799,-0.0078125},
+        {809,847,0.00390625}, {809,854,0.0078125}, {809,863,-0.0078125}, {809,867,-0.00390625},
+        {809,885,0.015625}, {809,914,-0.00390625}, {809,1058,0.00390625}, {809,1087,-0.0078125},
+        {809,1102,0.00390625}, {809,1115,0.0078125}, {809,1136,0.00390625}, {810,678,0.015625},
+        {810,699,-0.03125}, {810,701,-0.015625}, {810,718,-0.015625}, {810,754,0.03125},
+        {810,792,0.015625}, {810,846,-0.015625}, {810,1020,0.015625}, {810,1086,0.015625},
+        {810,1122,-0.015625}, {811,579,0.03125}, {811,607,0.015625}, {811,638,-0.015625},
+        {811,650,-0.015625}, {811,757,-0.03125}, {811,802,-0.015625}, {811,848,0.015625},
+        {811,858,0.015625}, {811,891,0.015625}, {811,960,-0.015625}, {812,765,-0.015625},
+        {812,901,0.03125}, {812,943,0.0078125}, {812,1003,0.03125}, {812,1059,-0.015625},
+        {812,1060,-0.015625}, {812,1061,-0.015625}, {812,1151,0.0078125}, {813,613,0.03125},
+        {813,694,-0.03125}, {813,709,-0.03125}, {813,860,0.015625}, {813,897,0.03125},
+        {813,1039,-0.015625}, {813,1046,-0.015625}, {813,1062,0.015625}, {814,630,0.0078125},
+        {814,668,-0.015625}, {814,759,0.03125}, {814,932,-0.015625}, {815,569,-0.03125},
+        {815,681,-0.015625}, {815,704,0.015625}, {815,974,0.015625}, {815,1034,-0.015625},
+        {815,1083,0.015625}, {815,1111,0.015625}, {815,1123,-0.015625}, {815,1128,-0.015625},
+        {815,1132,0.0078125}, {815,1142,0.0078125}, {815,1143,0.03125}, {816,653,-0.03125},
+        {816,661,-0.03125}, {816,672,0.015625}, {816,675,0.015625}, {816,783,-0.015625},
+        {816,790,-0.03125}, {816,813,-0.015625}, {816,875,0.03125}, {816,988,0.03125},
+        {816,1000,0.015625}, {816,1029,0.03125}, {816,1036,0.015625}, {816,1038,-0.015625},
+        {816,1089,-0.015625}, {817,671,0.015625}, {817,677,0.015625}, {817,687,-0.015625},
+        {817,711,0.015625}, {817,739,0.015625}, {817,758,0.015625}, {817,807,-0.015625},
+        {817,868,-0.015625}, {817,880,0.015625}, {817,969,0.015625}, {817,979,0.015625},
+        {817,1008,-0.015625}, {817,1016,-0.015625}, {817,1019,-0.015625}, {817,1023,0.015625},
+        {817,1044,-0.015625}, {817,1075,0.015625}, {817,1091,-0.015625}, {817,1107,-0.015625},
+        {817,1150,-0.015625}, {818,560,0.0078125}, {818,621,-0.0078125}, {818,632,0.0078125},
+        {818,652,0.0078125}, {818,670,0.00390625}, {818,766,0.00390625}, {818,787,0.015625},
+        {818,799,-0.0078125}, {818,847,-0.00390625}, {818,854,-0.0078125}, {818,863,-0.0078125},
+        {818,867,0.00390625}, {818,871,-0.03125}, {818,885,0.015625}, {818,914,0.00390625},
+        {818,1011,0.015625}, {818,1058,0.00390625}, {818,1087,-0.0078125}, {818,1102,-0.00390625},
+        {818,1115,-0.0078125}, {818,1136,0.00390625}, {819,576,-0.015625}, {819,605,0.015625},
+        {819,618,-0.015625}, {819,628,0.015625}, {819,641,0.015625}, {819,659,0.015625},
+        {819,676,-0.015625}, {819,700,-0.015625}, {819,721,0.015625}, {819,744,-0.015625},
+        {819,794,-0.015625}, {819,806,0.015625}, {819,824,0.015625}, {819,862,0.015625},
+        {819,864,-0.015625}, {819,896,-0.015625}, {819,909,0.015625}, {819,946,-0.015625},
+        {819,961,-0.015625}, {819,994,0.015625}, {820,573,-0.0078125}, {820,642,0.0078125},
+        {820,719,0.015625}, {820,753,-0.015625}, {820,767,-0.015625}, {820,853,0.015625},
+        {820,893,0.0078125}, {820,916,-0.015625}, {820,936,0.0078125}, {820,1055,0.0078125},
+        {821,573,0.0078125}, {821,642,-0.0078125}, {821,719,0.015625}, {821,753,-0.015625},
+        {821,767,-0.015625}, {821,853,0.015625}, {821,893,0.0078125}, {821,916,0.015625},
+        {821,936,-0.0078125}, {821,1055,-0.0078125}, {822,671,0.015625}, {822,677,-0.015625},
+        {822,687,-0.015625}, {822,711,-0.015625}, {822,739,-0.015625}, {822,758,-0.015625},
+        {822,807,0.015625}, {822,868,0.015625}, {822,880,0.015625}, {822,969,0.015625},
+        {822,979,0.015625}, {822,1008,0.015625}, {822,1016,-0.015625}, {822,1019,-0.015625},
+        {822,1023,-0.015625}, {822,1044,0.015625}, {822,1075,-0.015625}, {822,1091,0.015625},
+        {822,1107,-0.015625}, {822,1150,0.015625}, {823,576,0.015625}, {823,605,0.015625},
+        {823,618,0.015625}, {823,628,0.015625}, {823,641,0.015625}, {823,659,-0.015625},
+        {823,676,-0.015625}, {823,700,-0.015625}, {823,721,-0.015625}, {823,744,0.015625},
+        {823,794,0.015625}, {823,806,-0.015625}, {823,824,-0.015625}, {823,862,0.015625},
+        {823,864,0.015625}, {823,896,0.015625}, {823,909,-0.015625}, {823,946,-0.015625},
+        {823,961,-0.015625}, {823,994,-0.015625}, {824,569,0.03125}, {824,681,-0.015625},
+        {824,704,0.015625}, {824,974,0.015625}, {824,1034,-0.015625}, {824,1083,-0.015625},
+        {824,1111,-0.015625}, {824,1123,-0.015625}, {824,1128,-0.015625}, {824,1132,0.0078125},
+        {824,1142,0.0078125}, {824,1143,0.03125}, {825,653,0.03125}, {825,661,-0.03125},
+        {825,672,0.015625}, {825,675,0.015625}, {825,783,-0.015625}, {825,790,0.03125},
+        {825,813,-0.015625}, {825,875,0.03125}, {825,988,-0.03125}, {825,1000,0.015625},
+        {825,1029,-0.03125}, {825,1036,0.015625}, {825,1038,-0.015625}, {825,1089,-0.015625},
+        {826,560,0.0078125}, {826,621,-0.0078125}, {826,632,0.0078125}, {826,652,0.0078125},
+        {826,670,0.00390625}, {826,766,0.00390625}, {826,787,-0.015625}, {826,799,-0.0078125},
+        {826,847,-0.00390625}, {826,854,-0.0078125}, {826,863,-0.0078125}, {826,867,0.00390625},
+        {826,871,0.03125}, {826,885,0.015625}, {826,914,0.00390625}, {826,1011,-0.015625},
+        {826,1058,0.00390625}, {826,1087,-0.0078125}, {826,1102,-0.00390625}, {826,1115,-0.0078125},
+        {826,1136,0.00390625}, {827,560,0.0078125}, {827,583,-0.03125}, {827,621,0.0078125},
+        {827,632,0.0078125}, {827,652,0.0078125}, {827,670,-0.00390625}, {827,766,0.00390625},
+        {827,799,-0.0078125}, {827,839,-0.03125}, {827,847,-0.00390625}, {827,854,0.0078125},
+        {827,856,0.03125}, {827,863,0.0078125}, {827,867,-0.00390625}, {827,885,0.015625},
+        {827,914,0.00390625}, {827,1058,-0.00390625}, {827,1087,-0.0078125}, {827,1102,-0.00390625},
+        {827,1115,0.0078125}, {827,1136,-0.00390625}, {828,568,0.0625}, {828,678,-0.015625},
+        {828,683,0.03125}, {828,699,-0.03125}, {828,701,0.015625}, {828,707,0.03125},
+        {828,718,-0.015625}, {828,754,-0.03125}, {828,792,0.015625}, {828,846,-0.015625},
+        {828,913,-0.03125}, {828,1018,-0.03125}, {828,1020,0.015625}, {828,1086,-0.015625},
+        {828,1122,0.015625}, {829,658,0.03125}, {829,661,0.03125}, {829,672,0.015625},
+        {829,675,-0.015625}, {829,688,-0.03125}, {829,780,0.03125}, {829,783,0.015625},
+        {829,813,-0.015625}, {829,875,0.03125}, {829,918,-0.03125}, {829,992,-0.03125},
+        {829,1000,0.015625}, {829,1031,-0.03125}, {829,1036,-0.015625}, {829,1038,-0.015625},
+        {829,1089,0.015625}, {830,585,0.03125}, {830,679,-0.0625}, {830,765,0.015625},
+        {830,901,0.03125}, {830,943,-0.0078125}, {830,1003,0.03125}, {830,1059,-0.015625},
+        {830,1060,0.015625}, {830,1061,-0.015625}, {830,1151,-0.0078125}, {831,686,-0.03125},
+        {831,730,0.03125}, {831,830,0.0625}, {831,857,0.03125}, {831,865,-0.0625},
+        {831,948,-0.03125}, {831,967,0.03125}, {831,980,-0.03125}, {831,1106,0.03125},
+        {831,1114,-0.03125}, {832,681,-0.015625}, {832,704,0.015625}, {832,899,-0.03125},
+        {832,964,0.03125}, {832,974,0.015625}, {832,989,-0.03125}, {832,1034,-0.015625},
+        {832,1123,0.015625}, {832,1128,0.015625}, {832,1132,-0.0078125}, {832,1142,-0.0078125},
+        {832,1143,0.03125}, {833,560,-0.0078125}, {833,621,-0.0078125}, {833,632,0.0078125},
+        {833,652,0.0078125}, {833,670,-0.00390625}, {833,766,-0.00390625}, {833,799,-0.0078125},
+        {833,847,0.00390625}, {833,854,0.0078125}, {833,863,-0.0078125}, {833,867,-0.00390625},
+        {833,885,0.015625}, {833,914,-0.00390625}, {833,1058,0.00390625}, {833,1087,-0.0078125},
+        {833,1102,0.00390625}, {833,1115,0.0078125}, {833,1136,0.00390625}, {834,579,0.03125},
+        {834,607,0.015625}, {834,638,-0.015625}, {834,650,-0.015625}, {834,757,-0.03125},
+        {834,802,-0.015625}, {834,848,0.015625}, {834,858,0.015625}, {834,891,0.015625},
+        {834,960,-0.015625}, {835,678,-0.015625}, {835,699,0.03125}, {835,701,0.015625},
+        {835,718,0.015625}, {835,754,-0.03125}, {835,792,-0.015625}, {835,846,0.015625},
+        {835,1020,-0.015625}, {835,1086,-0.015625}, {835,1122,0.015625}, {836,630,0.0078125},
+        {836,668,-0.015625}, {836,759,0.03125}, {836,932,-0.015625}, {837,613,-0.03125},
+        {837,694,0.03125}, {837,709,0.03125}, {837,860,-0.015625}, {837,897,-0.03125},
+        {837,1039,0.015625}, {837,1046,0.015625}, {837,1062,-0.015625}, {838,719,0.03125},
+        {838,753,-0.03125}, {838,767,0.03125}, {838,777,-0.03125}, {838,853,0.03125},
+        {838,893,-0.015625}, {838,1045,0.015625}, {838,1081,0.015625}, {838,1090,-0.015625},
+        {838,1112,-0.015625}, {839,573,0.03125}, {839,642,0.03125}, {839,916,-0.0625},
+        {839,936,-0.03125}, {839,1055,0.03125}, {840,671,0.03125}, {840,687,0.03125},
+        {840,880,0.03125}, {840,969,-0.03125}, {840,979,-0.03125}, {840,1016,-0.03125},
+        {840,1019,0.03125}, {840,1107,-0.03125}, {841,702,-0.0625}, {841,720,-0.0625},
+        {841,747,0.0625}, {841,831,0.0625}, {842,727,0.0625}, {842,1030,-0.125},
+        {842,1079,0.0625}, {843,596,-0.125}, {843,874,0.0625}, {843,934,0.0625},
+        {844,605,-0.03125}, {844,628,0.03125}, {844,641,-0.03125}, {844,676,-0.03125},
+        {844,700,0.03125}, {844,862,0.03125}, {844,946,0.03125}, {844,961,-0.03125},
+        {845,765,-0.015625}, {845,901,0.03125}, {845,943,0.0078125}, {845,1003,0.03125},
+        {845,1059,-0.015625}, {845,1060,-0.015625}, {845,1061,-0.015625}, {845,1151,0.0078125},
+        {846,630,-0.015625}, {846,668,-0.03125}, {846,759,0.0625}, {846,922,0.015625},
+        {846,932,0.03125}, {846,933,0.015625}, {846,983,-0.03125}, {846,1053,-0.03125},
+        {847,719,0.03125}, {847,753,-0.03125}, {847,767,0.03125}, {847,777,0.03125},
+        {847,853,0.03125}, {847,893,-0.015625}, {847,1045,-0.015625}, {847,1081,-0.015625},
+        {847,1090,0.015625}, {847,1112,0.015625}, {848,677,0.03125}, {848,711,0.03125},
+        {848,739,-0.03125}, {848,758,0.03125}, {848,807,0.03125}, {848,868,0.03125},
+        {848,1008,0.03125}, {848,1023,-0.03125}, {848,1044,-0.03125}, {848,1075,0.03125},
+        {848,1091,0.03125}, {848,1150,-0.03125}, {849,563,0.0625}, {849,624,0.0625},
+        {849,636,0.0625}, {849,791,0.0625}, {849,815,-0.0625}, {849,919,-0.0625},
+        {850,954,-0.125}, {850,973,0.125}, {850,1121,0.125}, {851,715,0.125},
+        {851,782,0.125}, {851,836,-0.125}, {852,576,-0.03125}, {852,618,0.03125},
+        {852,659,0.03125}, {852,721,0.03125}, {852,744,0.03125}, {852,794,0.03125},
+        {852,806,-0.03125}, {852,824,0.03125}, {852,864,0.03125}, {852,896,-0.03125},
+        {852,909,0.03125}, {852,994,-0.03125}, {853,681,-0.015625}, {853,704,0.015625},
+        {853,899,0.03125}, {853,964,-0.03125}, {853,974,0.015625}, {853,989,0.03125},
+        {853,1034,-0.015625}, {853,1123,0.015625}, {853,1128,0.015625}, {853,1132,-0.0078125},
+        {853,1142,-0.0078125}, {853,1143,0.03125}, {854,686,0.03125}, {854,730,0.03125},
+        {854,830,0.0625}, {854,857,-0.03125}, {854,865,0.0625}, {854,948,-0.03125},
+        {854,967,0.03125}, {854,980,0.03125}, {854,1106,-0.03125}, {854,1114,-0.03125},
+        {855,819,0.125}, {855,907,-0.0625}, {855,1009,0.0625}, {855,1042,-0.0625},
+        {855,1129,0.0625}, {856,724,0.0625}, {856,737,-0.0625}, {856,795,-0.0625},
+        {856,1035,0.125}, {856,1070,0.0625}, {857,658,-0.03125}, {857,661,0.03125},
+        {857,672,0.015625}, {857,675,-0.015625}, {857,688,0.03125}, {857,780,-0.03125},
+        {857,783,0.015625}, {857,813,-0.015625}, {857,875,0.03125}, {857,918,0.03125},
+        {857,992,0.03125}, {857,1000,0.015625}, {857,1031,0.03125}, {857,1036,-0.015625},
+        {857,1038,-0.015625}, {857,1089,0.015625}, {858,585,-0.03125}, {858,679,0.0625},
+        {858,765,0.015625}, {858,901,0.03125}, {858,943,-0.0078125}, {858,1003,0.03125},
+        {858,1059,-0.015625}, {858,1060,0.015625}, {858,1061,-0.015625}, {858,1151,-0.0078125},
+        {859,808,0.125}, {859,1014,-0.0625}, {859,1076,-0.0625}, {859,1104,0.125},
+        {860,613,0.0625}, {860,694,0.0625}, {860,709,0.0625}, {860,860,-0.03125},
+        {860,897,0.0625}, {860,1039,-0.03125}, {860,1046,-0.03125}, {860,1062,-0.03125},
+        {861,568,0.0625}, {861,678,0.015625}, {861,683,0.03125}, {861,699,0.03125},
+        {861,701,-0.015625}, {861,707,0.03125}, {861,718,0.015625}, {861,754,0.03125},
+        {861,792,-0.015625}, {861,846,0.015625}, {861,913,-0.03125}, {861,1018,-0.03125},
+        {861,1020,-0.015625}, {861,1086,0.015625}, {861,1122,-0.015625}, {862,804,0.25},
+        {862,1152,-0.125}, {863,939,0.25}, {863,1141,-0.125}, {864,570,0.0625},
+        {864,703,-0.0625}, {864,820,0.125}, {864,851,0.0625}, {864,940,-0.0625},
+        {865,630,-0.015625}, {865,668,-0.03125}, {865,759,0.0625}, {865,922,-0.015625},
+        {865,932,0.03125}, {865,933,-0.015625}, {865,983,0.03125}, {865,1053,0.03125},
+        {866,579,0.0625}, {866,607,-0.03125}, {866,638,-0.03125}, {866,650,0.03125},
+        {866,757,0.0625}, {866,802,-0.03125}, {866,848,-0.03125}, {866,858,0.03125},
+        {866,891,0.03125}, {866,960,0.03125}, {867,560,0.0078125}, {867,583,0.03125},
+        {867,621,0.0078125}, {867,632,0.0078125}, {867,652,0.0078125}, {867,670,-0.00390625},
+        {867,766,0.00390625}, {867,799,-0.0078125}, {867,839,0.03125}, {867,847,-0.00390625},
+        {867,854,0.0078125}, {867,856,-0.03125}, {867,863,0.0078125}, {867,867,-0.00390625},
+        {867,885,0.015625}, {867,914,0.00390625}, {867,1058,-0.00390625}, {867,1087,-0.0078125},
+        {867,1102,-0.00390625}, {867,1115,0.0078125}, {867,1136,-0.00390625}, {868,560,-0.03125},
+        {868,621,-0.03125}, {868,632,-0.03125}, {868,652,-0.03125}, {868,670,-0.015625},
+        {868,766,0.015625}, {868,799,-0.03125}, {868,847,0.015625}, {868,854,0.03125},
+        {868,863,0.03125}, {868,867,0.015625}, {868,885,0.0625}, {868,914,0.015625},
+        {868,1058,0.015625}, {868,1087,0.03125}, {868,1102,-0.015625}, {868,1115,-0.03125},
+        {868,1136,-0.015625}, {869,612,0.03125}, {869,632,-0.03125}, {869,652,0.03125},
+        {869,766,-0.015625}, {869,914,0.015625}, {869,962,0.015625}, {869,995,-0.03125},
+        {869,1134,-0.015625}, {870,616,0.03125}, {870,678,0.03125}, {870,680,-0.03125},
+        {870,718,-0.03125}, {870,740,-0.03125}, {870,835,0.03125}, {870,846,0.03125},
+        {870,1086,-0.03125}, {871,587,-0.03125}, {871,633,-0.03125}, {871,634,0.03125},
+        {871,650,0.03125}, {871,785,0.03125}, {871,858,-0.03125}, {871,891,0.03125},
+        {871,960,-0.03125}, {872,644,0.015625}, {872,722,-0.03125}, {872,728,0.03125},
+        {872,842,0.03125}, {872,938,-0.015625}, {872,971,0.015625}, {872,1040,-0.03125},
+        {872,1100,-0.015625}, {873,619,0.03125}, {873,623,-0.03125}, {873,929,0.03125},
+        {873,931,-0.03125}, {873,966,-0.03125}, {873,996,0.03125}, {873,1043,0.03125},
+        {873,1103,-0.03125}, {874,564,-0.03125}, {874,589,-0.03125}, {874,599,0.03125},
+        {874,817,0.03125}, {874,821,0.03125}, {874,837,-0.03125}, {874,1069,0.03125},
+        {874,1096,-0.03125}, {875,612,0.03125}, {875,632,0.03125}, {875,652,-0.03125},
+        {875,766,0.015625}, {875,914,-0.015625}, {875,962,0.015625}, {875,995,-0.03125},
+        {875,1134,-0.015625}, {876,644,-0.015625}, {876,722,0.03125}, {876,728,-0.03125},
+        {876,842,0.03125}, {876,938,-0.015625}, {876,971,0.015625}, {876,1040,-0.03125},
+        {876,1100,0.015625}, {877,587,-0.03125}, {877,633,-0.03125}, {877,634,0.03125},
+        {877,650,-0.03125}, {877,785,0.03125}, {877,858,0.03125}, {877,891,-0.03125},
+        {877,960,0.03125}, {878,564,-0.03125}, {878,589,0.03125}, {878,599,-0.03125},
+        {878,817,0.03125}, {878,821,-0.03125}, {878,837,-0.03125}, {878,1069,0.03125},
+        {878,1096,0.03125}, {879,616,-0.03125}, {879,678,0.03125}, {879,680,0.03125},
+        {879,718,-0.03125}, {879,740,0.03125}, {879,835,-0.03125}, {879,846,0.03125},
+        {879,1086,-0.03125}, {880,619,-0.03125}, {880,623,-0.03125}, {880,929,-0.03125},
+        {880,931,-0.03125}, {880,966,0.03125}, {880,996,0.03125}, {880,1043,0.03125},
+        {880,1103,0.03125}, {881,560,-0.03125}, {881,621,0.03125}, {881,632,-0.03125},
+        {881,652,-0.03125}, {881,670,0.015625}, {881,766,0.015625}, {881,799,-0.03125},
+        {881,847,0.015625}, {881,854,-0.03125}, {881,863,-0.03125}, {881,867,-0.015625},
+        {881,885,0.0625}, {881,914,0.015625}, {881,1058,-0.015625}, {881,1087,0.03125},
+        {881,1102,-0.015625}, {881,1115,0.03125}, {881,1136,0.015625}, {882,579,0.0625},
+        {882,607,-0.03125}, {882,638,0.03125}, {882,650,0.03125}, {882,757,-0.0625},
+        {882,802,-0.03125}, {882,848,0.03125}, {882,858,-0.03125}, {882,891,-0.03125},
+        {882,960,0.03125}, {883,678,0.03125}, {883,699,0.0625}, {883,701,-0.03125},
+        {883,718,-0.03125}, {883,754,-0.0625}, {883,792,-0.03125}, {883,846,-0.03125},
+        {883,1020,0.03125}, {883,1086,0.03125}, {883,1122,0.03125}, {884,678,-0.03125},
+        {884,699,-0.0625}, {884,701,0.03125}, {884,718,0.03125}, {884,754,0.0625},
+        {884,792,0.03125}, {884,846,0.03125}, {884,1020,-0.03125}, {884,1086,-0.03125},
+        {884,1122,-0.03125}, {885,613,-0.0625}, {885,694,-0.0625}, {885,709,0.0625},
+        {885,860,0.03125}, {885,897,0.0625}, {885,1039,0.03125}, {885,1046,-0.03125},
+        {885,1062,-0.03125}, {886,765,-0.0625}, {886,901,0.125}, {886,943,-0.03125},
+        {886,1003,-0.125}, {886,1059,0.0625}, {886,1060,0.0625}, {886,1061,-0.0625},
+        {886,1151,0.03125}, {887,579,0.0625}, {887,607,-0.03125}, {887,638,0.03125},
+        {887,650,0.03125}, {887,757,-0.0625}, {887,802,-0.03125}, {887,848,0.03125},
+        {887,858,-0.03125}, {887,891,-0.03125}, {887,960,0.03125}, {888,922,0.03125},
+        {888,933,-0.03125}, {888,983,-0.0625}, {888,1053,0.0625}, {889,613,0.0625},
+        {889,694,0.0625}, {889,709,-0.0625}, {889,860,-0.03125}, {889,897,-0.0625},
+        {889,1039,-0.03125}, {889,1046,0.03125}, {889,1062,0.03125}, {890,677,0.03125},
+        {890,711,-0.03125}, {890,739,0.03125}, {890,758,0.03125}, {890,807,0.03125},
+        {890,868,-0.03125}, {890,1008,0.03125}, {890,1023,-0.03125}, {890,1044,0.03125},
+        {890,1075,-0.03125}, {890,1091,-0.03125}, {890,1150,-0.03125}, {891,681,-0.0625},
+        {891,704,-0.0625}, {891,974,-0.0625}, {891,1034,0.0625}, {891,1123,0.0625},
+        {891,1128,-0.0625}, {891,1132,-0.03125}, {891,1142,0.03125}, {891,1143,0.125},
+        {892,661,-0.0625}, {892,672,-0.03125}, {892,675,0.03125}, {892,783,0.03125},
+        {892,813,0.03125}, {892,875,0.0625}, {892,1000,-0.03125}, {892,1036,-0.03125},
+        {892,1038,-0.03125}, {892,1089,0.03125}, {893,576,-0.03125}, {893,618,0.03125},
+        {893,659,-0.03125}, {893,721,0.03125}, {893,744,-0.03125}, {893,794,-0.03125},
+        {893,806,-0.03125}, {893,824,0.03125}, {893,864,0.03125}, {893,896,0.03125},
+        {893,909,-0.03125}, {893,994,0.03125}, {894,661,-0.0625}, {894,672,-0.03125},
+        {894,675,0.03125}, {894,783,0.03125}, {894,813,0.03125}, {894,875,0.0625},
+        {894,1000,-0.03125}, {894,1036,-0.03125}, {894,1038,-0.03125}, {894,1089,0.03125},
+        {895,560,0.03125}, {895,621,0.03125}, {895,632,-0.03125}, {895,652,-0.03125},
+        {895,670,-0.015625}, {895,766,-0.015625}, {895,799,-0.03125}, {895,847,-0.015625},
+        {895,854,0.03125}, {895,863,-0.03125}, {895,867,0.015625}, {895,885,0.0625},
+        {895,914,-0.015625}, {895,1058,-0.015625}, {895,1087,0.03125}, {895,1102,0.015625},
+        {895,1115,-0.03125}, {895,1136,0.015625}, {896,777,-0.0625}, {896,1045,-0.03125},
+        {896,1081,0.03125}, {896,1090,0.03125}, {896,1112,0.03125}, {897,677,-0.03125},
+        {897,711,0.03125}, {897,739,-0.03125}, {897,758,-0.03125}, {897,807,-0.03125},
+        {897,868,0.03125}, {897,1008,-0.03125}, {897,1023,0.03125}, {897,1044,-0.03125},
+        {897,1075,0.03125}, {897,1091,0.03125}, {897,1150,0.03125}, {898,576,0.03125},
+        {898,618,-0.03125}, {898,659,0.03125}, {898,721,-0.03125}, {898,744,0.03125},
+        {898,794,0.03125}, {898,806,0.03125}, {898,824,-0.03125}, {898,864,-0.03125},
+        {898,896,-0.03125}, {898,909,0.03125}, {898,994,-0.03125}, {899,576,0.0625},
+        {899,618,0.0625}, {899,659,0.0625}, {899,721,-0.0625}, {899,744,-0.0625},
+        {899,794,-0.0625}, {899,806,-0.0625}, {899,824,-0.0625}, {899,864,0.0625},
+        {899,896,-0.0625}, {899,909,0.0625}, {899,994,0.0625}, {900,658,0.0625},
+        {900,661,0.0625}, {900,672,-0.03125}, {900,675,-0.03125}, {900,688,0.0625},
+        {900,780,-0.0625}, {900,783,-0.03125}, {900,813,0.03125}, {900,875,0.0625},
+        {900,918,-0.0625}, {900,992,-0.0625}, {900,1000,-0.03125}, {900,1031,0.0625},
+        {900,1036,0.03125}, {900,1038,-0.03125}, {900,1089,-0.03125}, {901,568,0.125},
+        {901,678,-0.03125}, {901,683,-0.0625}, {901,699,0.0625}, {901,701,0.03125},
+        {901,707,-0.0625}, {901,718,-0.03125}, {901,754,0.0625}, {901,792,-0.03125},
+        {901,846,-0.03125}, {901,913,0.0625}, {901,1018,-0.0625}, {901,1020,0.03125},
+        {901,1086,-0.03125}, {901,1122,-0.03125}, {902,570,-0.125}, {902,703,-0.125},
+        {902,820,0.25}, {902,851,-0.125}, {902,940,0.125}, {903,579,0.125},
+        {903,607,0.0625}, {903,638,0.0625}, {903,650,-0.0625}, {903,757,0.125},
+        {903,802,-0.0625}, {903,848,-0.0625}, {903,858,-0.0625}, {903,891,-0.0625},
+        {903,960,-0.0625}, {904,560,0.03125}, {904,621,-0.03125}, {904,632,-0.03125},
+        {904,652,-0.03125}, {904,670,0.015625}, {904,766,-0.015625}, {904,799,-0.03125},
+        {904,847,-0.015625}, {904,854,-0.03125}, {904,863,0.03125}, {904,867,-0.015625},
+        {904,885,0.0625}, {904,914,-0.015625}, {904,1058,0.015625}, {904,1087,0.03125},
+        {904,1102,0.015625}, {904,1115,0.03125}, {904,1136,-0.015625}, {905,563,0.125},
+        {905,624,-0.125}, {905,636,0.125}, {905,791,-0.125}, {905,815,0.125},
+        {905,919,-0.125}, {906,686,0.0625}, {906,730,-0.0625}, {906,830,0.125},
+        {906,857,-0.0625}, {906,865,-0.125}, {906,948,0.0625}, {906,967,-0.0625},
+        {906,980,0.0625}, {906,1106,0.0625}, {906,1114,-0.0625}, {907,765,0.0625},
+        {907,901,0.125}, {907,943,0.03125}, {907,1003,-0.125}, {907,1059,0.0625},
+        {907,1060,-0.0625}, {907,1061,-0.0625}, {907,1151,-0.03125}, {908,808,-0.25},
+        {908,1014,-0.125}, {908,1076,0.125}, {908,1104,0.25}, {909,613,0.125},
+        {909,694,-0.125}, {909,709,0.125}, {909,860,0.0625}, {909,897,-0.125},
+        {909,1039,-0.0625}, {909,1046,0.0625}, {909,1062,-0.0625}, {910,568,0.125},
+        {910,678,0.03125}, {910,683,-0.0625}, {910,699,-0.0625}, {910,701,-0.03125},
+        {910,707,-0.0625}, {910,718,0.03125}, {910,754,-0.0625}, {910,792,0.03125},
+        {910,846,0.03125}, {910,913,0.0625}, {910,1018,-0.0625}, {910,1020,-0.03125},
+        {910,1086,0.03125}, {910,1122,0.03125}, {911,677,-0.0625}, {911,711,0.0625},
+        {911,739,0.0625}, {911,758,-0.0625}, {911,807,0.0625}, {911,868,-0.0625},
+        {911,1008,0.0625}, {911,1023,-0.0625}, {911,1044,-0.0625}, {911,1075,0.0625},
+        {911,1091,-0.0625}, {911,1150,0.0625}, {912,681,-0.0625}, {912,704,-0.0625},
+        {912,974,-0.0625}, {912,1034,0.0625}, {912,1123,-0.0625}, {912,1128,0.0625},
+        {912,1132,0.03125}, {912,1142,-0.03125}, {912,1143,0.125}, {913,686,-0.0625},
+        {913,730,-0.0625}, {913,830,0.125}, {913,857,0.0625}, {913,865,0.125},
+        {913,948,0.0625}, {913,967,-0.0625}, {913,980,-0.0625}, {913,1106,-0.0625},
+        {913,1114,-0.0625}, {914,819,0.25}, {914,907,-0.125}, {914,1009,-0.125},
+        {914,1042,0.125}, {914,1129,-0.125}, {915,724,-0.125}, {915,737,0.125},
+        {915,795,-0.125}, {915,1035,0.25}, {915,1070,-0.125}, {916,658,-0.0625},
+        {916,661,0.0625}, {916,672,-0.03125}, {916,675,-0.03125}, {916,688,-0.0625},
+        {916,780,0.0625}, {916,783,-0.03125}, {916,813,0.03125}, {916,875,0.0625},
+        {916,918,0.0625}, {916,992,0.0625}, {916,1000,-0.03125}, {916,1031,-0.0625},
+        {916,1036,0.03125}, {916,1038,-0.03125}, {916,1089,-0.03125}, {917,612,0.03125},
+        {917,632,-0.03125}, {917,652,0.03125}, {917,766,-0.015625}, {917,914,0.015625},
+        {917,962,0.015625}, {917,995,-0.03125}, {917,1134,-0.015625}, {918,587,-0.03125},
+        {918,633,-0.03125}, {918,634,0.03125}, {918,650,0.03125}, {918,785,0.03125},
+        {918,858,-0.03125}, {918,891,0.03125}, {918,960,-0.03125}, {919,616,-0.03125},
+        {919,678,-0.03125}, {919,680,0.03125}, {919,718,0.03125}, {919,740,0.03125},
+        {919,835,-0.03125}, {919,846,-0.03125}, {919,1086,0.03125}, {920,644,0.015625},
+        {920,722,-0.03125}, {920,728,0.03125}, {920,842,0.03125}, {920,938,-0.015625},
+        {920,971,0.015625}, {920,1040,-0.03125}, {920,1100,-0.015625}, {921,564,-0.03125},
+        {921,589,-0.03125}, {921,599,0.03125}, {921,817,0.03125}, {921,821,0.03125},
+        {921,837,-0.03125}, {921,1069,0.03125}, {921,1096,-0.03125}, {922,619,-0.03125},
+        {922,623,0.03125}, {922,929,-0.03125}, {922,931,0.03125}, {922,966,0.03125},
+        {922,996,-0.03125}, {922,1043,-0.03125}, {922,1103,0.03125}, {923,612,0.03125},
+        {923,632,0.03125}, {923,652,-0.03125}, {923,766,0.015625}, {923,914,-0.015625},
+        {923,962,0.015625}, {923,995,-0.03125}, {923,1134,-0.015625}, {924,644,-0.015625},
+        {924,722,0.03125}, {924,728,-0.03125}, {924,842,0.03125}, {924,938,-0.015625},
+        {924,971,0.015625}, {924,1040,-0.03125}, {924,1100,0.015625}, {925,616,0.03125},
+        {925,678,-0.03125}, {925,680,-0.03125}, {925,718,0.03125}, {925,740,-0.03125},
+        {925,835,0.03125}, {925,846,-0.03125}, {925,1086,0.03125}, {926,619,0.03125},
+        {926,623,0.03125}, {926,929,0.03125}, {926,931,0.03125}, {926,966,-0.03125},
+        {926,996,-0.03125}, {926,1043,-0.03125}, {926,1103,-0.03125}, {927,587,-0.03125},
+        {927,633,-0.03125}, {927,634,0.03125}, {927,650,-0.03125}, {927,785,0.03125},
+        {927,858,0.03125}, {927,891,-0.03125}, {927,960,0.03125}, {928,564,-0.03125},
+        {928,589,0.03125}, {928,599,-0.03125}, {928,817,0.03125}, {928,821,-0.03125},
+        {928,837,-0.03125}, {928,1069,0.03125}, {928,1096,0.03125}, {929,577,0.03125},
+        {929,653,-0.03125}, {929,672,0.03125}, {929,688,-0.0625}, {929,778,-0.03125},
+        {929,783,0.03125}, {929,790,0.03125}, {929,895,-0.03125}, {929,982,0.03125},
+        {929,988,0.03125}, {929,1000,-0.03125}, {929,1029,-0.03125}, {929,1031,0.0625},
+        {929,1089,-0.03125}, {930,686,0.0625}, {930,730,-0.0625}, {930,816,-0.0625},
+        {930,872,0.0625}, {930,889,-0.0625}, {930,967,0.0625}, {930,980,-0.0625},
+        {930,1124,0.0625}, {931,704,-0.0625}, {931,899,0.0625}, {931,974,0.0625},
+        {931,989,-0.0625}, {931,991,0.0625}, {931,1083,0.03125}, {931,1097,-0.0625},
+        {931,1111,-0.03125}, {932,583,0.0625}, {932,612,0.03125}, {932,632,-0.03125},
+        {932,652,0.03125}, {932,766,0.015625}, {932,787,-0.03125}, {932,839,-0.0625},
+        {932,914,-0.015625}, {932,962,-0.015625}, {932,995,-0.03125}, {932,1011,0.03125},
+        {932,1134,0.015625}, {933,616,-0.03125}, {933,657,0.0625}, {933,678,-0.03125},
+        {933,680,0.03125}, {933,683,0.0625}, {933,707,-0.0625}, {933,718,-0.03125},
+        {933,740,-0.03125}, {933,812,-0.0625}, {933,835,0.03125}, {933,846,0.03125},
+        {933,1086,0.03125}, {934,577,0.03125}, {934,653,0.03125}, {934,672,0.03125},
+        {934,778,-0.03125}, {934,783,-0.03125}, {934,790,-0.03125}, {934,895,0.03125},
+        {934,918,0.0625}, {934,982,-0.03125}, {934,988,0.03125}, {934,992,-0.0625},
+        {934,1000,-0.03125}, {934,1029,-0.03125}, {934,1089,0.03125}, {935,605,0.03125},
+        {935,618,-0.03125}, {935,641,-0.03125}, {935,659,0.03125}, {935,676,0.03125},
+        {935,721,-0.03125}, {935,744,0.03125}, {935,794,-0.03125}, {935,824,0.03125},
+        {935,864,0.03125}, {935,909,-0.03125}, {935,961,-0.03125}, {936,563,-0.0625},
+        {936,624,-0.0625}, {936,636,0.0625}, {936,702,0.0625}, {936,720,-0.0625},
+        {936,791,0.0625}, {937,677,-0.03125}, {937,711,0.03125}, {937,758,0.03125},
+        {937,807,0.03125}, {937,868,-0.03125}, {937,969,0.03125}, {937,979,-0.03125},
+        {937,1008,-0.03125}, {937,1016,0.03125}, {937,1075,-0.03125}, {937,1091,0.03125},
+        {937,1107,-0.03125}, {938,584,0.03125}, {938,642,0.03125}, {938,719,-0.0625},
+        {938,853,0.0625}, {938,951,-0.03125}, {938,1055,-0.03125}, {938,1090,-0.03125},
+        {938,1112,0.03125}, {939,584,0.03125}, {939,642,-0.03125}, {939,719,0.0625},
+        {939,853,-0.0625}, {939,951,-0.03125}, {939,1055,0.03125}, {939,1090,-0.03125},
+        {939,1112,0.03125}, {940,671,-0.03125}, {940,677,0.03125}, {940,687,-0.03125},
+        {940,711,0.03125}, {940,758,-0.03125}, {940,807,0.03125}, {940,868,0.03125},
+        {940,880,0.03125}, {940,1008,-0.03125}, {940,1019,0.03125}, {940,1075,-0.03125},
+        {940,1091,-0.03125}, {941,563,-0.0625}, {941,624,0.0625}, {941,636,0.0625},
+        {941,747,-0.0625}, {941,791,-0.0625}, {941,831,0.0625}, {942,727,0.0625},
+        {942,973,-0.125}, {942,1079,-0.0625}, {942,1121,0.125}, {943,715,0.125},
+        {943,782,-0.125}, {943,874,-0.0625}, {943,934,0.0625}, {944,618,-0.03125},
+        {944,628,-0.03125}, {944,659,0.03125}, {944,700,0.03125}, {944,721,0.03125},
+        {944,744,-0.03125}, {944,794,0.03125}, {944,824,-0.03125}, {944,862,0.03125},
+        {944,864,0.03125}, {944,909,-0.03125}, {944,946,-0.03125}, {945,671,-0.03125},
+        {945,687,0.03125}, {945,711,0.0625}, {945,807,-0.0625}, {945,880,0.03125},
+        {945,969,-0.03125}, {945,979,0.03125}, {945,1008,0.0625}, {945,1016,0.03125},
+        {945,1019,-0.03125}, {945,1075,-0.0625}, {945,1107,-0.03125}, {946,671,0.03125},
+        {946,677,-0.0625}, {946,687,-0.03125}, {946,758,0.0625}, {946,868,0.0625},
+        {946,880,-0.03125}, {946,969,-0.03125}, {946,979,0.03125}, {946,1016,0.03125},
+        {946,1019,0.03125}, {946,1091,-0.0625}, {946,1107,-0.03125}, {947,704,-0.0625},
+        {947,899,-0.0625}, {947,974,0.0625}, {947,989,0.0625}, {947,991,0.0625},
+        {947,1083,-0.03125}, {947,1097,-0.0625}, {947,1111,0.03125}, {948,686,-0.0625},
+        {948,730,-0.0625}, {948,816,-0.0625}, {948,872,0.0625}, {948,889,0.0625},
+        {948,967,0.0625}, {948,980,0.0625}, {948,1124,-0.0625}, {949,734,0.125},
+        {949,1009,-0.125}, {949,1129,0.125}, {949,1144,-0.125}, {950,724,-0.125},
+        {950,748,-0.125}, {950,930,0.125}, {950,1070,0.125}, {951,577,0.03125},
+        {951,653,0.03125}, {951,672,0.03125}, {951,688,0.0625}, {951,778,-0.03125},
+        {951,783,0.03125}, {951,790,-0.03125}, {951,895,-0.03125}, {951,982,0.03125},
+        {951,988,-0.03125}, {951,1000,-0.03125}, {951,1029,0.03125}, {951,1031,-0.0625},
+        {951,1089,-0.03125}, {952,605,-0.03125}, {952,618,0.0625}, {952,628,-0.03125},
+        {952,641,0.03125}, {952,659,0.0625}, {952,676,0.03125}, {952,700,-0.03125},
+        {952,862,0.03125}, {952,864,-0.0625}, {952,909,-0.0625}, {952,946,0.03125},
+        {952,961,-0.03125}, {953,605,-0.03125}, {953,628,0.03125}, {953,641,0.03125},
+        {953,676,0.03125}, {953,700,0.03125}, {953,721,-0.0625}, {953,744,-0.0625},
+        {953,794,0.0625}, {953,824,0.0625}, {953,862,-0.03125}, {953,946,-0.03125},
+        {953,961,-0.03125}, {954,577,0.03125}, {954,653,-0.03125}, {954,672,0.03125},
+        {954,778,-0.03125}, {954,783,-0.03125}, {954,790,0.03125}, {954,895,0.03125},
+        {954,918,-0.0625}, {954,982,-0.03125}, {954,988,-0.03125}, {954,992,0.0625},
+        {954,1000,-0.03125}, {954,1029,0.03125}, {954,1089,0.03125}, {955,616,0.03125},
+        {955,657,0.0625}, {955,678,0.03125}, {955,680,-0.03125}, {955,683,0.0625},
+        {955,707,-0.0625}, {955,718,0.03125}, {955,740,0.03125}, {955,812,-0.0625},
+        {955,835,-0.03125}, {955,846,-0.03125}, {955,1086,-0.03125}, {956,562,0.125},
+        {956,570,0.125}, {956,834,-0.125}, {956,851,-0.125}, {957,587,0.0625},
+        {957,633,-0.0625}, {957,634,-0.0625}, {957,650,-0.0625}, {957,785,0.0625},
+        {957,858,-0.0625}, {957,891,0.0625}, {957,960,0.0625}, {958,583,-0.0625},
+        {958,612,0.03125}, {958,632,-0.03125}, {958,652,0.03125}, {958,766,0.015625},
+        {958,787,0.03125}, {958,839,0.0625}, {958,914,-0.015625}, {958,962,-0.015625},
+        {958,995,-0.03125}, {958,1011,-0.03125}, {958,1134,0.015625}, {959,673,-0.0625},
+        {959,755,0.0625}, {959,762,0.03125}, {959,773,0.03125}, {959,774,0.0625},
+        {959,827,0.03125}, {959,844,-0.03125}, {959,859,-0.03125}, {959,935,-0.03125},
+        {959,1051,-0.0625}, {959,1099,0.03125}, {959,1138,-0.03125}, {960,595,-0.0625},
+        {960,713,0.0625}, {960,877,-0.0625}, {960,1074,0.0625}, {960,1085,0.0625},
+        {960,1105,-0.0625}, {960,1116,-0.0625}, {960,1133,0.0625}, {961,697,-0.0625},
+        {961,741,0.0625}, {961,912,0.0625}, {961,972,-0.0625}, {961,1017,0.0625},
+        {961,1049,-0.0625}, {961,1110,0.0625}, {961,1146,-0.0625}, {962,608,-0.0625},
+        {962,644,-0.015625}, {962,692,-0.0625}, {962,722,-0.03125}, {962,728,0.03125},
+        {962,760,0.0625}, {962,842,0.03125}, {962,883,0.0625}, {962,938,0.015625},
+        {962,971,-0.015625}, {962,1040,-0.03125}, {962,1100,0.015625}, {963,604,-0.0625},
+        {963,619,0.03125}, {963,623,0.03125}, {963,647,-0.0625}, {963,756,0.0625},
+        {963,841,0.0625}, {963,929,-0.03125}, {963,931,-0.03125}, {963,966,0.03125},
+        {963,996,0.03125}, {963,1043,-0.03125}, {963,1103,-0.03125}, {964,762,-0.03125},
+        {964,773,0.03125}, {964,779,-0.0625}, {964,789,0.0625}, {964,797,0.0625},
+        {964,827,0.03125}, {964,844,-0.03125}, {964,859,-0.03125}, {964,903,-0.0625},
+        {964,935,0.03125}, {964,1099,-0.03125}, {964,1138,0.03125}, {965,581,0.03125},
+        {965,593,-0.03125}, {965,598,-0.03125}, {965,648,0.03125}, {965,695,-0.03125},
+        {965,708,0.03125}, {965,714,-0.03125}, {965,736,-0.03125}, {965,772,0.03125},
+        {965,810,0.03125}, {965,887,0.03125}, {965,904,0.03125}, {965,915,-0.03125},
+        {965,950,0.03125}, {965,970,-0.03125}, {965,1005,-0.03125}, {966,610,-0.0625},
+        {966,639,0.0625}, {966,649,-0.0625}, {966,656,-0.0625}, {966,696,0.0625},
+        {966,805,0.0625}, {966,843,0.0625}, {966,1001,-0.0625}, {967,622,0.03125},
+        {967,627,-0.03125}, {967,803,-0.03125}, {967,826,0.03125}, {967,850,-0.03125},
+        {967,852,0.03125}, {967,870,-0.03125}, {967,886,0.03125}, {967,958,0.03125},
+        {967,968,0.03125}, {967,1007,0.03125}, {967,1010,0.03125}, {967,1025,-0.03125},
+        {967,1032,-0.03125}, {967,1048,-0.03125}, {967,1117,-0.03125}, {968,565,0.0625},
+        {968,572,0.0625}, {968,651,0.03125}, {968,664,-0.0625}, {968,822,-0.0625},
+        {968,1047,0.03125}, {968,1050,-0.03125}, {968,1068,-0.03125}, {969,565,-0.0625},
+        {969,572,-0.0625}, {969,651,0.03125}, {969,664,0.0625}, {969,822,0.0625},
+        {969,1047,0.03125}, {969,1050,-0.03125}, {969,1068,-0.03125}, {970,622,0.03125},
+        {970,627,-0.03125}, {970,803,-0.03125}, {970,826,0.03125}, {970,850,0.03125},
+        {970,852,0.03125}, {970,870,0.03125}, {970,886,-0.03125}, {970,958,-0.03125},
+        {970,968,-0.03125}, {970,1007,0.03125}, {970,1010,-0.03125}, {970,1025,0.03125},
+        {970,1032,-0.03125}, {970,1048,0.03125}, {970,1117,-0.03125}, {971,610,0.0625},
+        {971,639,-0.0625}, {971,649,-0.0625}, {971,656,-0.0625}, {971,696,0.0625},
+        {971,805,-0.0625}, {971,843,0.0625}, {971,1001,0.0625}, {972,606,-0.125},
+        {972,691,0.125}, {972,725,0.125}, {972,890,-0.125}, {973,594,0.125},
+        {973,614,-0.125}, {973,710,-0.125}, {973,775,0.125}, {974,581,0.03125},
+        {974,593,-0.03125}, {974,598,0.03125}, {974,648,-0.03125}, {974,695,-0.03125},
+        {974,708,-0.03125}, {974,714,-0.03125}, {974,736,0.03125}, {974,772,-0.03125},
+        {974,810,0.03125}, {974,887,0.03125}, {974,904,-0.03125}, {974,915,-0.03125},
+        {974,950,0.03125}, {974,970,0.03125}, {974,1005,0.03125}, {975,622,0.0625},
+        {975,627,0.0625}, {975,803,0.0625}, {975,826,0.0625}, {975,852,-0.0625},
+        {975,1007,-0.0625}, {975,1032,-0.0625}, {975,1117,-0.0625}, {976,850,0.0625},
+        {976,870,0.0625}, {976,886,0.0625}, {976,958,0.0625}, {976,968,-0.0625},
+        {976,1010,-0.0625}, {976,1025,-0.0625}, {976,1048,-0.0625}, {977,697,-0.0625},
+        {977,741,0.0625}, {977,912,0.0625}, {977,972,0.0625}, {977,1017,-0.0625},
+        {977,1049,0.0625}, {977,1110,-0.0625}, {977,1146,-0.0625}, {978,595,-0.0625},
+        {978,713,0.0625}, {978,877,0.0625}, {978,1074,-0.0625}, {978,1085,0.0625},
+        {978,1105,0.0625}, {978,1116,-0.0625}, {978,1133,-0.0625}, {979,601,-0.125},
+        {979,667,0.125}, {979,898,-0.125}, {979,1037,0.125}, {980,770,-0.125},
+        {980,832,-0.125}, {980,866,0.125}, {980,941,0.125}, {981,673,0.0625},
+        {981,755,-0.0625}, {981,762,0.03125}, {981,773,0.03125}, {981,774,-0.0625},
+        {981,827,0.03125}, {981,844,-0.03125}, {981,859,-0.03125}, {981,935,-0.03125},
+        {981,1051,0.0625}, {981,1099,0.03125}, {981,1138,-0.03125}, {982,581,-0.0625},
+        {982,593,0.0625}, {982,695,-0.0625}, {982,714,0.0625}, {982,810,0.0625},
+        {982,887,0.0625}, {982,915,-0.0625}, {982,950,-0.0625}, {983,598,0.0625},
+        {983,648,-0.0625}, {983,708,0.0625}, {983,736,-0.0625}, {983,772,0.0625},
+        {983,904,-0.0625}, {983,970,0.0625}, {983,1005,-0.0625}, {984,762,-0.03125},
+        {984,773,0.03125}, {984,779,0.0625}, {984,789,-0.0625}, {984,797,-0.0625},
+        {984,827,0.03125}, {984,844,-0.03125}, {984,859,-0.03125}, {984,903,0.0625},
+        {984,935,0.03125}, {984,1099,-0.03125}, {984,1138,0.03125}, {985,604,-0.0625},
+        {985,619,-0.03125}, {985,623,-0.03125}, {985,647,-0.0625}, {985,756,0.0625},
+        {985,841,0.0625}, {985,929,0.03125}, {985,931,0.03125}, {985,966,-0.03125},
+        {985,996,-0.03125}, {985,1043,0.03125}, {985,1103,0.03125}, {986,625,0.125},
+        {986,690,-0.125}, {986,801,0.125}, {986,993,-0.125}, {987,564,-0.0625},
+        {987,589,-0.0625}, {987,599,0.0625}, {987,817,-0.0625}, {987,821,-0.0625},
+        {987,837,0.0625}, {987,1069,0.0625}, {987,1096,0.0625}, {988,608,0.0625},
+        {988,644,-0.015625}, {988,692,0.0625}, {988,722,-0.03125}, {988,728,0.03125},
+        {988,760,-0.0625}, {988,842,0.03125}, {988,883,-0.0625}, {988,938,0.015625},
+        {988,971,-0.015625}, {988,1040,-0.03125}, {988,1100,0.015625}, {989,671,0.03125},
+        {989,687,-0.03125}, {989,711,0.0625}, {989,807,-0.0625}, {989,880,-0.03125},
+        {989,969,0.03125}, {989,979,-0.03125}, {989,1008,0.0625}, {989,1016,-0.03125},
+        {989,1019,0.03125}, {989,1075,-0.0625}, {989,1107,0.03125}, {990,622,0.0625},
+        {990,627,-0.0625}, {990,803,0.0625}, {990,826,-0.0625}, {990,852,0.0625},
+        {990,1007,-0.0625}, {990,1032,0.0625}, {990,1117,-0.0625}, {991,671,0.03125},
+        {991,677,0.0625}, {991,687,-0.03125}, {991,758,-0.0625}, {991,868,-0.0625},
+        {991,880,-0.03125}, {991,969,-0.03125}, {991,979,0.03125}, {991,1016,0.03125},
+        {991,1019,0.03125}, {991,1091,0.0625}, {991,1107,-0.03125}, {992,850,0.0625},
+        {992,870,-0.0625}, {992,886,0.0625}, {992,958,-0.0625}, {992,968,0.0625},
+        {992,1010,-0.0625}, {992,1025,0.0625}, {992,1048,-0.0625}, {993,704,0.0625},
+        {993,899,0.0625}, {993,974,-0.0625}, {993,989,-0.0625}, {993,991,0.0625},
+        {993,1083,-0.03125}, {993,1097,-0.0625}, {993,1111,0.03125}, {994,697,0.0625},
+        {994,741,-0.0625}, {994,912,0.0625}, {994,972,-0.0625}, {994,1017,-0.0625},
+        {994,1049,0.0625}, {994,1110,0.0625}, {994,1146,-0.0625}, {995,686,0.0625},
+        {995,730,0.0625}, {995,816,-0.0625}, {995,872,0.0625}, {995,889,0.0625},
+        {995,967,-0.0625}, {995,980,-0.0625}, {995,1124,-0.0625}, {996,595,-0.0625},
+        {996,713,-0.0625}, {996,877,-0.0625}, {996,1074,0.0625}, {996,1085,0.0625},
+        {996,1105,0.0625}, {996,1116,0.0625}, {996,1133,-0.0625}, {997,734,0.125},
+        {997,1009,0.125}, {997,1129,-0.125}, {997,1144,-0.125}, {998,601,-0.125},
+        {998,667,-0.125}, {998,898,0.125}, {998,1037,0.125}, {999,724,0.125},
+        {999,748,-0.125}, {999,930,0.125}, {999,1070,-0.125}, {1000,770,-0.125},
+        {1000,832,0.125}, {1000,866,0.125}, {1000,941,-0.125}, {1001,577,0.03125},
+        {1001,653,0.03125}, {1001,672,-0.03125}, {1001,688,-0.0625}, {1001,778,-0.03125},
+        {1001,783,-0.03125}, {1001,790,-0.03125}, {1001,895,-0.03125}, {1001,982,0.03125},
+        {1001,988,-0.03125}, {1001,1000,0.03125}, {1001,1029,0.03125}, {1001,1031,0.0625},
+        {1001,1089,0.03125}, {1002,673,0.0625}, {1002,755,0.0625}, {1002,762,-0.03125},
+        {1002,773,0.03125}, {1002,774,-0.0625}, {1002,827,-0.03125}, {1002,844,-0.03125},
+        {1002,859,0.03125}, {1002,935,0.03125}, {1002,1051,-0.0625}, {1002,1099,0.03125},
+        {1002,1138,-0.03125}, {1003,605,0.03125}, {1003,618,0.0625}, {1003,628,0.03125},
+        {1003,641,-0.03125}, {1003,659,0.0625}, {1003,676,-0.03125}, {1003,700,0.03125},
+        {1003,862,-0.03125}, {1003,864,-0.0625}, {1003,909,-0.0625}, {1003,946,-0.03125},
+        {1003,961,0.03125}, {1004,581,0.0625}, {1004,593,-0.0625}, {1004,695,0.0625},
+        {1004,714,0.0625}, {1004,810,0.0625}, {1004,887,-0.0625}, {1004,915,-0.0625},
+        {1004,950,-0.0625}, {1005,605,-0.03125}, {1005,628,0.03125}, {1005,641,0.03125},
+        {1005,676,0.03125}, {1005,700,0.03125}, {1005,721,0.0625}, {1005,744,0.0625},
+        {1005,794,-0.0625}, {1005,824,-0.0625}, {1005,862,-0.03125}, {1005,946,-0.03125},
+        {1005,961,-0.03125}, {1006,598,-0.0625}, {1006,648,-0.0625}, {1006,708,0.0625},
+        {1006,736,-0.0625}, {1006,772,-0.0625}, {1006,904,0.0625}, {1006,970,0.0625},
+        {1006,1005,0.0625}, {1007,577,0.03125}, {1007,653,-0.03125}, {1007,672,-0.03125},
+        {1007,778,-0.03125}, {1007,783,0.03125}, {1007,790,0.03125}, {1007,895,0.03125},
+        {1007,918,0.0625}, {1007,982,-0.03125}, {1007,988,-0.03125}, {1007,992,-0.0625},
+        {1007,1000,0.03125}, {1007,1029,0.03125}, {1007,1089,-0.03125}, {1008,762,0.03125},
+        {1008,773,0.03125}, {1008,779,-0.0625}, {1008,789,-0.0625}, {1008,797,0.0625},
+        {1008,827,-0.03125}, {1008,844,-0.03125}, {1008,859,0.03125}, {1008,903,0.0625},
+        {1008,935,-0.03125}, {1008,1099,-0.03125}, {1008,1138,0.03125}, {1009,616,0.03125},
+        {1009,657,0.0625}, {1009,678,-0.03125}, {1009,680,-0.03125}, {1009,683,-0.0625},
+        {1009,707,0.0625}, {1009,718,-0.03125}, {1009,740,0.03125}, {1009,812,-0.0625},
+        {1009,835,-0.03125}, {1009,846,0.03125}, {1009,1086,0.03125}, {1010,604,0.0625},
+        {1010,619,-0.03125}, {1010,623,0.03125}, {1010,647,-0.0625}, {1010,756,-0.0625},
+        {1010,841,0.0625}, {1010,929,0.03125}, {1010,931,-0.03125}, {1010,966,-0.03125},
+        {1010,996,0.03125}, {1010,1043,-0.03125}, {1010,1103,0.03125}, {1011,562,0.125},
+        {1011,570,-0.125}, {1011,834,-0.125}, {1011,851,0.125}, {1012,625,0.125},
+        {1012,690,0.125}, {1012,801,-0.125}, {1012,993,-0.125}, {1013,587,0.0625},
+        {1013,633,-0.0625}, {1013,634,-0.0625}, {1013,650,0.0625}, {1013,785,0.0625},
+        {1013,858,0.0625}, {1013,891,-0.0625}, {1013,960,-0.0625}, {1014,564,-0.0625},
+        {1014,589,0.0625}, {1014,599,-0.0625}, {1014,817,-0.0625}, {1014,821,0.0625},
+        {1014,837,0.0625}, {1014,1069,0.0625}, {1014,1096,-0.0625}, {1015,583,0.0625},
+        {1015,612,0.03125}, {1015,632,0.03125}, {1015,652,-0.03125}, {1015,766,-0.015625},
+        {1015,787,0.03125}, {1015,839,-0.0625}, {1015,914,0.015625}, {1015,962,-0.015625},
+        {1015,995,-0.03125}, {1015,1011,-0.03125}, {1015,1134,0.015625}, {1016,608,0.0625},
+        {1016,644,0.015625}, {1016,692,-0.0625}, {1016,722,0.03125}, {1016,728,-0.03125},
+        {1016,760,-0.0625}, {1016,842,0.03125}, {1016,883,0.0625}, {1016,938,0.015625},
+        {1016,971,-0.015625}, {1016,1040,-0.03125}, {1016,1100,-0.015625}, {1017,584,0.03125},
+        {1017,642,0.03125}, {1017,719,0.0625}, {1017,853,-0.0625}, {1017,951,-0.03125},
+        {1017,1055,-0.03125}, {1017,1090,0.03125}, {1017,1112,-0.03125}, {1018,565,-0.0625},
+        {1018,572,0.0625}, {1018,651,0.03125}, {1018,664,0.0625}, {1018,822,-0.0625},
+        {1018,1047,-0.03125}, {1018,1050,-0.03125}, {1018,1068,0.03125}, {1019,584,-0.03125},
+        {1019,642,0.03125}, {1019,719,0.0625}, {1019,853,-0.0625}, {1019,951,0.03125},
+        {1019,1055,-0.03125}, {1019,1090,-0.03125}, {1019,1112,0.03125}, {1020,565,-0.0625},
+        {1020,572,0.0625}, {1020,651,-0.03125}, {1020,664,0.0625}, {1020,822,-0.0625},
+        {1020,1047,0.03125}, {1020,1050,0.03125}, {1020,1068,-0.03125}, {1021,671,0.03125},
+        {1021,677,0.03125}, {1021,687,0.03125}, {1021,711,0.03125}, {1021,758,-0.03125},
+        {1021,807,0.03125}, {1021,868,0.03125}, {1021,880,-0.03125}, {1021,1008,-0.03125},
+        {1021,1019,-0.03125}, {1021,1075,-0.03125}, {1021,1091,-0.03125}, {1022,622,0.03125},
+        {1022,627,0.03125}, {1022,803,-0.03125}, {1022,826,-0.03125}, {1022,850,-0.03125},
+        {1022,852,-0.03125}, {1022,870,0.03125}, {1022,886,0.03125}, {1022,958,-0.03125},
+        {1022,968,-0.03125}, {1022,1007,0.03125}, {1022,1010,0.03125}, {1022,1025,0.03125},
+        {1022,1032,0.03125}, {1022,1048,-0.03125}, {1022,1117,-0.03125}, {1023,563,-0.0625},
+        {1023,624,0.0625}, {1023,636,0.0625}, {1023,747,0.0625}, {1023,791,-0.0625},
+        {1023,831,-0.0625}, {1024,610,-0.0625}, {1024,639,0.0625}, {1024,649,-0.0625},
+        {1024,656,0.0625}, {1024,696,0.0625}, {1024,805,-0.0625}, {1024,843,-0.0625},
+        {1024,1001,0.0625}, {1025,727,-0.0625}, {1025,973,-0.125}, {1025,1079,0.0625},
+        {1025,1121,0.125}, {1026,606,0.125}, {1026,691,0.125}, {1026,725,-0.125},
+        {1026,890,-0.125}, {1027,715,0.125}, {1027,782,-0.125}, {1027,874,0.0625},
+        {1027,934,-0.0625}, {1028,594,-0.125}, {1028,614,-0.125}, {1028,710,0.125},
+        {1028,775,0.125}, {1029,618,-0.03125}, {1029,628,0.03125}, {1029,659,0.03125},
+        {1029,700,-0.03125}, {1029,721,0.03125}, {1029,744,-0.03125}, {1029,794,0.03125},
+        {1029,824,-0.03125}, {1029,862,-0.03125}, {1029,864,0.03125}, {1029,909,-0.03125},
+        {1029,946,0.03125}, {1030,581,-0.03125}, {1030,593,0.03125}, {1030,598,0.03125},
+        {1030,648,0.03125}, {1030,695,0.03125}, {1030,708,0.03125}, {1030,714,-0.03125},
+        {1030,736,-0.03125}, {1030,772,-0.03125}, {1030,810,0.03125}, {1030,887,-0.03125},
+        {1030,904,-0.03125}, {1030,915,-0.03125}, {1030,950,0.03125}, {1030,970,-0.03125},
+        {1030,1005,0.03125}, {1031,605,-0.03125}, {1031,618,-0.03125}, {1031,641,0.03125},
+        {1031,659,0.03125}, {1031,676,-0.03125}, {1031,721,-0.03125}, {1031,744,0.03125},
+        {1031,794,-0.03125}, {1031,824,0.03125}, {1031,864,0.03125}, {1031,909,-0.03125},
+        {1031,961,0.03125}, {1032,581,-0.03125}, {1032,593,0.03125}, {1032,598,-0.03125},
+        {1032,648,-0.03125}, {1032,695,0.03125}, {1032,708,-0.03125}, {1032,714,-0.03125},
+        {1032,736,0.03125}, {1032,772,0.03125}, {1032,810,0.03125}, {1032,887,-0.03125},
+        {1032,904,0.03125}, {1032,915,-0.03125}, {1032,950,0.03125}, {1032,970,0.03125},
+        {1032,1005,-0.03125}, {1033,563,-0.0625}, {1033,624,-0.0625}, {1033,636,0.0625},
+        {1033,702,-0.0625}, {1033,720,0.0625}, {1033,791,0.0625}, {1034,610,0.0625},
+        {1034,639,-0.0625}, {1034,649,-0.0625}, {1034,656,0.0625}, {1034,696,0.0625},
+        {1034,805,0.0625}, {1034,843,-0.0625}, {1034,1001,-0.0625}, {1035,677,-0.03125},
+        {1035,711,0.03125}, {1035,758,0.03125}, {1035,807,0.03125}, {1035,868,-0.03125},
+        {1035,969,-0.03125}, {1035,979,0.03125}, {1035,1008,-0.03125}, {1035,1016,-0.03125},
+        {1035,1075,-0.03125}, {1035,1091,0.03125}, {1035,1107,0.03125}, {1036,622,0.03125},
+        {1036,627,0.03125}, {1036,803,-0.03125}, {1036,826,-0.03125}, {1036,850,0.03125},
+        {1036,852,-0.03125}, {1036,870,-0.03125}, {1036,886,-0.03125}, {1036,958,0.03125},
+        {1036,968,0.03125}, {1036,1007,0.03125}, {1036,1010,-0.03125}, {1036,1025,-0.03125},
+        {1036,1032,0.03125}, {1036,1048,0.03125}, {1036,1117,-0.03125}, {1037,577,0.03125},
+        {1037,653,-0.03125}, {1037,672,-0.03125}, {1037,688,0.0625}, {1037,778,-0.03125},
+        {1037,783,-0.03125}, {1037,790,0.03125}, {1037,895,-0.03125}, {1037,982,0.03125},
+        {1037,988,0.03125}, {1037,1000,0.03125}, {1037,1029,-0.03125}, {1037,1031,-0.0625},
+        {1037,1089,0.03125}, {1038,673,-0.0625}, {1038,755,-0.0625}, {1038,762,-0.03125},
+        {1038,773,0.03125}, {1038,774,0.0625}, {1038,827,-0.03125}, {1038,844,-0.03125},
+        {1038,859,0.03125}, {1038,935,0.03125}, {1038,1051,0.0625}, {1038,1099,0.03125},
+        {1038,1138,-0.03125}, {1039,686,-0.0625}, {1039,730,0.0625}, {1039,816,-0.0625},
+        {1039,872,0.0625}, {1039,889,-0.0625}, {1039,967,-0.0625}, {1039,980,0.0625},
+        {1039,1124,0.0625}, {1040,595,-0.0625}, {1040,713,-0.0625}, {1040,877,0.0625},
+        {1040,1074,-0.0625}, {1040,1085,0.0625}, {1040,1105,-0.0625}, {1040,1116,0.0625},
+        {1040,1133,0.0625}, {1041,704,0.0625}, {1041,899,-0.0625}, {1041,974,-0.0625},
+        {1041,989,0.0625}, {1041,991,0.0625}, {1041,1083,0.03125}, {1041,1097,-0.0625},
+        {1041,1111,-0.03125}, {1042,697,0.0625}, {1042,741,-0.0625}, {1042,912,0.0625},
+        {1042,972,0.0625}, {1042,1017,0.0625}, {1042,1049,-0.0625}, {1042,1110,-0.0625},
+        {1042,1146,-0.0625}, {1043,583,-0.0625}, {1043,612,0.03125}, {1043,632,0.03125},
+        {1043,652,-0.03125}, {1043,766,-0.015625}, {1043,787,-0.03125}, {1043,839,0.0625},
+        {1043,914,0.015625}, {1043,962,-0.015625}, {1043,995,-0.03125}, {1043,1011,0.03125},
+        {1043,1134,0.015625}, {1044,608,-0.0625}, {1044,644,0.015625}, {1044,692,0.0625},
+        {1044,722,0.03125}, {1044,728,-0.03125}, {1044,760,0.0625}, {1044,842,0.03125},
+        {1044,883,-0.0625}, {1044,938,0.015625}, {1044,971,-0.015625}, {1044,1040,-0.03125},
+        {1044,1100,-0.015625}, {1045,616,-0.03125}, {1045,657,0.0625}, {1045,678,0.03125},
+        {1045,680,0.03125}, {1045,683,-0.0625}, {1045,707,0.0625}, {1045,718,0.03125},
+        {1045,740,-0.03125}, {1045,812,-0.0625}, {1045,835,0.03125}, {1045,846,-0.03125},
+        {1045,1086,-0.03125}, {1046,604,0.0625}, {1046,619,0.03125}, {1046,623,-0.03125},
+        {1046,647,-0.0625}, {1046,756,-0.0625}, {1046,841,0.0625}, {1046,929,-0.03125},
+        {1046,931,0.03125}, {1046,966,0.03125}, {1046,996,-0.03125}, {1046,1043,0.03125},
+        {1046,1103,-0.03125}, {1047,577,0.03125}, {1047,653,0.03125}, {1047,672,-0.03125},
+        {1047,778,-0.03125}, {1047,783,0.03125}, {1047,790,-0.03125}, {1047,895,0.03125},
+        {1047,918,-0.0625}, {1047,982,-0.03125}, {1047,988,0.03125}, {1047,992,0.0625},
+        {1047,1000,0.03125}, {1047,1029,-0.03125}, {1047,1089,-0.03125}, {1048,762,0.03125},
+        {1048,773,0.03125}, {1048,779,0.0625}, {1048,789,0.0625}, {1048,797,-0.0625},
+        {1048,827,-0.03125}, {1048,844,-0.03125}, {1048,859,0.03125}, {1048,903,-0.0625},
+        {1048,935,-0.03125}, {1048,1099,-0.03125}, {1048,1138,0.03125}, {1049,560,-0.0078125},
+        {1049,621,0.0078125}, {1049,632,0.0078125}, {1049,652,0.0078125}, {1049,670,0.00390625},
+        {1049,766,-0.00390625}, {1049,799,-0.0078125}, {1049,847,0.00390625}, {1049,854,-0.0078125},
+        {1049,863,0.0078125}, {1049,867,0.00390625}, {1049,885,0.015625}, {1049,914,-0.00390625},
+        {1049,1058,-0.00390625}, {1049,1087,-0.0078125}, {1049,1102,0.00390625}, {1049,1115,-0.0078125},
+        {1049,1136,-0.00390625}, {1050,560,-0.0078125}, {1050,612,-0.015625}, {1050,621,0.0078125},
+        {1050,632,0.0078125}, {1050,645,-0.015625}, {1050,652,0.0078125}, {1050,670,-0.00390625},
+        {1050,766,-0.00390625}, {1050,799,0.0078125}, {1050,847,-0.00390625}, {1050,854,-0.0078125},
+        {1050,863,0.0078125}, {1050,867,-0.00390625}, {1050,885,0.015625}, {1050,902,0.015625},
+        {1050,914,-0.00390625}, {1050,962,0.0078125}, {1050,995,-0.015625}, {1050,1058,0.00390625},
+        {1050,1087,0.0078125}, {1050,1102,-0.00390625}, {1050,1115,-0.0078125}, {1050,1134,0.0078125},
+        {1050,1136,0.00390625}, {1051,644,-0.0078125}, {1051,722,0.015625}, {1051,728,0.015625},
+        {1051,818,-0.015625}, {1051,842,-0.015625}, {1051,855,0.03125}, {1051,926,0.015625},
+        {1051,938,0.0078125}, {1051,949,0.015625}, {1051,971,0.0078125}, {1051,977,0.015625},
+        {1051,1002,-0.03125}, {1051,1012,0.015625}, {1051,1015,-0.015625}, {1051,1021,-0.015625},
+        {1051,1024,-0.015625}, {1051,1040,-0.015625}, {1051,1092,0.015625}, {1051,1100,-0.0078125},
+        {1051,1118,-0.015625}, {1052,637,0.015625}, {1052,751,-0.015625}, {1052,879,-0.03125},
+        {1052,888,0.03125}, {1052,892,0.015625}, {1052,963,-0.015625}, {1052,978,0.03125},
+        {1052,981,-0.015625}, {1052,1057,-0.015625}, {1052,1080,-0.015625}, {1052,1098,0.015625},
+        {1052,1120,0.015625}, {1053,560,-0.0078125}, {1053,612,0.015625}, {1053,621,0.0078125},
+        {1053,632,0.0078125}, {1053,645,0.015625}, {1053,652,0.0078125}, {1053,670,-0.00390625},
+        {1053,766,-0.00390625}, {1053,799,0.0078125}, {1053,847,-0.00390625}, {1053,854,-0.0078125},
+        {1053,863,0.0078125}, {1053,867,-0.00390625}, {1053,885,0.015625}, {1053,902,-0.015625},
+        {1053,914,-0.00390625}, {1053,962,-0.0078125}, {1053,995,0.015625}, {1053,1058,0.00390625},
+        {1053,1087,0.0078125}, {1053,1102,-0.00390625}, {1053,1115,-0.0078125}, {1053,1134,-0.0078125},
+        {1053,1136,0.00390625}, {1054,644,-0.0078125}, {1054,722,0.015625}, {1054,728,0.015625},
+        {1054,818,0.015625}, {1054,842,0.015625}, {1054,855,0.03125}, {1054,926,-0.015625},
+        {1054,938,-0.0078125}, {1054,949,0.015625}, {1054,971,-0.0078125}, {1054,977,0.015625},
+        {1054,1002,0.03125}, {1054,1012,-0.015625}, {1054,1015,-0.015625}, {1054,1021,0.015625},
+        {1054,1024,-0.015625}, {1054,1040,0.015625}, {1054,1092,-0.015625}, {1054,1100,-0.0078125},
+        {1054,1118,-0.015625}, {1055,637,-0.015625}, {1055,751,-0.015625}, {1055,879,0.03125},
+        {1055,888,0.03125}, {1055,892,0.015625}, {1055,963,-0.015625}, {1055,978,0.03125},
+        {1055,981,-0.015625}, {1055,1057,-0.015625}, {1055,1080,0.015625}, {1055,1098,0.015625},
+        {1055,1120,-0.015625}, {1056,612,-0.03125}, {1056,632,0.03125}, {1056,652,-0.03125},
+        {1056,766,0.015625}, {1056,914,-0.015625}, {1056,962,-0.015625}, {1056,995,0.03125},
+        {1056,1134,0.015625}, {1057,587,0.03125}, {1057,633,0.03125}, {1057,634,-0.03125},
+        {1057,650,-0.03125}, {1057,785,-0.03125}, {1057,858,0.03125}, {1057,891,-0.03125},
+        {1057,960,0.03125}, {1058,616,0.03125}, {1058,678,0.03125}, {1058,680,-0.03125},
+        {1058,718,-0.03125}, {1058,740,-0.03125}, {1058,835,0.03125}, {1058,846,0.03125},
+        {1058,1086,-0.03125}, {1059,644,-0.015625}, {1059,722,0.03125}, {1059,728,-0.03125},
+        {1059,842,-0.03125}, {1059,938,0.015625}, {1059,971,-0.015625}, {1059,1040,0.03125},
+        {1059,1100,0.015625}, {1060,564,0.03125}, {1060,589,0.03125}, {1060,599,-0.03125},
+        {1060,817,-0.03125}, {1060,821,-0.03125}, {1060,837,0.03125}, {1060,1069,-0.03125},
+        {1060,1096,0.03125}, {1061,619,0.03125}, {1061,623,-0.03125}, {1061,929,0.03125},
+        {1061,931,-0.03125}, {1061,966,-0.03125}, {1061,996,0.03125}, {1061,1043,0.03125},
+        {1061,1103,-0.03125}, {1062,612,-0.03125}, {1062,632,-0.03125}, {1062,652,0.03125},
+        {1062,766,-0.015625}, {1062,914,0.015625}, {1062,962,-0.015625}, {1062,995,0.03125},
+        {1062,1134,0.015625}, {1063,644,0.015625}, {1063,722,-0.03125}, {1063,728,0.03125},
+        {1063,842,-0.03125}, {1063,938,0.015625}, {1063,971,-0.015625}, {1063,1040,0.03125},
+        {1063,1100,-0.015625}, {1064,616,-0.03125}, {1064,678,0.03125}, {1064,680,0.03125},
+        {1064,718,-0.03125}, {1064,740,0.03125}, {1064,835,-0.03125}, {1064,846,0.03125},
+        {1064,1086,-0.03125}, {1065,619,-0.03125}, {1065,623,-0.03125}, {1065,929,-0.03125},
+        {1065,931,-0.03125}, {1065,966,0.03125}, {1065,996,0.03125}, {1065,1043,0.03125},
+        {1065,1103,0.03125}, {1066,587,0.03125}, {1066,633,0.03125}, {1066,634,-0.03125},
+        {1066,650,0.03125}, {1066,785,-0.03125}, {1066,858,-0.03125}, {1066,891,0.03125},
+        {1066,960,-0.03125}, {1067,564,0.03125}, {1067,589,-0.03125}, {1067,599,0.03125},
+        {1067,817,-0.03125}, {1067,821,0.03125}, {1067,837,0.03125}, {1067,1069,-0.03125},
+        {1067,1096,-0.03125}, {1068,560,-0.03125}, {1068,621,-0.03125}, {1068,632,-0.03125},
+        {1068,652,-0.03125}, {1068,670,0.015625}, {1068,766,0.015625}, {1068,799,0.03125},
+        {1068,847,-0.015625}, {1068,854,0.03125}, {1068,863,0.03125}, {1068,867,-0.015625},
+        {1068,885,0.0625}, {1068,914,0.015625}, {1068,1058,-0.015625}, {1068,1087,-0.03125},
+        {1068,1102,0.015625}, {1068,1115,-0.03125}, {1068,1136,0.015625}, {1069,644,0.015625},
+        {1069,722,-0.03125}, {1069,728,-0.03125}, {1069,818,-0.03125}, {1069,842,-0.03125},
+        {1069,855,0.0625}, {1069,926,0.03125}, {1069,938,0.015625}, {1069,949,-0.03125},
+        {1069,971,0.015625}, {1069,977,0.03125}, {1069,1002,0.0625}, {1069,1012,-0.03125},
+        {1069,1015,-0.03125}, {1069,1021,0.03125}, {1069,1024,0.03125}, {1069,1040,-0.03125},
+        {1069,1092,-0.03125}, {1069,1100,0.015625}, {1069,1118,-0.03125}, {1070,644,0.015625},
+        {1070,722,-0.03125}, {1070,728,-0.03125}, {1070,818,0.03125}, {1070,842,0.03125},
+        {1070,855,0.0625}, {1070,926,-0.03125}, {1070,938,-0.015625}, {1070,949,-0.03125},
+        {1070,971,-0.015625}, {1070,977,0.03125}, {1070,1002,-0.0625}, {1070,1012,0.03125},
+        {1070,1015,-0.03125}, {1070,1021,-0.03125}, {1070,1024,0.03125}, {1070,1040,0.03125},
+        {1070,1092,0.03125}, {1070,1100,0.015625}, {1070,1118,-0.03125}, {1071,751,-0.0625},
+        {1071,888,0.125}, {1071,892,0.0625}, {1071,963,-0.0625}, {1071,978,-0.125},
+        {1071,981,0.0625}, {1071,1057,0.0625}, {1071,1098,-0.0625}, {1072,560,-0.0078125},
+        {1072,621,0.0078125}, {1072,632,0.0078125}, {1072,652,0.0078125}, {1072,670,0.00390625},
+        {1072,766,-0.00390625}, {1072,799,-0.0078125}, {1072,847,0.00390625}, {1072,854,-0.0078125},
+        {1072,863,0.0078125}, {1072,867,0.00390625}, {1072,885,0.015625}, {1072,914,-0.00390625},
+        {1072,1058,-0.00390625}, {1072,1087,-0.0078125}, {1072,1102,0.00390625}, {1072,1115,-0.0078125},
+        {1072,1136,-0.00390625}, {1073,560,-0.0078125}, {1073,621,-0.0078125}, {1073,632,0.0078125},
+        {1073,652,0.0078125}, {1073,670,-0.00390625}, {1073,766,-0.00390625}, {1073,799,-0.0078125},
+        {1073,847,0.00390625}, {1073,854,0.0078125}, {1073,863,-0.0078125}, {1073,867,-0.00390625},
+        {1073,885,0.015625}, {1073,914,-0.00390625}, {1073,1058,0.00390625}, {1073,1087,-0.0078125},
+        {1073,1102,0.00390625}, {1073,1115,0.0078125}, {1073,1136,0.00390625}, {1074,678,0.015625},
+        {1074,699,-0.03125}, {1074,701,-0.015625}, {1074,718,-0.015625}, {1074,754,0.03125},
+        {1074,792,0.015625}, {1074,846,-0.015625}, {1074,1020,0.015625}, {1074,1086,0.015625},
+        {1074,1122,-0.015625}, {1075,579,0.03125}, {1075,607,0.015625}, {1075,638,-0.015625},
+        {1075,650,-0.015625}, {1075,757,-0.03125}, {1075,802,-0.015625}, {1075,848,0.015625},
+        {1075,858,0.015625}, {1075,891,0.015625}, {1075,960,-0.015625}, {1076,765,-0.015625},
+        {1076,901,0.03125}, {1076,943,0.0078125}, {1076,1003,0.03125}, {1076,1059,-0.015625},
+        {1076,1060,-0.015625}, {1076,1061,-0.015625}, {1076,1151,0.0078125}, {1077,613,0.03125},
+        {1077,694,-0.03125}, {1077,709,-0.03125}, {1077,860,0.015625}, {1077,897,0.03125},
+        {1077,1039,-0.015625}, {1077,1046,-0.015625}, {1077,1062,0.015625}, {1078,630,0.0078125},
+        {1078,668,-0.015625}, {1078,759,0.03125}, {1078,932,-0.015625}, {1079,569,0.03125},
+        {1079,681,-0.015625}, {1079,704,0.015625}, {1079,974,0.015625}, {1079,1034,-0.015625},
+        {1079,1083,-0.015625}, {1079,1111,-0.015625}, {1079,1123,-0.015625}, {1079,1128,-0.015625},
+        {1079,1132,0.0078125}, {1079,1142,0.0078125}, {1079,1143,0.03125}, {1080,653,0.03125},
+        {1080,661,-0.03125}, {1080,672,0.015625}, {1080,675,0.015625}, {1080,783,-0.015625},
+        {1080,790,0.03125}, {1080,813,-0.015625}, {1080,875,0.03125}, {1080,988,-0.03125},
+        {1080,1000,0.015625}, {1080,1029,-0.03125}, {1080,1036,0.015625}, {1080,1038,-0.015625},
+        {1080,1089,-0.015625}, {1081,671,-0.015625}, {1081,677,0.015625}, {1081,687,0.015625},
+        {1081,711,0.015625}, {1081,739,0.015625}, {1081,758,0.015625}, {1081,807,-0.015625},
+        {1081,868,-0.015625}, {1081,880,-0.015625}, {1081,969,-0.015625}, {1081,979,-0.015625},
+        {1081,1008,-0.015625}, {1081,1016,0.015625}, {1081,1019,0.015625}, {1081,1023,0.015625},
+        {1081,1044,-0.015625}, {1081,1075,0.015625}, {1081,1091,-0.015625}, {1081,1107,0.015625},
+        {1081,1150,-0.015625}, {1082,560,0.0078125}, {1082,621,-0.0078125}, {1082,632,0.0078125},
+        {1082,652,0.0078125}, {1082,670,0.00390625}, {1082,766,0.00390625}, {1082,787,-0.015625},
+        {1082,799,-0.0078125}, {1082,847,-0.00390625}, {1082,854,-0.0078125}, {1082,863,-0.0078125},
+        {1082,867,0.00390625}, {1082,871,0.03125}, {1082,885,0.015625}, {1082,914,0.00390625},
+        {1082,1011,-0.015625}, {1082,1058,0.00390625}, {1082,1087,-0.0078125}, {1082,1102,-0.00390625},
+        {1082,1115,-0.0078125}, {1082,1136,0.00390625}, {1083,576,-0.015625}, {1083,605,-0.015625},
+        {1083,618,-0.015625}, {1083,628,-0.015625}, {1083,641,-0.015625}, {1083,659,0.015625},
+        {1083,676,0.015625}, {1083,700,0.015625}, {1083,721,0.015625}, {1083,744,-0.015625},
+        {1083,794,-0.015625}, {1083,806,0.015625}, {1083,824,0.015625}, {1083,862,-0.015625},
+        {1083,864,-0.015625}, {1083,896,-0.015625}, {1083,909,0.015625}, {1083,946,0.015625},
+        {1083,961,0.015625}, {1083,994,0.015625}, {1084,573,0.0078125}, {1084,642,-0.0078125},
+        {1084,719,0.015625}, {1084,753,-0.015625}, {1084,767,-0.015625}, {1084,853,0.015625},
+        {1084,893,0.0078125}, {1084,916,0.015625}, {1084,936,-0.0078125}, {1084,1055,-0.0078125},
+        {1085,573,-0.0078125}, {1085,642,0.0078125}, {1085,719,0.015625}, {1085,753,-0.015625},
+        {1085,767,-0.015625}, {1085,853,0.015625}, {1085,893,0.0078125}, {1085,916,-0.015625},
+        {1085,936,0.0078125}, {1085,1055,0.0078125}, {1086,671,-0.015625}, {1086,677,-0.015625},
+        {1086,687,0.015625}, {1086,711,-0.015625}, {1086,739,-0.015625}, {1086,758,-0.015625},
+        {1086,807,0.015625}, {1086,868,0.015625}, {1086,880,-0.015625}, {1086,969,-0.015625},
+        {1086,979,-0.015625}, {1086,1008,0.015625}, {1086,1016,0.015625}, {1086,1019,0.015625},
+        {1086,1023,-0.015625}, {1086,1044,0.015625}, {1086,1075,-0.015625}, {1086,1091,0.015625},
+        {1086,1107,0.015625}, {1086,1150,0.015625}, {1087,576,0.015625}, {1087,605,-0.015625},
+        {1087,618,0.015625}, {1087,628,-0.015625}, {1087,641,-0.015625}, {1087,659,-0.015625},
+        {1087,676,0.015625}, {1087,700,0.015625}, {1087,721,-0.015625}, {1087,744,0.015625},
+        {1087,794,0.015625}, {1087,806,-0.015625}, {1087,824,-0.015625}, {1087,862,-0.015625},
+        {1087,864,0.015625}, {1087,896,0.015625}, {1087,909,-0.015625}, {1087,946,0.015625},
+        {1087,961,0.015625}, {1087,994,-0.015625}, {1088,569,-0.03125}, {1088,681,-0.015625},
+        {1088,704,0.015625}, {1088,974,0.015625}, {1088,1034,-0.015625}, {1088,1083,0.015625},
+        {1088,1111,0.015625}, {1088,1123,-0.015625}, {1088,1128,-0.015625}, {1088,1132,0.0078125},
+        {1088,1142,0.0078125}, {1088,1143,0.03125}, {1089,653,-0.03125}, {1089,661,-0.03125},
+        {1089,672,0.015625}, {1089,675,0.015625}, {1089,783,-0.015625}, {1089,790,-0.03125},
+        {1089,813,-0.015625}, {1089,875,0.03125}, {1089,988,0.03125}, {1089,1000,0.015625},
+        {1089,1029,0.03125}, {1089,1036,0.015625}, {1089,1038,-0.015625}, {1089,1089,-0.015625},
+        {1090,560,0.0078125}, {1090,621,-0.0078125}, {1090,632,0.0078125}, {1090,652,0.0078125},
+        {1090,670,0.00390625}, {1090,766,0.00390625}, {1090,787,0.015625}, {1090,799,-0.0078125},
+        {1090,847,-0.00390625}, {1090,854,-0.0078125}, {1090,863,-0.0078125}, {1090,867,0.00390625},
+        {1090,871,-0.03125}, {1090,885,0.015625}, {1090,914,0.00390625}, {1090,1011,0.015625},
+        {1090,1058,0.00390625}, {1090,1087,-0.0078125}, {1090,1102,-0.00390625}, {1090,1115,-0.0078125},
+        {1090,1136,0.00390625}, {1091,560,0.0078125}, {1091,583,-0.03125}, {1091,621,0.0078125},
+        {1091,632,0.0078125}, {1091,652,0.0078125}, {1091,670,-0.00390625}, {1091,766,0.00390625},
+        {1091,799,-0.0078125}, {1091,839,-0.03125}, {1091,847,-0.00390625}, {1091,854,0.0078125},
+        {1091,856,0.03125}, {1091,863,0.0078125}, {1091,867,-0.00390625}, {1091,885,0.015625},
+        {1091,914,0.00390625}, {1091,1058,-0.00390625}, {1091,1087,-0.0078125}, {1091,1102,-0.00390625},
+        {1091,1115,0.0078125}, {1091,1136,-0.00390625}, {1092,568,0.0625}, {1092,678,-0.015625},
+        {1092,683,0.03125}, {1092,699,-0.03125}, {1092,701,0.015625}, {1092,707,0.03125},
+        {1092,718,-0.015625}, {1092,754,-0.03125}, {1092,792,0.015625}, {1092,846,-0.015625},
+        {1092,913,-0.03125}, {1092,1018,-0.03125}, {1092,1020,0.015625}, {1092,1086,-0.015625},
+        {1092,1122,0.015625}, {1093,658,0.03125}, {1093,661,0.03125}, {1093,672,0.015625},
+        {1093,675,-0.015625}, {1093,688,-0.03125}, {1093,780,0.03125}, {1093,783,0.015625},
+        {1093,813,-0.015625}, {1093,875,0.03125}, {1093,918,-0.03125}, {1093,992,-0.03125},
+        {1093,1000,0.015625}, {1093,1031,-0.03125}, {1093,1036,-0.015625}, {1093,1038,-0.015625},
+        {1093,1089,0.015625}, {1094,585,0.03125}, {1094,679,-0.0625}, {1094,765,0.015625},
+        {1094,901,0.03125}, {1094,943,-0.0078125}, {1094,1003,0.03125}, {1094,1059,-0.015625},
+        {1094,1060,0.015625}, {1094,1061,-0.015625}, {1094,1151,-0.0078125}, {1095,686,-0.03125},
+        {1095,730,0.03125}, {1095,830,0.0625}, {1095,857,0.03125}, {1095,865,-0.0625},
+        {1095,948,-0.03125}, {1095,967,0.03125}, {1095,980,-0.03125}, {1095,1106,0.03125},
+        {1095,1114,-0.03125}, {1096,681,-0.015625}, {1096,704,0.015625}, {1096,899,-0.03125},
+        {1096,964,0.03125}, {1096,974,0.015625}, {1096,989,-0.03125}, {1096,1034,-0.015625},
+        {1096,1123,0.015625}, {1096,1128,0.015625}, {1096,1132,-0.0078125}, {1096,1142,-0.0078125},
+        {1096,1143,0.03125}, {1097,560,-0.0078125}, {1097,621,-0.0078125}, {1097,632,0.0078125},
+        {1097,652,0.0078125}, {1097,670,-0.00390625}, {1097,766,-0.00390625}, {1097,799,-0.0078125},
+        {1097,847,0.00390625}, {1097,854,0.0078125}, {1097,863,-0.0078125}, {1097,867,-0.00390625},
+        {1097,885,0.015625}, {1097,914,-0.00390625}, {1097,1058,0.00390625}, {1097,1087,-0.0078125},
+        {1097,1102,0.00390625}, {1097,1115,0.0078125}, {1097,1136,0.00390625}, {1098,579,0.03125},
+        {1098,607,0.015625}, {1098,638,-0.015625}, {1098,650,-0.015625}, {1098,757,-0.03125},
+        {1098,802,-0.015625}, {1098,848,0.015625}, {1098,858,0.015625}, {1098,891,0.015625},
+        {1098,960,-0.015625}, {1099,678,-0.015625}, {1099,699,0.03125}, {1099,701,0.015625},
+        {1099,718,0.015625}, {1099,754,-0.03125}, {1099,792,-0.015625}, {1099,846,0.015625},
+        {1099,1020,-0.015625}, {1099,1086,-0.015625}, {1099,1122,0.015625}, {1100,630,0.0078125},
+        {1100,668,-0.015625}, {1100,759,0.03125}, {1100,932,-0.015625}, {1101,613,-0.03125},
+        {1101,694,0.03125}, {1101,709,0.03125}, {1101,860,-0.015625}, {1101,897,-0.03125},
+        {1101,1039,0.015625}, {1101,1046,0.015625}, {1101,1062,-0.015625}, {1102,719,0.03125},
+        {1102,753,-0.03125}, {1102,767,0.03125}, {1102,777,-0.03125}, {1102,853,0.03125},
+        {1102,893,-0.015625}, {1102,1045,0.015625}, {1102,1081,0.015625}, {1102,1090,-0.015625},
+        {1102,1112,-0.015625}, {1103,573,-0.03125}, {1103,642,-0.03125}, {1103,916,0.0625},
+        {1103,936,0.03125}, {1103,1055,-0.03125}, {1104,671,-0.03125}, {1104,687,-0.03125},
+        {1104,880,-0.03125}, {1104,969,0.03125}, {1104,979,0.03125}, {1104,1016,0.03125},
+        {1104,1019,-0.03125}, {1104,1107,0.03125}, {1105,702,0.0625}, {1105,720,0.0625},
+        {1105,747,-0.0625}, {1105,831,-0.0625}, {1106,727,-0.0625}, {1106,1030,0.125},
+        {1106,1079,-0.0625}, {1107,596,0.125}, {1107,874,-0.0625}, {1107,934,-0.0625},
+        {1108,605,0.03125}, {1108,628,-0.03125}, {1108,641,0.03125}, {1108,676,0.03125},
+        {1108,700,-0.03125}, {1108,862,-0.03125}, {1108,946,-0.03125}, {1108,961,0.03125},
+        {1109,765,-0.015625}, {1109,901,0.03125}, {1109,943,0.0078125}, {1109,1003,0.03125},
+        {1109,1059,-0.015625}, {1109,1060,-0.015625}, {1109,1061,-0.015625}, {1109,1151,0.0078125},
+        {1110,630,-0.015625}, {1110,668,-0.03125}, {1110,759,0.0625}, {1110,922,0.015625},
+        {1110,932,0.03125}, {1110,933,0.015625}, {1110,983,-0.03125}, {1110,1053,-0.03125},
+        {1111,719,0.03125}, {1111,753,-0.03125}, {1111,767,0.03125}, {1111,777,0.03125},
+        {1111,853,0.03125}, {1111,893,-0.015625}, {1111,1045,-0.015625}, {1111,1081,-0.015625},
+        {1111,1090,0.015625}, {1111,1112,0.015625}, {1112,677,0.03125}, {1112,711,0.03125},
+        {1112,739,-0.03125}, {1112,758,0.03125}, {1112,807,0.03125}, {1112,868,0.03125},
+        {1112,1008,0.03125}, {1112,1023,-0.03125}, {1112,1044,-0.03125}, {1112,1075,0.03125},
+        {1112,1091,0.03125}, {1112,1150,-0.03125}, {1113,563,0.0625}, {1113,624,0.0625},
+        {1113,636,0.0625}, {1113,791,0.0625}, {1113,815,-0.0625}, {1113,919,-0.0625},
+        {1114,954,-0.125}, {1114,973,0.125}, {1114,1121,0.125}, {1115,715,0.125},
+        {1115,782,0.125}, {1115,836,-0.125}, {1116,576,-0.03125}, {1116,618,0.03125},
+        {1116,659,0.03125}, {1116,721,0.03125}, {1116,744,0.03125}, {1116,794,0.03125},
+        {1116,806,-0.03125}, {1116,824,0.03125}, {1116,864,0.03125}, {1116,896,-0.03125},
+        {1116,909,0.03125}, {1116,994,-0.03125}, {1117,681,-0.015625}, {1117,704,0.015625},
+        {1117,899,0.03125}, {1117,964,-0.03125}, {1117,974,0.015625}, {1117,989,0.03125},
+        {1117,1034,-0.015625}, {1117,1123,0.015625}, {1117,1128,0.015625}, {1117,1132,-0.0078125},
+        {1117,1142,-0.0078125}, {1117,1143,0.03125}, {1118,686,0.03125}, {1118,730,0.03125},
+        {1118,830,0.0625}, {1118,857,-0.03125}, {1118,865,0.0625}, {1118,948,-0.03125},
+        {1118,967,0.03125}, {1118,980,0.03125}, {1118,1106,-0.03125}, {1118,1114,-0.03125},
+        {1119,819,0.125}, {1119,907,-0.0625}, {1119,1009,0.0625}, {1119,1042,-0.0625},
+        {1119,1129,0.0625}, {1120,724,0.0625}, {1120,737,-0.0625}, {1120,795,-0.0625},
+        {1120,1035,0.125}, {1120,1070,0.0625}, {1121,658,-0.03125}, {1121,661,0.03125},
+        {1121,672,0.015625}, {1121,675,-0.015625}, {1121,688,0.03125}, {1121,780,-0.03125},
+        {1121,783,0.015625}, {1121,813,-0.015625}, {1121,875,0.03125}, {1121,918,0.03125},
+        {1121,992,0.03125}, {1121,1000,0.015625}, {1121,1031,0.03125}, {1121,1036,-0.015625},
+        {1121,1038,-0.015625}, {1121,1089,0.015625}, {1122,585,-0.03125}, {1122,679,0.0625},
+        {1122,765,0.015625}, {1122,901,0.03125}, {1122,943,-0.0078125}, {1122,1003,0.03125},
+        {1122,1059,-0.015625}, {1122,1060,0.015625}, {1122,1061,-0.015625}, {1122,1151,-0.0078125},
+        {1123,808,0.125}, {1123,1014,-0.0625}, {1123,1076,-0.0625}, {1123,1104,0.125},
+        {1124,613,0.0625}, {1124,694,0.0625}, {1124,709,0.0625}, {1124,860,-0.03125},
+        {1124,897,0.0625}, {1124,1039,-0.03125}, {1124,1046,-0.03125}, {1124,1062,-0.03125},
+        {1125,568,0.0625}, {1125,678,0.015625}, {1125,683,0.03125}, {1125,699,0.03125},
+        {1125,701,-0.015625}, {1125,707,0.03125}, {1125,718,0.015625}, {1125,754,0.03125},
+        {1125,792,-0.015625}, {1125,846,0.015625}, {1125,913,-0.03125}, {1125,1018,-0.03125},
+        {1125,1020,-0.015625}, {1125,1086,0.015625}, {1125,1122,-0.015625}, {1126,804,0.25},
+        {1126,1152,-0.125}, {1127,939,0.25}, {1127,1141,-0.125}, {1128,570,0.0625},
+        {1128,703,-0.0625}, {1128,820,0.125}, {1128,851,0.0625}, {1128,940,-0.0625},
+        {1129,630,-0.015625}, {1129,668,-0.03125}, {1129,759,0.0625}, {1129,922,-0.015625},
+        {1129,932,0.03125}, {1129,933,-0.015625}, {1129,983,0.03125}, {1129,1053,0.03125},
+        {1130,579,0.0625}, {1130,607,-0.03125}, {1130,638,-0.03125}, {1130,650,0.03125},
+        {1130,757,0.0625}, {1130,802,-0.03125}, {1130,848,-0.03125}, {1130,858,0.03125},
+        {1130,891,0.03125}, {1130,960,0.03125}, {1131,560,0.0078125}, {1131,583,0.03125},
+        {1131,621,0.0078125}, {1131,632,0.0078125}, {1131,652,0.0078125}, {1131,670,-0.00390625},
+        {1131,766,0.00390625}, {1131,799,-0.0078125}, {1131,839,0.03125}, {1131,847,-0.00390625},
+        {1131,854,0.0078125}, {1131,856,-0.03125}, {1131,863,0.0078125}, {1131,867,-0.00390625},
+        {1131,885,0.015625}, {1131,914,0.00390625}, {1131,1058,-0.00390625}, {1131,1087,-0.0078125},
+        {1131,1102,-0.00390625}, {1131,1115,0.0078125}, {1131,1136,-0.00390625}, {1132,612,-0.03125},
+        {1132,632,0.03125}, {1132,652,-0.03125}, {1132,766,0.015625}, {1132,914,-0.015625},
+        {1132,962,-0.015625}, {1132,995,0.03125}, {1132,1134,0.015625}, {1133,616,-0.03125},
+        {1133,678,-0.03125}, {1133,680,0.03125}, {1133,718,0.03125}, {1133,740,0.03125},
+        {1133,835,-0.03125}, {1133,846,-0.03125}, {1133,1086,0.03125}, {1134,587,0.03125},
+        {1134,633,0.03125}, {1134,634,-0.03125}, {1134,650,-0.03125}, {1134,785,-0.03125},
+        {1134,858,0.03125}, {1134,891,-0.03125}, {1134,960,0.03125}, {1135,644,-0.015625},
+        {1135,722,0.03125}, {1135,728,-0.03125}, {1135,842,-0.03125}, {1135,938,0.015625},
+        {1135,971,-0.015625}, {1135,1040,0.03125}, {1135,1100,0.015625}, {1136,619,-0.03125},
+        {1136,623,0.03125}, {1136,929,-0.03125}, {1136,931,0.03125}, {1136,966,0.03125},
+        {1136,996,-0.03125}, {1136,1043,-0.03125}, {1136,1103,0.03125}, {1137,564,0.03125},
+        {1137,589,0.03125}, {1137,599,-0.03125}, {1137,817,-0.03125}, {1137,821,-0.03125},
+        {1137,837,0.03125}, {1137,1069,-0.03125}, {1137,1096,0.03125}, {1138,612,-0.03125},
+        {1138,632,-0.03125}, {1138,652,0.03125}, {1138,766,-0.015625}, {1138,914,0.015625},
+        {1138,962,-0.015625}, {1138,995,0.03125}, {1138,1134,0.015625}, {1139,644,0.015625},
+        {1139,722,-0.03125}, {1139,728,0.03125}, {1139,842,-0.03125}, {1139,938,0.015625},
+        {1139,971,-0.015625}, {1139,1040,0.03125}, {1139,1100,-0.015625}, {1140,587,0.03125},
+        {1140,633,0.03125}, {1140,634,-0.03125}, {1140,650,0.03125}, {1140,785,-0.03125},
+        {1140,858,-0.03125}, {1140,891,0.03125}, {1140,960,-0.03125}, {1141,564,0.03125},
+        {1141,589,-0.03125}, {1141,599,0.03125}, {1141,817,-0.03125}, {1141,821,0.03125},
+        {1141,837,0.03125}, {1141,1069,-0.03125}, {1141,1096,-0.03125}, {1142,616,0.03125},
+        {1142,678,-0.03125}, {1142,680,-0.03125}, {1142,718,0.03125}, {1142,740,-0.03125},
+        {1142,835,0.03125}, {1142,846,-0.03125}, {1142,1086,0.03125}, {1143,619,0.03125},
+        {1143,623,0.03125}, {1143,929,0.03125}, {1143,931,0.03125}, {1143,966,-0.03125},
+        {1143,996,-0.03125}, {1143,1043,-0.03125}, {1143,1103,-0.03125}, {1144,671,-0.03125},
+        {1144,687,0.03125}, {1144,711,0.0625}, {1144,807,-0.0625}, {1144,880,0.03125},
+        {1144,969,-0.03125}, {1144,979,0.03125}, {1144,1008,0.0625}, {1144,1016,0.03125},
+        {1144,1019,-0.03125}, {1144,1075,-0.0625}, {1144,1107,-0.03125}, {1145,671,-0.03125},
+        {1145,677,0.0625}, {1145,687,0.03125}, {1145,758,-0.0625}, {1145,868,-0.0625},
+        {1145,880,0.03125}, {1145,969,0.03125}, {1145,979,-0.03125}, {1145,1016,-0.03125},
+        {1145,1019,-0.03125}, {1145,1091,0.0625}, {1145,1107,0.03125}, {1146,704,0.0625},
+        {1146,899,0.0625}, {1146,974,-0.0625}, {1146,989,-0.0625}, {1146,991,-0.0625},
+        {1146,1083,0.03125}, {1146,1097,0.0625}, {1146,1111,-0.03125}, {1147,686,0.0625},
+        {1147,730,0.0625}, {1147,816,0.0625}, {1147,872,-0.0625}, {1147,889,-0.0625},
+        {1147,967,-0.0625}, {1147,980,-0.0625}, {1147,1124,0.0625}, {1148,734,-0.125},
+        {1148,1009,0.125}, {1148,1129,-0.125}, {1148,1144,0.125}, {1149,724,0.125},
+        {1149,748,0.125}, {1149,930,-0.125}, {1149,1070,-0.125}, {1150,577,-0.03125},
+        {1150,653,-0.03125}, {1150,672,-0.03125}, {1150,688,-0.0625}, {1150,778,0.03125},
+        {1150,783,-0.03125}, {1150,790,0.03125}, {1150,895,0.03125}, {1150,982,-0.03125},
+        {1150,988,0.03125}, {1150,1000,0.03125}, {1150,1029,-0.03125}, {1150,1031,0.0625},
+        {1150,1089,0.03125}, {1151,605,-0.03125}, {1151,618,0.0625}, {1151,628,-0.03125},
+        {1151,641,0.03125}, {1151,659,0.0625}, {1151,676,0.03125}, {1151,700,-0.03125},
+        {1151,862,0.03125}, {1151,864,-0.0625}, {1151,909,-0.0625}, {1151,946,0.03125},
+        {1151,961,-0.03125}, {1152,605,0.03125}, {1152,628,-0.03125}, {1152,641,-0.03125},
+        {1152,676,-0.03125}, {1152,700,-0.03125}, {1152,721,0.0625}, {1152,744,0.0625},
+        {1152,794,-0.0625}, {1152,824,-0.0625}, {1152,862,0.03125}, {1152,946,0.03125},
+        {1152,961,0.03125}, {1153,577,-0.03125}, {1153,653,0.03125}, {1153,672,-0.03125},
+        {1153,778,0.03125}, {1153,783,0.03125}, {1153,790,-0.03125}, {1153,895,-0.03125},
+        {1153,918,0.0625}, {1153,982,0.03125}, {1153,988,0.03125}, {1153,992,-0.0625},
+        {1153,1000,0.03125}, {1153,1029,-0.03125}, {1153,1089,-0.03125}, {1154,616,-0.03125},
+        {1154,657,-0.0625}, {1154,678,-0.03125}, {1154,680,0.03125}, {1154,683,-0.0625},
+        {1154,707,0.0625}, {1154,718,-0.03125}, {1154,740,-0.03125}, {1154,812,0.0625},
+        {1154,835,0.03125}, {1154,846,0.03125}, {1154,1086,0.03125}, {1155,562,-0.125},
+        {1155,570,-0.125}, {1155,834,0.125}, {1155,851,0.125}, {1156,587,-0.0625},
+        {1156,633,0.0625}, {1156,634,0.0625}, {1156,650,0.0625}, {1156,785,-0.0625},
+        {1156,858,0.0625}, {1156,891,-0.0625}, {1156,960,-0.0625}, {1157,583,0.0625},
+        {1157,612,-0.03125}, {1157,632,0.03125}, {1157,652,-0.03125}, {1157,766,-0.015625},
+        {1157,787,-0.03125}, {1157,839,-0.0625}, {1157,914,0.015625}, {1157,962,0.015625},
+        {1157,995,0.03125}, {1157,1011,0.03125}, {1157,1134,-0.015625}, {1158,584,-0.03125},
+        {1158,642,-0.03125}, {1158,719,0.0625}, {1158,853,-0.0625}, {1158,951,0.03125},
+        {1158,1055,0.03125}, {1158,1090,0.03125}, {1158,1112,-0.03125}, {1159,584,0.03125},
+        {1159,642,-0.03125}, {1159,719,0.0625}, {1159,853,-0.0625}, {1159,951,-0.03125},
+        {1159,1055,0.03125}, {1159,1090,-0.03125}, {1159,1112,0.03125}, {1160,671,-0.03125},
+        {1160,677,0.03125}, {1160,687,-0.03125}, {1160,711,0.03125}, {1160,758,-0.03125},
+        {1160,807,0.03125}, {1160,868,0.03125}, {1160,880,0.03125}, {1160,1008,-0.03125},
+        {1160,1019,0.03125}, {1160,1075,-0.03125}, {1160,1091,-0.03125}, {1161,563,-0.0625},
+        {1161,624,0.0625}, {1161,636,0.0625}, {1161,747,-0.0625}, {1161,791,-0.0625},
+        {1161,831,0.0625}, {1162,727,0.0625}, {1162,973,-0.125}, {1162,1079,-0.0625},
+        {1162,1121,0.125}, {1163,715,0.125}, {1163,782,-0.125}, {1163,874,-0.0625},
+        {1163,934,0.0625}, {1164,618,-0.03125}, {1164,628,-0.03125}, {1164,659,0.03125},
+        {1164,700,0.03125}, {1164,721,0.03125}, {1164,744,-0.03125}, {1164,794,0.03125},
+        {1164,824,-0.03125}, {1164,862,0.03125}, {1164,864,0.03125}, {1164,909,-0.03125},
+        {1164,946,-0.03125}, {1165,605,0.03125}, {1165,618,-0.03125}, {1165,641,-0.03125},
+        {1165,659,0.03125}, {1165,676,0.03125}, {1165,721,-0.03125}, {1165,744,0.03125},
+        {1165,794,-0.03125}, {1165,824,0.03125}, {1165,864,0.03125}, {1165,909,-0.03125},
+        {1165,961,-0.03125}, {1166,563,-0.0625}, {1166,624,-0.0625}, {1166,636,0.0625},
+        {1166,702,0.0625}, {1166,720,-0.0625}, {1166,791,0.0625}, {1167,677,-0.03125},
+        {1167,711,0.03125}, {1167,758,0.03125}, {1167,807,0.03125}, {1167,868,-0.03125},
+        {1167,969,0.03125}, {1167,979,-0.03125}, {1167,1008,-0.03125}, {1167,1016,0.03125},
+        {1167,1075,-0.03125}, {1167,1091,0.03125}, {1167,1107,-0.03125}, {1168,577,-0.03125},
+        {1168,653,0.03125}, {1168,672,-0.03125}, {1168,688,0.0625}, {1168,778,0.03125},
+        {1168,783,-0.03125}, {1168,790,-0.03125}, {1168,895,0.03125}, {1168,982,-0.03125},
+        {1168,988,-0.03125}, {1168,1000,0.03125}, {1168,1029,0.03125}, {1168,1031,-0.0625},
+        {1168,1089,0.03125}, {1169,686,-0.0625}, {1169,730,0.0625}, {1169,816,0.0625},
+        {1169,872,-0.0625}, {1169,889,0.0625}, {1169,967,-0.0625}, {1169,980,0.0625},
+        {1169,1124,-0.0625}, {1170,704,0.0625}, {1170,899,-0.0625}, {1170,974,-0.0625},
+        {1170,989,0.0625}, {1170,991,-0.0625}, {1170,1083,-0.03125}, {1170,1097,0.0625},
+        {1170,1111,0.03125}, {1171,583,-0.0625}, {1171,612,-0.03125}, {1171,632,0.03125},
+        {1171,652,-0.03125}, {1171,766,-0.015625}, {1171,787,0.03125}, {1171,839,0.0625},
+        {1171,914,0.015625}, {1171,962,0.015625}, {1171,995,0.03125}, {1171,1011,-0.03125},
+        {1171,1134,-0.015625}, {1172,616,0.03125}, {1172,657,-0.0625}, {1172,678,0.03125},
+        {1172,680,-0.03125}, {1172,683,-0.0625}, {1172,707,0.0625}, {1172,718,0.03125},
+        {1172,740,0.03125}, {1172,812,0.0625}, {1172,835,-0.03125}, {1172,846,-0.03125},
+        {1172,1086,-0.03125}, {1173,577,-0.03125}, {1173,653,-0.03125}, {1173,672,-0.03125},
+        {1173,778,0.03125}, {1173,783,0.03125}, {1173,790,0.03125}, {1173,895,-0.03125},
+        {1173,918,-0.0625}, {1173,982,0.03125}, {1173,988,-0.03125}, {1173,992,0.0625},
+        {1173,1000,0.03125}, {1173,1029,0.03125}, {1173,1089,-0.03125}, {1174,622,0.0625},
+        {1174,627,0.0625}, {1174,803,0.0625}, {1174,826,0.0625}, {1174,852,-0.0625},
+        {1174,1007,-0.0625}, {1174,1032,-0.0625}, {1174,1117,-0.0625}, {1175,850,-0.0625},
+        {1175,870,-0.0625}, {1175,886,-0.0625}, {1175,958,-0.0625}, {1175,968,0.0625},
+        {1175,1010,0.0625}, {1175,1025,0.0625}, {1175,1048,0.0625}, {1176,697,0.0625},
+        {1176,741,-0.0625}, {1176,912,-0.0625}, {1176,972,-0.0625}, {1176,1017,0.0625},
+        {1176,1049,-0.0625}, {1176,1110,0.0625}, {1176,1146,0.0625}, {1177,595,0.0625},
+        {1177,713,-0.0625}, {1177,877,-0.0625}, {1177,1074,0.0625}, {1177,1085,-0.0625},
+        {1177,1105,-0.0625}, {1177,1116,0.0625}, {1177,1133,0.0625}, {1178,601,0.125},
+        {1178,667,-0.125}, {1178,898,0.125}, {1178,1037,-0.125}, {1179,770,0.125},
+        {1179,832,0.125}, {1179,866,-0.125}, {1179,941,-0.125}, {1180,673,-0.0625},
+        {1180,755,0.0625}, {1180,762,-0.03125}, {1180,773,-0.03125}, {1180,774,0.0625},
+        {1180,827,-0.03125}, {1180,844,0.03125}, {1180,859,0.03125}, {1180,935,0.03125},
+        {1180,1051,-0.0625}, {1180,1099,-0.03125}, {1180,1138,0.03125}, {1181,581,-0.0625},
+        {1181,593,0.0625}, {1181,695,-0.0625}, {1181,714,0.0625}, {1181,810,0.0625},
+        {1181,887,0.0625}, {1181,915,-0.0625}, {1181,950,-0.0625}, {1182,598,-0.0625},
+        {1182,648,0.0625}, {1182,708,-0.0625}, {1182,736,0.0625}, {1182,772,-0.0625},
+        {1182,904,0.0625}, {1182,970,-0.0625}, {1182,1005,0.0625}, {1183,762,0.03125},
+        {1183,773,-0.03125}, {1183,779,-0.0625}, {1183,789,0.0625}, {1183,797,0.0625},
+        {1183,827,-0.03125}, {1183,844,0.03125}, {1183,859,0.03125}, {1183,903,-0.0625},
+        {1183,935,-0.03125}, {1183,1099,0.03125}, {1183,1138,-0.03125}, {1184,604,0.0625},
+        {1184,619,0.03125}, {1184,623,0.03125}, {1184,647,0.0625}, {1184,756,-0.0625},
+        {1184,841,-0.0625}, {1184,929,-0.03125}, {1184,931,-0.03125}, {1184,966,0.03125},
+        {1184,996,0.03125}, {1184,1043,-0.03125}, {1184,1103,-0.03125}, {1185,625,-0.125},
+        {1185,690,0.125}, {1185,801,-0.125}, {1185,993,0.125}, {1186,564,0.0625},
+        {1186,589,0.0625}, {1186,599,-0.0625}, {1186,817,0.0625}, {1186,821,0.0625},
+        {1186,837,-0.0625}, {1186,1069,-0.0625}, {1186,1096,-0.0625}, {1187,608,-0.0625},
+        {1187,644,0.015625}, {1187,692,-0.0625}, {1187,722,0.03125}, {1187,728,-0.03125},
+        {1187,760,0.0625}, {1187,842,-0.03125}, {1187,883,0.0625}, {1187,938,-0.015625},
+        {1187,971,0.015625}, {1187,1040,0.03125}, {1187,1100,-0.015625}, {1188,565,-0.0625},
+        {1188,572,-0.0625}, {1188,651,-0.03125}, {1188,664,0.0625}, {1188,822,0.0625},
+        {1188,1047,-0.03125}, {1188,1050,0.03125}, {1188,1068,0.03125}, {1189,565,-0.0625},
+        {1189,572,-0.0625}, {1189,651,0.03125}, {1189,664,0.0625}, {1189,822,0.0625},
+        {1189,1047,0.03125}, {1189,1050,-0.03125}, {1189,1068,-0.03125}, {1190,622,0.03125},
+        {1190,627,-0.03125}, {1190,803,-0.03125}, {1190,826,0.03125}, {1190,850,0.03125},
+        {1190,852,0.03125}, {1190,870,0.03125}, {1190,886,-0.03125}, {1190,958,-0.03125},
+        {1190,968,-0.03125}, {1190,1007,0.03125}, {1190,1010,-0.03125}, {1190,1025,0.03125},
+        {1190,1032,-0.03125}, {1190,1048,0.03125}, {1190,1117,-0.03125}, {1191,610,0.0625},
+        {1191,639,-0.0625}, {1191,649,-0.0625}, {1191,656,-0.0625}, {1191,696,0.0625},
+        {1191,805,-0.0625}, {1191,843,0.0625}, {1191,1001,0.0625}, {1192,606,-0.125},
+        {1192,691,0.125}, {1192,725,0.125}, {1192,890,-0.125}, {1193,594,0.125},
+        {1193,614,-0.125}, {1193,710,-0.125}, {1193,775,0.125}, {1194,581,0.03125},
+        {1194,593,-0.03125}, {1194,598,0.03125}, {1194,648,-0.03125}, {1194,695,-0.03125},
+        {1194,708,-0.03125}, {1194,714,-0.03125}, {1194,736,0.03125}, {1194,772,-0.03125},
+        {1194,810,0.03125}, {1194,887,0.03125}, {1194,904,-0.03125}, {1194,915,-0.03125},
+        {1194,950,0.03125}, {1194,970,0.03125}, {1194,1005,0.03125}, {1195,581,0.03125},
+        {1195,593,-0.03125}, {1195,598,-0.03125}, {1195,648,0.03125}, {1195,695,-0.03125},
+        {1195,708,0.03125}, {1195,714,-0.03125}, {1195,736,-0.03125}, {1195,772,0.03125},
+        {1195,810,0.03125}, {1195,887,0.03125}, {1195,904,0.03125}, {1195,915,-0.03125},
+        {1195,950,0.03125}, {1195,970,-0.03125}, {1195,1005,-0.03125}, {1196,610,-0.0625},
+        {1196,639,0.0625}, {1196,649,-0.0625}, {1196,656,-0.0625}, {1196,696,0.0625},
+        {1196,805,0.0625}, {1196,843,0.0625}, {1196,1001,-0.0625}, {1197,622,0.03125},
+        {1197,627,-0.03125}, {1197,803,-0.03125}, {1197,826,0.03125}, {1197,850,-0.03125},
+        {1197,852,0.03125}, {1197,870,-0.03125}, {1197,886,0.03125}, {1197,958,0.03125},
+        {1197,968,0.03125}, {1197,1007,0.03125}, {1197,1010,0.03125}, {1197,1025,-0.03125},
+        {1197,1032,-0.03125}, {1197,1048,-0.03125}, {1197,1117,-0.03125}, {1198,673,0.0625},
+        {1198,755,-0.0625}, {1198,762,-0.03125}, {1198,773,-0.03125}, {1198,774,-0.0625},
+        {1198,827,-0.03125}, {1198,844,0.03125}, {1198,859,0.03125}, {1198,935,0.03125},
+        {1198,1051,0.0625}, {1198,1099,-0.03125}, {1198,1138,0.03125}, {1199,595,0.0625},
+        {1199,713,-0.0625}, {1199,877,0.0625}, {1199,1074,-0.0625}, {1199,1085,-0.0625},
+        {1199,1105,0.0625}, {1199,1116,0.0625}, {1199,1133,-0.0625}, {1200,697,0.0625},
+        {1200,741,-0.0625}, {1200,912,-0.0625}, {1200,972,0.0625}, {1200,1017,-0.0625},
+        {1200,1049,0.0625}, {1200,1110,-0.0625}, {1200,1146,0.0625}, {1201,608,0.0625},
+        {1201,644,0.015625}, {1201,692,0.0625}, {1201,722,0.03125}, {1201,728,-0.03125},
+        {1201,760,-0.0625}, {1201,842,-0.03125}, {1201,883,-0.0625}, {1201,938,-0.015625},
+        {1201,971,0.015625}, {1201,1040,0.03125}, {1201,1100,-0.015625}, {1202,604,0.0625},
+        {1202,619,-0.03125}, {1202,623,-0.03125}, {1202,647,0.0625}, {1202,756,-0.0625},
+        {1202,841,-0.0625}, {1202,929,0.03125}, {1202,931,0.03125}, {1202,966,-0.03125},
+        {1202,996,-0.03125}, {1202,1043,0.03125}, {1202,1103,0.03125}, {1203,762,0.03125},
+        {1203,773,-0.03125}, {1203,779,0.0625}, {1203,789,-0.0625}, {1203,797,-0.0625},
+        {1203,827,-0.03125}, {1203,844,0.03125}, {1203,859,0.03125}, {1203,903,0.0625},
+        {1203,935,-0.03125}, {1203,1099,0.03125}, {1203,1138,-0.03125}, {1204,577,-0.03125},
+        {1204,653,0.03125}, {1204,672,0.03125}, {1204,688,-0.0625}, {1204,778,0.03125},
+        {1204,783,0.03125}, {1204,790,-0.03125}, {1204,895,0.03125}, {1204,982,-0.03125},
+        {1204,988,-0.03125}, {1204,1000,-0.03125}, {1204,1029,0.03125}, {1204,1031,0.0625},
+        {1204,1089,-0.03125}, {1205,673,0.0625}, {1205,755,0.0625}, {1205,762,0.03125},
+        {1205,773,-0.03125}, {1205,774,-0.0625}, {1205,827,0.03125}, {1205,844,0.03125},
+        {1205,859,-0.03125}, {1205,935,-0.03125}, {1205,1051,-0.0625}, {1205,1099,-0.03125},
+        {1205,1138,0.03125}, {1206,686,0.0625}, {1206,730,-0.0625}, {1206,816,0.0625},
+        {1206,872,-0.0625}, {1206,889,0.0625}, {1206,967,0.0625}, {1206,980,-0.0625},
+        {1206,1124,-0.0625}, {1207,595,0.0625}, {1207,713,0.0625}, {1207,877,-0.0625},
+        {1207,1074,0.0625}, {1207,1085,-0.0625}, {1207,1105,0.0625}, {1207,1116,-0.0625},
+        {1207,1133,-0.0625}, {1208,704,-0.0625}, {1208,899,0.0625}, {1208,974,0.0625},
+        {1208,989,-0.0625}, {1208,991,-0.0625}, {1208,1083,-0.03125}, {1208,1097,0.0625},
+        {1208,1111,0.03125}, {1209,697,-0.0625}, {1209,741,0.0625}, {1209,912,-0.0625},
+        {1209,972,-0.0625}, {1209,1017,-0.0625}, {1209,1049,0.0625}, {1209,1110,0.0625},
+        {1209,1146,0.0625}, {1210,583,0.0625}, {1210,612,-0.03125}, {1210,632,-0.03125},
+        {1210,652,0.03125}, {1210,766,0.015625}, {1210,787,0.03125}, {1210,839,-0.0625},
+        {1210,914,-0.015625}, {1210,962,0.015625}, {1210,995,0.03125}, {1210,1011,-0.03125},
+        {1210,1134,-0.015625}, {1211,608,0.0625}, {1211,644,-0.015625}, {1211,692,-0.0625},
+        {1211,722,-0.03125}, {1211,728,0.03125}, {1211,760,-0.0625}, {1211,842,-0.03125},
+        {1211,883,0.0625}, {1211,938,-0.015625}, {1211,971,0.015625}, {1211,1040,0.03125},
+        {1211,1100,0.015625}, {1212,616,0.03125}, {1212,657,-0.0625}, {1212,678,-0.03125},
+        {1212,680,-0.03125}, {1212,683,0.0625}, {1212,707,-0.0625}, {1212,718,-0.03125},
+        {1212,740,0.03125}, {1212,812,0.0625}, {1212,835,-0.03125}, {1212,846,0.03125},
+        {1212,1086,0.03125}, {1213,604,-0.0625}, {1213,619,-0.03125}, {1213,623,0.03125},
+        {1213,647,0.0625}, {1213,756,0.0625}, {1213,841,-0.0625}, {1213,929,0.03125},
+        {1213,931,-0.03125}, {1213,966,-0.03125}, {1213,996,0.03125}, {1213,1043,-0.03125},
+        {1213,1103,0.03125}, {1214,577,-0.03125}, {1214,653,-0.03125}, {1214,672,0.03125},
+        {1214,778,0.03125}, {1214,783,-0.03125}, {1214,790,0.03125}, {1214,895,-0.03125},
+        {1214,918,0.0625}, {1214,982,0.03125}, {1214,988,-0.03125}, {1214,992,-0.0625},
+        {1214,1000,-0.03125}, {1214,1029,0.03125}, {1214,1089,0.03125}, {1215,762,-0.03125},
+        {1215,773,-0.03125}, {1215,779,-0.0625}, {1215,789,-0.0625}, {1215,797,0.0625},
+        {1215,827,0.03125}, {1215,844,0.03125}, {1215,859,-0.03125}, {1215,903,0.0625},
+        {1215,935,0.03125}, {1215,1099,0.03125}, {1215,1138,-0.03125}, {1216,605,-0.03125},
+        {1216,618,-0.03125}, {1216,641,0.03125}, {1216,659,0.03125}, {1216,676,-0.03125},
+        {1216,721,-0.03125}, {1216,744,0.03125}, {1216,794,-0.03125}, {1216,824,0.03125},
+        {1216,864,0.03125}, {1216,909,-0.03125}, {1216,961,0.03125}, {1217,581,-0.03125},
+        {1217,593,0.03125}, {1217,598,-0.03125}, {1217,648,-0.03125}, {1217,695,0.03125},
+        {1217,708,-0.03125}, {1217,714,-0.03125}, {1217,736,0.03125}, {1217,772,0.03125},
+        {1217,810,0.03125}, {1217,887,-0.03125}, {1217,904,0.03125}, {1217,915,-0.03125},
+        {1217,950,0.03125}, {1217,970,0.03125}, {1217,1005,-0.03125}, {1218,563,-0.0625},
+        {1218,624,-0.0625}, {1218,636,0.0625}, {1218,702,-0.0625}, {1218,720,0.0625},
+        {1218,791,0.0625}, {1219,610,0.0625}, {1219,639,-0.0625}, {1219,649,-0.0625},
+        {1219,656,0.0625}, {1219,696,0.0625}, {1219,805,0.0625}, {1219,843,-0.0625},
+        {1219,1001,-0.0625}, {1220,677,-0.03125}, {1220,711,0.03125}, {1220,758,0.03125},
+        {1220,807,0.03125}, {1220,868,-0.03125}, {1220,969,-0.03125}, {1220,979,0.03125},
+        {1220,1008,-0.03125}, {1220,1016,-0.03125}, {1220,1075,-0.03125}, {1220,1091,0.03125},
+        {1220,1107,0.03125}, {1221,622,0.03125}, {1221,627,0.03125}, {1221,803,-0.03125},
+        {1221,826,-0.03125}, {1221,850,0.03125}, {1221,852,-0.03125}, {1221,870,-0.03125},
+        {1221,886,-0.03125}, {1221,958,0.03125}, {1221,968,0.03125}, {1221,1007,0.03125},
+        {1221,1010,-0.03125}, {1221,1025,-0.03125}, {1221,1032,0.03125}, {1221,1048,0.03125},
+        {1221,1117,-0.03125}, {1222,584,-0.03125}, {1222,642,-0.03125}, {1222,719,-0.0625},
+        {1222,853,0.0625}, {1222,951,0.03125}, {1222,1055,0.03125}, {1222,1090,-0.03125},
+        {1222,1112,0.03125}, {1223,565,0.0625}, {1223,572,-0.0625}, {1223,651,-0.03125},
+        {1223,664,-0.0625}, {1223,822,0.0625}, {1223,1047,0.03125}, {1223,1050,0.03125},
+        {1223,1068,-0.03125}, {1224,584,-0.03125}, {1224,642,0.03125}, {1224,719,0.0625},
+        {1224,853,-0.0625}, {1224,951,0.03125}, {1224,1055,-0.03125}, {1224,1090,-0.03125},
+        {1224,1112,0.03125}, {1225,565,-0.0625}, {1225,572,0.0625}, {1225,651,-0.03125},
+        {1225,664,0.0625}, {1225,822,-0.0625}, {1225,1047,0.03125}, {1225,1050,0.03125},
+        {1225,1068,-0.03125}, {1226,671,0.03125}, {1226,677,0.03125}, {1226,687,0.03125},
+        {1226,711,0.03125}, {1226,758,-0.03125}, {1226,807,0.03125}, {1226,868,0.03125},
+        {1226,880,-0.03125}, {1226,1008,-0.03125}, {1226,1019,-0.03125}, {1226,1075,-0.03125},
+        {1226,1091,-0.03125}, {1227,622,0.03125}, {1227,627,0.03125}, {1227,803,-0.03125},
+        {1227,826,-0.03125}, {1227,850,-0.03125}, {1227,852,-0.03125}, {1227,870,0.03125},
+        {1227,886,0.03125}, {1227,958,-0.03125}, {1227,968,-0.03125}, {1227,1007,0.03125},
+        {1227,1010,0.03125}, {1227,1025,0.03125}, {1227,1032,0.03125}, {1227,1048,-0.03125},
+        {1227,1117,-0.03125}, {1228,563,-0.0625}, {1228,624,0.0625}, {1228,636,0.0625},
+        {1228,747,0.0625}, {1228,791,-0.0625}, {1228,831,-0.0625}, {1229,610,-0.0625},
+        {1229,639,0.0625}, {1229,649,-0.0625}, {1229,656,0.0625}, {1229,696,0.0625},
+        {1229,805,-0.0625}, {1229,843,-0.0625}, {1229,1001,0.0625}, {1230,727,-0.0625},
+        {1230,973,-0.125}, {1230,1079,0.0625}, {1230,1121,0.125}, {1231,606,0.125},
+        {1231,691,0.125}, {1231,725,-0.125}, {1231,890,-0.125}, {1232,715,0.125},
+        {1232,782,-0.125}, {1232,874,0.0625}, {1232,934,-0.0625}, {1233,594,-0.125},
+        {1233,614,-0.125}, {1233,710,0.125}, {1233,775,0.125}, {1234,618,-0.03125},
+        {1234,628,0.03125}, {1234,659,0.03125}, {1234,700,-0.03125}, {1234,721,0.03125},
+        {1234,744,-0.03125}, {1234,794,0.03125}, {1234,824,-0.03125}, {1234,862,-0.03125},
+        {1234,864,0.03125}, {1234,909,-0.03125}, {1234,946,0.03125}, {1235,581,-0.03125},
+        {1235,593,0.03125}, {1235,598,0.03125}, {1235,648,0.03125}, {1235,695,0.03125},
+        {1235,708,0.03125}, {1235,714,-0.03125}, {1235,736,-0.03125}, {1235,772,-0.03125},
+        {1235,810,0.03125}, {1235,887,-0.03125}, {1235,904,-0.03125}, {1235,915,-0.03125},
+        {1235,950,0.03125}, {1235,970,-0.03125}, {1235,1005,0.03125}, {1236,671,0.03125},
+        {1236,687,-0.03125}, {1236,711,0.0625}, {1236,807,-0.0625}, {1236,880,-0.03125},
+        {1236,969,0.03125}, {1236,979,-0.03125}, {1236,1008,0.0625}, {1236,1016,-0.03125},
+        {1236,1019,0.03125}, {1236,1075,-0.0625}, {1236,1107,0.03125}, {1237,622,0.0625},
+        {1237,627,-0.0625}, {1237,803,0.0625}, {1237,826,-0.0625}, {1237,852,0.0625},
+        {1237,1007,-0.0625}, {1237,1032,0.0625}, {1237,1117,-0.0625}, {1238,671,-0.03125},
+        {1238,677,-0.0625}, {1238,687,0.03125}, {1238,758,0.0625}, {1238,868,0.0625},
+        {1238,880,0.03125}, {1238,969,0.03125}, {1238,979,-0.03125}, {1238,1016,-0.03125},
+        {1238,1019,-0.03125}, {1238,1091,-0.0625}, {1238,1107,0.03125}, {1239,850,-0.0625},
+        {1239,870,0.0625}, {1239,886,-0.0625}, {1239,958,0.0625}, {1239,968,-0.0625},
+        {1239,1010,0.0625}, {1239,1025,-0.0625}, {1239,1048,0.0625}, {1240,704,-0.0625},
+        {1240,899,-0.0625}, {1240,974,0.0625}, {1240,989,0.0625}, {1240,991,-0.0625},
+        {1240,1083,0.03125}, {1240,1097,0.0625}, {1240,1111,-0.03125}, {1241,697,-0.0625},
+        {1241,741,0.0625}, {1241,912,-0.0625}, {1241,972,0.0625}, {1241,1017,0.0625},
+        {1241,1049,-0.0625}, {1241,1110,-0.0625}, {1241,1146,0.0625}, {1242,686,-0.0625},
+        {1242,730,-0.0625}, {1242,816,0.0625}, {1242,872,-0.0625}, {1242,889,-0.0625},
+        {1242,967,0.0625}, {1242,980,0.0625}, {1242,1124,0.0625}, {1243,595,0.0625},
+        {1243,713,0.0625}, {1243,877,0.0625}, {1243,1074,-0.0625}, {1243,1085,-0.0625},
+        {1243,1105,-0.0625}, {1243,1116,-0.0625}, {1243,1133,0.0625}, {1244,734,-0.125},
+        {1244,1009,-0.125}, {1244,1129,0.125}, {1244,1144,0.125}, {1245,601,0.125},
+        {1245,667,0.125}, {1245,898,-0.125}, {1245,1037,-0.125}, {1246,724,-0.125},
+        {1246,748,0.125}, {1246,930,-0.125}, {1246,1070,0.125}, {1247,770,0.125},
+        {1247,832,-0.125}, {1247,866,-0.125}, {1247,941,0.125}, {1248,577,-0.03125},
+        {1248,653,-0.03125}, {1248,672,0.03125}, {1248,688,0.0625}, {1248,778,0.03125},
+        {1248,783,0.03125}, {1248,790,0.03125}, {1248,895,0.03125}, {1248,982,-0.03125},
+        {1248,988,0.03125}, {1248,1000,-0.03125}, {1248,1029,-0.03125}, {1248,1031,-0.0625},
+        {1248,1089,-0.03125}, {1249,673,-0.0625}, {1249,755,-0.0625}, {1249,762,0.03125},
+        {1249,773,-0.03125}, {1249,774,0.0625}, {1249,827,0.03125}, {1249,844,0.03125},
+        {1249,859,-0.03125}, {1249,935,-0.03125}, {1249,1051,0.0625}, {1249,1099,-0.03125},
+        {1249,1138,0.03125}, {1250,605,0.03125}, {1250,618,0.0625}, {1250,628,0.03125},
+        {1250,641,-0.03125}, {1250,659,0.0625}, {1250,676,-0.03125}, {1250,700,0.03125},
+        {1250,862,-0.03125}, {1250,864,-0.0625}, {1250,909,-0.0625}, {1250,946,-0.03125},
+        {1250,961,0.03125}, {1251,581,0.0625}, {1251,593,-0.0625}, {1251,695,0.0625},
+        {1251,714,0.0625}, {1251,810,0.0625}, {1251,887,-0.0625}, {1251,915,-0.0625},
+        {1251,950,-0.0625}, {1252,605,0.03125}, {1252,628,-0.03125}, {1252,641,-0.03125},
+        {1252,676,-0.03125}, {1252,700,-0.03125}, {1252,721,-0.0625}, {1252,744,-0.0625},
+        {1252,794,0.0625}, {1252,824,0.0625}, {1252,862,0.03125}, {1252,946,0.03125},
+        {1252,961,0.03125}, {1253,598,0.0625}, {1253,648,0.0625}, {1253,708,-0.0625},
+        {1253,736,0.0625}, {1253,772,0.0625}, {1253,904,-0.0625}, {1253,970,-0.0625},
+        {1253,1005,-0.0625}, {1254,577,-0.03125}, {1254,653,0.03125}, {1254,672,0.03125},
+        {1254,778,0.03125}, {1254,783,-0.03125}, {1254,790,-0.03125}, {1254,895,-0.03125},
+        {1254,918,-0.0625}, {1254,982,0.03125}, {1254,988,0.03125}, {1254,992,0.0625},
+        {1254,1000,-0.03125}, {1254,1029,-0.03125}, {1254,1089,0.03125}, {1255,762,-0.03125},
+        {1255,773,-0.03125}, {1255,779,0.0625}, {1255,789,0.0625}, {1255,797,-0.0625},
+        {1255,827,0.03125}, {1255,844,0.03125}, {1255,859,-0.03125}, {1255,903,-0.0625},
+        {1255,935,0.03125}, {1255,1099,0.03125}, {1255,1138,-0.03125}, {1256,616,-0.03125},
+        {1256,657,-0.0625}, {1256,678,0.03125}, {1256,680,0.03125}, {1256,683,0.0625},
+        {1256,707,-0.0625}, {1256,718,0.03125}, {1256,740,-0.03125}, {1256,812,0.0625},
+        {1256,835,0.03125}, {1256,846,-0.03125}, {1256,1086,-0.03125}, {1257,604,-0.0625},
+        {1257,619,0.03125}, {1257,623,-0.03125}, {1257,647,0.0625}, {1257,756,0.0625},
+        {1257,841,-0.0625}, {1257,929,-0.03125}, {1257,931,0.03125}, {1257,966,0.03125},
+        {1257,996,-0.03125}, {1257,1043,0.03125}, {1257,1103,-0.03125}, {1258,562,-0.125},
+        {1258,570,0.125}, {1258,834,0.125}, {1258,851,-0.125}, {1259,625,-0.125},
+        {1259,690,-0.125}, {1259,801,0.125}, {1259,993,0.125}, {1260,587,-0.0625},
+        {1260,633,0.0625}, {1260,634,0.0625}, {1260,650,-0.0625}, {1260,785,-0.0625},
+        {1260,858,-0.0625}, {1260,891,0.0625}, {1260,960,0.0625}, {1261,564,0.0625},
+        {1261,589,-0.0625}, {1261,599,0.0625}, {1261,817,0.0625}, {1261,821,-0.0625},
+        {1261,837,-0.0625}, {1261,1069,-0.0625}, {1261,1096,0.0625}, {1262,583,-0.0625},
+        {1262,612,-0.03125}, {1262,632,-0.03125}, {1262,652,0.03125}, {1262,766,0.015625},
+        {1262,787,-0.03125}, {1262,839,0.0625}, {1262,914,-0.015625}, {1262,962,0.015625},
+        {1262,995,0.03125}, {1262,1011,0.03125}, {1262,1134,-0.015625}, {1263,608,-0.0625},
+        {1263,644,-0.015625}, {1263,692,0.0625}, {1263,722,-0.03125}, {1263,728,0.03125},
+        {1263,760,0.0625}, {1263,842,-0.03125}, {1263,883,-0.0625}, {1263,938,-0.015625},
+        {1263,971,0.015625}, {1263,1040,0.03125}, {1263,1100,0.015625}, {1264,560,-0.0078125},
+        {1264,612,-0.015625}, {1264,621,0.0078125}, {1264,632,0.0078125}, {1264,645,-0.015625},
+        {1264,652,0.0078125}, {1264,670,-0.00390625}, {1264,766,-0.00390625}, {1264,799,0.0078125},
+        {1264,847,-0.00390625}, {1264,854,-0.0078125}, {1264,863,0.0078125}, {1264,867,-0.00390625},
+        {1264,885,0.015625}, {1264,902,0.015625}, {1264,914,-0.00390625}, {1264,962,0.0078125},
+        {1264,995,-0.015625}, {1264,1058,0.00390625}, {1264,1087,0.0078125}, {1264,1102,-0.00390625},
+        {1264,1115,-0.0078125}, {1264,1134,0.0078125}, {1264,1136,0.00390625}, {1265,644,-0.0078125},
+        {1265,722,0.015625}, {1265,728,0.015625}, {1265,818,-0.015625}, {1265,842,-0.015625},
+        {1265,855,0.03125}, {1265,926,0.015625}, {1265,938,0.0078125}, {1265,949,0.015625},
+        {1265,971,0.0078125}, {1265,977,0.015625}, {1265,1002,-0.03125}, {1265,1012,0.015625},
+        {1265,1015,-0.015625}, {1265,1021,-0.015625}, {1265,1024,-0.015625}, {1265,1040,-0.015625},
+        {1265,1092,0.015625}, {1265,1100,-0.0078125}, {1265,1118,-0.015625}, {1266,637,0.015625},
+        {1266,751,-0.015625}, {1266,879,-0.03125}, {1266,888,0.03125}, {1266,892,0.015625},
+        {1266,963,-0.015625}, {1266,978,0.03125}, {1266,981,-0.015625}, {1266,1057,-0.015625},
+        {1266,1080,-0.015625}, {1266,1098,0.015625}, {1266,1120,0.015625}, {1267,560,-0.0078125},
+        {1267,612,0.015625}, {1267,621,0.0078125}, {1267,632,0.0078125}, {1267,645,0.015625},
+        {1267,652,0.0078125}, {1267,670,-0.00390625}, {1267,766,-0.00390625}, {1267,799,0.0078125},
+        {1267,847,-0.00390625}, {1267,854,-0.0078125}, {1267,863,0.0078125}, {1267,867,-0.00390625},
+        {1267,885,0.015625}, {1267,902,-0.015625}, {1267,914,-0.00390625}, {1267,962,-0.0078125},
+        {1267,995,0.015625}, {1267,1058,0.00390625}, {1267,1087,0.0078125}, {1267,1102,-0.00390625},
+        {1267,1115,-0.0078125}, {1267,1134,-0.0078125}, {1267,1136,0.00390625}, {1268,644,-0.0078125},
+        {1268,722,0.015625}, {1268,728,0.015625}, {1268,818,0.015625}, {1268,842,0.015625},
+        {1268,855,0.03125}, {1268,926,-0.015625}, {1268,938,-0.0078125}, {1268,949,0.015625},
+        {1268,971,-0.0078125}, {1268,977,0.015625}, {1268,1002,0.03125}, {1268,1012,-0.015625},
+        {1268,1015,-0.015625}, {1268,1021,0.015625}, {1268,1024,-0.015625}, {1268,1040,0.015625},
+        {1268,1092,-0.015625}, {1268,1100,-0.0078125}, {1268,1118,-0.015625}, {1269,637,-0.015625},
+        {1269,751,-0.015625}, {1269,879,0.03125}, {1269,888,0.03125}, {1269,892,0.015625},
+        {1269,963,-0.015625}, {1269,978,0.03125}, {1269,981,-0.015625}, {1269,1057,-0.015625},
+        {1269,1080,0.015625}, {1269,1098,0.015625}, {1269,1120,-0.015625}, {1270,560,-0.0078125},
+        {1270,612,-0.015625}, {1270,621,-0.0078125}, {1270,632,0.0078125}, {1270,645,0.015625},
+        {1270,652,0.0078125}, {1270,670,0.00390625}, {1270,766,-0.00390625}, {1270,799,0.0078125},
+        {1270,847,-0.00390625}, {1270,854,0.0078125}, {1270,863,-0.0078125}, {1270,867,0.00390625},
+        {1270,885,0.015625}, {1270,902,-0.015625}, {1270,914,-0.00390625}, {1270,962,0.0078125},
+        {1270,995,-0.015625}, {1270,1058,-0.00390625}, {1270,1087,0.0078125}, {1270,1102,-0.00390625},
+        {1270,1115,0.0078125}, {1270,1134,0.0078125}, {1270,1136,-0.00390625}, {1271,616,-0.03125},
+        {1271,678,0.015625}, {1271,680,-0.03125}, {1271,699,-0.03125}, {1271,701,0.015625},
+        {1271,718,-0.015625}, {1271,740,0.03125}, {1271,754,0.03125}, {1271,792,-0.015625},
+        {1271,835,0.03125}, {1271,846,-0.015625}, {1271,1020,-0.015625}, {1271,1086,0.015625},
+        {1271,1122,0.015625}, {1272,579,0.03125}, {1272,587,0.03125}, {1272,607,-0.015625},
+        {1272,633,-0.03125}, {1272,634,0.03125}, {1272,638,0.015625}, {1272,650,-0.015625},
+        {1272,757,-0.03125}, {1272,785,-0.03125}, {1272,802,0.015625}, {1272,848,-0.015625},
+        {1272,858,0.015625}, {1272,891,0.015625}, {1272,960,-0.015625}, {1273,669,-0.0625},
+        {1273,765,-0.015625}, {1273,901,0.03125}, {1273,943,-0.0078125}, {1273,1003,0.03125},
+        {1273,1059,0.015625}, {1273,1060,-0.015625}, {1273,1061,0.015625}, {1273,1065,0.03125},
+        {1273,1151,-0.0078125}, {1274,592,-0.0625}, {1274,613,0.03125}, {1274,694,-0.03125},
+        {1274,709,-0.03125}, {1274,798,0.0625}, {1274,860,-0.015625}, {1274,897,0.03125},
+        {1274,1039,0.015625}, {1274,1046,0.015625}, {1274,1062,-0.015625}, {1275,617,0.015625},
+        {1275,630,-0.0078125}, {1275,668,0.015625}, {1275,759,0.03125}, {1275,823,-0.03125},
+        {1275,932,-0.015625}, {1276,681,0.015625}, {1276,704,0.015625}, {1276,974,0.015625},
+        {1276,991,-0.03125}, {1276,1034,0.015625}, {1276,1071,0.03125}, {1276,1097,-0.03125},
+        {1276,1123,-0.015625}, {1276,1128,-0.015625}, {1276,1132,-0.0078125}, {1276,1142,-0.0078125},
+        {1276,1143,0.03125}, {1277,577,-0.03125}, {1277,661,-0.03125}, {1277,672,0.015625},
+        {1277,675,-0.015625}, {1277,778,-0.03125}, {1277,783,-0.015625}, {1277,813,0.015625},
+        {1277,875,0.03125}, {1277,895,0.03125}, {1277,982,0.03125}, {1277,1000,0.015625},
+        {1277,1036,-0.015625}, {1277,1038,0.015625}, {1277,1089,-0.015625}, {1278,671,-0.015625},
+        {1278,677,0.015625}, {1278,687,0.015625}, {1278,711,0.015625}, {1278,739,-0.015625},
+        {1278,758,0.015625}, {1278,807,-0.015625}, {1278,868,-0.015625}, {1278,880,-0.015625},
+        {1278,969,0.015625}, {1278,979,0.015625}, {1278,1008,-0.015625}, {1278,1016,-0.015625},
+        {1278,1019,0.015625}, {1278,1023,-0.015625}, {1278,1044,0.015625}, {1278,1075,0.015625},
+        {1278,1091,-0.015625}, {1278,1107,-0.015625}, {1278,1150,0.015625}, {1279,560,0.0078125},
+        {1279,612,-0.015625}, {1279,621,-0.0078125}, {1279,632,0.0078125}, {1279,645,0.015625},
+        {1279,652,0.0078125}, {1279,670,-0.00390625}, {1279,766,0.00390625}, {1279,799,0.0078125},
+        {1279,847,0.00390625}, {1279,854,-0.0078125}, {1279,863,-0.0078125}, {1279,867,-0.00390625},
+        {1279,885,0.015625}, {1279,902,0.015625}, {1279,914,0.00390625}, {1279,962,-0.0078125},
+        {1279,995,-0.015625}, {1279,1058,-0.00390625}, {1279,1087,0.0078125}, {1279,1102,0.00390625},
+        {1279,1115,-0.0078125}, {1279,1134,-0.0078125}, {1279,1136,-0.00390625}, {1280,576,0.015625},
+        {1280,605,0.015625}, {1280,618,-0.015625}, {1280,628,-0.015625}, {1280,641,0.015625},
+        {1280,659,0.015625}, {1280,676,-0.015625}, {1280,700,0.015625}, {1280,721,0.015625},
+        {1280,744,-0.015625}, {1280,794,-0.015625}, {1280,806,-0.015625}, {1280,824,0.015625},
+        {1280,862,-0.015625}, {1280,864,-0.015625}, {1280,896,0.015625}, {1280,909,0.015625},
+        {1280,946,0.015625}, {1280,961,-0.015625}, {1280,994,-0.015625}, {1281,573,0.0078125},
+        {1281,642,-0.0078125}, {1281,719,0.015625}, {1281,753,0.015625}, {1281,767,-0.015625},
+        {1281,853,0.015625}, {1281,893,-0.0078125}, {1281,916,-0.015625}, {1281,936,0.0078125},
+        {1281,1055,-0.0078125}, {1282,573,0.0078125}, {1282,642,-0.0078125}, {1282,719,0.015625},
+        {1282,753,0.015625}, {1282,767,-0.015625}, {1282,853,0.015625}, {1282,893,-0.0078125},
+        {1282,916,-0.015625}, {1282,936,0.0078125}, {1282,1055,-0.0078125}, {1283,671,0.015625},
+        {1283,677,-0.015625}, {1283,687,-0.015625}, {1283,711,-0.015625}, {1283,739,0.015625},
+        {1283,758,-0.015625}, {1283,807,0.015625}, {1283,868,0.015625}, {1283,880,0.015625},
+        {1283,969,-0.015625}, {1283,979,-0.015625}, {1283,1008,0.015625}, {1283,1016,0.015625},
+        {1283,1019,-0.015625}, {1283,1023,0.015625}, {1283,1044,-0.015625}, {1283,1075,-0.015625},
+        {1283,1091,0.015625}, {1283,1107,0.015625}, {1283,1150,-0.015625}, {1284,576,-0.015625},
+        {1284,605,-0.015625}, {1284,618,0.015625}, {1284,628,0.015625}, {1284,641,-0.015625},
+        {1284,659,-0.015625}, {1284,676,0.015625}, {1284,700,-0.015625}, {1284,721,-0.015625},
+        {1284,744,0.015625}, {1284,794,0.015625}, {1284,806,0.015625}, {1284,824,-0.015625},
+        {1284,862,0.015625}, {1284,864,0.015625}, {1284,896,-0.015625}, {1284,909,-0.015625},
+        {1284,946,-0.015625}, {1284,961,0.015625}, {1284,994,0.015625}, {1285,681,0.015625},
+        {1285,704,0.015625}, {1285,974,0.015625}, {1285,991,-0.03125}, {1285,1034,0.015625},
+        {1285,1071,0.03125}, {1285,1097,-0.03125}, {1285,1123,-0.015625}, {1285,1128,-0.015625},
+        {1285,1132,-0.0078125}, {1285,1142,-0.0078125}, {1285,1143,0.03125}, {1286,577,-0.03125},
+        {1286,661,-0.03125}, {1286,672,0.015625}, {1286,675,-0.015625}, {1286,778,-0.03125},
+        {1286,783,-0.015625}, {1286,813,0.015625}, {1286,875,0.03125}, {1286,895,0.03125},
+        {1286,982,0.03125}, {1286,1000,0.015625}, {1286,1036,-0.015625}, {1286,1038,0.015625},
+        {1286,1089,-0.015625}, {1287,560,0.0078125}, {1287,612,-0.015625}, {1287,621,-0.0078125},
+        {1287,632,0.0078125}, {1287,645,0.015625}, {1287,652,0.0078125}, {1287,670,-0.00390625},
+        {1287,766,0.00390625}, {1287,799,0.0078125}, {1287,847,0.00390625}, {1287,854,-0.0078125},
+        {1287,863,-0.0078125}, {1287,867,-0.00390625}, {1287,885,0.015625}, {1287,902,0.015625},
+        {1287,914,0.00390625}, {1287,962,-0.0078125}, {1287,995,-0.015625}, {1287,1058,-0.00390625},
+        {1287,1087,0.0078125}, {1287,1102,0.00390625}, {1287,1115,-0.0078125}, {1287,1134,-0.0078125},
+        {1287,1136,-0.00390625}, {1288,560,0.0078125}, {1288,583,-0.03125}, {1288,612,-0.015625},
+        {1288,621,0.0078125}, {1288,632,0.0078125}, {1288,645,-0.015625}, {1288,652,0.0078125},
+        {1288,670,0.00390625}, {1288,766,0.00390625}, {1288,787,0.015625}, {1288,799,0.0078125},
+        {1288,839,-0.03125}, {1288,847,0.00390625}, {1288,854,0.0078125}, {1288,856,-0.03125},
+        {1288,863,0.0078125}, {1288,867,0.00390625}, {1288,871,0.03125}, {1288,885,0.015625},
+        {1288,902,-0.015625}, {1288,914,0.00390625}, {1288,962,-0.0078125}, {1288,995,-0.015625},
+        {1288,1011,0.015625}, {1288,1058,0.00390625}, {1288,1087,0.0078125}, {1288,1102,0.00390625},
+        {1288,1115,0.0078125}, {1288,1134,-0.0078125}, {1288,1136,0.00390625}, {1289,568,0.0625},
+        {1289,616,0.03125}, {1289,657,-0.0625}, {1289,678,-0.015625}, {1289,680,0.03125},
+        {1289,683,0.03125}, {1289,699,-0.03125}, {1289,701,-0.015625}, {1289,707,0.03125},
+        {1289,718,-0.015625}, {1289,740,0.03125}, {1289,754,-0.03125}, {1289,792,-0.015625},
+        {1289,812,-0.0625}, {1289,835,0.03125}, {1289,846,-0.015625}, {1289,913,0.03125},
+        {1289,1018,0.03125}, {1289,1020,-0.015625}, {1289,1086,-0.015625}, {1289,1122,-0.015625},
+        {1290,577,-0.03125}, {1290,653,0.03125}, {1290,658,-0.03125}, {1290,661,0.03125},
+        {1290,672,0.015625}, {1290,675,0.015625}, {1290,688,-0.03125}, {1290,778,-0.03125},
+        {1290,780,-0.03125}, {1290,783,0.015625}, {1290,790,0.03125}, {1290,813,0.015625},
+        {1290,875,0.03125}, {1290,895,-0.03125}, {1290,918,-0.03125}, {1290,982,-0.03125},
+        {1290,988,0.03125}, {1290,992,-0.03125}, {1290,1000,0.015625}, {1290,1029,0.03125},
+        {1290,1031,-0.03125}, {1290,1036,0.015625}, {1290,1038,0.015625}, {1290,1089,0.015625},
+        {1291,585,-0.03125}, {1291,597,0.0625}, {1291,669,-0.0625}, {1291,679,-0.0625},
+        {1291,765,0.015625}, {1291,901,0.03125}, {1291,943,0.0078125}, {1291,1003,0.03125},
+        {1291,1059,0.015625}, {1291,1060,0.015625}, {1291,1061,0.015625}, {1291,1065,-0.03125},
+        {1291,1151,0.0078125}, {1292,686,-0.03125}, {1292,730,0.03125}, {1292,816,-0.0625},
+        {1292,830,0.0625}, {1292,857,-0.03125}, {1292,865,-0.0625}, {1292,872,-0.0625},
+        {1292,889,0.0625}, {1292,948,0.03125}, {1292,967,0.03125}, {1292,980,-0.03125},
+        {1292,1106,-0.03125}, {1292,1114,0.03125}, {1292,1124,0.0625}, {1293,569,0.03125},
+        {1293,681,0.015625}, {1293,704,0.015625}, {1293,899,-0.03125}, {1293,964,-0.03125},
+        {1293,974,0.015625}, {1293,989,-0.03125}, {1293,991,-0.03125}, {1293,1034,0.015625},
+        {1293,1071,-0.03125}, {1293,1083,0.015625}, {1293,1097,-0.03125}, {1293,1111,0.015625},
+        {1293,1123,0.015625}, {1293,1128,0.015625}, {1293,1132,0.0078125}, {1293,1142,0.0078125},
+        {1293,1143,0.03125}, {1294,560,-0.0078125}, {1294,612,-0.015625}, {1294,621,-0.0078125},
+        {1294,632,0.0078125}, {1294,645,0.015625}, {1294,652,0.0078125}, {1294,670,0.00390625},
+        {1294,766,-0.00390625}, {1294,799,0.0078125}, {1294,847,-0.00390625}, {1294,854,0.0078125},
+        {1294,863,-0.0078125}, {1294,867,0.00390625}, {1294,885,0.015625}, {1294,902,-0.015625},
+        {1294,914,-0.00390625}, {1294,962,0.0078125}, {1294,995,-0.015625}, {1294,1058,-0.00390625},
+        {1294,1087,0.0078125}, {1294,1102,-0.00390625}, {1294,1115,0.0078125}, {1294,1134,0.0078125},
+        {1294,1136,-0.00390625}, {1295,579,0.03125}, {1295,587,0.03125}, {1295,607,-0.015625},
+        {1295,633,-0.03125}, {1295,634,0.03125}, {1295,638,0.015625}, {1295,650,-0.015625},
+        {1295,757,-0.03125}, {1295,785,-0.03125}, {1295,802,0.015625}, {1295,848,-0.015625},
+        {1295,858,0.015625}, {1295,891,0.015625}, {1295,960,-0.015625}, {1296,616,0.03125},
+        {1296,678,-0.015625}, {1296,680,0.03125}, {1296,699,0.03125}, {1296,701,-0.015625},
+        {1296,718,0.015625}, {1296,740,-0.03125}, {1296,754,-0.03125}, {1296,792,0.015625},
+        {1296,835,-0.03125}, {1296,846,0.015625}, {1296,1020,0.015625}, {1296,1086,-0.015625},
+        {1296,1122,-0.015625}, {1297,617,0.015625}, {1297,630,-0.0078125}, {1297,668,0.015625},
+        {1297,759,0.03125}, {1297,823,-0.03125}, {1297,932,-0.015625}, {1298,592,0.0625},
+        {1298,613,-0.03125}, {1298,694,0.03125}, {1298,709,0.03125}, {1298,798,-0.0625},
+        {1298,860,0.015625}, {1298,897,-0.03125}, {1298,1039,-0.015625}, {1298,1046,-0.015625},
+        {1298,1062,0.015625}, {1299,573,-0.015625}, {1299,584,0.03125}, {1299,642,-0.015625},
+        {1299,719,0.03125}, {1299,753,0.03125}, {1299,767,0.03125}, {1299,777,-0.03125},
+        {1299,853,0.03125}, {1299,893,0.015625}, {1299,916,-0.03125}, {1299,936,-0.015625},
+        {1299,951,0.03125}, {1299,1045,-0.015625}, {1299,1055,-0.015625}, {1299,1081,-0.015625},
+        {1299,1090,-0.015625}, {1299,1112,-0.015625}, {1300,669,-0.0625}, {1300,765,-0.015625},
+        {1300,901,0.03125}, {1300,943,-0.0078125}, {1300,1003,0.03125}, {1300,1059,0.015625},
+        {1300,1060,-0.015625}, {1300,1061,0.015625}, {1300,1065,0.03125}, {1300,1151,-0.0078125},
+        {1301,617,-0.03125}, {1301,630,0.015625}, {1301,668,0.03125}, {1301,759,0.0625},
+        {1301,823,-0.0625}, {1301,922,-0.015625}, {1301,924,0.0625}, {1301,932,0.03125},
+        {1301,933,-0.015625}, {1301,983,-0.03125}, {1301,1053,-0.03125}, {1302,573,-0.015625},
+        {1302,584,-0.03125}, {1302,642,-0.015625}, {1302,719,0.03125}, {1302,753,0.03125},
+        {1302,767,0.03125}, {1302,777,0.03125}, {1302,853,0.03125}, {1302,893,0.015625},
+        {1302,916,-0.03125}, {1302,936,-0.015625}, {1302,951,-0.03125}, {1302,1045,0.015625},
+        {1302,1055,-0.015625}, {1302,1081,0.015625}, {1302,1090,0.015625}, {1302,1112,0.015625},
+        {1303,671,-0.03125}, {1303,677,0.03125}, {1303,687,-0.03125}, {1303,711,0.03125},
+        {1303,739,0.03125}, {1303,758,0.03125}, {1303,807,0.03125}, {1303,868,0.03125},
+        {1303,880,-0.03125}, {1303,969,-0.03125}, {1303,979,-0.03125}, {1303,1008,0.03125},
+        {1303,1016,-0.03125}, {1303,1019,-0.03125}, {1303,1023,0.03125}, {1303,1044,0.03125},
+        {1303,1075,0.03125}, {1303,1091,0.03125}, {1303,1107,-0.03125}, {1303,1150,0.03125},
+        {1304,563,0.0625}, {1304,624,0.0625}, {1304,636,0.0625}, {1304,702,-0.0625},
+        {1304,720,-0.0625}, {1304,747,-0.0625}, {1304,791,0.0625}, {1304,815,0.0625},
+        {1304,831,-0.0625}, {1304,919,0.0625}, {1305,727,-0.0625}, {1305,954,0.125},
+        {1305,973,0.125}, {1305,1030,-0.125}, {1305,1079,-0.0625}, {1305,1121,0.125},
+        {1306,596,-0.125}, {1306,715,0.125}, {1306,782,0.125}, {1306,836,0.125},
+        {1306,874,-0.0625}, {1306,934,-0.0625}, {1307,576,0.03125}, {1307,605,-0.03125},
+        {1307,618,0.03125}, {1307,628,-0.03125}, {1307,641,-0.03125}, {1307,659,0.03125},
+        {1307,676,-0.03125}, {1307,700,-0.03125}, {1307,721,0.03125}, {1307,744,0.03125},
+        {1307,794,0.03125}, {1307,806,0.03125}, {1307,824,0.03125}, {1307,862,-0.03125},
+        {1307,864,0.03125}, {1307,896,0.03125}, {1307,909,0.03125}, {1307,946,-0.03125},
+        {1307,961,-0.03125}, {1307,994,0.03125}, {1308,569,-0.03125}, {1308,681,0.015625},
+        {1308,704,0.015625}, {1308,899,0.03125}, {1308,964,0.03125}, {1308,974,0.015625},
+        {1308,989,0.03125}, {1308,991,-0.03125}, {1308,1034,0.015625}, {1308,1071,-0.03125},
+        {1308,1083,-0.015625}, {1308,1097,-0.03125}, {1308,1111,-0.015625}, {1308,1123,0.015625},
+        {1308,1128,0.015625}, {1308,1132,0.0078125}, {1308,1142,0.0078125}, {1308,1143,0.03125},
+        {1309,686,0.03125}, {1309,730,0.03125}, {1309,816,-0.0625}, {1309,830,0.0625},
+        {1309,857,0.03125}, {1309,865,0.0625}, {1309,872,-0.0625}, {1309,889,-0.0625},
+        {1309,948,0.03125}, {1309,967,0.03125}, {1309,980,0.03125}, {1309,1106,0.03125},
+        {1309,1114,0.03125}, {1309,1124,-0.0625}, {1310,734,-0.125}, {1310,819,0.125},
+        {1310,907,0.0625}, {1310,1009,0.0625}, {1310,1042,0.0625}, {1310,1129,0.0625},
+        {1310,1144,-0.125}, {1311,724,0.0625}, {1311,737,0.0625}, {1311,748,-0.125},
+        {1311,795,0.0625}, {1311,930,-0.125}, {1311,1035,0.125}, {1311,1070,0.0625},
+        {1312,577,-0.03125}, {1312,653,-0.03125}, {1312,658,0.03125}, {1312,661,0.03125},
+        {1312,672,0.015625}, {1312,675,0.015625}, {1312,688,0.03125}, {1312,778,-0.03125},
+        {1312,780,0.03125}, {1312,783,0.015625}, {1312,790,-0.03125}, {1312,813,0.015625},
+        {1312,875,0.03125}, {1312,895,-0.03125}, {1312,918,0.03125}, {1312,982,-0.03125},
+        {1312,988,-0.03125}, {1312,992,0.03125}, {1312,1000,0.015625}, {1312,1029,-0.03125},
+        {1312,1031,0.03125}, {1312,1036,0.015625}, {1312,1038,0.015625}, {1312,1089,0.015625},
+        {1313,585,0.03125}, {1313,597,-0.0625}, {1313,669,-0.0625}, {1313,679,0.0625},
+        {1313,765,0.015625}, {1313,901,0.03125}, {1313,943,0.0078125}, {1313,1003,0.03125},
+        {1313,1059,0.015625}, {1313,1060,0.015625}, {1313,1061,0.015625}, {1313,1065,-0.03125},
+        {1313,1151,0.0078125}, {1314,808,0.125}, {1314,908,-0.25}, {1314,1014,0.0625},
+        {1314,1076,0.0625}, {1314,1104,0.125}, {1315,592,-0.125}, {1315,613,0.0625},
+        {1315,694,0.0625}, {1315,709,0.0625}, {1315,798,-0.125}, {1315,860,0.03125},
+        {1315,897,0.0625}, {1315,1039,0.03125}, {1315,1046,0.03125}, {1315,1062,0.03125},
+        {1316,568,0.0625}, {1316,616,-0.03125}, {1316,657,-0.0625}, {1316,678,0.015625},
+        {1316,680,-0.03125}, {1316,683,0.03125}, {1316,699,0.03125}, {1316,701,0.015625},
+        {1316,707,0.03125}, {1316,718,0.015625}, {1316,740,-0.03125}, {1316,754,0.03125},
+        {1316,792,0.015625}, {1316,812,-0.0625}, {1316,835,-0.03125}, {1316,846,0.015625},
+        {1316,913,0.03125}, {1316,1018,0.03125}, {1316,1020,0.015625}, {1316,1086,0.015625},
+        {1316,1122,0.015625}, {1317,615,-0.25}, {1317,804,0.25}, {1317,1152,0.125},
+        {1318,939,0.25}, {1318,999,-0.25}, {1318,1141,0.125}, {1319,562,-0.125},
+        {1319,570,0.0625}, {1319,703,0.0625}, {1319,820,0.125}, {1319,834,-0.125},
+        {1319,851,0.0625}, {1319,940,0.0625}, {1320,617,-0.03125}, {1320,630,0.015625},
+        {1320,668,0.03125}, {1320,759,0.0625}, {1320,823,-0.0625}, {1320,922,0.015625},
+        {1320,924,-0.0625}, {1320,932,0.03125}, {1320,933,0.015625}, {1320,983,0.03125},
+        {1320,1053,0.03125}, {1321,579,0.0625}, {1321,587,-0.0625}, {1321,607,0.03125},
+        {1321,633,-0.0625}, {1321,634,-0.0625}, {1321,638,0.03125}, {1321,650,0.03125},
+        {1321,757,0.0625}, {1321,785,-0.0625}, {1321,802,0.03125}, {1321,848,0.03125},
+        {1321,858,0.03125}, {1321,891,0.03125}, {1321,960,0.03125}, {1322,560,0.0078125},
+        {1322,583,0.03125}, {1322,612,-0.015625}, {1322,621,0.0078125}, {1322,632,0.0078125},
+        {1322,645,-0.015625}, {1322,652,0.0078125}, {1322,670,0.00390625}, {1322,766,0.00390625},
+        {1322,787,-0.015625}, {1322,799,0.0078125}, {1322,839,0.03125}, {1322,847,0.00390625},
+        {1322,854,0.0078125}, {1322,856,0.03125}, {1322,863,0.0078125}, {1322,867,0.00390625},
+        {1322,871,-0.03125}, {1322,885,0.015625}, {1322,902,-0.015625}, {1322,914,0.00390625},
+        {1322,962,-0.0078125}, {1322,995,-0.015625}, {1322,1011,-0.015625}, {1322,1058,0.00390625},
+        {1322,1087,0.0078125}, {1322,1102,0.00390625}, {1322,1115,0.0078125}, {1322,1134,-0.0078125},
+        {1322,1136,0.00390625}, {1323,644,-0.0078125}, {1323,722,0.015625}, {1323,728,0.015625},
+        {1323,818,0.015625}, {1323,842,-0.015625}, {1323,855,0.03125}, {1323,926,-0.015625},
+        {1323,938,0.0078125}, {1323,949,-0.015625}, {1323,971,0.0078125}, {1323,977,-0.015625},
+        {1323,1002,-0.03125}, {1323,1012,0.015625}, {1323,1015,-0.015625}, {1323,1021,0.015625},
+        {1323,1024,0.015625}, {1323,1040,-0.015625}, {1323,1092,-0.015625}, {1323,1100,-0.0078125},
+        {1323,1118,0.015625}, {1324,575,0.0625}, {1324,619,0.03125}, {1324,623,0.03125},
+        {1324,655,0.0625}, {1324,731,-0.0625}, {1324,833,-0.0625}, {1324,929,-0.03125},
+        {1324,931,-0.03125}, {1324,966,-0.03125}, {1324,996,-0.03125}, {1324,1043,0.03125},
+        {1324,1103,0.03125}, {1325,564,-0.03125}, {1325,578,0.0625}, {1325,589,0.03125},
+        {1325,599,0.03125}, {1325,611,-0.0625}, {1325,761,-0.0625}, {1325,817,0.03125},
+        {1325,821,-0.03125}, {1325,837,0.03125}, {1325,840,0.0625}, {1325,1069,-0.03125},
+        {1325,1096,-0.03125}, {1326,717,-0.0625}, {1326,861,-0.0625}, {1326,882,0.0625},
+        {1326,986,0.03125}, {1326,1063,0.0625}, {1326,1082,-0.03125}, {1326,1135,-0.03125},
+        {1326,1137,0.03125}, {1327,586,-0.0625}, {1327,742,0.0625}, {1327,869,-0.0625},
+        {1327,873,0.0625}, {1327,878,0.0625}, {1327,894,-0.0625}, {1327,959,0.0625},
+        {1327,965,-0.0625}, {1328,663,0.0625}, {1328,745,-0.03125}, {1328,906,-0.0625},
+        {1328,956,0.03125}, {1329,654,0.03125}, {1329,697,0.03125}, {1329,741,0.03125},
+        {1329,876,-0.03125}, {1329,912,-0.03125}, {1329,944,0.0625}, {1329,955,0.03125},
+        {1329,1026,-0.0625}, {1329,1073,-0.03125}, {1329,1146,-0.03125}, {1330,646,0.0625},
+        {1330,762,-0.03125}, {1330,773,-0.03125}, {1330,827,0.03125}, {1330,844,-0.03125},
+        {1330,859,0.03125}, {1330,921,-0.0625}, {1330,935,-0.03125}, {1330,945,-0.0625},
+        {1330,1027,0.0625}, {1330,1099,0.03125}, {1330,1138,0.03125}, {1331,622,0.03125},
+        {1331,627,0.03125}, {1331,803,-0.03125}, {1331,826,-0.03125}, {1331,850,0.03125},
+        {1331,852,0.03125}, {1331,870,-0.03125}, {1331,886,-0.03125}, {1331,958,0.03125},
+        {1331,968,-0.03125}, {1331,1007,-0.03125}, {1331,1010,0.03125}, {1331,1025,0.03125},
+        {1331,1032,-0.03125}, {1331,1048,-0.03125}, {1331,1117,0.03125}, {1332,644,0.0078125},
+        {1332,722,0.015625}, {1332,728,0.015625}, {1332,818,0.015625}, {1332,842,-0.015625},
+        {1332,855,0.03125}, {1332,926,0.015625}, {1332,938,-0.0078125}, {1332,949,-0.015625},
+        {1332,971,-0.0078125}, {1332,977,-0.015625}, {1332,1002,-0.03125}, {1332,1012,-0.015625},
+        {1332,1015,0.015625}, {1332,1021,0.015625}, {1332,1024,-0.015625}, {1332,1040,-0.015625},
+        {1332,1092,0.015625}, {1332,1100,0.0078125}, {1332,1118,-0.015625}, {1333,581,0.03125},
+        {1333,593,0.03125}, {1333,598,-0.03125}, {1333,648,0.03125}, {1333,695,-0.03125},
+        {1333,708,-0.03125}, {1333,714,-0.03125}, {1333,736,-0.03125}, {1333,772,0.03125},
+        {1333,810,0.03125}, {1333,887,-0.03125}, {1333,904,-0.03125}, {1333,915,0.03125},
+        {1333,950,-0.03125}, {1333,970,0.03125}, {1333,1005,0.03125}, {1334,565,0.03125},
+        {1334,572,-0.03125}, {1334,588,-0.03125}, {1334,664,0.03125}, {1334,682,0.03125},
+        {1334,822,-0.03125}, {1335,565,0.03125}, {1335,572,-0.03125}, {1335,588,-0.03125},
+        {1335,664,0.03125}, {1335,682,0.03125}, {1335,822,-0.03125}, {1336,622,-0.03125},
+        {1336,627,-0.03125}, {1336,803,0.03125}, {1336,826,0.03125}, {1336,850,-0.03125},
+        {1336,852,-0.03125}, {1336,870,0.03125}, {1336,886,0.03125}, {1336,958,-0.03125},
+        {1336,968,0.03125}, {1336,1007,0.03125}, {1336,1010,-0.03125}, {1336,1025,-0.03125},
+        {1336,1032,0.03125}, {1336,1048,0.03125}, {1336,1117,-0.03125}, {1337,581,-0.03125},
+        {1337,593,-0.03125}, {1337,598,0.03125}, {1337,648,-0.03125}, {1337,695,0.03125},
+        {1337,708,0.03125}, {1337,714,0.03125}, {1337,736,0.03125}, {1337,772,-0.03125},
+        {1337,810,-0.03125}, {1337,887,0.03125}, {1337,904,0.03125}, {1337,915,-0.03125},
+        {1337,950,0.03125}, {1337,970,-0.03125}, {1337,1005,-0.03125}, {1338,654,0.03125},
+        {1338,697,0.03125}, {1338,741,0.03125}, {1338,876,-0.03125}, {1338,912,-0.03125},
+        {1338,944,0.0625}, {1338,955,0.03125}, {1338,1026,-0.0625}, {1338,1073,-0.03125},
+        {1338,1146,-0.03125}, {1339,646,0.0625}, {1339,762,-0.03125}, {1339,773,-0.03125},
+        {1339,827,0.03125}, {1339,844,-0.03125}, {1339,859,0.03125}, {1339,921,-0.0625},
+        {1339,935,-0.03125}, {1339,945,-0.0625}, {1339,1027,0.0625}, {1339,1099,0.03125},
+        {1339,1138,0.03125}, {1340,644,0.0078125}, {1340,722,0.015625}, {1340,728,0.015625},
+        {1340,818,0.015625}, {1340,842,-0.015625}, {1340,855,0.03125}, {1340,926,0.015625},
+        {1340,938,-0.0078125}, {1340,949,-0.015625}, {1340,971,-0.0078125}, {1340,977,-0.015625},
+        {1340,1002,-0.03125}, {1340,1012,-0.015625}, {1340,1015,0.015625}, {1340,1021,0.015625},
+        {1340,1024,-0.015625}, {1340,1040,-0.015625}, {1340,1092,0.015625}, {1340,1100,0.0078125},
+        {1340,1118,-0.015625}, {1341,608,0.0625}, {1341,644,0.0078125}, {1341,692,-0.0625},
+        {1341,722,0.015625}, {1341,728,0.015625}, {1341,760,0.0625}, {1341,818,-0.015625},
+        {1341,842,-0.015625}, {1341,855,0.03125}, {1341,883,-0.0625}, {1341,926,-0.015625},
+        {1341,938,-0.0078125}, {1341,949,0.015625}, {1341,971,-0.0078125}, {1341,977,0.015625},
+        {1341,1002,-0.03125}, {1341,1012,-0.015625}, {1341,1015,0.015625}, {1341,1021,-0.015625},
+        {1341,1024,0.015625}, {1341,1040,-0.015625}, {1341,1092,-0.015625}, {1341,1100,0.0078125},
+        {1341,1118,0.015625}, {1342,575,-0.0625}, {1342,580,-0.125}, {1342,604,0.0625},
+        {1342,619,0.03125}, {1342,623,-0.03125}, {1342,631,0.125}, {1342,647,-0.0625},
+        {1342,655,0.0625}, {1342,731,0.0625}, {1342,756,0.0625}, {1342,833,-0.0625},
+        {1342,841,-0.0625}, {1342,929,0.03125}, {1342,931,-0.03125}, {1342,966,0.03125},
+        {1342,996,-0.03125}, {1342,1043,-0.03125}, {1342,1103,0.03125}, {1343,646,0.0625},
+        {1343,673,0.0625}, {1343,755,-0.0625}, {1343,762,0.03125}, {1343,773,-0.03125},
+        {1343,774,0.0625}, {1343,779,-0.0625}, {1343,789,0.0625}, {1343,797,-0.0625},
+        {1343,827,0.03125}, {1343,844,-0.03125}, {1343,859,0.03125}, {1343,903,0.0625},
+        {1343,921,0.0625}, {1343,935,0.03125}, {1343,945,-0.0625}, {1343,1027,-0.0625},
+        {1343,1051,-0.0625}, {1343,1099,-0.03125}, {1343,1138,-0.03125}, {1344,684,-0.125},
+        {1344,717,-0.0625}, {1344,768,0.125}, {1344,861,-0.0625}, {1344,882,0.0625},
+        {1344,986,-0.03125}, {1344,1063,0.0625}, {1344,1082,0.03125}, {1344,1135,0.03125},
+        {1344,1137,-0.03125}, {1345,574,-0.125}, {1345,595,-0.0625}, {1345,689,0.125},
+        {1345,713,0.0625}, {1345,786,-0.125}, {1345,877,-0.0625}, {1345,947,0.125},
+        {1345,1074,-0.0625}, {1345,1085,-0.0625}, {1345,1105,0.0625}, {1345,1116,0.0625},
+        {1345,1133,0.0625}, {1346,654,-0.03125}, {1346,697,0.03125}, {1346,741,0.03125},
+        {1346,876,0.03125}, {1346,912,-0.03125}, {1346,944,0.0625}, {1346,955,-0.03125},
+        {1346,972,-0.0625}, {1346,1017,0.0625}, {1346,1026,-0.0625}, {1346,1049,0.0625},
+        {1346,1073,0.03125}, {1346,1110,-0.0625}, {1346,1146,-0.03125}, {1347,644,-0.0078125},
+        {1347,722,0.015625}, {1347,728,0.015625}, {1347,818,0.015625}, {1347,842,-0.015625},
+        {1347,855,0.03125}, {1347,926,-0.015625}, {1347,938,0.0078125}, {1347,949,-0.015625},
+        {1347,971,0.0078125}, {1347,977,-0.015625}, {1347,1002,-0.03125}, {1347,1012,0.015625},
+        {1347,1015,-0.015625}, {1347,1021,0.015625}, {1347,1024,0.015625}, {1347,1040,-0.015625},
+        {1347,1092,-0.015625}, {1347,1100,-0.0078125}, {1347,1118,0.015625}, {1348,564,-0.03125},
+        {1348,578,0.0625}, {1348,589,0.03125}, {1348,599,0.03125}, {1348,611,-0.0625},
+        {1348,761,-0.0625}, {1348,817,0.03125}, {1348,821,-0.03125}, {1348,837,0.03125},
+        {1348,840,0.0625}, {1348,1069,-0.03125}, {1348,1096,-0.03125}, {1349,575,-0.0625},
+        {1349,619,-0.03125}, {1349,623,-0.03125}, {1349,655,-0.0625}, {1349,731,0.0625},
+        {1349,833,0.0625}, {1349,929,0.03125}, {1349,931,0.03125}, {1349,966,0.03125},
+        {1349,996,0.03125}, {1349,1043,-0.03125}, {1349,1103,-0.03125}, {1350,663,0.0625},
+        {1350,745,-0.03125}, {1350,906,-0.0625}, {1350,956,0.03125}, {1351,586,0.0625},
+        {1351,742,-0.0625}, {1351,869,0.0625}, {1351,873,-0.0625}, {1351,878,-0.0625},
+        {1351,894,0.0625}, {1351,959,-0.0625}, {1351,965,0.0625}, {1352,565,0.0625},
+        {1352,572,-0.0625}, {1352,588,0.0625}, {1352,651,0.03125}, {1352,664,0.0625},
+        {1352,682,-0.0625}, {1352,764,0.0625}, {1352,822,-0.0625}, {1352,1041,-0.0625},
+        {1352,1047,-0.03125}, {1352,1050,0.03125}, {1352,1068,-0.03125}, {1353,717,-0.0625},
+        {1353,861,-0.0625}, {1353,882,0.0625}, {1353,986,0.03125}, {1353,1063,0.0625},
+        {1353,1082,-0.03125}, {1353,1135,-0.03125}, {1353,1137,0.03125}, {1354,663,0.125},
+        {1354,712,-0.0625}, {1354,745,0.0625}, {1354,900,-0.0625}, {1354,906,-0.125},
+        {1354,952,0.0625}, {1354,956,-0.0625}, {1354,1149,0.0625}, {1355,565,0.0625},
+        {1355,572,-0.0625}, {1355,588,0.0625}, {1355,651,-0.03125}, {1355,664,0.0625},
+        {1355,682,-0.0625}, {1355,764,-0.0625}, {1355,822,-0.0625}, {1355,1041,0.0625},
+        {1355,1047,0.03125}, {1355,1050,-0.03125}, {1355,1068,0.03125}, {1356,622,0.0625},
+        {1356,627,-0.0625}, {1356,803,0.0625}, {1356,826,-0.0625}, {1356,850,-0.0625},
+        {1356,852,-0.0625}, {1356,870,0.0625}, {1356,886,-0.0625}, {1356,958,0.0625},
+        {1356,968,0.0625}, {1356,1007,0.0625}, {1356,1010,-0.0625}, {1356,1025,0.0625},
+        {1356,1032,-0.0625}, {1356,1048,-0.0625}, {1356,1117,0.0625}, {1357,610,-0.125},
+        {1357,639,-0.125}, {1357,649,0.125}, {1357,656,-0.125}, {1357,696,0.125},
+        {1357,805,0.125}, {1357,843,-0.125}, {1357,1001,0.125}, {1358,606,-0.25},
+        {1358,691,0.25}, {1358,725,-0.25}, {1358,890,0.25}, {1359,594,-0.25},
+        {1359,614,0.25}, {1359,710,-0.25}, {1359,775,0.25}, {1360,581,-0.0625},
+        {1360,593,-0.0625}, {1360,598,0.0625}, {1360,648,-0.0625}, {1360,695,-0.0625},
+        {1360,708,-0.0625}, {1360,714,0.0625}, {1360,736,-0.0625}, {1360,772,0.0625},
+        {1360,810,0.0625}, {1360,887,-0.0625}, {1360,904,0.0625}, {1360,915,0.0625},
+        {1360,950,0.0625}, {1360,970,-0.0625}, {1360,1005,0.0625}, {1361,654,-0.03125},
+        {1361,697,0.03125}, {1361,741,0.03125}, {1361,876,0.03125}, {1361,912,-0.03125},
+        {1361,944,0.0625}, {1361,955,-0.03125}, {1361,972,0.0625}, {1361,1017,-0.0625},
+        {1361,1026,-0.0625}, {1361,1049,-0.0625}, {1361,1073,0.03125}, {1361,1110,0.0625},
+        {1361,1146,-0.03125}, {1362,574,0.125}, {1362,595,-0.0625}, {1362,689,0.125},
+        {1362,713,0.0625}, {1362,786,-0.125}, {1362,877,0.0625}, {1362,947,-0.125},
+        {1362,1074,0.0625}, {1362,1085,-0.0625}, {1362,1105,-0.0625}, {1362,1116,0.0625},
+        {1362,1133,-0.0625}, {1363,591,0.25}, {1363,601,-0.125}, {1363,660,-0.25},
+        {1363,667,0.125}, {1363,898,0.125}, {1363,1037,-0.125}, {1364,571,0.25},
+        {1364,732,-0.25}, {1364,770,-0.125}, {1364,832,0.125}, {1364,866,-0.125},
+        {1364,941,0.125}, {1365,646,0.0625}, {1365,673,-0.0625}, {1365,755,0.0625},
+        {1365,762,0.03125}, {1365,773,-0.03125}, {1365,774,-0.0625}, {1365,779,0.0625},
+        {1365,789,-0.0625}, {1365,797,0.0625}, {1365,827,0.03125}, {1365,844,-0.03125},
+        {1365,859,0.03125}, {1365,903,-0.0625}, {1365,921,0.0625}, {1365,935,0.03125},
+        {1365,945,-0.0625}, {1365,1027,-0.0625}, {1365,1051,0.0625}, {1365,1099,-0.03125},
+        {1365,1138,-0.03125}, {1366,684,0.125}, {1366,717,-0.0625}, {1366,768,-0.125},
+        {1366,861,-0.0625}, {1366,882,0.0625}, {1366,986,-0.03125}, {1366,1063,0.0625},
+        {1366,1082,0.03125}, {1366,1135,0.03125}, {1366,1137,-0.03125}, {1367,698,-0.25},
+        {1367,705,-0.25}, {1367,937,0.25}, {1367,976,0.25}, {1368,586,0.125},
+        {1368,742,0.125}, {1368,869,0.125}, {1368,873,-0.125}, {1368,878,-0.125},
+        {1368,894,-0.125}, {1368,959,0.125}, {1368,965,-0.125}, {1369,575,0.0625},
+        {1369,580,-0.125}, {1369,604,0.0625}, {1369,619,-0.03125}, {1369,623,0.03125},
+        {1369,631,0.125}, {1369,647,-0.0625}, {1369,655,-0.0625}, {1369,731,-0.0625},
+        {1369,756,0.0625}, {1369,833,0.0625}, {1369,841,-0.0625}, {1369,929,-0.03125},
+        {1369,931,0.03125}, {1369,966,-0.03125}, {1369,996,0.03125}, {1369,1043,0.03125},
+        {1369,1103,-0.03125}, {1370,609,-0.5}, {1370,665,0.5}, {1371,626,0.5},
+        {1371,911,-0.5}, {1372,600,0.25}, {1372,625,-0.125}, {1372,690,0.125},
+        {1372,743,-0.25}, {1372,801,0.125}, {1372,993,-0.125}, {1373,663,0.125},
+        {1373,712,0.0625}, {1373,745,0.0625}, {1373,900,0.0625}, {1373,906,-0.125},
+        {1373,952,-0.0625}, {1373,956,-0.0625}, {1373,1149,-0.0625}, {1374,564,-0.0625},
+        {1374,578,-0.125}, {1374,589,0.0625}, {1374,599,0.0625}, {1374,611,0.125},
+        {1374,761,-0.125}, {1374,817,-0.0625}, {1374,821,0.0625}, {1374,837,-0.0625},
+        {1374,840,0.125}, {1374,1069,-0.0625}, {1374,1096,0.0625}, {1375,608,-0.0625},
+        {1375,644,0.0078125}, {1375,692,0.0625}, {1375,722,0.015625}, {1375,728,0.015625},
+        {1375,760,-0.0625}, {1375,818,-0.015625}, {1375,842,-0.015625}, {1375,855,0.03125},
+        {1375,883,0.0625}, {1375,926,-0.015625}, {1375,938,-0.0078125}, {1375,949,0.015625},
+        {1375,971,-0.0078125}, {1375,977,0.015625}, {1375,1002,-0.03125}, {1375,1012,-0.015625},
+        {1375,1015,0.015625}, {1375,1021,-0.015625}, {1375,1024,0.015625}, {1375,1040,-0.015625},
+        {1375,1092,-0.015625}, {1375,1100,0.0078125}, {1375,1118,0.015625}, {1376,560,-0.03125},
+        {1376,621,0.03125}, {1376,632,-0.03125}, {1376,652,-0.03125}, {1376,670,-0.015625},
+        {1376,766,0.015625}, {1376,799,0.03125}, {1376,847,-0.015625}, {1376,854,-0.03125},
+        {1376,863,-0.03125}, {1376,867,0.015625}, {1376,885,0.0625}, {1376,914,0.015625},
+        {1376,1058,0.015625}, {1376,1087,-0.03125}, {1376,1102,0.015625}, {1376,1115,0.03125},
+        {1376,1136,-0.015625}, {1377,644,0.015625}, {1377,722,-0.03125}, {1377,728,-0.03125},
+        {1377,818,0.03125}, {1377,842,-0.03125}, {1377,855,0.0625}, {1377,926,-0.03125},
+        {1377,938,0.015625}, {1377,949,0.03125}, {1377,971,0.015625}, {1377,977,-0.03125},
+        {1377,1002,0.0625}, {1377,1012,-0.03125}, {1377,1015,-0.03125}, {1377,1021,-0.03125},
+        {1377,1024,-0.03125}, {1377,1040,-0.03125}, {1377,1092,0.03125}, {1377,1100,0.015625},
+        {1377,1118,0.03125}, {1378,579,0.0625}, {1378,607,0.03125}, {1378,638,-0.03125},
+        {1378,650,0.03125}, {1378,757,-0.0625}, {1378,802,0.03125}, {1378,848,-0.03125},
+        {1378,858,-0.03125}, {1378,891,-0.03125}, {1378,960,0.03125}, {1379,564,-0.03125},
+        {1379,578,-0.0625}, {1379,589,-0.03125}, {1379,599,-0.03125}, {1379,611,-0.0625},
+        {1379,761,0.0625}, {1379,817,0.03125}, {1379,821,0.03125}, {1379,837,0.03125},
+        {1379,840,0.0625}, {1379,1069,-0.03125}, {1379,1096,0.03125}, {1380,678,0.03125},
+        {1380,699,0.0625}, {1380,701,0.03125}, {1380,718,-0.03125}, {1380,754,-0.0625},
+        {1380,792,0.03125}, {1380,846,-0.03125}, {1380,1020,-0.03125}, {1380,1086,0.03125},
+        {1380,1122,-0.03125}, {1381,575,-0.0625}, {1381,619,-0.03125}, {1381,623,0.03125},
+        {1381,655,0.0625}, {1381,731,-0.0625}, {1381,833,0.0625}, {1381,929,0.03125},
+        {1381,931,-0.03125}, {1381,966,0.03125}, {1381,996,-0.03125}, {1381,1043,0.03125},
+        {1381,1103,-0.03125}, {1382,678,-0.03125}, {1382,699,-0.0625}, {1382,701,-0.03125},
+        {1382,718,0.03125}, {1382,754,0.0625}, {1382,792,-0.03125}, {1382,846,0.03125},
+        {1382,1020,0.03125}, {1382,1086,-0.03125}, {1382,1122,0.03125}, {1383,575,0.0625},
+        {1383,619,0.03125}, {1383,623,-0.03125}, {1383,655,-0.0625}, {1383,731,0.0625},
+        {1383,833,-0.0625}, {1383,929,-0.03125}, {1383,931,0.03125}, {1383,966,-0.03125},
+        {1383,996,0.03125}, {1383,1043,-0.03125}, {1383,1103,0.03125}, {1384,613,-0.0625},
+        {1384,694,-0.0625}, {1384,709,0.0625}, {1384,860,-0.03125}, {1384,897,0.0625},
+        {1384,1039,-0.03125}, {1384,1046,0.03125}, {1384,1062,0.03125}, {1385,586,0.0625},
+        {1385,742,-0.0625}, {1385,869,-0.0625}, {1385,873,0.0625}, {1385,878,-0.0625},
+        {1385,894,0.0625}, {1385,959,0.0625}, {1385,965,-0.0625}, {1386,765,-0.0625},
+        {1386,901,0.125}, {1386,943,0.03125}, {1386,1003,-0.125}, {1386,1059,-0.0625},
+        {1386,1060,0.0625}, {1386,1061,0.0625}, {1386,1151,-0.03125}, {1387,717,0.125},
+        {1387,861,-0.125}, {1387,882,-0.125}, {1387,986,-0.0625}, {1387,1063,0.125},
+        {1387,1082,-0.0625}, {1387,1135,0.0625}, {1387,1137,0.0625}, {1388,579,0.0625},
+        {1388,607,0.03125}, {1388,638,-0.03125}, {1388,650,0.03125}, {1388,757,-0.0625},
+        {1388,802,0.03125}, {1388,848,-0.03125}, {1388,858,-0.03125}, {1388,891,-0.03125},
+        {1388,960,0.03125}, {1389,564,-0.03125}, {1389,578,-0.0625}, {1389,589,-0.03125},
+        {1389,599,-0.03125}, {1389,611,-0.0625}, {1389,761,0.0625}, {1389,817,0.03125},
+        {1389,821,0.03125}, {1389,837,0.03125}, {1389,840,0.0625}, {1389,1069,-0.03125},
+        {1389,1096,0.03125}, {1390,922,-0.03125}, {1390,933,0.03125}, {1390,983,-0.0625},
+        {1390,1053,0.0625}, {1391,712,-0.0625}, {1391,900,0.0625}, {1391,952,0.0625},
+        {1391,1149,-0.0625}, {1392,613,0.0625}, {1392,694,0.0625}, {1392,709,-0.0625},
+        {1392,860,0.03125}, {1392,897,-0.0625}, {1392,1039,0.03125}, {1392,1046,-0.03125},
+        {1392,1062,-0.03125}, {1393,586,-0.0625}, {1393,742,0.0625}, {1393,869,0.0625},
+        {1393,873,-0.0625}, {1393,878,0.0625}, {1393,894,-0.0625}, {1393,959,-0.0625},
+        {1393,965,0.0625}, {1394,677,0.03125}, {1394,711,-0.03125}, {1394,739,-0.03125},
+        {1394,758,0.03125}, {1394,807,0.03125}, {1394,868,-0.03125}, {1394,1008,0.03125},
+        {1394,1023,0.03125}, {1394,1044,-0.03125}, {1394,1075,-0.03125}, {1394,1091,-0.03125},
+        {1394,1150,0.03125}, {1395,622,-0.03125}, {1395,627,0.03125}, {1395,803,0.03125},
+        {1395,826,-0.03125}, {1395,850,-0.03125}, {1395,852,0.03125}, {1395,870,-0.03125},
+        {1395,886,0.03125}, {1395,958,0.03125}, {1395,968,-0.03125}, {1395,1007,0.03125},
+        {1395,1010,-0.03125}, {1395,1025,0.03125}, {1395,1032,-0.03125}, {1395,1048,0.03125},
+        {1395,1117,-0.03125}, {1396,681,0.0625}, {1396,704,-0.0625}, {1396,974,-0.0625},
+        {1396,1034,-0.0625}, {1396,1123,0.0625}, {1396,1128,-0.0625}, {1396,1132,0.03125},
+        {1396,1142,-0.03125}, {1396,1143,0.125}, {1397,654,0.0625}, {1397,697,-0.0625},
+        {1397,741,-0.0625}, {1397,876,-0.0625}, {1397,912,-0.0625}, {1397,944,0.125},
+        {1397,955,-0.0625}, {1397,1026,0.125}, {1397,1073,0.0625}, {1397,1146,-0.0625},
+        {1398,661,-0.0625}, {1398,672,-0.03125}, {1398,675,-0.03125}, {1398,783,0.03125},
+        {1398,813,-0.03125}, {1398,875,0.0625}, {1398,1000,-0.03125}, {1398,1036,0.03125},
+        {1398,1038,0.03125}, {1398,1089,0.03125}, {1399,646,0.0625}, {1399,762,0.03125},
+        {1399,773,-0.03125}, {1399,827,-0.03125}, {1399,844,-0.03125}, {1399,859,-0.03125},
+        {1399,921,-0.0625}, {1399,935,0.03125}, {1399,945,0.0625}, {1399,1027,-0.0625},
+        {1399,1099,0.03125}, {1399,1138,0.03125}, {1400,576,0.03125}, {1400,618,0.03125},
+        {1400,659,-0.03125}, {1400,721,0.03125}, {1400,744,-0.03125}, {1400,794,-0.03125},
+        {1400,806,0.03125}, {1400,824,0.03125}, {1400,864,0.03125}, {1400,896,-0.03125},
+        {1400,909,-0.03125}, {1400,994,-0.03125}, {1401,581,0.03125}, {1401,593,0.03125},
+        {1401,598,-0.03125}, {1401,648,-0.03125}, {1401,695,-0.03125}, {1401,708,0.03125},
+        {1401,714,0.03125}, {1401,736,0.03125}, {1401,772,0.03125}, {1401,810,-0.03125},
+        {1401,887,-0.03125}, {1401,904,-0.03125}, {1401,915,-0.03125}, {1401,950,0.03125},
+        {1401,970,-0.03125}, {1401,1005,0.03125}, {1402,661,-0.0625}, {1402,672,-0.03125},
+        {1402,675,-0.03125}, {1402,783,0.03125}, {1402,813,-0.03125}, {1402,875,0.0625},
+        {1402,1000,-0.03125}, {1402,1036,0.03125}, {1402,1038,0.03125}, {1402,1089,0.03125},
+        {1403,646,0.0625}, {1403,762,0.03125}, {1403,773,-0.03125}, {1403,827,-0.03125},
+        {1403,844,-0.03125}, {1403,859,-0.03125}, {1403,921,-0.0625}, {1403,935,0.03125},
+        {1403,945,0.0625}, {1403,1027,-0.0625}, {1403,1099,0.03125}, {1403,1138,0.03125},
+        {1404,560,0.03125}, {1404,621,0.03125}, {1404,632,-0.03125}, {1404,652,-0.03125},
+        {1404,670,0.015625}, {1404,766,-0.015625}, {1404,799,0.03125}, {1404,847,0.015625},
+        {1404,854,0.03125}, {1404,863,-0.03125}, {1404,867,-0.015625}, {1404,885,0.0625},
+        {1404,914,-0.015625}, {1404,1058,0.015625}, {1404,1087,-0.03125}, {1404,1102,-0.015625},
+        {1404,1115,-0.03125}, {1404,1136,-0.015625}, {1405,644,-0.015625}, {1405,722,-0.03125},
+        {1405,728,-0.03125}, {1405,818,0.03125}, {1405,842,-0.03125}, {1405,855,0.0625},
+        {1405,926,0.03125}, {1405,938,-0.015625}, {1405,949,0.03125}, {1405,971,-0.015625},
+        {1405,977,-0.03125}, {1405,1002,0.0625}, {1405,1012,0.03125}, {1405,1015,0.03125},
+        {1405,1021,-0.03125}, {1405,1024,0.03125}, {1405,1040,-0.03125}, {1405,1092,-0.03125},
+        {1405,1100,-0.015625}, {1405,1118,-0.03125}, {1406,777,-0.0625}, {1406,1045,0.03125},
+        {1406,1081,-0.03125}, {1406,1090,0.03125}, {1406,1112,0.03125}, {1407,651,0.03125},
+        {1407,764,-0.0625}, {1407,1041,-0.0625}, {1407,1047,0.03125}, {1407,1050,0.03125},
+        {1407,1068,0.03125}, {1408,677,-0.03125}, {1408,711,0.03125}, {1408,739,0.03125},
+        {1408,758,-0.03125}, {1408,807,-0.03125}, {1408,868,0.03125}, {1408,1008,-0.03125},
+        {1408,1023,-0.03125}, {1408,1044,0.03125}, {1408,1075,0.03125}, {1408,1091,0.03125},
+        {1408,1150,-0.03125}, {1409,622,0.03125}, {1409,627,-0.03125}, {1409,803,-0.03125},
+        {1409,826,0.03125}, {1409,850,0.03125}, {1409,852,-0.03125}, {1409,870,0.03125},
+        {1409,886,-0.03125}, {1409,958,-0.03125}, {1409,968,0.03125}, {1409,1007,-0.03125},
+        {1409,1010,0.03125}, {1409,1025,-0.03125}, {1409,1032,0.03125}, {1409,1048,-0.03125},
+        {1409,1117,0.03125}, {1410,576,-0.03125}, {1410,618,-0.03125}, {1410,659,0.03125},
+        {1410,721,-0.03125}, {1410,744,0.03125}, {1410,794,0.03125}, {1410,806,-0.03125},
+        {1410,824,-0.03125}, {1410,864,-0.03125}, {1410,896,0.03125}, {1410,909,0.03125},
+        {1410,994,0.03125}, {1411,581,-0.03125}, {1411,593,-0.03125}, {1411,598,0.03125},
+        {1411,648,0.03125}, {1411,695,0.03125}, {1411,708,-0.03125}, {1411,714,-0.03125},
+        {1411,736,-0.03125}, {1411,772,-0.03125}, {1411,810,0.03125}, {1411,887,0.03125},
+        {1411,904,0.03125}, {1411,915,0.03125}, {1411,950,-0.03125}, {1411,970,0.03125},
+        {1411,1005,-0.03125}, {1412,576,-0.0625}, {1412,618,0.0625}, {1412,659,0.0625},
+        {1412,721,-0.0625}, {1412,744,-0.0625}, {1412,794,-0.0625}, {1412,806,0.0625},
+        {1412,824,-0.0625}, {1412,864,0.0625}, {1412,896,0.0625}, {1412,909,0.0625},
+        {1412,994,-0.0625}, {1413,581,0.0625}, {1413,593,0.0625}, {1413,598,-0.0625},
+        {1413,648,-0.0625}, {1413,695,0.0625}, {1413,708,-0.0625}, {1413,714,0.0625},
+        {1413,736,-0.0625}, {1413,772,-0.0625}, {1413,810,0.0625}, {1413,887,0.0625},
+        {1413,904,-0.0625}, {1413,915,0.0625}, {1413,950,0.0625}, {1413,970,-0.0625},
+        {1413,1005,-0.0625}, {1414,658,-0.0625}, {1414,661,0.0625}, {1414,672,-0.03125},
+        {1414,675,0.03125}, {1414,688,0.0625}, {1414,780,0.0625}, {1414,783,-0.03125},
+        {1414,813,-0.03125}, {1414,875,0.0625}, {1414,918,-0.0625}, {1414,992,-0.0625},
+        {1414,1000,-0.03125}, {1414,1031,0.0625}, {1414,1036,-0.03125}, {1414,1038,0.03125},
+        {1414,1089,-0.03125}, {1415,646,0.0625}, {1415,673,0.0625}, {1415,755,0.0625},
+        {1415,762,-0.03125}, {1415,773,-0.03125}, {1415,774,0.0625}, {1415,779,-0.0625},
+        {1415,789,-0.0625}, {1415,797,-0.0625}, {1415,827,-0.03125}, {1415,844,-0.03125},
+        {1415,859,-0.03125}, {1415,903,-0.0625}, {1415,921,0.0625}, {1415,935,-0.03125},
+        {1415,945,0.0625}, {1415,1027,0.0625}, {1415,1051,0.0625}, {1415,1099,-0.03125},
+        {1415,1138,-0.03125}, {1416,568,0.125}, {1416,678,-0.03125}, {1416,683,-0.0625},
+        {1416,699,0.0625}, {1416,701,-0.03125}, {1416,707,-0.0625}, {1416,718,-0.03125},
+        {1416,754,0.0625}, {1416,792,0.03125}, {1416,846,-0.03125}, {1416,913,-0.0625},
+        {1416,1018,0.0625}, {1416,1020,-0.03125}, {1416,1086,-0.03125}, {1416,1122,0.03125},
+        {1417,575,0.0625}, {1417,580,0.125}, {1417,604,-0.0625}, {1417,619,-0.03125},
+        {1417,623,-0.03125}, {1417,631,0.125}, {1417,647,-0.0625}, {1417,655,0.0625},
+        {1417,731,0.0625}, {1417,756,-0.0625}, {1417,833,0.0625}, {1417,841,-0.0625},
+        {1417,929,-0.03125}, {1417,931,-0.03125}, {1417,966,-0.03125}, {1417,996,-0.03125},
+        {1417,1043,-0.03125}, {1417,1103,-0.03125}, {1418,570,-0.125}, {1418,703,0.125},
+        {1418,820,0.25}, {1418,851,-0.125}, {1418,940,-0.125}, {1419,600,0.25},
+        {1419,625,-0.125}, {1419,690,-0.125}, {1419,743,0.25}, {1419,801,-0.125},
+        {1419,993,-0.125}, {1420,579,0.125}, {1420,607,-0.0625}, {1420,638,-0.0625},
+        {1420,650,-0.0625}, {1420,757,0.125}, {1420,802,0.0625}, {1420,848,0.0625},
+        {1420,858,-0.0625}, {1420,891,-0.0625}, {1420,960,-0.0625}, {1421,564,-0.0625},
+        {1421,578,0.125}, {1421,589,-0.0625}, {1421,599,-0.0625}, {1421,611,0.125},
+        {1421,761,0.125}, {1421,817,-0.0625}, {1421,821,-0.0625}, {1421,837,-0.0625},
+        {1421,840,0.125}, {1421,1069,-0.0625}, {1421,1096,-0.0625}, {1422,560,0.03125},
+        {1422,621,-0.03125}, {1422,632,-0.03125}, {1422,652,-0.03125}, {1422,670,-0.015625},
+        {1422,766,-0.015625}, {1422,799,0.03125}, {1422,847,0.015625}, {1422,854,-0.03125},
+        {1422,863,0.03125}, {1422,867,0.015625}, {1422,885,0.0625}, {1422,914,-0.015625},
+        {1422,1058,-0.015625}, {1422,1087,-0.03125}, {1422,1102,-0.015625}, {1422,1115,0.03125},
+        {1422,1136,0.015625}, {1423,644,-0.015625}, {1423,722,-0.03125}, {1423,728,-0.03125},
+        {1423,818,-0.03125}, {1423,842,-0.03125}, {1423,855,0.0625}, {1423,926,-0.03125},
+        {1423,938,-0.015625}, {1423,949,-0.03125}, {1423,971,-0.015625}, {1423,977,0.03125},
+        {1423,1002,0.0625}, {1423,1012,0.03125}, {1423,1015,0.03125}, {1423,1021,0.03125},
+        {1423,1024,-0.03125}, {1423,1040,-0.03125}, {1423,1092,0.03125}, {1423,1100,-0.015625},
+        {1423,1118,0.03125}, {1424,563,0.125}, {1424,624,-0.125}, {1424,636,0.125},
+        {1424,791,-0.125}, {1424,815,-0.125}, {1424,919,0.125}, {1425,610,-0.125},
+        {1425,639,-0.125}, {1425,649,0.125}, {1425,656,0.125}, {1425,696,0.125},
+        {1425,805,-0.125}, {1425,843,0.125}, {1425,1001,-0.125}, {1426,686,0.0625},
+        {1426,730,-0.0625}, {1426,830,0.125}, {1426,857,0.0625}, {1426,865,-0.125},
+        {1426,948,-0.0625}, {1426,967,-0.0625}, {1426,980,0.0625}, {1426,1106,-0.0625},
+        {1426,1114,0.0625}, {1427,574,-0.125}, {1427,595,-0.0625}, {1427,689,0.125},
+        {1427,713,-0.0625}, {1427,786,0.125}, {1427,877,0.0625}, {1427,947,-0.125},
+        {1427,1074,0.0625}, {1427,1085,-0.0625}, {1427,1105,0.0625}, {1427,1116,-0.0625},
+        {1427,1133,0.0625}, {1428,765,0.0625}, {1428,901,0.125}, {1428,943,-0.03125},
+        {1428,1003,-0.125}, {1428,1059,-0.0625}, {1428,1060,-0.0625}, {1428,1061,0.0625},
+        {1428,1151,0.03125}, {1429,717,0.125}, {1429,861,-0.125}, {1429,882,-0.125},
+        {1429,986,0.0625}, {1429,1063,0.125}, {1429,1082,0.0625}, {1429,1135,-0.0625},
+        {1429,1137,-0.0625}, {1430,808,-0.25}, {1430,1014,0.125}, {1430,1076,-0.125},
+        {1430,1104,0.25}, {1431,698,0.25}, {1431,705,-0.25}, {1431,937,-0.25},
+        {1431,976,0.25}, {1432,613,0.125}, {1432,694,-0.125}, {1432,709,0.125},
+        {1432,860,-0.0625}, {1432,897,-0.125}, {1432,1039,0.0625}, {1432,1046,-0.0625},
+        {1432,1062,0.0625}, {1433,586,0.125}, {1433,742,0.125}, {1433,869,-0.125},
+        {1433,873,0.125}, {1433,878,-0.125}, {1433,894,-0.125}, {1433,959,-0.125},
+        {1433,965,0.125}, {1434,568,0.125}, {1434,678,0.03125}, {1434,683,-0.0625},
+        {1434,699,-0.0625}, {1434,701,0.03125}, {1434,707,-0.0625}, {1434,718,0.03125},
+        {1434,754,-0.0625}, {1434,792,-0.03125}, {1434,846,0.03125}, {1434,913,-0.0625},
+        {1434,1018,0.0625}, {1434,1020,0.03125}, {1434,1086,0.03125}, {1434,1122,-0.03125},
+        {1435,575,-0.0625}, {1435,580,0.125}, {1435,604,-0.0625}, {1435,619,0.03125},
+        {1435,623,0.03125}, {1435,631,0.125}, {1435,647,-0.0625}, {1435,655,-0.0625},
+        {1435,731,-0.0625}, {1435,756,-0.0625}, {1435,833,-0.0625}, {1435,841,-0.0625},
+        {1435,929,0.03125}, {1435,931,0.03125}, {1435,966,0.03125}, {1435,996,0.03125},
+        {1435,1043,0.03125}, {1435,1103,0.03125}, {1436,677,-0.0625}, {1436,711,0.0625},
+        {1436,739,-0.0625}, {1436,758,-0.0625}, {1436,807,0.0625}, {1436,868,-0.0625},
+        {1436,1008,0.0625}, {1436,1023,0.0625}, {1436,1044,0.0625}, {1436,1075,0.0625},
+        {1436,1091,-0.0625}, {1436,1150,-0.0625}, {1437,622,0.0625}, {1437,627,0.0625},
+        {1437,803,0.0625}, {1437,826,0.0625}, {1437,850,-0.0625}, {1437,852,0.0625},
+        {1437,870,-0.0625}, {1437,886,-0.0625}, {1437,958,-0.0625}, {1437,968,-0.0625},
+        {1437,1007,0.0625}, {1437,1010,-0.0625}, {1437,1025,-0.0625}, {1437,1032,0.0625},
+        {1437,1048,-0.0625}, {1437,1117,0.0625}, {1438,681,0.0625}, {1438,704,-0.0625},
+        {1438,974,-0.0625}, {1438,1034,-0.0625}, {1438,1123,-0.0625}, {1438,1128,0.0625},
+        {1438,1132,-0.03125}, {1438,1142,0.03125}, {1438,1143,0.125}, {1439,654,-0.0625},
+        {1439,697,-0.0625}, {1439,741,-0.0625}, {1439,876,0.0625}, {1439,912,-0.0625},
+        {1439,944,0.125}, {1439,955,0.0625}, {1439,1026,0.125}, {1439,1073,-0.0625},
+        {1439,1146,-0.0625}, {1440,686,-0.0625}, {1440,730,-0.0625}, {1440,830,0.125},
+        {1440,857,-0.0625}, {1440,865,0.125}, {1440,948,-0.0625}, {1440,967,-0.0625},
+        {1440,980,-0.0625}, {1440,1106,0.0625}, {1440,1114,0.0625}, {1441,574,0.125},
+        {1441,595,-0.0625}, {1441,689,0.125}, {1441,713,-0.0625}, {1441,786,0.125},
+        {1441,877,-0.0625}, {1441,947,0.125}, {1441,1074,-0.0625}, {1441,1085,-0.0625},
+        {1441,1105,-0.0625}, {1441,1116,-0.0625}, {1441,1133,-0.0625}, {1442,819,0.25},
+        {1442,907,0.125}, {1442,1009,-0.125}, {1442,1042,-0.125}, {1442,1129,-0.125},
+        {1443,591,0.25}, {1443,601,-0.125}, {1443,660,0.25}, {1443,667,-0.125},
+        {1443,898,-0.125}, {1443,1037,-0.125}, {1444,724,-0.125}, {1444,737,-0.125},
+        {1444,795,0.125}, {1444,1035,0.25}, {1444,1070,-0.125}, {1445,571,0.25},
+        {1445,732,0.25}, {1445,770,-0.125}, {1445,832,-0.125}, {1445,866,-0.125},
+        {1445,941,-0.125}, {1446,658,0.0625}, {1446,661,0.0625}, {1446,672,-0.03125},
+        {1446,675,0.03125}, {1446,688,-0.0625}, {1446,780,-0.0625}, {1446,783,-0.03125},
+        {1446,813,-0.03125}, {1446,875,0.0625}, {1446,918,0.0625}, {1446,992,0.0625},
+        {1446,1000,-0.03125}, {1446,1031,-0.0625}, {1446,1036,-0.03125}, {1446,1038,0.03125},
+        {1446,1089,-0.03125}, {1447,646,0.0625}, {1447,673,-0.0625}, {1447,755,-0.0625},
+        {1447,762,-0.03125}, {1447,773,-0.03125}, {1447,774,-0.0625}, {1447,779,0.0625},
+        {1447,789,0.0625}, {1447,797,0.0625}, {1447,827,-0.03125}, {1447,844,-0.03125},
+        {1447,859,-0.03125}, {1447,903,0.0625}, {1447,921,0.0625}, {1447,935,-0.03125},
+        {1447,945,0.0625}, {1447,1027,0.0625}, {1447,1051,-0.0625}, {1447,1099,-0.03125},
+        {1447,1138,-0.03125}, {1448,637,-0.015625}, {1448,751,-0.015625}, {1448,879,-0.03125},
+        {1448,888,0.03125}, {1448,892,-0.015625}, {1448,963,0.015625}, {1448,978,0.03125},
+        {1448,981,0.015625}, {1448,1057,-0.015625}, {1448,1080,0.015625}, {1448,1098,-0.015625},
+        {1448,1120,0.015625}, {1449,811,0.0625}, {1449,910,-0.0625}, {1449,957,-0.0625},
+        {1449,1054,-0.0625}, {1449,1066,0.0625}, {1449,1093,0.0625}, {1450,582,0.0625},
+        {1450,629,-0.0625}, {1450,776,0.0625}, {1450,781,0.0625}, {1450,927,-0.0625},
+        {1450,998,-0.0625}, {1451,828,0.0625}, {1451,1006,-0.03125}, {1451,1119,-0.0625},
+        {1451,1130,0.0625}, {1451,1139,-0.03125}, {1451,1148,0.03125}, {1452,640,0.0625},
+        {1452,784,-0.0625}, {1452,1004,-0.0625}, {1452,1022,-0.0625}, {1452,1052,0.0625},
+        {1452,1113,0.0625}, {1453,788,-0.03125}, {1453,825,-0.03125}, {1453,942,0.0625},
+        {1453,1084,0.015625}, {1454,723,0.0625}, {1454,726,-0.0625}, {1454,849,-0.03125},
+        {1454,925,-0.03125}, {1454,1078,0.0625}, {1454,1127,0.03125}, {1455,561,-0.0625},
+        {1455,590,-0.0625}, {1455,793,0.0625}, {1455,1033,-0.0625}, {1455,1077,0.0625},
+        {1455,1088,0.0625}, {1456,603,0.0625}, {1456,796,-0.0625}, {1456,845,-0.0625},
+        {1456,1095,0.0625}, {1456,1108,0.0625}, {1456,1140,-0.0625}, {1457,637,0.015625},
+        {1457,751,0.015625}, {1457,879,-0.03125}, {1457,888,0.03125}, {1457,892,-0.015625},
+        {1457,963,-0.015625}, {1457,978,0.03125}, {1457,981,-0.015625}, {1457,1057,0.015625},
+        {1457,1080,0.015625}, {1457,1098,-0.015625}, {1457,1120,-0.015625}, {1458,620,-0.0625},
+        {1458,662,0.0625}, {1458,666,-0.0625}, {1458,706,0.0625}, {1458,800,0.0625},
+        {1458,997,-0.0625}, {1459,838,0.0625}, {1459,905,-0.03125}, {1459,984,-0.03125},
+        {1459,1145,0.015625}, {1460,838,0.0625}, {1460,905,-0.03125}, {1460,984,-0.03125},
+        {1460,1145,0.015625}, {1461,603,-0.0625}, {1461,796,0.0625}, {1461,845,0.0625},
+        {1461,1095,-0.0625}, {1461,1108,-0.0625}, {1461,1140,0.0625}, {1462,620,0.0625},
+        {1462,662,-0.0625}, {1462,666,0.0625}, {1462,706,-0.0625}, {1462,800,-0.0625},
+        {1462,997,0.0625}, {1463,723,0.0625}, {1463,726,-0.0625}, {1463,849,-0.03125},
+        {1463,925,-0.03125}, {1463,1078,0.0625}, {1463,1127,0.03125}, {1464,561,-0.0625},
+        {1464,590,-0.0625}, {1464,793,0.0625}, {1464,1033,-0.0625}, {1464,1077,0.0625},
+        {1464,1088,0.0625}, {1465,637,0.015625}, {1465,751,0.015625}, {1465,879,-0.03125},
+        {1465,888,0.03125}, {1465,892,-0.015625}, {1465,963,-0.015625}, {1465,978,0.03125},
+        {1465,981,-0.015625}, {1465,1057,0.015625}, {1465,1080,0.015625}, {1465,1098,-0.015625},
+        {1465,1120,-0.015625}, {1466,637,-0.015625}, {1466,674,0.0625}, {1466,751,0.015625},
+        {1466,809,-0.125}, {1466,879,-0.03125}, {1466,888,0.03125}, {1466,892,0.015625},
+        {1466,963,0.015625}, {1466,978,0.03125}, {1466,981,0.015625}, {1466,1057,0.015625},
+        {1466,1080,-0.015625}, {1466,1098,0.015625}, {1466,1120,-0.015625}, {1467,602,-0.125},
+        {1467,771,0.125}, {1467,811,-0.0625}, {1467,910,-0.0625}, {1467,957,-0.0625},
+        {1467,987,0.125}, {1467,1054,0.0625}, {1467,1066,0.0625}, {1467,1093,-0.0625},
+        {1468,561,0.0625}, {1468,590,0.0625}, {1468,716,-0.125}, {1468,735,0.125},
+        {1468,746,-0.125}, {1468,793,-0.0625}, {1468,1033,-0.0625}, {1468,1077,0.0625},
+        {1468,1088,0.0625}, {1469,749,-0.125}, {1469,828,0.0625}, {1469,1006,0.03125},
+        {1469,1072,0.0625}, {1469,1119,-0.0625}, {1469,1130,0.0625}, {1469,1139,0.03125},
+        {1469,1148,-0.03125}, {1470,733,-0.125}, {1470,763,0.125}, {1470,829,0.125},
+        {1470,1028,0.125}, {1470,1064,-0.125}, {1470,1109,-0.125}, {1471,723,0.0625},
+        {1471,726,-0.0625}, {1471,750,-0.125}, {1471,849,0.03125}, {1471,925,0.03125},
+        {1471,1078,0.0625}, {1471,1125,0.0625}, {1471,1127,-0.03125}, {1472,637,-0.015625},
+        {1472,751,-0.015625}, {1472,879,-0.03125}, {1472,888,0.03125}, {1472,892,-0.015625},
+        {1472,963,0.015625}, {1472,978,0.03125}, {1472,981,0.015625}, {1472,1057,-0.015625},
+        {1472,1080,0.015625}, {1472,1098,-0.015625}, {1472,1120,0.015625}, {1473,582,0.0625},
+        {1473,629,-0.0625}, {1473,776,0.0625}, {1473,781,0.0625}, {1473,927,-0.0625},
+        {1473,998,-0.0625}, {1474,811,-0.0625}, {1474,910,0.0625}, {1474,957,0.0625},
+        {1474,1054,0.0625}, {1474,1066,-0.0625}, {1474,1093,-0.0625}, {1475,788,-0.03125},
+        {1475,825,-0.03125}, {1475,942,0.0625}, {1475,1084,0.015625}, {1476,640,-0.0625},
+        {1476,784,0.0625}, {1476,1004,0.0625}, {1476,1022,0.0625}, {1476,1052,-0.0625},
+        {1476,1113,-0.0625}, {1477,838,0.125}, {1477,905,0.0625}, {1477,975,-0.0625},
+        {1477,984,-0.0625}, {1477,1013,-0.0625}, {1477,1101,0.0625}, {1477,1145,-0.03125},
+        {1478,828,0.0625}, {1478,1006,-0.03125}, {1478,1119,-0.0625}, {1478,1130,0.0625},
+        {1478,1139,-0.03125}, {1478,1148,0.03125}, {1479,788,0.0625}, {1479,825,-0.0625},
+        {1479,917,0.0625}, {1479,942,0.125}, {1479,985,-0.0625}, {1479,1084,-0.03125},
+        {1479,1126,-0.0625}, {1480,838,0.125}, {1480,905,0.0625}, {1480,975,0.0625},
+        {1480,984,-0.0625}, {1480,1013,0.0625}, {1480,1101,-0.0625}, {1480,1145,-0.03125},
+        {1481,603,0.125}, {1481,796,0.125}, {1481,845,-0.125}, {1481,1095,-0.125},
+        {1481,1108,0.125}, {1481,1140,0.125}, {1482,643,0.25}, {1482,738,0.25},
+        {1482,752,-0.25}, {1483,635,0.5}, {1483,884,-0.25}, {1484,685,0.5},
+        {1484,990,-0.25}, {1485,620,0.125}, {1485,662,0.125}, {1485,666,0.125},
+        {1485,706,-0.125}, {1485,800,0.125}, {1485,997,-0.125}, {1486,723,0.0625},
+        {1486,726,-0.0625}, {1486,750,0.125}, {1486,849,0.03125}, {1486,925,0.03125},
+        {1486,1078,0.0625}, {1486,1125,-0.0625}, {1486,1127,-0.03125}, {1487,733,0.125},
+        {1487,763,-0.125}, {1487,829,0.125}, {1487,1028,0.125}, {1487,1064,-0.125},
+        {1487,1109,0.125}, {1488,928,0.25}, {1488,1056,-0.25}, {1488,1094,0.25},
+        {1489,567,-0.25}, {1489,923,0.25}, {1489,953,0.25}, {1490,561,0.0625},
+        {1490,590,0.0625}, {1490,716,0.125}, {1490,735,-0.125}, {1490,746,0.125},
+        {1490,793,-0.0625}, {1490,1033,-0.0625}, {1490,1077,0.0625}, {1490,1088,0.0625},
+        {1491,749,0.125}, {1491,828,0.0625}, {1491,1006,0.03125}, {1491,1072,-0.0625},
+        {1491,1119,-0.0625}, {1491,1130,0.0625}, {1491,1139,0.03125}, {1491,1148,-0.03125},
+        {1492,566,0.25}, {1492,693,0.25}, {1492,769,-0.25}, {1493,640,0.125},
+        {1493,784,-0.125}, {1493,1004,0.125}, {1493,1022,0.125}, {1493,1052,0.125},
+        {1493,1113,-0.125}, {1494,602,-0.125}, {1494,771,0.125}, {1494,811,0.0625},
+        {1494,910,0.0625}, {1494,957,0.0625}, {1494,987,0.125}, {1494,1054,-0.0625},
+        {1494,1066,-0.0625}, {1494,1093,0.0625}, {1495,1131,0.5}, {1495,1147,-0.25},
+        {1496,729,-0.25}, {1496,881,0.5}, {1497,814,0.25}, {1497,920,0.25},
+        {1497,1067,-0.25}, {1498,788,0.0625}, {1498,825,-0.0625}, {1498,917,-0.0625},
+        {1498,942,0.125}, {1498,985,0.0625}, {1498,1084,-0.03125}, {1498,1126,0.0625},
+        {1499,582,0.125}, {1499,629,0.125}, {1499,776,0.125}, {1499,781,-0.125},
+        {1499,927,-0.125}, {1499,998,0.125}, {1500,637,-0.015625}, {1500,674,-0.0625},
+        {1500,751,0.015625}, {1500,809,0.125}, {1500,879,-0.03125}, {1500,888,0.03125},
+        {1500,892,0.015625}, {1500,963,0.015625}, {1500,978,0.03125}, {1500,981,0.015625},
+        {1500,1057,0.015625}, {1500,1080,-0.015625}, {1500,1098,0.015625}, {1500,1120,-0.015625},
+        {1501,644,0.015625}, {1501,722,-0.03125}, {1501,728,-0.03125}, {1501,818,-0.03125},
+        {1501,842,0.03125}, {1501,855,0.0625}, {1501,926,0.03125}, {1501,938,-0.015625},
+        {1501,949,0.03125}, {1501,971,-0.015625}, {1501,977,-0.03125}, {1501,1002,-0.0625},
+        {1501,1012,0.03125}, {1501,1015,-0.03125}, {1501,1021,0.03125}, {1501,1024,-0.03125},
+        {1501,1040,0.03125}, {1501,1092,-0.03125}, {1501,1100,0.015625}, {1501,1118,0.03125},
+        {1502,751,-0.0625}, {1502,888,0.125}, {1502,892,-0.0625}, {1502,963,0.0625},
+        {1502,978,-0.125}, {1502,981,-0.0625}, {1502,1057,0.0625}, {1502,1098,0.0625},
+        {1503,564,0.03125}, {1503,578,0.0625}, {1503,589,-0.03125}, {1503,599,-0.03125},
+        {1503,611,-0.0625}, {1503,761,-0.0625}, {1503,817,-0.03125}, {1503,821,0.03125},
+        {1503,837,-0.03125}, {1503,840,0.0625}, {1503,1069,0.03125}, {1503,1096,0.03125},
+        {1504,582,0.125}, {1504,629,-0.125}, {1504,776,-0.125}, {1504,998,0.125},
+        {1505,575,-0.0625}, {1505,619,0.03125}, {1505,623,0.03125}, {1505,655,-0.0625},
+        {1505,731,0.0625}, {1505,833,0.0625}, {1505,929,-0.03125}, {1505,931,-0.03125},
+        {1505,966,-0.03125}, {1505,996,-0.03125}, {1505,1043,0.03125}, {1505,1103,0.03125},
+        {1506,811,-0.125}, {1506,910,0.125}, {1506,957,-0.125}, {1506,1093,0.125},
+        {1507,575,0.0625}, {1507,619,-0.03125}, {1507,623,-0.03125}, {1507,655,0.0625},
+        {1507,731,-0.0625}, {1507,833,-0.0625}, {1507,929,0.03125}, {1507,931,0.03125},
+        {1507,966,0.03125}, {1507,996,0.03125}, {1507,1043,-0.03125}, {1507,1103,-0.03125},
+        {1508,811,0.125}, {1508,910,-0.125}, {1508,957,0.125}, {1508,1093,-0.125},
+        {1509,586,0.0625}, {1509,742,-0.0625}, {1509,869,-0.0625}, {1509,873,-0.0625},
+        {1509,878,0.0625}, {1509,894,-0.0625}, {1509,959,0.0625}, {1509,965,0.0625},
+        {1510,640,-0.125}, {1510,1004,0.125}, {1510,1022,-0.125}, {1510,1052,0.125},
+        {1511,717,-0.125}, {1511,861,0.125}, {1511,882,-0.125}, {1511,986,0.0625},
+        {1511,1063,0.125}, {1511,1082,-0.0625}, {1511,1135,0.0625}, {1511,1137,-0.0625},
+        {1512,828,-0.25}, {1512,1006,0.125}, {1512,1130,0.25}, {1512,1139,-0.125},
+        {1513,564,0.03125}, {1513,578,0.0625}, {1513,589,-0.03125}, {1513,599,-0.03125},
+        {1513,611,-0.0625}, {1513,761,-0.0625}, {1513,817,-0.03125}, {1513,821,0.03125},
+        {1513,837,-0.03125}, {1513,840,0.0625}, {1513,1069,0.03125}, {1513,1096,0.03125},
+        {1514,582,0.125}, {1514,629,-0.125}, {1514,776,-0.125}, {1514,998,0.125},
+        {1515,712,-0.0625}, {1515,900,0.0625}, {1515,952,-0.0625}, {1515,1149,0.0625},
+        {1516,985,-0.125}, {1516,1126,0.125}, {1517,586,-0.0625}, {1517,742,0.0625},
+        {1517,869,0.0625}, {1517,873,0.0625}, {1517,878,-0.0625}, {1517,894,0.0625},
+        {1517,959,-0.0625}, {1517,965,-0.0625}, {1518,640,0.125}, {1518,1004,-0.125},
+        {1518,1022,0.125}, {1518,1052,-0.125}, {1519,622,-0.03125}, {1519,627,-0.03125},
+        {1519,803,0.03125}, {1519,826,0.03125}, {1519,850,0.03125}, {1519,852,-0.03125},
+        {1519,870,-0.03125}, {1519,886,-0.03125}, {1519,958,0.03125}, {1519,968,-0.03125},
+        {1519,1007,0.03125}, {1519,1010,0.03125}, {1519,1025,0.03125}, {1519,1032,0.03125},
+        {1519,1048,-0.03125}, {1519,1117,-0.03125}, {1520,603,0.125}, {1520,796,0.125},
+        {1520,1108,-0.125}, {1520,1140,-0.125}, {1521,654,-0.0625}, {1521,697,-0.0625},
+        {1521,741,-0.0625}, {1521,876,-0.0625}, {1521,912,0.0625}, {1521,944,0.125},
+        {1521,955,0.0625}, {1521,1026,-0.125}, {1521,1073,0.0625}, {1521,1146,0.0625},
+        {1522,723,-0.25}, {1522,849,0.125}, {1522,925,-0.125}, {1522,1078,0.25},
+        {1523,646,0.0625}, {1523,762,0.03125}, {1523,773,0.03125}, {1523,827,-0.03125},
+        {1523,844,0.03125}, {1523,859,-0.03125}, {1523,921,-0.0625}, {1523,935,0.03125},
+        {1523,945,-0.0625}, {1523,1027,0.0625}, {1523,1099,-0.03125}, {1523,1138,-0.03125},
+        {1524,561,0.125}, {1524,590,-0.125}, {1524,1077,0.125}, {1524,1088,-0.125},
+        {1525,581,-0.03125}, {1525,593,-0.03125}, {1525,598,-0.03125}, {1525,648,0.03125},
+        {1525,695,0.03125}, {1525,708,-0.03125}, {1525,714,0.03125}, {1525,736,-0.03125},
+        {1525,772,0.03125}, {1525,810,-0.03125}, {1525,887,0.03125}, {1525,904,-0.03125},
+        {1525,915,-0.03125}, {1525,950,0.03125}, {1525,970,0.03125}, {1525,1005,0.03125},
+        {1526,620,0.125}, {1526,662,-0.125}, {1526,666,-0.125}, {1526,800,0.125},
+        {1527,646,0.0625}, {1527,762,0.03125}, {1527,773,0.03125}, {1527,827,-0.03125},
+        {1527,844,0.03125}, {1527,859,-0.03125}, {1527,921,-0.0625}, {1527,935,0.03125},
+        {1527,945,-0.0625}, {1527,1027,0.0625}, {1527,1099,-0.03125}, {1527,1138,-0.03125},
+        {1528,561,0.125}, {1528,590,-0.125}, {1528,1077,0.125}, {1528,1088,-0.125},
+        {1529,644,-0.015625}, {1529,722,-0.03125}, {1529,728,-0.03125}, {1529,818,-0.03125},
+        {1529,842,0.03125}, {1529,855,0.0625}, {1529,926,-0.03125}, {1529,938,0.015625},
+        {1529,949,0.03125}, {1529,971,0.015625}, {1529,977,-0.03125}, {1529,1002,-0.0625},
+        {1529,1012,-0.03125}, {1529,1015,0.03125}, {1529,1021,0.03125}, {1529,1024,0.03125},
+        {1529,1040,0.03125}, {1529,1092,0.03125}, {1529,1100,-0.015625}, {1529,1118,-0.03125},
+        {1530,751,0.0625}, {1530,888,0.125}, {1530,892,-0.0625}, {1530,963,-0.0625},
+        {1530,978,-0.125}, {1530,981,0.0625}, {1530,1057,-0.0625}, {1530,1098,0.0625},
+        {1531,651,-0.03125}, {1531,764,0.0625}, {1531,1041,-0.0625}, {1531,1047,0.03125},
+        {1531,1050,-0.03125}, {1531,1068,0.03125}, {1532,975,0.125}, {1532,1013,-0.125},
+        {1533,622,0.03125}, {1533,627,0.03125}, {1533,803,-0.03125}, {1533,826,-0.03125},
+        {1533,850,-0.03125}, {1533,852,0.03125}, {1533,870,0.03125}, {1533,886,0.03125},
+        {1533,958,-0.03125}, {1533,968,0.03125}, {1533,1007,-0.03125}, {1533,1010,-0.03125},
+        {1533,1025,-0.03125}, {1533,1032,-0.03125}, {1533,1048,0.03125}, {1533,1117,0.03125},
+        {1534,603,-0.125}, {1534,796,-0.125}, {1534,1108,0.125}, {1534,1140,0.125},
+        {1535,581,0.03125}, {1535,593,0.03125}, {1535,598,0.03125}, {1535,648,-0.03125},
+        {1535,695,-0.03125}, {1535,708,0.03125}, {1535,714,-0.03125}, {1535,736,0.03125},
+        {1535,772,-0.03125}, {1535,810,0.03125}, {1535,887,-0.03125}, {1535,904,0.03125},
+        {1535,915,0.03125}, {1535,950,-0.03125}, {1535,970,-0.03125}, {1535,1005,-0.03125},
+        {1536,620,-0.125}, {1536,662,0.125}, {1536,666,0.125}, {1536,800,-0.125},
+        {1537,581,-0.0625}, {1537,593,-0.0625}, {1537,598,-0.0625}, {1537,648,0.0625},
+        {1537,695,-0.0625}, {1537,708,0.0625}, {1537,714,0.0625}, {1537,736,0.0625},
+        {1537,772,-0.0625}, {1537,810,0.0625}, {1537,887,-0.0625}, {1537,904,-0.0625},
+        {1537,915,0.0625}, {1537,950,0.0625}, {1537,970,0.0625}, {1537,1005,-0.0625},
+        {1538,620,0.25}, {1538,662,0.25}, {1538,666,-0.25}, {1538,800,-0.25},
+        {1539,646,0.0625}, {1539,673,-0.0625}, {1539,755,0.0625}, {1539,762,-0.03125},
+        {1539,773,0.03125}, {1539,774,-0.0625}, {1539,779,-0.0625}, {1539,789,0.0625},
+        {1539,797,-0.0625}, {1539,827,-0.03125}, {1539,844,0.03125}, {1539,859,-0.03125},
+        {1539,903,0.0625}, {1539,921,0.0625}, {1539,935,-0.03125}, {1539,945,-0.0625},
+        {1539,1027,-0.0625}, {1539,1051,0.0625}, {1539,1099,0.03125}, {1539,1138,0.03125},
+        {1540,561,-0.125}, {1540,590,0.125}, {1540,716,-0.25}, {1540,746,0.25},
+        {1540,1077,0.125}, {1540,1088,-0.125}, {1541,575,0.0625}, {1541,580,-0.125},
+        {1541,604,-0.0625}, {1541,619,0.03125}, {1541,623,-0.03125}, {1541,631,0.125},
+        {1541,647,0.0625}, {1541,655,-0.0625}, {1541,731,-0.0625}, {1541,756,-0.0625},
+        {1541,833,0.0625}, {1541,841,0.0625}, {1541,929,0.03125}, {1541,931,-0.03125},
+        {1541,966,0.03125}, {1541,996,-0.03125}, {1541,1043,-0.03125}, {1541,1103,0.03125},
+        {1542,771,0.25}, {1542,811,0.125}, {1542,910,0.125}, {1542,957,-0.125},
+        {1542,987,-0.25}, {1542,1093,-0.125}, {1543,600,0.25}, {1543,625,0.125},
+        {1543,690,-0.125}, {1543,743,-0.25}, {1543,801,-0.125}, {1543,993,0.125},
+        {1544,814,-0.5}, {1544,920,0.5}, {1545,564,0.0625}, {1545,578,-0.125},
+        {1545,589,-0.0625}, {1545,599,-0.0625}, {1545,611,0.125}, {1545,761,-0.125},
+        {1545,817,0.0625}, {1545,821,-0.0625}, {1545,837,0.0625}, {1545,840,0.125},
+        {1545,1069,0.0625}, {1545,1096,-0.0625}, {1546,582,0.25}, {1546,629,0.25},
+        {1546,776,-0.25}, {1546,998,-0.25}, {1547,644,-0.015625}, {1547,722,-0.03125},
+        {1547,728,-0.03125}, {1547,818,0.03125}, {1547,842,0.03125}, {1547,855,0.0625},
+        {1547,926,0.03125}, {1547,938,0.015625}, {1547,949,-0.03125}, {1547,971,0.015625},
+        {1547,977,0.03125}, {1547,1002,-0.0625}, {1547,1012,-0.03125}, {1547,1015,0.03125},
+        {1547,1021,-0.03125}, {1547,1024,-0.03125}, {1547,1040,0.03125}, {1547,1092,-0.03125},
+        {1547,1100,-0.015625}, {1547,1118,0.03125}, {1548,751,0.0625}, {1548,888,0.125},
+        {1548,892,0.0625}, {1548,963,0.0625}, {1548,978,-0.125}, {1548,981,-0.0625},
+        {1548,1057,-0.0625}, {1548,1098,-0.0625}, {1549,610,0.125}, {1549,639,0.125},
+        {1549,649,0.125}, {1549,656,-0.125}, {1549,696,0.125}, {1549,805,-0.125},
+        {1549,843,-0.125}, {1549,1001,-0.125}, {1550,643,-0.5}, {1550,738,0.5},
+        {1551,574,-0.125}, {1551,595,0.0625}, {1551,689,0.125}, {1551,713,-0.0625},
+        {1551,786,-0.125}, {1551,877,0.0625}, {1551,947,0.125}, {1551,1074,0.0625},
+        {1551,1085,0.0625}, {1551,1105,-0.0625}, {1551,1116,-0.0625}, {1551,1133,-0.0625},
+        {1552,733,0.25}, {1552,829,0.25}, {1552,1028,-0.25}, {1552,1109,-0.25},
+        {1553,717,-0.125}, {1553,861,0.125}, {1553,882,-0.125}, {1553,986,-0.0625},
+        {1553,1063,0.125}, {1553,1082,0.0625}, {1553,1135,-0.0625}, {1553,1137,0.0625},
+        {1554,828,-0.25}, {1554,1006,-0.125}, {1554,1130,0.25}, {1554,1139,0.125},
+        {1555,698,-0.25}, {1555,705,0.25}, {1555,937,-0.25}, {1555,976,0.25},
+        {1556,566,-0.5}, {1556,693,0.5}, {1557,586,0.125}, {1557,742,0.125},
+        {1557,869,-0.125}, {1557,873,-0.125}, {1557,878,0.125}, {1557,894,0.125},
+        {1557,959,-0.125}, {1557,965,-0.125}, {1558,640,0.25}, {1558,1004,0.25},
+        {1558,1022,-0.25}, {1558,1052,-0.25}, {1559,575,-0.0625}, {1559,580,-0.125},
+        {1559,604,-0.0625}, {1559,619,-0.03125}, {1559,623,0.03125}, {1559,631,0.125},
+        {1559,647,0.0625}, {1559,655,0.0625}, {1559,731,0.0625}, {1559,756,-0.0625},
+        {1559,833,-0.0625}, {1559,841,0.0625}, {1559,929,-0.03125}, {1559,931,0.03125},
+        {1559,966,-0.03125}, {1559,996,0.03125}, {1559,1043,0.03125}, {1559,1103,-0.03125},
+        {1560,771,0.25}, {1560,811,-0.125}, {1560,910,-0.125}, {1560,957,0.125},
+        {1560,987,-0.25}, {1560,1093,0.125}, {1561,622,0.0625}, {1561,627,-0.0625},
+        {1561,803,0.0625}, {1561,826,-0.0625}, {1561,850,0.0625}, {1561,852,-0.0625},
+        {1561,870,-0.0625}, {1561,886,0.0625}, {1561,958,-0.0625}, {1561,968,-0.0625},
+        {1561,1007,0.0625}, {1561,1010,0.0625}, {1561,1025,-0.0625}, {1561,1032,-0.0625},
+        {1561,1048,0.0625}, {1561,1117,0.0625}, {1562,603,-0.25}, {1562,796,0.25},
+        {1562,1108,0.25}, {1562,1140,-0.25}, {1563,654,0.0625}, {1563,697,-0.0625},
+        {1563,741,-0.0625}, {1563,876,0.0625}, {1563,912,0.0625}, {1563,944,0.125},
+        {1563,955,-0.0625}, {1563,1026,-0.125}, {1563,1073,-0.0625}, {1563,1146,0.0625},
+        {1564,723,-0.25}, {1564,849,-0.125}, {1564,925,0.125}, {1564,1078,0.25},
+        {1565,574,0.125}, {1565,595,0.0625}, {1565,689,0.125}, {1565,713,-0.0625},
+        {1565,786,-0.125}, {1565,877,-0.0625}, {1565,947,-0.125}, {1565,1074,-0.0625},
+        {1565,1085,0.0625}, {1565,1105,0.0625}, {1565,1116,-0.0625}, {1565,1133,0.0625},
+        {1566,733,-0.25}, {1566,829,0.25}, {1566,1028,-0.25}, {1566,1109,0.25},
+        {1567,591,0.25}, {1567,601,0.125}, {1567,660,-0.25}, {1567,667,-0.125},
+        {1567,898,-0.125}, {1567,1037,0.125}, {1568,928,0.5}, {1568,1094,-0.5},
+        {1569,571,0.25}, {1569,732,-0.25}, {1569,770,0.125}, {1569,832,-0.125},
+        {1569,866,0.125}, {1569,941,-0.125}, {1570,923,-0.5}, {1570,953,0.5},
+        {1571,646,0.0625}, {1571,673,0.0625}, {1571,755,-0.0625}, {1571,762,-0.03125},
+        {1571,773,0.03125}, {1571,774,0.0625}, {1571,779,0.0625}, {1571,789,-0.0625},
+        {1571,797,0.0625}, {1571,827,-0.03125}, {1571,844,0.03125}, {1571,859,-0.03125},
+        {1571,903,-0.0625}, {1571,921,0.0625}, {1571,935,-0.03125}, {1571,945,-0.0625},
+        {1571,1027,-0.0625}, {1571,1051,-0.0625}, {1571,1099,0.03125}, {1571,1138,0.03125},
+        {1572,561,-0.125}, {1572,590,0.125}, {1572,716,0.25}, {1572,746,-0.25},
+        {1572,1077,0.125}, {1572,1088,-0.125}, {1573,560,-0.0078125}, {1573,612,0.015625},
+        {1573,621,-0.0078125}, {1573,632,0.0078125}, {1573,645,-0.015625}, {1573,652,0.0078125},
+        {1573,670,0.00390625}, {1573,766,-0.00390625}, {1573,799,0.0078125}, {1573,847,-0.00390625},
+        {1573,854,0.0078125}, {1573,863,-0.0078125}, {1573,867,0.00390625}, {1573,885,0.015625},
+        {1573,902,0.015625}, {1573,914,-0.00390625}, {1573,962,-0.0078125}, {1573,995,0.015625},
+        {1573,1058,-0.00390625}, {1573,1087,0.0078125}, {1573,1102,-0.00390625}, {1573,1115,0.0078125},
+        {1573,1134,-0.0078125}, {1573,1136,-0.00390625}, {1574,644,-0.0078125}, {1574,722,0.015625},
+        {1574,728,0.015625}, {1574,818,-0.015625}, {1574,842,0.015625}, {1574,855,0.03125},
+        {1574,926,0.015625}, {1574,938,-0.0078125}, {1574,949,-0.015625}, {1574,971,-0.0078125},
+        {1574,977,-0.015625}, {1574,1002,0.03125}, {1574,1012,-0.015625}, {1574,1015,-0.015625},
+        {1574,1021,-0.015625}, {1574,1024,0.015625}, {1574,1040,0.015625}, {1574,1092,0.015625},
+        {1574,1100,-0.0078125}, {1574,1118,0.015625}, {1575,637,0.015625}, {1575,751,-0.015625},
+        {1575,879,0.03125}, {1575,888,0.03125}, {1575,892,-0.015625}, {1575,963,0.015625},
+        {1575,978,0.03125}, {1575,981,0.015625}, {1575,1057,-0.015625}, {1575,1080,-0.015625},
+        {1575,1098,-0.015625}, {1575,1120,-0.015625}, {1576,616,0.03125}, {1576,678,0.015625},
+        {1576,680,0.03125}, {1576,699,-0.03125}, {1576,701,0.015625}, {1576,718,-0.015625},
+        {1576,740,-0.03125}, {1576,754,0.03125}, {1576,792,-0.015625}, {1576,835,-0.03125},
+        {1576,846,-0.015625}, {1576,1020,-0.015625}, {1576,1086,0.015625}, {1576,1122,0.015625},
+        {1577,575,0.0625}, {1577,619,-0.03125}, {1577,623,0.03125}, {1577,655,-0.0625},
+        {1577,731,0.0625}, {1577,833,-0.0625}, {1577,929,0.03125}, {1577,931,-0.03125},
+        {1577,966,0.03125}, {1577,996,-0.03125}, {1577,1043,0.03125}, {1577,1103,-0.03125},
+        {1578,811,0.0625}, {1578,910,-0.0625}, {1578,957,-0.0625}, {1578,1054,0.0625},
+        {1578,1066,-0.0625}, {1578,1093,0.0625}, {1579,579,0.03125}, {1579,587,-0.03125},
+        {1579,607,-0.015625}, {1579,633,0.03125}, {1579,634,-0.03125}, {1579,638,0.015625},
+        {1579,650,-0.015625}, {1579,757,-0.03125}, {1579,785,0.03125}, {1579,802,0.015625},
+        {1579,848,-0.015625}, {1579,858,0.015625}, {1579,891,0.015625}, {1579,960,-0.015625},
+        {1580,564,0.03125}, {1580,578,-0.0625}, {1580,589,0.03125}, {1580,599,0.03125},
+        {1580,611,-0.0625}, {1580,761,0.0625}, {1580,817,-0.03125}, {1580,821,-0.03125},
+        {1580,837,-0.03125}, {1580,840,0.0625}, {1580,1069,0.03125}, {1580,1096,-0.03125},
+        {1581,582,0.0625}, {1581,629,-0.0625}, {1581,776,0.0625}, {1581,781,-0.0625},
+        {1581,927,0.0625}, {1581,998,-0.0625}, {1582,669,0.0625}, {1582,765,-0.015625},
+        {1582,901,0.03125}, {1582,943,-0.0078125}, {1582,1003,0.03125}, {1582,1059,0.015625},
+        {1582,1060,-0.015625}, {1582,1061,0.015625}, {1582,1065,-0.03125}, {1582,1151,-0.0078125},
+        {1583,717,0.0625}, {1583,861,0.0625}, {1583,882,0.0625}, {1583,986,-0.03125},
+        {1583,1063,0.0625}, {1583,1082,-0.03125}, {1583,1135,-0.03125}, {1583,1137,-0.03125},
+        {1584,828,0.0625}, {1584,1006,-0.03125}, {1584,1119,0.0625}, {1584,1130,0.0625},
+        {1584,1139,-0.03125}, {1584,1148,-0.03125}, {1585,592,0.0625}, {1585,613,0.03125},
+        {1585,694,-0.03125}, {1585,709,-0.03125}, {1585,798,-0.0625}, {1585,860,-0.015625},
+        {1585,897,0.03125}, {1585,1039,0.015625}, {1585,1046,0.015625}, {1585,1062,-0.015625},
+        {1586,586,-0.0625}, {1586,742,0.0625}, {1586,869,-0.0625}, {1586,873,-0.0625},
+        {1586,878,-0.0625}, {1586,894,0.0625}, {1586,959,0.0625}, {1586,965,0.0625},
+        {1587,640,0.0625}, {1587,784,0.0625}, {1587,1004,-0.0625}, {1587,1022,-0.0625},
+        {1587,1052,0.0625}, {1587,1113,-0.0625}, {1588,617,-0.015625}, {1588,630,-0.0078125},
+        {1588,668,0.015625}, {1588,759,0.03125}, {1588,823,0.03125}, {1588,932,-0.015625},
+        {1589,663,0.0625}, {1589,745,-0.03125}, {1589,906,0.0625}, {1589,956,-0.03125},
+        {1590,788,-0.03125}, {1590,825,0.03125}, {1590,942,0.0625}, {1590,1084,-0.015625},
+        {1591,681,0.015625}, {1591,704,0.015625}, {1591,974,0.015625}, {1591,991,0.03125},
+        {1591,1034,0.015625}, {1591,1071,-0.03125}, {1591,1097,0.03125}, {1591,1123,-0.015625},
+        {1591,1128,-0.015625}, {1591,1132,-0.0078125}, {1591,1142,-0.0078125}, {1591,1143,0.03125},
+        {1592,654,-0.03125}, {1592,697,0.03125}, {1592,741,0.03125}, {1592,876,-0.03125},
+        {1592,912,0.03125}, {1592,944,0.0625}, {1592,955,-0.03125}, {1592,1026,0.0625},
+        {1592,1073,-0.03125}, {1592,1146,0.03125}, {1593,723,0.0625}, {1593,726,0.0625},
+        {1593,849,-0.03125}, {1593,925,-0.03125}, {1593,1078,0.0625}, {1593,1127,-0.03125},
+        {1594,577,0.03125}, {1594,661,-0.03125}, {1594,672,0.015625}, {1594,675,-0.015625},
+        {1594,778,0.03125}, {1594,783,-0.015625}, {1594,813,0.015625}, {1594,875,0.03125},
+        {1594,895,-0.03125}, {1594,982,-0.03125}, {1594,1000,0.015625}, {1594,1036,-0.015625},
+        {1594,1038,0.015625}, {1594,1089,-0.015625}, {1595,646,0.0625}, {1595,762,-0.03125},
+        {1595,773,0.03125}, {1595,827,0.03125}, {1595,844,0.03125}, {1595,859,0.03125},
+        {1595,921,-0.0625}, {1595,935,-0.03125}, {1595,945,0.0625}, {1595,1027,-0.0625},
+        {1595,1099,-0.03125}, {1595,1138,-0.03125}, {1596,561,-0.0625}, {1596,590,-0.0625},
+        {1596,793,-0.0625}, {1596,1033,0.0625}, {1596,1077,0.0625}, {1596,1088,0.0625},
+        {1597,671,0.015625}, {1597,677,0.015625}, {1597,687,-0.015625}, {1597,711,0.015625},
+        {1597,739,-0.015625}, {1597,758,0.015625}, {1597,807,-0.015625}, {1597,868,-0.015625},
+        {1597,880,0.015625}, {1597,969,-0.015625}, {1597,979,-0.015625}, {1597,1008,-0.015625},
+        {1597,1016,0.015625}, {1597,1019,-0.015625}, {1597,1023,-0.015625}, {1597,1044,0.015625},
+        {1597,1075,0.015625}, {1597,1091,-0.015625}, {1597,1107,0.015625}, {1597,1150,0.015625},
+        {1598,622,0.03125}, {1598,627,-0.03125}, {1598,803,-0.03125}, {1598,826,0.03125},
+        {1598,850,-0.03125}, {1598,852,-0.03125}, {1598,870,-0.03125}, {1598,886,0.03125},
+        {1598,958,0.03125}, {1598,968,-0.03125}, {1598,1007,-0.03125}, {1598,1010,-0.03125},
+        {1598,1025,0.03125}, {1598,1032,0.03125}, {1598,1048,0.03125}, {1598,1117,0.03125},
+        {1599,603,0.0625}, {1599,796,-0.0625}, {1599,845,0.0625}, {1599,1095,-0.0625},
+        {1599,1108,0.0625}, {1599,1140,-0.0625}, {1600,560,0.0078125}, {1600,612,0.015625},
+        {1600,621,-0.0078125}, {1600,632,0.0078125}, {1600,645,-0.015625}, {1600,652,0.0078125},
+        {1600,670,-0.00390625}, {1600,766,0.00390625}, {1600,799,0.0078125}, {1600,847,0.00390625},
+        {1600,854,-0.0078125}, {1600,863,-0.0078125}, {1600,867,-0.00390625}, {1600,885,0.015625},
+        {1600,902,-0.015625}, {1600,914,0.00390625}, {1600,962,0.0078125}, {1600,995,0.015625},
+        {1600,1058,-0.00390625}, {1600,1087,0.0078125}, {1600,1102,0.00390625}, {1600,1115,-0.0078125},
+        {1600,1134,0.0078125}, {1600,1136,-0.00390625}, {1601,644,0.0078125}, {1601,722,0.015625},
+        {1601,728,0.015625}, {1601,818,-0.015625}, {1601,842,0.015625}, {1601,855,0.03125},
+        {1601,926,-0.015625}, {1601,938,0.0078125}, {1601,949,-0.015625}, {1601,971,0.0078125},
+        {1601,977,-0.015625}, {1601,1002,0.03125}, {1601,1012,0.015625}, {1601,1015,0.015625},
+        {1601,1021,-0.015625}, {1601,1024,-0.015625}, {1601,1040,0.015625}, {1601,1092,-0.015625},
+        {1601,1100,0.0078125}, {1601,1118,-0.015625}, {1602,637,-0.015625}, {1602,751,0.015625},
+        {1602,879,0.03125}, {1602,888,0.03125}, {1602,892,-0.015625}, {1602,963,-0.015625},
+        {1602,978,0.03125}, {1602,981,-0.015625}, {1602,1057,0.015625}, {1602,1080,-0.015625},
+        {1602,1098,-0.015625}, {1602,1120,0.015625}, {1603,576,0.015625}, {1603,605,-0.015625},
+        {1603,618,-0.015625}, {1603,628,0.015625}, {1603,641,-0.015625}, {1603,659,0.015625},
+        {1603,676,0.015625}, {1603,700,-0.015625}, {1603,721,0.015625}, {1603,744,-0.015625},
+        {1603,794,-0.015625}, {1603,806,-0.015625}, {1603,824,0.015625}, {1603,862,0.015625},
+        {1603,864,-0.015625}, {1603,896,0.015625}, {1603,909,0.015625}, {1603,946,-0.015625},
+        {1603,961,0.015625}, {1603,994,-0.015625}, {1604,581,-0.03125}, {1604,593,-0.03125},
+        {1604,598,-0.03125}, {1604,648,-0.03125}, {1604,695,0.03125}, {1604,708,0.03125},
+        {1604,714,-0.03125}, {1604,736,0.03125}, {1604,772,0.03125}, {1604,810,0.03125},
+        {1604,887,0.03125}, {1604,904,-0.03125}, {1604,915,0.03125}, {1604,950,-0.03125},
+        {1604,970,-0.03125}, {1604,1005,0.03125}, {1605,620,-0.0625}, {1605,662,0.0625},
+        {1605,666,-0.0625}, {1605,706,-0.0625}, {1605,800,0.0625}, {1605,997,0.0625},
+        {1606,573,-0.0078125}, {1606,642,0.0078125}, {1606,719,0.015625}, {1606,753,0.015625},
+        {1606,767,-0.015625}, {1606,853,0.015625}, {1606,893,-0.0078125}, {1606,916,0.015625},
+        {1606,936,-0.0078125}, {1606,1055,0.0078125}, {1607,565,0.03125}, {1607,572,0.03125},
+        {1607,588,-0.03125}, {1607,664,0.03125}, {1607,682,-0.03125}, {1607,822,0.03125},
+        {1608,838,0.0625}, {1608,905,-0.03125}, {1608,984,0.03125}, {1608,1145,-0.015625},
+        {1609,573,-0.0078125}, {1609,642,0.0078125}, {1609,719,0.015625}, {1609,753,0.015625},
+        {1609,767,-0.015625}, {1609,853,0.015625}, {1609,893,-0.0078125}, {1609,916,0.015625},
+        {1609,936,-0.0078125}, {1609,1055,0.0078125}, {1610,565,0.03125}, {1610,572,0.03125},
+        {1610,588,-0.03125}, {1610,664,0.03125}, {1610,682,-0.03125}, {1610,822,0.03125},
+        {1611,838,0.0625}, {1611,905,-0.03125}, {1611,984,0.03125}, {1611,1145,-0.015625},
+        {1612,671,-0.015625}, {1612,677,-0.015625}, {1612,687,0.015625}, {1612,711,-0.015625},
+        {1612,739,0.015625}, {1612,758,-0.015625}, {1612,807,0.015625}, {1612,868,0.015625},
+        {1612,880,-0.015625}, {1612,969,0.015625}, {1612,979,0.015625}, {1612,1008,0.015625},
+        {1612,1016,-0.015625}, {1612,1019,0.015625}, {1612,1023,0.015625}, {1612,1044,-0.015625},
+        {1612,1075,-0.015625}, {1612,1091,0.015625}, {1612,1107,-0.015625}, {1612,1150,-0.015625},
+        {1613,622,-0.03125}, {1613,627,0.03125}, {1613,803,0.03125}, {1613,826,-0.03125},
+        {1613,850,0.03125}, {1613,852,0.03125}, {1613,870,0.03125}, {1613,886,-0.03125},
+        {1613,958,-0.03125}, {1613,968,0.03125}, {1613,1007,0.03125}, {1613,1010,0.03125},
+        {1613,1025,-0.03125}, {1613,1032,-0.03125}, {1613,1048,-0.03125}, {1613,1117,-0.03125},
+        {1614,603,-0.0625}, {1614,796,0.0625}, {1614,845,-0.0625}, {1614,1095,0.0625},
+        {1614,1108,-0.0625}, {1614,1140,0.0625}, {1615,576,-0.015625}, {1615,605,0.015625},
+        {1615,618,0.015625}, {1615,628,-0.015625}, {1615,641,0.015625}, {1615,659,-0.015625},
+        {1615,676,-0.015625}, {1615,700,0.015625}, {1615,721,-0.015625}, {1615,744,0.015625},
+        {1615,794,0.015625}, {1615,806,0.015625}, {1615,824,-0.015625}, {1615,862,-0.015625},
+        {1615,864,0.015625}, {1615,896,-0.015625}, {1615,909,-0.015625}, {1615,946,0.015625},
+        {1615,961,-0.015625}, {1615,994,0.015625}, {1616,581,0.03125}, {1616,593,0.03125},
+        {1616,598,0.03125}, {1616,648,0.03125}, {1616,695,-0.03125}, {1616,708,-0.03125},
+        {1616,714,0.03125}, {1616,736,-0.03125}, {1616,772,-0.03125}, {1616,810,-0.03125},
+        {1616,887,-0.03125}, {1616,904,0.03125}, {1616,915,-0.03125}, {1616,950,0.03125},
+        {1616,970,0.03125}, {1616,1005,-0.03125}, {1617,620,0.0625}, {1617,662,-0.0625},
+        {1617,666,0.0625}, {1617,706,0.0625}, {1617,800,-0.0625}, {1617,997,-0.0625},
+        {1618,681,0.015625}, {1618,704,0.015625}, {1618,974,0.015625}, {1618,991,0.03125},
+        {1618,1034,0.015625}, {1618,1071,-0.03125}, {1618,1097,0.03125}, {1618,1123,-0.015625},
+        {1618,1128,-0.015625}, {1618,1132,-0.0078125}, {1618,1142,-0.0078125}, {1618,1143,0.03125},
+        {1619,654,-0.03125}, {1619,697,0.03125}, {1619,741,0.03125}, {1619,876,-0.03125},
+        {1619,912,0.03125}, {1619,944,0.0625}, {1619,955,-0.03125}, {1619,1026,0.0625},
+        {1619,1073,-0.03125}, {1619,1146,0.03125}, {1620,723,0.0625}, {1620,726,0.0625},
+        {1620,849,-0.03125}, {1620,925,-0.03125}, {1620,1078,0.0625}, {1620,1127,-0.03125},
+        {1621,577,0.03125}, {1621,661,-0.03125}, {1621,672,0.015625}, {1621,675,-0.015625},
+        {1621,778,0.03125}, {1621,783,-0.015625}, {1621,813,0.015625}, {1621,875,0.03125},
+        {1621,895,-0.03125}, {1621,982,-0.03125}, {1621,1000,0.015625}, {1621,1036,-0.015625},
+        {1621,1038,0.015625}, {1621,1089,-0.015625}, {1622,646,0.0625}, {1622,762,-0.03125},
+        {1622,773,0.03125}, {1622,827,0.03125}, {1622,844,0.03125}, {1622,859,0.03125},
+        {1622,921,-0.0625}, {1622,935,-0.03125}, {1622,945,0.0625}, {1622,1027,-0.0625},
+        {1622,1099,-0.03125}, {1622,1138,-0.03125}, {1623,561,-0.0625}, {1623,590,-0.0625},
+        {1623,793,-0.0625}, {1623,1033,0.0625}, {1623,1077,0.0625}, {1623,1088,0.0625},
+        {1624,560,0.0078125}, {1624,612,0.015625}, {1624,621,-0.0078125}, {1624,632,0.0078125},
+        {1624,645,-0.015625}, {1624,652,0.0078125}, {1624,670,-0.00390625}, {1624,766,0.00390625},
+        {1624,799,0.0078125}, {1624,847,0.00390625}, {1624,854,-0.0078125}, {1624,863,-0.0078125},
+        {1624,867,-0.00390625}, {1624,885,0.015625}, {1624,902,-0.015625}, {1624,914,0.00390625},
+        {1624,962,0.0078125}, {1624,995,0.015625}, {1624,1058,-0.00390625}, {1624,1087,0.0078125},
+        {1624,1102,0.00390625}, {1624,1115,-0.0078125}, {1624,1134,0.0078125}, {1624,1136,-0.00390625},
+        {1625,644,0.0078125}, {1625,722,0.015625}, {1625,728,0.015625}, {1625,818,-0.015625},
+        {1625,842,0.015625}, {1625,855,0.03125}, {1625,926,-0.015625}, {1625,938,0.0078125},
+        {1625,949,-0.015625}, {1625,971,0.0078125}, {1625,977,-0.015625}, {1625,1002,0.03125},
+        {1625,1012,0.015625}, {1625,1015,0.015625}, {1625,1021,-0.015625}, {1625,1024,-0.015625},
+        {1625,1040,0.015625}, {1625,1092,-0.015625}, {1625,1100,0.0078125}, {1625,1118,-0.015625},
+        {1626,637,-0.015625}, {1626,751,0.015625}, {1626,879,0.03125}, {1626,888,0.03125},
+        {1626,892,-0.015625}, {1626,963,-0.015625}, {1626,978,0.03125}, {1626,981,-0.015625},
+        {1626,1057,0.015625}, {1626,1080,-0.015625}, {1626,1098,-0.015625}, {1626,1120,0.015625},
+        {1627,560,0.0078125}, {1627,583,-0.03125}, {1627,612,0.015625}, {1627,621,0.0078125},
+        {1627,632,0.0078125}, {1627,645,0.015625}, {1627,652,0.0078125}, {1627,670,0.00390625},
+        {1627,766,0.00390625}, {1627,787,-0.015625}, {1627,799,0.0078125}, {1627,839,-0.03125},
+        {1627,847,0.00390625}, {1627,854,0.0078125}, {1627,856,-0.03125}, {1627,863,0.0078125},
+        {1627,867,0.00390625}, {1627,871,-0.03125}, {1627,885,0.015625}, {1627,902,0.015625},
+        {1627,914,0.00390625}, {1627,962,0.0078125}, {1627,995,0.015625}, {1627,1011,-0.015625},
+        {1627,1058,0.00390625}, {1627,1087,0.0078125}, {1627,1102,0.00390625}, {1627,1115,0.0078125},
+        {1627,1134,0.0078125}, {1627,1136,0.00390625}, {1628,608,-0.0625}, {1628,644,0.0078125},
+        {1628,692,-0.0625}, {1628,722,0.015625}, {1628,728,0.015625}, {1628,760,-0.0625},
+        {1628,818,0.015625}, {1628,842,0.015625}, {1628,855,0.03125}, {1628,883,-0.0625},
+        {1628,926,0.015625}, {1628,938,0.0078125}, {1628,949,0.015625}, {1628,971,0.0078125},
+        {1628,977,0.015625}, {1628,1002,0.03125}, {1628,1012,0.015625}, {1628,1015,0.015625},
+        {1628,1021,0.015625}, {1628,1024,0.015625}, {1628,1040,0.015625}, {1628,1092,0.015625},
+        {1628,1100,0.0078125}, {1628,1118,0.015625}, {1629,637,0.015625}, {1629,674,-0.0625},
+        {1629,751,0.015625}, {1629,809,-0.125}, {1629,879,0.03125}, {1629,888,0.03125},
+        {1629,892,0.015625}, {1629,963,0.015625}, {1629,978,0.03125}, {1629,981,0.015625},
+        {1629,1057,0.015625}, {1629,1080,0.015625}, {1629,1098,0.015625}, {1629,1120,0.015625},
+        {1630,568,0.0625}, {1630,616,-0.03125}, {1630,657,0.0625}, {1630,678,-0.015625},
+        {1630,680,-0.03125}, {1630,683,0.03125}, {1630,699,-0.03125}, {1630,701,-0.015625},
+        {1630,707,0.03125}, {1630,718,-0.015625}, {1630,740,-0.03125}, {1630,754,-0.03125},
+        {1630,792,-0.015625}, {1630,812,0.0625}, {1630,835,-0.03125}, {1630,846,-0.015625},
+        {1630,913,0.03125}, {1630,1018,0.03125}, {1630,1020,-0.015625}, {1630,1086,-0.015625},
+        {1630,1122,-0.015625}, {1631,575,-0.0625}, {1631,580,0.125}, {1631,604,0.0625},
+        {1631,619,-0.03125}, {1631,623,-0.03125}, {1631,631,0.125}, {1631,647,0.0625},
+        {1631,655,-0.0625}, {1631,731,-0.0625}, {1631,756,0.0625}, {1631,833,-0.0625},
+        {1631,841,0.0625}, {1631,929,-0.03125}, {1631,931,-0.03125}, {1631,966,-0.03125},
+        {1631,996,-0.03125}, {1631,1043,-0.03125}, {1631,1103,-0.03125}, {1632,602,0.125},
+        {1632,771,0.125}, {1632,811,-0.0625}, {1632,910,-0.0625}, {1632,957,-0.0625},
+        {1632,987,0.125}, {1632,1054,-0.0625}, {1632,1066,-0.0625}, {1632,1093,-0.0625},
+        {1633,577,0.03125}, {1633,653,-0.03125}, {1633,658,-0.03125}, {1633,661,0.03125},
+        {1633,672,0.015625}, {1633,675,0.015625}, {1633,688,-0.03125}, {1633,778,0.03125},
+        {1633,780,-0.03125}, {1633,783,0.015625}, {1633,790,-0.03125}, {1633,813,0.015625},
+        {1633,875,0.03125}, {1633,895,0.03125}, {1633,918,-0.03125}, {1633,982,0.03125},
+        {1633,988,-0.03125}, {1633,992,-0.03125}, {1633,1000,0.015625}, {1633,1029,-0.03125},
+        {1633,1031,-0.03125}, {1633,1036,0.015625}, {1633,1038,0.015625}, {1633,1089,0.015625},
+        {1634,646,0.0625}, {1634,673,-0.0625}, {1634,755,-0.0625}, {1634,762,0.03125},
+        {1634,773,0.03125}, {1634,774,-0.0625}, {1634,779,-0.0625}, {1634,789,-0.0625},
+        {1634,797,-0.0625}, {1634,827,0.03125}, {1634,844,0.03125}, {1634,859,0.03125},
+        {1634,903,-0.0625}, {1634,921,0.0625}, {1634,935,0.03125}, {1634,945,0.0625},
+        {1634,1027,0.0625}, {1634,1051,-0.0625}, {1634,1099,0.03125}, {1634,1138,0.03125},
+        {1635,561,0.0625}, {1635,590,0.0625}, {1635,716,-0.125}, {1635,735,-0.125},
+        {1635,746,-0.125}, {1635,793,0.0625}, {1635,1033,0.0625}, {1635,1077,0.0625},
+        {1635,1088,0.0625}, {1636,585,-0.03125}, {1636,597,-0.0625}, {1636,669,0.0625},
+        {1636,679,-0.0625}, {1636,765,0.015625}, {1636,901,0.03125}, {1636,943,0.0078125},
+        {1636,1003,0.03125}, {1636,1059,0.015625}, {1636,1060,0.015625}, {1636,1061,0.015625},
+        {1636,1065,0.03125}, {1636,1151,0.0078125}, {1637,684,-0.125}, {1637,717,0.0625},
+        {1637,768,-0.125}, {1637,861,0.0625}, {1637,882,0.0625}, {1637,986,0.03125},
+        {1637,1063,0.0625}, {1637,1082,0.03125}, {1637,1135,0.03125}, {1637,1137,0.03125},
+        {1638,749,-0.125}, {1638,828,0.0625}, {1638,1006,0.03125}, {1638,1072,-0.0625},
+        {1638,1119,0.0625}, {1638,1130,0.0625}, {1638,1139,0.03125}, {1638,1148,0.03125},
+        {1639,686,-0.03125}, {1639,730,0.03125}, {1639,816,0.0625}, {1639,830,0.0625},
+        {1639,857,-0.03125}, {1639,865,-0.0625}, {1639,872,0.0625}, {1639,889,-0.0625},
+        {1639,948,0.03125}, {1639,967,0.03125}, {1639,980,-0.03125}, {1639,1106,-0.03125},
+        {1639,1114,0.03125}, {1639,1124,-0.0625}, {1640,574,-0.125}, {1640,595,0.0625},
+        {1640,689,0.125}, {1640,713,0.0625}, {1640,786,0.125}, {1640,877,-0.0625},
+        {1640,947,-0.125}, {1640,1074,-0.0625}, {1640,1085,0.0625}, {1640,1105,-0.0625},
+        {1640,1116,0.0625}, {1640,1133,-0.0625}, {1641,733,-0.125}, {1641,763,-0.125},
+        {1641,829,0.125}, {1641,1028,0.125}, {1641,1064,0.125}, {1641,1109,-0.125},
+        {1642,569,-0.03125}, {1642,681,0.015625}, {1642,704,0.015625}, {1642,899,-0.03125},
+        {1642,964,-0.03125}, {1642,974,0.015625}, {1642,989,-0.03125}, {1642,991,0.03125},
+        {1642,1034,0.015625}, {1642,1071,0.03125}, {1642,1083,-0.015625}, {1642,1097,0.03125},
+        {1642,1111,-0.015625}, {1642,1123,0.015625}, {1642,1128,0.015625}, {1642,1132,0.0078125},
+        {1642,1142,0.0078125}, {1642,1143,0.03125}, {1643,654,0.03125}, {1643,697,0.03125},
+        {1643,741,0.03125}, {1643,876,0.03125}, {1643,912,0.03125}, {1643,944,0.0625},
+        {1643,955,0.03125}, {1643,972,-0.0625}, {1643,1017,-0.0625}, {1643,1026,0.0625},
+        {1643,1049,-0.0625}, {1643,1073,0.03125}, {1643,1110,-0.0625}, {1643,1146,0.03125},
+        {1644,723,0.0625}, {1644,726,0.0625}, {1644,750,-0.125}, {1644,849,0.03125},
+        {1644,925,0.03125}, {1644,1078,0.0625}, {1644,1125,-0.0625}, {1644,1127,0.03125},
+        {1645,560,-0.0078125}, {1645,612,0.015625}, {1645,621,-0.0078125}, {1645,632,0.0078125},
+        {1645,645,-0.015625}, {1645,652,0.0078125}, {1645,670,0.00390625}, {1645,766,-0.00390625},
+        {1645,799,0.0078125}, {1645,847,-0.00390625}, {1645,854,0.0078125}, {1645,863,-0.0078125},
+        {1645,867,0.00390625}, {1645,885,0.015625}, {1645,902,0.015625}, {1645,914,-0.00390625},
+        {1645,962,-0.0078125}, {1645,995,0.015625}, {1645,1058,-0.00390625}, {1645,1087,0.0078125},
+        {1645,1102,-0.00390625}, {1645,1115,0.0078125}, {1645,1134,-0.0078125}, {1645,1136,-0.00390625},
+        {1646,644,-0.0078125}, {1646,722,0.015625}, {1646,728,0.015625}, {1646,818,-0.015625},
+        {1646,842,0.015625}, {1646,855,0.03125}, {1646,926,0.015625}, {1646,938,-0.0078125},
+        {1646,949,-0.015625}, {1646,971,-0.0078125}, {1646,977,-0.015625}, {1646,1002,0.03125},
+        {1646,1012,-0.015625}, {1646,1015,-0.015625}, {1646,1021,-0.015625}, {1646,1024,0.015625},
+        {1646,1040,0.015625}, {1646,1092,0.015625}, {1646,1100,-0.0078125}, {1646,1118,0.015625},
+        {1647,637,0.015625}, {1647,751,-0.015625}, {1647,879,0.03125}, {1647,888,0.03125},
+        {1647,892,-0.015625}, {1647,963,0.015625}, {1647,978,0.03125}, {1647,981,0.015625},
+        {1647,1057,-0.015625}, {1647,1080,-0.015625}, {1647,1098,-0.015625}, {1647,1120,-0.015625},
+        {1648,579,0.03125}, {1648,587,-0.03125}, {1648,607,-0.015625}, {1648,633,0.03125},
+        {1648,634,-0.03125}, {1648,638,0.015625}, {1648,650,-0.015625}, {1648,757,-0.03125},
+        {1648,785,0.03125}, {1648,802,0.015625}, {1648,848,-0.015625}, {1648,858,0.015625},
+        {1648,891,0.015625}, {1648,960,-0.015625}, {1649,564,0.03125}, {1649,578,-0.0625},
+        {1649,589,0.03125}, {1649,599,0.03125}, {1649,611,-0.0625}, {1649,761,0.0625},
+        {1649,817,-0.03125}, {1649,821,-0.03125}, {1649,837,-0.03125}, {1649,840,0.0625},
+        {1649,1069,0.03125}, {1649,1096,-0.03125}, {1650,582,0.0625}, {1650,629,-0.0625},
+        {1650,776,0.0625}, {1650,781,-0.0625}, {1650,927,0.0625}, {1650,998,-0.0625},
+        {1651,616,-0.03125}, {1651,678,-0.015625}, {1651,680,-0.03125}, {1651,699,0.03125},
+        {1651,701,-0.015625}, {1651,718,0.015625}, {1651,740,0.03125}, {1651,754,-0.03125},
+        {1651,792,0.015625}, {1651,835,0.03125}, {1651,846,0.015625}, {1651,1020,0.015625},
+        {1651,1086,-0.015625}, {1651,1122,-0.015625}, {1652,575,-0.0625}, {1652,619,0.03125},
+        {1652,623,-0.03125}, {1652,655,0.0625}, {1652,731,-0.0625}, {1652,833,0.0625},
+        {1652,929,-0.03125}, {1652,931,0.03125}, {1652,966,-0.03125}, {1652,996,0.03125},
+        {1652,1043,-0.03125}, {1652,1103,0.03125}, {1653,811,-0.0625}, {1653,910,0.0625},
+        {1653,957,0.0625}, {1653,1054,-0.0625}, {1653,1066,0.0625}, {1653,1093,-0.0625},
+        {1654,617,-0.015625}, {1654,630,-0.0078125}, {1654,668,0.015625}, {1654,759,0.03125},
+        {1654,823,0.03125}, {1654,932,-0.015625}, {1655,663,0.0625}, {1655,745,-0.03125},
+        {1655,906,0.0625}, {1655,956,-0.03125}, {1656,788,-0.03125}, {1656,825,0.03125},
+        {1656,942,0.0625}, {1656,1084,-0.015625}, {1657,592,-0.0625}, {1657,613,-0.03125},
+        {1657,694,0.03125}, {1657,709,0.03125}, {1657,798,0.0625}, {1657,860,0.015625},
+        {1657,897,-0.03125}, {1657,1039,-0.015625}, {1657,1046,-0.015625}, {1657,1062,0.015625},
+        {1658,586,0.0625}, {1658,742,-0.0625}, {1658,869,0.0625}, {1658,873,0.0625},
+        {1658,878,0.0625}, {1658,894,-0.0625}, {1658,959,-0.0625}, {1658,965,-0.0625},
+        {1659,640,-0.0625}, {1659,784,-0.0625}, {1659,1004,0.0625}, {1659,1022,0.0625},
+        {1659,1052,-0.0625}, {1659,1113,0.0625}, {1660,573,0.015625}, {1660,584,-0.03125},
+        {1660,642,0.015625}, {1660,719,0.03125}, {1660,753,0.03125}, {1660,767,0.03125},
+        {1660,777,-0.03125}, {1660,853,0.03125}, {1660,893,0.015625}, {1660,916,0.03125},
+        {1660,936,0.015625}, {1660,951,-0.03125}, {1660,1045,-0.015625}, {1660,1055,0.015625},
+        {1660,1081,-0.015625}, {1660,1090,-0.015625}, {1660,1112,-0.015625}, {1661,565,0.0625},
+        {1661,572,0.0625}, {1661,588,0.0625}, {1661,651,-0.03125}, {1661,664,0.0625},
+        {1661,682,0.0625}, {1661,764,-0.0625}, {1661,822,0.0625}, {1661,1041,-0.0625},
+        {1661,1047,-0.03125}, {1661,1050,-0.03125}, {1661,1068,-0.03125}, {1662,838,0.125},
+        {1662,905,0.0625}, {1662,975,-0.0625}, {1662,984,0.0625}, {1662,1013,-0.0625},
+        {1662,1101,-0.0625}, {1662,1145,0.03125}, {1663,669,0.0625}, {1663,765,-0.015625},
+        {1663,901,0.03125}, {1663,943,-0.0078125}, {1663,1003,0.03125}, {1663,1059,0.015625},
+        {1663,1060,-0.015625}, {1663,1061,0.015625}, {1663,1065,-0.03125}, {1663,1151,-0.0078125},
+        {1664,717,0.0625}, {1664,861,0.0625}, {1664,882,0.0625}, {1664,986,-0.03125},
+        {1664,1063,0.0625}, {1664,1082,-0.03125}, {1664,1135,-0.03125}, {1664,1137,-0.03125},
+        {1665,828,0.0625}, {1665,1006,-0.03125}, {1665,1119,0.0625}, {1665,1130,0.0625},
+        {1665,1139,-0.03125}, {1665,1148,-0.03125}, {1666,617,0.03125}, {1666,630,0.015625},
+        {1666,668,0.03125}, {1666,759,0.0625}, {1666,823,0.0625}, {1666,922,-0.015625},
+        {1666,924,-0.0625}, {1666,932,0.03125}, {1666,933,-0.015625}, {1666,983,-0.03125},
+        {1666,1053,-0.03125}, {1667,663,0.125}, {1667,712,-0.0625}, {1667,745,0.0625},
+        {1667,900,-0.0625}, {1667,906,0.125}, {1667,952,-0.0625}, {1667,956,0.0625},
+        {1667,1149,-0.0625}, {1668,788,0.0625}, {1668,825,0.0625}, {1668,917,-0.0625},
+        {1668,942,0.125}, {1668,985,-0.0625}, {1668,1084,0.03125}, {1668,1126,-0.0625},
+        {1669,573,0.015625}, {1669,584,0.03125}, {1669,642,0.015625}, {1669,719,0.03125},
+        {1669,753,0.03125}, {1669,767,0.03125}, {1669,777,0.03125}, {1669,853,0.03125},
+        {1669,893,0.015625}, {1669,916,0.03125}, {1669,936,0.015625}, {1669,951,0.03125},
+        {1669,1045,0.015625}, {1669,1055,0.015625}, {1669,1081,0.015625}, {1669,1090,0.015625},
+        {1669,1112,0.015625}, {1670,565,0.0625}, {1670,572,0.0625}, {1670,588,0.0625},
+        {1670,651,0.03125}, {1670,664,0.0625}, {1670,682,0.0625}, {1670,764,0.0625},
+        {1670,822,0.0625}, {1670,1041,0.0625}, {1670,1047,0.03125}, {1670,1050,0.03125},
+        {1670,1068,0.03125}, {1671,838,0.125}, {1671,905,0.0625}, {1671,975,0.0625},
+        {1671,984,0.0625}, {1671,1013,0.0625}, {1671,1101,0.0625}, {1671,1145,0.03125},
+        {1672,671,0.03125}, {1672,677,0.03125}, {1672,687,0.03125}, {1672,711,0.03125},
+        {1672,739,0.03125}, {1672,758,0.03125}, {1672,807,0.03125}, {1672,868,0.03125},
+        {1672,880,0.03125}, {1672,969,0.03125}, {1672,979,0.03125}, {1672,1008,0.03125},
+        {1672,1016,0.03125}, {1672,1019,0.03125}, {1672,1023,0.03125}, {1672,1044,0.03125},
+        {1672,1075,0.03125}, {1672,1091,0.03125}, {1672,1107,0.03125}, {1672,1150,0.03125},
+        {1673,622,0.0625}, {1673,627,0.0625}, {1673,803,0.0625}, {1673,826,0.0625},
+        {1673,850,0.0625}, {1673,852,0.0625}, {1673,870,0.0625}, {1673,886,0.0625},
+        {1673,958,0.0625}, {1673,968,0.0625}, {1673,1007,0.0625}, {1673,1010,0.0625},
+        {1673,1025,0.0625}, {1673,1032,0.0625}, {1673,1048,0.0625}, {1673,1117,0.0625},
+        {1674,603,0.125}, {1674,796,0.125}, {1674,845,0.125}, {1674,1095,0.125},
+        {1674,1108,0.125}, {1674,1140,0.125}, {1675,563,0.0625}, {1675,624,0.0625},
+        {1675,636,0.0625}, {1675,702,0.0625}, {1675,720,0.0625}, {1675,747,0.0625},
+        {1675,791,0.0625}, {1675,815,0.0625}, {1675,831,0.0625}, {1675,919,0.0625},
+        {1676,610,0.125}, {1676,639,0.125}, {1676,649,0.125}, {1676,656,0.125},
+        {1676,696,0.125}, {1676,805,0.125}, {1676,843,0.125}, {1676,1001,0.125},
+        {1677,643,0.25}, {1677,738,0.25}, {1677,752,0.25}, {1678,727,0.0625},
+        {1678,954,0.125}, {1678,973,0.125}, {1678,1030,0.125}, {1678,1079,0.0625},
+        {1678,1121,0.125}, {1679,606,0.25}, {1679,691,0.25}, {1679,725,0.25},
+        {1679,890,0.25}, {1680,635,0.5}, {1680,884,0.25}, {1681,596,0.125},
+        {1681,715,0.125}, {1681,782,0.125}, {1681,836,0.125}, {1681,874,0.0625},
+        {1681,934,0.0625}, {1682,594,0.25}, {1682,614,0.25}, {1682,710,0.25},
+        {1682,775,0.25}, {1683,685,0.5}, {1683,990,0.25}, {1684,576,0.03125},
+        {1684,605,0.03125}, {1684,618,0.03125}, {1684,628,0.03125}, {1684,641,0.03125},
+        {1684,659,0.03125}, {1684,676,0.03125}, {1684,700,0.03125}, {1684,721,0.03125},
+        {1684,744,0.03125}, {1684,794,0.03125}, {1684,806,0.03125}, {1684,824,0.03125},
+        {1684,862,0.03125}, {1684,864,0.03125}, {1684,896,0.03125}, {1684,909,0.03125},
+        {1684,946,0.03125}, {1684,961,0.03125}, {1684,994,0.03125}, {1685,581,0.0625},
+        {1685,593,0.0625}, {1685,598,0.0625}, {1685,648,0.0625}, {1685,695,0.0625},
+        {1685,708,0.0625}, {1685,714,0.0625}, {1685,736,0.0625}, {1685,772,0.0625},
+        {1685,810,0.0625}, {1685,887,0.0625}, {1685,904,0.0625}, {1685,915,0.0625},
+        {1685,950,0.0625}, {1685,970,0.0625}, {1685,1005,0.0625}, {1686,620,0.125},
+        {1686,662,0.125}, {1686,666,0.125}, {1686,706,0.125}, {1686,800,0.125},
+        {1686,997,0.125}, {1687,569,0.03125}, {1687,681,0.015625}, {1687,704,0.015625},
+        {1687,899,0.03125}, {1687,964,0.03125}, {1687,974,0.015625}, {1687,989,0.03125},
+        {1687,991,0.03125}, {1687,1034,0.015625}, {1687,1071,0.03125}, {1687,1083,0.015625},
+        {1687,1097,0.03125}, {1687,1111,0.015625}, {1687,1123,0.015625}, {1687,1128,0.015625},
+        {1687,1132,0.0078125}, {1687,1142,0.0078125}, {1687,1143,0.03125}, {1688,654,0.03125},
+        {1688,697,0.03125}, {1688,741,0.03125}, {1688,876,0.03125}, {1688,912,0.03125},
+        {1688,944,0.0625}, {1688,955,0.03125}, {1688,972,0.0625}, {1688,1017,0.0625},
+        {1688,1026,0.0625}, {1688,1049,0.0625}, {1688,1073,0.03125}, {1688,1110,0.0625},
+        {1688,1146,0.03125}, {1689,723,0.0625}, {1689,726,0.0625}, {1689,750,0.125},
+        {1689,849,0.03125}, {1689,925,0.03125}, {1689,1078,0.0625}, {1689,1125,0.0625},
+        {1689,1127,0.03125}, {1690,686,0.03125}, {1690,730,0.03125}, {1690,816,0.0625},
+        {1690,830,0.0625}, {1690,857,0.03125}, {1690,865,0.0625}, {1690,872,0.0625},
+        {1690,889,0.0625}, {1690,948,0.03125}, {1690,967,0.03125}, {1690,980,0.03125},
+        {1690,1106,0.03125}, {1690,1114,0.03125}, {1690,1124,0.0625}, {1691,574,0.125},
+        {1691,595,0.0625}, {1691,689,0.125}, {1691,713,0.0625}, {1691,786,0.125},
+        {1691,877,0.0625}, {1691,947,0.125}, {1691,1074,0.0625}, {1691,1085,0.0625},
+        {1691,1105,0.0625}, {1691,1116,0.0625}, {1691,1133,0.0625}, {1692,733,0.125},
+        {1692,763,0.125}, {1692,829,0.125}, {1692,1028,0.125}, {1692,1064,0.125},
+        {1692,1109,0.125}, {1693,734,0.125}, {1693,819,0.125}, {1693,907,0.0625},
+        {1693,1009,0.0625}, {1693,1042,0.0625}, {1693,1129,0.0625}, {1693,1144,0.125},
+        {1694,591,0.25}, {1694,601,0.125}, {1694,660,0.25}, {1694,667,0.125},
+        {1694,898,0.125}, {1694,1037,0.125}, {1695,928,0.25}, {1695,1056,0.25},
+        {1695,1094,0.25}, {1696,724,0.0625}, {1696,737,0.0625}, {1696,748,0.125},
+        {1696,795,0.0625}, {1696,930,0.125}, {1696,1035,0.125}, {1696,1070,0.0625},
+        {1697,571,0.25}, {1697,732,0.25}, {1697,770,0.125}, {1697,832,0.125},
+        {1697,866,0.125}, {1697,941,0.125}, {1698,567,0.25}, {1698,923,0.25},
+        {1698,953,0.25}, {1699,577,0.03125}, {1699,653,0.03125}, {1699,658,0.03125},
+        {1699,661,0.03125}, {1699,672,0.015625}, {1699,675,0.015625}, {1699,688,0.03125},
+        {1699,778,0.03125}, {1699,780,0.03125}, {1699,783,0.015625}, {1699,790,0.03125},
+        {1699,813,0.015625}, {1699,875,0.03125}, {1699,895,0.03125}, {1699,918,0.03125},
+        {1699,982,0.03125}, {1699,988,0.03125}, {1699,992,0.03125}, {1699,1000,0.015625},
+        {1699,1029,0.03125}, {1699,1031,0.03125}, {1699,1036,0.015625}, {1699,1038,0.015625},
+        {1699,1089,0.015625}, {1700,646,0.0625}, {1700,673,0.0625}, {1700,755,0.0625},
+        {1700,762,0.03125}, {1700,773,0.03125}, {1700,774,0.0625}, {1700,779,0.0625},
+        {1700,789,0.0625}, {1700,797,0.0625}, {1700,827,0.03125}, {1700,844,0.03125},
+        {1700,859,0.03125}, {1700,903,0.0625}, {1700,921,0.0625}, {1700,935,0.03125},
+        {1700,945,0.0625}, {1700,1027,0.0625}, {1700,1051,0.0625}, {1700,1099,0.03125},
+        {1700,1138,0.03125}, {1701,561,0.0625}, {1701,590,0.0625}, {1701,716,0.125},
+        {1701,735,0.125}, {1701,746,0.125}, {1701,793,0.0625}, {1701,1033,0.0625},
+        {1701,1077,0.0625}, {1701,1088,0.0625}, {1702,585,0.03125}, {1702,597,0.0625},
+        {1702,669,0.0625}, {1702,679,0.0625}, {1702,765,0.015625}, {1702,901,0.03125},
+        {1702,943,0.0078125}, {1702,1003,0.03125}, {1702,1059,0.015625}, {1702,1060,0.015625},
+        {1702,1061,0.015625}, {1702,1065,0.03125}, {1702,1151,0.0078125}, {1703,684,0.125},
+        {1703,717,0.0625}, {1703,768,0.125}, {1703,861,0.0625}, {1703,882,0.0625},
+        {1703,986,0.03125}, {1703,1063,0.0625}, {1703,1082,0.03125}, {1703,1135,0.03125},
+        {1703,1137,0.03125}, {1704,749,0.125}, {1704,828,0.0625}, {1704,1006,0.03125},
+        {1704,1072,0.0625}, {1704,1119,0.0625}, {1704,1130,0.0625}, {1704,1139,0.03125},
+        {1704,1148,0.03125}, {1705,808,0.125}, {1705,908,0.25}, {1705,1014,0.0625},
+        {1705,1076,0.0625}, {1705,1104,0.125}, {1706,698,0.25}, {1706,705,0.25},
+        {1706,937,0.25}, {1706,976,0.25}, {1707,566,0.25}, {1707,693,0.25},
+        {1707,769,0.25}, {1708,592,0.125}, {1708,613,0.0625}, {1708,694,0.0625},
+        {1708,709,0.0625}, {1708,798,0.125}, {1708,860,0.03125}, {1708,897,0.0625},
+        {1708,1039,0.03125}, {1708,1046,0.03125}, {1708,1062,0.03125}, {1709,586,0.125},
+        {1709,742,0.125}, {1709,869,0.125}, {1709,873,0.125}, {1709,878,0.125},
+        {1709,894,0.125}, {1709,959,0.125}, {1709,965,0.125}, {1710,640,0.125},
+        {1710,784,0.125}, {1710,1004,0.125}, {1710,1022,0.125}, {1710,1052,0.125},
+        {1710,1113,0.125}, {1711,568,0.0625}, {1711,616,0.03125}, {1711,657,0.0625},
+        {1711,678,0.015625}, {1711,680,0.03125}, {1711,683,0.03125}, {1711,699,0.03125},
+        {1711,701,0.015625}, {1711,707,0.03125}, {1711,718,0.015625}, {1711,740,0.03125},
+        {1711,754,0.03125}, {1711,792,0.015625}, {1711,812,0.0625}, {1711,835,0.03125},
+        {1711,846,0.015625}, {1711,913,0.03125}, {1711,1018,0.03125}, {1711,1020,0.015625},
+        {1711,1086,0.015625}, {1711,1122,0.015625}, {1712,575,0.0625}, {1712,580,0.125},
+        {1712,604,0.0625}, {1712,619,0.03125}, {1712,623,0.03125}, {1712,631,0.125},
+        {1712,647,0.0625}, {1712,655,0.0625}, {1712,731,0.0625}, {1712,756,0.0625},
+        {1712,833,0.0625}, {1712,841,0.0625}, {1712,929,0.03125}, {1712,931,0.03125},
+        {1712,966,0.03125}, {1712,996,0.03125}, {1712,1043,0.03125}, {1712,1103,0.03125},
+        {1713,602,0.125}, {1713,771,0.125}, {1713,811,0.0625}, {1713,910,0.0625},
+        {1713,957,0.0625}, {1713,987,0.125}, {1713,1054,0.0625}, {1713,1066,0.0625},
+        {1713,1093,0.0625}, {1714,615,0.25}, {1714,804,0.25}, {1714,1152,0.125},
+        {1715,609,0.5}, {1715,665,0.5}, {1716,1131,0.5}, {1716,1147,0.25},
+        {1717,939,0.25}, {1717,999,0.25}, {1717,1141,0.125}, {1718,626,0.5},
+        {1718,911,0.5}, {1719,729,0.25}, {1719,881,0.5}, {1720,562,0.125},
+        {1720,570,0.0625}, {1720,703,0.0625}, {1720,820,0.125}, {1720,834,0.125},
+        {1720,851,0.0625}, {1720,940,0.0625}, {1721,600,0.25}, {1721,625,0.125},
+        {1721,690,0.125}, {1721,743,0.25}, {1721,801,0.125}, {1721,993,0.125},
+        {1722,814,0.25}, {1722,920,0.25}, {1722,1067,0.25}, {1723,617,0.03125},
+        {1723,630,0.015625}, {1723,668,0.03125}, {1723,759,0.0625}, {1723,823,0.0625},
+        {1723,922,0.015625}, {1723,924,0.0625}, {1723,932,0.03125}, {1723,933,0.015625},
+        {1723,983,0.03125}, {1723,1053,0.03125}, {1724,663,0.125}, {1724,712,0.0625},
+        {1724,745,0.0625}, {1724,900,0.0625}, {1724,906,0.125}, {1724,952,0.0625},
+        {1724,956,0.0625}, {1724,1149,0.0625}, {1725,788,0.0625}, {1725,825,0.0625},
+        {1725,917,0.0625}, {1725,942,0.125}, {1725,985,0.0625}, {1725,1084,0.03125},
+        {1725,1126,0.0625}, {1726,579,0.0625}, {1726,587,0.0625}, {1726,607,0.03125},
+        {1726,633,0.0625}, {1726,634,0.0625}, {1726,638,0.03125}, {1726,650,0.03125},
+        {1726,757,0.0625}, {1726,785,0.0625}, {1726,802,0.03125}, {1726,848,0.03125},
+        {1726,858,0.03125}, {1726,891,0.03125}, {1726,960,0.03125}, {1727,564,0.0625},
+        {1727,578,0.125}, {1727,589,0.0625}, {1727,599,0.0625}, {1727,611,0.125},
+        {1727,761,0.125}, {1727,817,0.0625}, {1727,821,0.0625}, {1727,837,0.0625},
+        {1727,840,0.125}, {1727,1069,0.0625}, {1727,1096,0.0625}, {1728,582,0.125},
+        {1728,629,0.125}, {1728,776,0.125}, {1728,781,0.125}, {1728,927,0.125},
+        {1728,998,0.125}, {1729,560,0.0078125}, {1729,583,0.03125}, {1729,612,0.015625},
+        {1729,621,0.0078125}, {1729,632,0.0078125}, {1729,645,0.015625}, {1729,652,0.0078125},
+        {1729,670,0.00390625}, {1729,766,0.00390625}, {1729,787,0.015625}, {1729,799,0.0078125},
+        {1729,839,0.03125}, {1729,847,0.00390625}, {1729,854,0.0078125}, {1729,856,0.03125},
+        {1729,863,0.0078125}, {1729,867,0.00390625}, {1729,871,0.03125}, {1729,885,0.015625},
+        {1729,902,0.015625}, {1729,914,0.00390625}, {1729,962,0.0078125}, {1729,995,0.015625},
+        {1729,1011,0.015625}, {1729,1058,0.00390625}, {1729,1087,0.0078125}, {1729,1102,0.00390625},
+        {1729,1115,0.0078125}, {1729,1134,0.0078125}, {1729,1136,0.00390625}, {1730,608,0.0625},
+        {1730,644,0.0078125}, {1730,692,0.0625}, {1730,722,0.015625}, {1730,728,0.015625},
+        {1730,760,0.0625}, {1730,818,0.015625}, {1730,842,0.015625}, {1730,855,0.03125},
+        {1730,883,0.0625}, {1730,926,0.015625}, {1730,938,0.0078125}, {1730,949,0.015625},
+        {1730,971,0.0078125}, {1730,977,0.015625}, {1730,1002,0.03125}, {1730,1012,0.015625},
+        {1730,1015,0.015625}, {1730,1021,0.015625}, {1730,1024,0.015625}, {1730,1040,0.015625},
+        {1730,1092,0.015625}, {1730,1100,0.0078125}, {1730,1118,0.015625}, {1731,637,0.015625},
+        {1731,674,0.0625}, {1731,751,0.015625}, {1731,809,0.125}, {1731,879,0.03125},
+        {1731,888,0.03125}, {1731,892,0.015625}, {1731,963,0.015625}, {1731,978,0.03125},
+        {1731,981,0.015625}, {1731,1057,0.015625}, {1731,1080,0.015625}, {1731,1098,0.015625},
+        {1731,1120,0.015625}
+    };
+
+    for (int i = 0; i < 1732; i++)
+        c[i] = 0.;
+    for (int l = 0; l < 13169; l++)
+        c[links[l].term] += links[l].weight*a[links[l].index];
+}
@@ -0,0 +1,374 @@
+#!/usr/bin/env python3
+"""
+Generates twobodyForcePolynomialSymmetric.cu, the symmetry reduced form of the MB-pol 2B polynomial,
+from the Maple code of twobodyForcePolynomial.cu:
+
+    python3 twobodyForcePolynomialSymmetric.py > twobodyForcePolynomialSymmetric.cu
+
+The 31 variables of computeDimerVariables are permuted by the group of order 32 generated by swapping
+the hydrogens of either monomer, swapping the lone pairs (extra points) of either monomer and swapping
+the monomers, and the energy is invariant under it: each of the 1153 coefficients multiplies the sum of
+the orbit of one monomial, 12725 monomials in all.
+
+The polynomial is rewritten in symmetry adapted coordinates z, a fixed sum and difference transform of
+the variables. First, within each set of variables that the hydrogen and lone pair swaps permute, the
+Hadamard combinations: the sum is invariant, the differences change sign under one swap or a pair of them.
+Then the same with the pairs of coordinates that the monomer swap exchanges. Only products whose signs
+cancel, i.e. invariants, survive, so the polynomial shrinks to about 1700 terms. The terms are evaluated as
+one nested Horner scheme, sharing the sums of every common factor, and the gradient by reverse accumulation
+over that scheme then back through the transform. The coefficients of the terms are fixed linear
+combinations of the 1153 coefficients, folded once by poly_2b_v6x_symmetric_coefficients().
+
+The coordinates and the products of them may be evaluated in a narrower type (real) than the sums weighted by
+the coefficients (accum), which is how the mixed precision keeps the monomials in float and every sum in double.
+
+Only the energy part of the Maple code is read, the gradient is derived here.
+"""
+
+import collections
+import random
+import re
+import sys
+from fractions import Fraction
+
+MAPLE_SOURCE = 'twobodyForcePolynomial.cu'
+
+# Sites of the variables, in the order of computeDimerVariables
+SITE_PAIRS = [
+    ('Ha1', 'Ha2'), ('Hb1', 'Hb2'),
+    ('Oa', 'Ha1'), ('Oa', 'Ha2'), ('Ob', 'Hb1'), ('Ob', 'Hb2'),
+    ('Ha1', 'Hb1'), ('Ha1', 'Hb2'), ('Ha2', 'Hb1'), ('Ha2', 'Hb2'),
+    ('Oa', 'Hb1'), ('Oa', 'Hb2'), ('Ob', 'Ha1'), ('Ob', 'Ha2'), ('Oa', 'Ob'),
+    ('Xa1', 'Hb1'), ('Xa1', 'Hb2'), ('Xa2', 'Hb1'), ('Xa2', 'Hb2'),
+    ('Xb1', 'Ha1'), ('Xb1', 'Ha2'), ('Xb2', 'Ha1'), ('Xb2', 'Ha2'),
+    ('Oa', 'Xb1'), ('Oa', 'Xb2'), ('Ob', 'Xa1'), ('Ob', 'Xa2'),
+    ('Xa1', 'Xb1'), ('Xa1', 'Xb2'), ('Xa2', 'Xb1'), ('Xa2', 'Xb2')]
+NVARS = len(SITE_PAIRS)
+
+SWAPS = {
+    'Ha': {'Ha1': 'Ha2', 'Ha2': 'Ha1'},
+    'Hb': {'Hb1': 'Hb2', 'Hb2': 'Hb1'},
+    'Xa': {'Xa1': 'Xa2', 'Xa2': 'Xa1'},
+    'Xb': {'Xb1': 'Xb2', 'Xb2': 'Xb1'},
+    'ab': {'Ha1': 'Hb1', 'Hb1': 'Ha1', 'Ha2': 'Hb2', 'Hb2': 'Ha2', 'Oa': 'Ob', 'Ob': 'Oa',
+           'Xa1': 'Xb1', 'Xb1': 'Xa1', 'Xa2': 'Xb2', 'Xb2': 'Xa2'}}
+
+# Stage 1: sets of variables permuted by the hydrogen and lone pair swaps, as Hadamard blocks
+BLOCKS = [(2, 3), (4, 5), (6, 7, 8, 9), (10, 11), (12, 13), (15, 16, 17, 18), (19, 20, 21, 22),
+          (23, 24), (25, 26), (27, 28, 29, 30)]
+HADAMARD = {2: [[1, 1], [1, -1]],
+            4: [[1, 1, 1, 1], [1, 1, -1, -1], [1, -1, 1, -1], [1, -1, -1, 1]]}
+
+# Stage 2: pairs of stage 1 coordinates exchanged by the monomer swap
+MONOMER_PAIRS = [(0, 1), (2, 4), (3, 5), (7, 8), (10, 12), (11, 13), (15, 19), (16, 20), (17, 21),
+                 (18, 22), (23, 25), (24, 26), (28, 29)]
+
+
+def read_maple_energy(filename):
+    """The energy as {(coefficient, monomial): multiplicity}, a monomial is a sorted tuple of variables"""
+    source = open(filename).read()
+    body = source[source.index('real df['):source.index('// the energy is complete')]
+    statements = [s.strip() for s in body.split(';')[1:] if s.strip()]
+    token = re.compile(r'\s*(a\[\d+\]|x\[\d+\]|t\d+|\(|\)|\+|\*)')
+    values = {}
+
+    def add(p, q):
+        r = dict(p)
+        for k, v in q.items():
+            r[k] = r.get(k, 0) + v
+        return r
+
+    def mul(p, q):
+        r = collections.defaultdict(int)
+        for (ca, ma), va in p.items():
+            for (cb, mb), vb in q.items():
+                assert ca is None or cb is None, 'not linear in the coefficients'
+                r[(ca if ca is not None else cb, tuple(sorted(ma + mb)))] += va * vb
+        return dict(r)
+
+    def parse(text):
+        tokens = token.findall(text)
+        pos = [0]
+
+        def expr():
+            r = term()
+            while pos[0] < len(tokens) and tokens[pos[0]] == '+':
+                pos[0] += 1
+                r = add(r, term())
+            return r
+
+        def term():
+            r = factor()
+            while pos[0] < len(tokens) and tokens[pos[0]] == '*':
+                pos[0] += 1
+                r = mul(r, factor())
+            return r
+
+        def factor():
+            t = tokens[pos[0]]
+            pos[0] += 1
+            if t == '(':
+                r = expr()
+                assert tokens[pos[0]] == ')'
+                pos[0] += 1
+                return r
+            if t.startswith('a['):
+                return {(int(t[2:-1]), ()): 1}
+            if t.startswith('x['):
+                return {(None, (int(t[2:-1]),)): 1}
+            return values[t]
+
+        r = expr()
+        assert pos[0] == len(tokens), text
+        return r
+
+    for s in statements:
+        m = re.match(r'const real (t\d+) = (.*)', s, re.S)
+        assert m, s
+        values[m.group(1)] = parse(m.group(2))
+
+    result = re.search(r'return (t\d+)\+(t\d+);', source[source.index('// the energy is complete'):])
+    return add(values[result.group(1)], values[result.group(2)])
+
+
+def variable_permutation(swap):
+    index = {frozenset(p): i for i, p in enumerate(SITE_PAIRS)}
+    return [index[frozenset(swap.get(s, s) for s in p)] for p in SITE_PAIRS]
+
+
+def check_invariance(energy):
+    for name, swap in SWAPS.items():
+        p = variable_permutation(swap)
+        for (c, m) in energy:
+            assert (c, tuple(sorted(p[v] for v in m))) in energy, 'not invariant under the swap ' + name
+
+
+def inverse_transforms():
+    """x in terms of the stage 1 coordinates y, and y in terms of the coordinates z, {i: {j: weight}}"""
+    x_of_y = {i: {i: Fraction(1)} for i in range(NVARS)}
+    for block in BLOCKS:
+        h = HADAMARD[len(block)]
+        for r, i in enumerate(block):
+            x_of_y[i] = {block[c]: Fraction(h[c][r], len(block)) for c in range(len(block))}
+    y_of_z = {i: {i: Fraction(1)} for i in range(NVARS)}
+    for a, b in MONOMER_PAIRS:
+        y_of_z[a] = {a: Fraction(1, 2), b: Fraction(1, 2)}
+        y_of_z[b] = {a: Fraction(1, 2), b: Fraction(-1, 2)}
+    return x_of_y, y_of_z
+
+
+def substitute(poly, transform):
+    """{monomial: {coefficient: weight}} with every variable replaced by its linear combination"""
+    result = collections.defaultdict(lambda: collections.defaultdict(Fraction))
+    for m, weights in poly.items():
+        terms = {(): Fraction(1)}
+        for v in m:
+            expanded = collections.defaultdict(Fraction)
+            for t, w in terms.items():
+                for j, tw in transform[v].items():
+                    expanded[tuple(sorted(t + (j,)))] += w * tw
+            terms = expanded
+        for t, w in terms.items():
+            if w != 0:
+                for c, cw in weights.items():
+                    result[t][c] += w * cw
+    return {m: {c: w for c, w in ws.items() if w != 0}
+            for m, ws in result.items() if any(w != 0 for w in ws.values())}
+
+
+def horner_edges(terms, order):
+    rank = {v: i for i, v in enumerate(order)}
+    prefixes = set()
+    for m in terms:
+        s = sorted(m, key=lambda v: rank[v])
+        for i in range(1, len(s) + 1):
+            prefixes.add(tuple(s[:i]))
+    return len(prefixes)
+
+
+def factor_order(terms):
+    """Order of the factors of the nested scheme, a seeded local search for the fewest multiplications"""
+    frequency = collections.Counter(v for m in terms for v in set(m))
+    order = sorted(range(NVARS), key=lambda v: (frequency[v], v))
+    best = horner_edges(terms, order)
+    rng = random.Random(2)
+    for _ in range(3000):
+        candidate = order[:]
+        i, j = rng.sample(range(NVARS), 2)
+        candidate[i], candidate[j] = candidate[j], candidate[i]
+        edges = horner_edges(terms, candidate)
+        if edges <= best:
+            order, best = candidate, edges
+    return order
+
+
+def statement(lhs, parts, width=110):
+    """lhs followed by the sum of parts, continued on the next lines as the Maple code does"""
+    lines = [lhs + parts[0]]
+    for p in parts[1:]:
+        if len(lines[-1]) + 1 + len(p) > width:
+            lines.append('        +' + p)
+        else:
+            lines[-1] += '+' + p
+    return '\n'.join(lines) + ';\n'
+
+
+class Node:
+    def __init__(self, prefix):
+        self.prefix = prefix
+        self.term = None      # index of the coefficient of this product, if it is a term
+        self.children = {}    # factor -> Node
+        self.name = None      # temporary holding its value, None for a lone coefficient
+
+
+def build_tree(terms, order):
+    rank = {v: i for i, v in enumerate(order)}
+    root = Node(())
+    keys = sorted(terms, key=lambda m: (len(m), sorted(rank[v] for v in m)))
+    for index, m in enumerate(keys):
+        node = root
+        for v in sorted(m, key=lambda v: rank[v]):
+            node = node.children.setdefault(v, Node(node.prefix + (v,)))
+        node.term = index
+    return root, keys
+
+
+def emit(energy, out):
+    check_invariance(energy)
+    poly = collections.defaultdict(dict)
+    for (c, m), v in energy.items():
+        poly[m][c] = Fraction(v)
+    x_of_y, y_of_z = inverse_transforms()
+    terms = substitute(substitute(poly, x_of_y), y_of_z)
+    order = factor_order(terms)
+    root, keys = build_tree(terms, order)
+    links = sum(len(terms[m]) for m in keys)
+
+    w = out.write
+    w('// code generated by twobodyForcePolynomialSymmetric.py from the Maple code of twobodyForcePolynomial.cu,\n')
+    w('// do not edit\n\n')
+    w('// Symmetry reduced form of poly_2b_v6x_eval: %d terms in the coordinates z instead of %d monomials\n'
+      % (len(keys), len(energy)))
+    w('// in the variables x, see twobodyForcePolynomialSymmetric.py. c are the POLY_NUM_SYMMETRIC_TERMS\n')
+    w('// coefficients of poly_2b_v6x_symmetric_coefficients(). The energy and the gradient equal those\n')
+    w('// of poly_2b_v6x_eval to round-off. real holds the coordinates and the products of them, accum the sums\n')
+    w('// weighted by the coefficients (the scheme, the energy and the gradient): both double, or float lanes\n')
+    w('// and double lanes for the mixed precision of TwoBodyPolynomial.\n')
+    w('template <typename real, bool gradient, typename coefficient, typename accum>\n')
+    w('__device__ accum poly_2b_v6x_symmetric_eval(\n')
+    w('                         const coefficient * __restrict__ c,\n')
+    w('                         const real x[31],\n')
+    w('                               accum g[31])\n{\n')
+
+    # forward transform, the sums and differences
+    w('    // sums and differences over the hydrogen and lone pair swaps\n')
+    ysrc = {i: 'x[%d]' % i for i in range(NVARS)}
+    for block in BLOCKS:
+        h = HADAMARD[len(block)]
+        for c in range(len(block)):
+            expr = ''.join(('+' if h[c][r] > 0 else '-') + 'x[%d]' % block[r] for r in range(len(block)))
+            w('    const real y%d = %s;\n' % (block[c], expr.lstrip('+')))
+            ysrc[block[c]] = 'y%d' % block[c]
+    w('    // then over the monomer swap\n')
+    paired = {}
+    for a, b in MONOMER_PAIRS:
+        paired[a] = '%s+%s' % (ysrc[a], ysrc[b])
+        paired[b] = '%s-%s' % (ysrc[a], ysrc[b])
+    for i in range(NVARS):
+        w('    const real z%d = %s;\n' % (i, paired.get(i, ysrc[i])))
+
+    # forward Horner scheme, children before parents
+    w('\n    // nested Horner scheme of the terms\n')
+    count = [0]
+    nodes = []
+
+    def value(node):
+        return node.name if node.name is not None else 'c[%d]' % node.term
+
+    def product(factor, child):
+        """factor, a coordinate or a product of them, times the value of child, widened to accum"""
+        return value(child) if factor is None else 'accum(%s)*%s' % (factor, value(child))
+
+    def forward(node):
+        for v in sorted(node.children):
+            forward(node.children[v])
+        if not node.children:
+            return
+        parts = ['c[%d]' % node.term] if node.term is not None else []
+        parts += [product('z%d' % v, node.children[v]) for v in sorted(node.children)]
+        if node.prefix:
+            node.name = 's%d' % count[0]
+            count[0] += 1
+            nodes.append(node)
+            w(statement('    const accum %s = ' % node.name, parts))
+        else:
+            w(statement('    const accum energy = ', parts))
+
+    forward(root)
+    w('\n    if (!gradient)\n        return energy;\n')
+
+    # reverse accumulation: the adjoint of a node is the product of the factors of its prefix
+    w('\n    // adjoints of the inner sums, the products of their factors\n')
+    gz = collections.defaultdict(list)
+    products = [0]
+
+    def reverse(node, name):
+        for v in sorted(node.children):
+            child = node.children[v]
+            gz[v].append(product(name, child))
+            if child.children:
+                if name is None:
+                    child_name = 'z%d' % v
+                else:
+                    child_name = 'p%d' % products[0]
+                    products[0] += 1
+                    w('    const real %s = %s*z%d;\n' % (child_name, name, v))
+                reverse(child, child_name)
+
+    reverse(root, None)
+
+    w('\n    // gradient with respect to z\n')
+    for v in range(NVARS):
+        w(statement('    const accum gz%d = ' % v, gz[v] or ['accum(0)']))
+
+    w('\n    // back through the monomer swap\n')
+    gysrc = {i: 'gz%d' % i for i in range(NVARS)}
+    for a, b in MONOMER_PAIRS:
+        w('    const accum gy%d = gz%d+gz%d;\n' % (a, a, b))
+        w('    const accum gy%d = gz%d-gz%d;\n' % (b, a, b))
+        gysrc[a], gysrc[b] = 'gy%d' % a, 'gy%d' % b
+    w('    // and the hydrogen and lone pair swaps\n')
+    gx = {i: gysrc[i] for i in range(NVARS)}
+    for block in BLOCKS:
+        h = HADAMARD[len(block)]
+        for r in range(len(block)):
+            gx[block[r]] = ''.join(('+' if h[c][r] > 0 else '-') + gysrc[block[c]]
+                                   for c in range(len(block))).lstrip('+')
+    for i in range(NVARS):
+        w('    g[%d] = %s;\n' % (i, gx[i]))
+    w('\n    return energy;\n}\n\n')
+
+    # folding of the coefficients
+    w('// Coefficients of the %d terms of poly_2b_v6x_symmetric_eval from the %d of poly_2b_v6x_eval,\n'
+      % (len(keys), POLY_NUM_COEFFICIENTS))
+    w('// each a sum of %d exact binary fractions of them in all\n' % links)
+    w('void poly_2b_v6x_symmetric_coefficients(const double * a, double * c)\n{\n')
+    w('    // term, coefficient, weight\n')
+    w('    static const struct { short term, index; double weight; } links[%d] = {\n' % links)
+    entries = ['{%d,%d,%s}' % (t, k, repr(float(wt)))
+               for t, m in enumerate(keys) for k, wt in sorted(terms[m].items())]
+    for i in range(0, len(entries), 4):
+        w('        ' + ', '.join(entries[i:i + 4]) + (',\n' if i + 4 < len(entries) else '\n'))
+    w('    };\n\n')
+    w('    for (int i = 0; i < %d; i++)\n        c[i] = 0.;\n' % len(keys))
+    w('    for (int l = 0; l < %d; l++)\n        c[links[l].term] += links[l].weight*a[links[l].index];\n}\n'
+      % links)
+
+    sys.stderr.write('%d terms, %d products in the nested scheme, %d links\n'
+                     % (len(keys), horner_edges(terms, order), links))
+
+
+POLY_NUM_COEFFICIENTS = 1153
+
+if __name__ == '__main__':
+    emit(read_maple_energy(sys.argv[1] if len(sys.argv) > 1 else MAPLE_SOURCE), sys.stdout)
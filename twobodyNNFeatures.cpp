@@ -0,0 +1,783 @@
+#include <math.h>
+#include "twobodyNNFeatures.h"
+#include "twobodyForceInteraction.h"
+#include "vectorOps.cu"
+
+const int nnDistanceSites[NN_NUM_DISTANCES][2] = {
+    {Ha1, Ha2}, {Hb1, Hb2},                                         // intra HH
+    {Oa, Ha1}, {Oa, Ha2}, {Ob, Hb1}, {Ob, Hb2},                     // intra OH
+    {Ha1, Hb1}, {Ha1, Hb2}, {Ha2, Hb1}, {Ha2, Hb2},                 // HH
+    {Oa, Hb1}, {Oa, Hb2}, {Ob, Ha1}, {Ob, Ha2},                     // OH
+    {Oa, Ob},                                                       // OO
+    {Xa1, Hb1}, {Xa1, Hb2}, {Xa2, Hb1}, {Xa2, Hb2},                 // LH
+    {Xb1, Ha1}, {Xb1, Ha2}, {Xb2, Ha1}, {Xb2, Ha2},
+    {Oa, Xb1}, {Oa, Xb2}, {Ob, Xa1}, {Ob, Xa2},                     // OL
+    {Xa1, Xb1}, {Xa1, Xb2}, {Xa2, Xb1}, {Xa2, Xb2}                  // LL
+};
+
+// poly_2d() of BenchMarking_InputGeneration.py on the m dimers of a block, x[k][b] = exp(-r_k) of dimer b.
+// The sums keep the order of the script, so the features match the training data to the last bit.
+static void poly2d(const double (* x)[NN_FEATURE_BLOCK], const int m, double (* f)[NN_FEATURE_BLOCK]) {
+        for (int b = 0; b < m; b++) {
+            f[0][b] = x[18][b] + x[19][b] + x[17][b] + x[16][b] + x[22][b] + x[21][b] + x[20][b] + x[15][b];
+            f[1][b] = x[30][b] + x[29][b] + x[28][b] + x[27][b];
+            f[2][b] = x[14][b];
+            f[3][b] = x[26][b] + x[23][b] + x[24][b] + x[25][b];
+            f[4][b] = x[12][b] + x[13][b] + x[10][b] + x[11][b];
+            f[5][b] = x[7][b] + x[6][b] + x[9][b] + x[8][b];
+            f[6][b] = x[15][b]*x[17][b] + x[19][b]*x[21][b] + x[20][b]*x[22][b] + x[16][b]*x[18][b];
+            f[7][b] = x[15][b]*x[8][b] + x[17][b]*x[8][b] + x[17][b]*x[6][b] + x[22][b]*x[8][b] + x[19][b]*x[6][b] + x[15][b]*x[6][b] + x[19][b]*x[7][b] + x[18][b]*x[9][b] + x[16][b]*x[9][b] + x[20][b]*x[8][b] + x[22][b]*x[9][b] + x[21][b]*x[7][b] + x[21][b]*x[6][b] + x[16][b]*x[7][b] + x[20][b]*x[9][b] + x[18][b]*x[7][b];
+            f[8][b] = x[0][b]*x[22][b] + x[0][b]*x[20][b] + x[18][b]*x[1][b] + x[15][b]*x[1][b] + x[17][b]*x[1][b] + x[16][b]*x[1][b] + x[0][b]*x[19][b] + x[0][b]*x[21][b];
+            f[9][b] = x[16][b]*x[25][b] + x[19][b]*x[23][b] + x[17][b]*x[26][b] + x[15][b]*x[25][b] + x[20][b]*x[23][b] + x[22][b]*x[24][b] + x[18][b]*x[26][b] + x[21][b]*x[24][b];
+            f[10][b] = x[1][b]*x[8][b] + x[1][b]*x[9][b] + x[0][b]*x[8][b] + x[0][b]*x[9][b] + x[1][b]*x[7][b] + x[0][b]*x[7][b] + x[0][b]*x[6][b] + x[1][b]*x[6][b];
+            f[11][b] = x[21][b]*x[25][b] + x[22][b]*x[26][b] + x[19][b]*x[25][b] + x[15][b]*x[24][b] + x[17][b]*x[23][b] + x[17][b]*x[24][b] + x[21][b]*x[26][b] + x[20][b]*x[26][b] + x[19][b]*x[26][b] + x[20][b]*x[25][b] + x[22][b]*x[25][b] + x[16][b]*x[24][b] + x[18][b]*x[23][b] + x[16][b]*x[23][b] + x[15][b]*x[23][b] + x[18][b]*x[24][b];
+            f[12][b] = x[4][b]*x[6][b] + x[3][b]*x[8][b] + x[2][b]*x[6][b] + x[5][b]*x[7][b] + x[3][b]*x[9][b] + x[4][b]*x[8][b] + x[2][b]*x[7][b] + x[5][b]*x[9][b];
+            f[13][b] = x[16][b]*x[27][b] + x[15][b]*x[27][b] + x[20][b]*x[29][b] + x[15][b]*x[28][b] + x[17][b]*x[29][b] + x[19][b]*x[27][b] + x[21][b]*x[30][b] + x[19][b]*x[29][b] + x[17][b]*x[30][b] + x[22][b]*x[28][b] + x[18][b]*x[29][b] + x[21][b]*x[28][b] + x[22][b]*x[30][b] + x[18][b]*x[30][b] + x[16][b]*x[28][b] + x[20][b]*x[27][b];
+            f[14][b] = x[15][b]*x[21][b] + x[18][b]*x[22][b] + x[15][b]*x[19][b] + x[18][b]*x[19][b] + x[17][b]*x[19][b] + x[17][b]*x[20][b] + x[18][b]*x[21][b] + x[16][b]*x[22][b] + x[15][b]*x[22][b] + x[18][b]*x[20][b] + x[16][b]*x[20][b] + x[17][b]*x[21][b] + x[15][b]*x[20][b] + x[16][b]*x[19][b] + x[16][b]*x[21][b] + x[17][b]*x[22][b];
+            f[15][b] = x[11][b]*x[30][b] + x[12][b]*x[29][b] + x[11][b]*x[28][b] + x[13][b]*x[27][b] + x[13][b]*x[28][b] + x[12][b]*x[27][b] + x[12][b]*x[28][b] + x[10][b]*x[27][b] + x[10][b]*x[29][b] + x[12][b]*x[30][b] + x[13][b]*x[29][b] + x[11][b]*x[29][b] + x[10][b]*x[28][b] + x[11][b]*x[27][b] + x[13][b]*x[30][b] + x[10][b]*x[30][b];
+            f[16][b] = x[29][b]*x[2][b] + x[27][b]*x[2][b] + x[28][b]*x[2][b] + x[29][b]*x[5][b] + x[30][b]*x[5][b] + x[27][b]*x[4][b] + x[29][b]*x[3][b] + x[27][b]*x[3][b] + x[28][b]*x[4][b] + x[27][b]*x[5][b] + x[29][b]*x[4][b] + x[30][b]*x[3][b] + x[28][b]*x[5][b] + x[2][b]*x[30][b] + x[28][b]*x[3][b] + x[30][b]*x[4][b];
+            f[17][b] = x[30][b]*x[9][b] + x[29][b]*x[7][b] + x[29][b]*x[9][b] + x[29][b]*x[6][b] + x[27][b]*x[7][b] + x[27][b]*x[6][b] + x[28][b]*x[7][b] + x[28][b]*x[9][b] + x[27][b]*x[8][b] + x[30][b]*x[7][b] + x[28][b]*x[8][b] + x[27][b]*x[9][b] + x[28][b]*x[6][b] + x[30][b]*x[8][b] + x[30][b]*x[6][b] + x[29][b]*x[8][b];
+            f[18][b] = x[13][b]*x[14][b] + x[12][b]*x[14][b] + x[11][b]*x[14][b] + x[10][b]*x[14][b];
+            f[19][b] = x[10][b]*x[11][b] + x[12][b]*x[13][b];
+            f[20][b] = x[6][b]*x[6][b] + x[7][b]*x[7][b] + x[8][b]*x[8][b] + x[9][b]*x[9][b];
+            f[21][b] = x[26][b]*x[3][b] + x[25][b]*x[2][b] + x[24][b]*x[4][b] + x[23][b]*x[4][b] + x[26][b]*x[2][b] + x[23][b]*x[5][b] + x[24][b]*x[5][b] + x[25][b]*x[3][b];
+            f[22][b] = x[11][b]*x[7][b] + x[13][b]*x[9][b] + x[12][b]*x[7][b] + x[10][b]*x[8][b] + x[10][b]*x[6][b] + x[13][b]*x[8][b] + x[12][b]*x[6][b] + x[11][b]*x[9][b];
+            f[23][b] = x[19][b]*x[4][b] + x[15][b]*x[3][b] + x[22][b]*x[4][b] + x[19][b]*x[5][b] + x[16][b]*x[2][b] + x[17][b]*x[3][b] + x[18][b]*x[3][b] + x[22][b]*x[5][b] + x[21][b]*x[4][b] + x[18][b]*x[2][b] + x[15][b]*x[2][b] + x[17][b]*x[2][b] + x[20][b]*x[4][b] + x[16][b]*x[3][b] + x[21][b]*x[5][b] + x[20][b]*x[5][b];
+            f[24][b] = x[12][b]*x[2][b] + x[10][b]*x[4][b] + x[13][b]*x[3][b] + x[11][b]*x[5][b];
+            f[25][b] = x[16][b]*x[4][b] + x[21][b]*x[3][b] + x[15][b]*x[5][b] + x[18][b]*x[4][b] + x[22][b]*x[2][b] + x[20][b]*x[2][b] + x[17][b]*x[5][b] + x[19][b]*x[3][b];
+            f[26][b] = x[12][b]*x[9][b] + x[11][b]*x[8][b] + x[10][b]*x[7][b] + x[13][b]*x[7][b] + x[10][b]*x[9][b] + x[13][b]*x[6][b] + x[12][b]*x[8][b] + x[11][b]*x[6][b];
+            f[27][b] = x[27][b]*x[30][b] + x[28][b]*x[29][b];
+            f[28][b] = x[23][b]*x[6][b] + x[26][b]*x[6][b] + x[26][b]*x[8][b] + x[23][b]*x[8][b] + x[24][b]*x[7][b] + x[24][b]*x[9][b] + x[25][b]*x[6][b] + x[25][b]*x[9][b] + x[23][b]*x[9][b] + x[24][b]*x[8][b] + x[24][b]*x[6][b] + x[25][b]*x[8][b] + x[26][b]*x[7][b] + x[25][b]*x[7][b] + x[23][b]*x[7][b] + x[26][b]*x[9][b];
+            f[29][b] = x[6][b]*x[9][b] + x[7][b]*x[8][b];
+            f[30][b] = x[11][b]*x[25][b] + x[13][b]*x[23][b] + x[12][b]*x[24][b] + x[10][b]*x[26][b] + x[11][b]*x[26][b] + x[10][b]*x[25][b] + x[13][b]*x[24][b] + x[12][b]*x[23][b];
+            f[31][b] = x[0][b]*x[14][b] + x[14][b]*x[1][b];
+            f[32][b] = x[12][b]*x[22][b] + x[12][b]*x[20][b] + x[11][b]*x[15][b] + x[10][b]*x[18][b] + x[13][b]*x[19][b] + x[11][b]*x[17][b] + x[13][b]*x[21][b] + x[10][b]*x[16][b];
+            f[33][b] = x[14][b]*x[25][b] + x[14][b]*x[24][b] + x[14][b]*x[26][b] + x[14][b]*x[23][b];
+            f[34][b] = x[25][b]*x[25][b] + x[23][b]*x[23][b] + x[26][b]*x[26][b] + x[24][b]*x[24][b];
+            f[35][b] = x[0][b]*x[18][b] + x[1][b]*x[20][b] + x[1][b]*x[21][b] + x[0][b]*x[15][b] + x[19][b]*x[1][b] + x[0][b]*x[17][b] + x[0][b]*x[16][b] + x[1][b]*x[22][b];
+            f[36][b] = x[19][b]*x[8][b] + x[20][b]*x[7][b] + x[15][b]*x[9][b] + x[22][b]*x[7][b] + x[22][b]*x[6][b] + x[19][b]*x[9][b] + x[21][b]*x[8][b] + x[17][b]*x[9][b] + x[17][b]*x[7][b] + x[20][b]*x[6][b] + x[18][b]*x[8][b] + x[16][b]*x[6][b] + x[18][b]*x[6][b] + x[21][b]*x[9][b] + x[15][b]*x[7][b] + x[16][b]*x[8][b];
+            f[37][b] = x[20][b]*x[28][b] + x[18][b]*x[28][b] + x[17][b]*x[27][b] + x[22][b]*x[29][b] + x[20][b]*x[30][b] + x[19][b]*x[30][b] + x[16][b]*x[30][b] + x[22][b]*x[27][b] + x[21][b]*x[29][b] + x[17][b]*x[28][b] + x[16][b]*x[29][b] + x[21][b]*x[27][b] + x[18][b]*x[27][b] + x[19][b]*x[28][b] + x[15][b]*x[29][b] + x[15][b]*x[30][b];
+            f[38][b] = x[22][b]*x[23][b] + x[16][b]*x[26][b] + x[20][b]*x[24][b] + x[18][b]*x[25][b] + x[21][b]*x[23][b] + x[15][b]*x[26][b] + x[19][b]*x[24][b] + x[17][b]*x[25][b];
+            f[39][b] = x[23][b]*x[26][b] + x[24][b]*x[25][b] + x[24][b]*x[26][b] + x[23][b]*x[25][b];
+            f[40][b] = x[0][b]*x[29][b] + x[1][b]*x[27][b] + x[1][b]*x[30][b] + x[0][b]*x[30][b] + x[1][b]*x[29][b] + x[0][b]*x[27][b] + x[0][b]*x[28][b] + x[1][b]*x[28][b];
+            f[41][b] = x[16][b]*x[5][b] + x[21][b]*x[2][b] + x[18][b]*x[5][b] + x[19][b]*x[2][b] + x[22][b]*x[3][b] + x[15][b]*x[4][b] + x[17][b]*x[4][b] + x[20][b]*x[3][b];
+            f[42][b] = x[10][b]*x[12][b] + x[11][b]*x[13][b] + x[11][b]*x[12][b] + x[10][b]*x[13][b];
+            f[43][b] = x[12][b]*x[5][b] + x[13][b]*x[4][b] + x[11][b]*x[3][b] + x[11][b]*x[2][b] + x[12][b]*x[4][b] + x[10][b]*x[3][b] + x[10][b]*x[2][b] + x[13][b]*x[5][b];
+            f[44][b] = x[7][b]*x[9][b] + x[8][b]*x[9][b] + x[6][b]*x[7][b] + x[6][b]*x[8][b];
+            f[45][b] = x[15][b]*x[16][b] + x[17][b]*x[18][b] + x[21][b]*x[22][b] + x[19][b]*x[20][b];
+            f[46][b] = x[14][b]*x[9][b] + x[14][b]*x[7][b] + x[14][b]*x[6][b] + x[14][b]*x[8][b];
+            f[47][b] = x[10][b]*x[5][b] + x[13][b]*x[2][b] + x[11][b]*x[4][b] + x[12][b]*x[3][b];
+            f[48][b] = x[25][b]*x[28][b] + x[25][b]*x[27][b] + x[26][b]*x[30][b] + x[26][b]*x[29][b] + x[24][b]*x[28][b] + x[24][b]*x[30][b] + x[23][b]*x[27][b] + x[23][b]*x[29][b];
+            f[49][b] = x[11][b]*x[1][b] + x[0][b]*x[12][b] + x[10][b]*x[1][b] + x[0][b]*x[13][b];
+            f[50][b] = x[17][b]*x[17][b] + x[18][b]*x[18][b] + x[22][b]*x[22][b] + x[20][b]*x[20][b] + x[16][b]*x[16][b] + x[15][b]*x[15][b] + x[21][b]*x[21][b] + x[19][b]*x[19][b];
+            f[51][b] = x[10][b]*x[24][b] + x[11][b]*x[23][b] + x[11][b]*x[24][b] + x[12][b]*x[25][b] + x[13][b]*x[26][b] + x[12][b]*x[26][b] + x[10][b]*x[23][b] + x[13][b]*x[25][b];
+            f[52][b] = x[14][b]*x[20][b] + x[14][b]*x[15][b] + x[14][b]*x[22][b] + x[14][b]*x[17][b] + x[14][b]*x[18][b] + x[14][b]*x[21][b] + x[14][b]*x[16][b] + x[14][b]*x[19][b];
+            f[53][b] = x[10][b]*x[17][b] + x[12][b]*x[21][b] + x[13][b]*x[20][b] + x[11][b]*x[18][b] + x[13][b]*x[22][b] + x[10][b]*x[15][b] + x[11][b]*x[16][b] + x[12][b]*x[19][b];
+            f[54][b] = x[1][b]*x[24][b] + x[0][b]*x[25][b] + x[1][b]*x[23][b] + x[0][b]*x[26][b];
+            f[55][b] = x[4][b]*x[9][b] + x[3][b]*x[6][b] + x[2][b]*x[9][b] + x[5][b]*x[8][b] + x[3][b]*x[7][b] + x[4][b]*x[7][b] + x[2][b]*x[8][b] + x[5][b]*x[6][b];
+            f[56][b] = x[12][b]*x[15][b] + x[13][b]*x[15][b] + x[10][b]*x[21][b] + x[11][b]*x[20][b] + x[13][b]*x[16][b] + x[11][b]*x[21][b] + x[12][b]*x[18][b] + x[10][b]*x[20][b] + x[10][b]*x[22][b] + x[13][b]*x[17][b] + x[11][b]*x[22][b] + x[12][b]*x[17][b] + x[12][b]*x[16][b] + x[13][b]*x[18][b] + x[10][b]*x[19][b] + x[11][b]*x[19][b];
+            f[57][b] = x[23][b]*x[28][b] + x[24][b]*x[29][b] + x[24][b]*x[27][b] + x[26][b]*x[27][b] + x[25][b]*x[30][b] + x[26][b]*x[28][b] + x[23][b]*x[30][b] + x[25][b]*x[29][b];
+            f[58][b] = x[23][b]*x[3][b] + x[25][b]*x[4][b] + x[25][b]*x[5][b] + x[26][b]*x[4][b] + x[24][b]*x[3][b] + x[26][b]*x[5][b] + x[23][b]*x[2][b] + x[24][b]*x[2][b];
+            f[59][b] = x[14][b]*x[27][b] + x[14][b]*x[28][b] + x[14][b]*x[29][b] + x[14][b]*x[30][b];
+            f[60][b] = x[29][b]*x[29][b] + x[28][b]*x[28][b] + x[27][b]*x[27][b] + x[30][b]*x[30][b];
+            f[61][b] = x[1][b]*x[25][b] + x[0][b]*x[24][b] + x[0][b]*x[23][b] + x[1][b]*x[26][b];
+            f[62][b] = x[14][b]*x[5][b] + x[14][b]*x[3][b] + x[14][b]*x[2][b] + x[14][b]*x[4][b];
+            f[63][b] = x[0][b]*x[11][b] + x[13][b]*x[1][b] + x[0][b]*x[10][b] + x[12][b]*x[1][b];
+            f[64][b] = x[28][b]*x[30][b] + x[27][b]*x[29][b] + x[27][b]*x[28][b] + x[29][b]*x[30][b];
+            f[65][b] = x[11][b]*x[11][b] + x[10][b]*x[10][b] + x[12][b]*x[12][b] + x[13][b]*x[13][b];
+            f[66][b] = x[23][b]*x[24][b] + x[25][b]*x[26][b];
+            f[67][b] = x[16][b]*x[17][b] + x[19][b]*x[22][b] + x[20][b]*x[21][b] + x[15][b]*x[18][b];
+            f[68][b] = x[14][b]*x[14][b];
+        }
+}
+
+// Backward of poly2d: gx[k][b] = sum over the features of gf[f][b] * d f / d x_k, gx zeroed by the caller
+static void poly2dGradient(const double (* x)[NN_FEATURE_BLOCK], const double (* gf)[NN_FEATURE_BLOCK], const int m,
+                           double (* gx)[NN_FEATURE_BLOCK]) {
+        for (int b = 0; b < m; b++) {
+            double g;
+            g = gf[0][b];
+            gx[18][b] += g;
+            gx[19][b] += g;
+            gx[17][b] += g;
+            gx[16][b] += g;
+            gx[22][b] += g;
+            gx[21][b] += g;
+            gx[20][b] += g;
+            gx[15][b] += g;
+            g = gf[1][b];
+            gx[30][b] += g;
+            gx[29][b] += g;
+            gx[28][b] += g;
+            gx[27][b] += g;
+            g = gf[2][b];
+            gx[14][b] += g;
+            g = gf[3][b];
+            gx[26][b] += g;
+            gx[23][b] += g;
+            gx[24][b] += g;
+            gx[25][b] += g;
+            g = gf[4][b];
+            gx[12][b] += g;
+            gx[13][b] += g;
+            gx[10][b] += g;
+            gx[11][b] += g;
+            g = gf[5][b];
+            gx[7][b] += g;
+            gx[6][b] += g;
+            gx[9][b] += g;
+            gx[8][b] += g;
+            g = gf[6][b];
+            gx[15][b] += g*x[17][b]; gx[17][b] += g*x[15][b];
+            gx[19][b] += g*x[21][b]; gx[21][b] += g*x[19][b];
+            gx[20][b] += g*x[22][b]; gx[22][b] += g*x[20][b];
+            gx[16][b] += g*x[18][b]; gx[18][b] += g*x[16][b];
+            g = gf[7][b];
+            gx[15][b] += g*x[8][b]; gx[8][b] += g*x[15][b];
+            gx[17][b] += g*x[8][b]; gx[8][b] += g*x[17][b];
+            gx[17][b] += g*x[6][b]; gx[6][b] += g*x[17][b];
+            gx[22][b] += g*x[8][b]; gx[8][b] += g*x[22][b];
+            gx[19][b] += g*x[6][b]; gx[6][b] += g*x[19][b];
+            gx[15][b] += g*x[6][b]; gx[6][b] += g*x[15][b];
+            gx[19][b] += g*x[7][b]; gx[7][b] += g*x[19][b];
+            gx[18][b] += g*x[9][b]; gx[9][b] += g*x[18][b];
+            gx[16][b] += g*x[9][b]; gx[9][b] += g*x[16][b];
+            gx[20][b] += g*x[8][b]; gx[8][b] += g*x[20][b];
+            gx[22][b] += g*x[9][b]; gx[9][b] += g*x[22][b];
+            gx[21][b] += g*x[7][b]; gx[7][b] += g*x[21][b];
+            gx[21][b] += g*x[6][b]; gx[6][b] += g*x[21][b];
+            gx[16][b] += g*x[7][b]; gx[7][b] += g*x[16][b];
+            gx[20][b] += g*x[9][b]; gx[9][b] += g*x[20][b];
+            gx[18][b] += g*x[7][b]; gx[7][b] += g*x[18][b];
+            g = gf[8][b];
+            gx[0][b] += g*x[22][b]; gx[22][b] += g*x[0][b];
+            gx[0][b] += g*x[20][b]; gx[20][b] += g*x[0][b];
+            gx[18][b] += g*x[1][b]; gx[1][b] += g*x[18][b];
+            gx[15][b] += g*x[1][b]; gx[1][b] += g*x[15][b];
+            gx[17][b] += g*x[1][b]; gx[1][b] += g*x[17][b];
+            gx[16][b] += g*x[1][b]; gx[1][b] += g*x[16][b];
+            gx[0][b] += g*x[19][b]; gx[19][b] += g*x[0][b];
+            gx[0][b] += g*x[21][b]; gx[21][b] += g*x[0][b];
+            g = gf[9][b];
+            gx[16][b] += g*x[25][b]; gx[25][b] += g*x[16][b];
+            gx[19][b] += g*x[23][b]; gx[23][b] += g*x[19][b];
+            gx[17][b] += g*x[26][b]; gx[26][b] += g*x[17][b];
+            gx[15][b] += g*x[25][b]; gx[25][b] += g*x[15][b];
+            gx[20][b] += g*x[23][b]; gx[23][b] += g*x[20][b];
+            gx[22][b] += g*x[24][b]; gx[24][b] += g*x[22][b];
+            gx[18][b] += g*x[26][b]; gx[26][b] += g*x[18][b];
+            gx[21][b] += g*x[24][b]; gx[24][b] += g*x[21][b];
+            g = gf[10][b];
+            gx[1][b] += g*x[8][b]; gx[8][b] += g*x[1][b];
+            gx[1][b] += g*x[9][b]; gx[9][b] += g*x[1][b];
+            gx[0][b] += g*x[8][b]; gx[8][b] += g*x[0][b];
+            gx[0][b] += g*x[9][b]; gx[9][b] += g*x[0][b];
+            gx[1][b] += g*x[7][b]; gx[7][b] += g*x[1][b];
+            gx[0][b] += g*x[7][b]; gx[7][b] += g*x[0][b];
+            gx[0][b] += g*x[6][b]; gx[6][b] += g*x[0][b];
+            gx[1][b] += g*x[6][b]; gx[6][b] += g*x[1][b];
+            g = gf[11][b];
+            gx[21][b] += g*x[25][b]; gx[25][b] += g*x[21][b];
+            gx[22][b] += g*x[26][b]; gx[26][b] += g*x[22][b];
+            gx[19][b] += g*x[25][b]; gx[25][b] += g*x[19][b];
+            gx[15][b] += g*x[24][b]; gx[24][b] += g*x[15][b];
+            gx[17][b] += g*x[23][b]; gx[23][b] += g*x[17][b];
+            gx[17][b] += g*x[24][b]; gx[24][b] += g*x[17][b];
+            gx[21][b] += g*x[26][b]; gx[26][b] += g*x[21][b];
+            gx[20][b] += g*x[26][b]; gx[26][b] += g*x[20][b];
+            gx[19][b] += g*x[26][b]; gx[26][b] += g*x[19][b];
+            gx[20][b] += g*x[25][b]; gx[25][b] += g*x[20][b];
+            gx[22][b] += g*x[25][b]; gx[25][b] += g*x[22][b];
+            gx[16][b] += g*x[24][b]; gx[24][b] += g*x[16][b];
+            gx[18][b] += g*x[23][b]; gx[23][b] += g*x[18][b];
+            gx[16][b] += g*x[23][b]; gx[23][b] += g*x[16][b];
+            gx[15][b] += g*x[23][b]; gx[23][b] += g*x[15][b];
+            gx[18][b] += g*x[24][b]; gx[24][b] += g*x[18][b];
+            g = gf[12][b];
+            gx[4][b] += g*x[6][b]; gx[6][b] += g*x[4][b];
+            gx[3][b] += g*x[8][b]; gx[8][b] += g*x[3][b];
+            gx[2][b] += g*x[6][b]; gx[6][b] += g*x[2][b];
+            gx[5][b] += g*x[7][b]; gx[7][b] += g*x[5][b];
+            gx[3][b] += g*x[9][b]; gx[9][b] += g*x[3][b];
+            gx[4][b] += g*x[8][b]; gx[8][b] += g*x[4][b];
+            gx[2][b] += g*x[7][b]; gx[7][b] += g*x[2][b];
+            gx[5][b] += g*x[9][b]; gx[9][b] += g*x[5][b];
+            g = gf[13][b];
+            gx[16][b] += g*x[27][b]; gx[27][b] += g*x[16][b];
+            gx[15][b] += g*x[27][b]; gx[27][b] += g*x[15][b];
+            gx[20][b] += g*x[29][b]; gx[29][b] += g*x[20][b];
+            gx[15][b] += g*x[28][b]; gx[28][b] += g*x[15][b];
+            gx[17][b] += g*x[29][b]; gx[29][b] += g*x[17][b];
+            gx[19][b] += g*x[27][b]; gx[27][b] += g*x[19][b];
+            gx[21][b] += g*x[30][b]; gx[30][b] += g*x[21][b];
+            gx[19][b] += g*x[29][b]; gx[29][b] += g*x[19][b];
+            gx[17][b] += g*x[30][b]; gx[30][b] += g*x[17][b];
+            gx[22][b] += g*x[28][b]; gx[28][b] += g*x[22][b];
+            gx[18][b] += g*x[29][b]; gx[29][b] += g*x[18][b];
+            gx[21][b] += g*x[28][b]; gx[28][b] += g*x[21][b];
+            gx[22][b] += g*x[30][b]; gx[30][b] += g*x[22][b];
+            gx[18][b] += g*x[30][b]; gx[30][b] += g*x[18][b];
+            gx[16][b] += g*x[28][b]; gx[28][b] += g*x[16][b];
+            gx[20][b] += g*x[27][b]; gx[27][b] += g*x[20][b];
+            g = gf[14][b];
+            gx[15][b] += g*x[21][b]; gx[21][b] += g*x[15][b];
+            gx[18][b] += g*x[22][b]; gx[22][b] += g*x[18][b];
+            gx[15][b] += g*x[19][b]; gx[19][b] += g*x[15][b];
+            gx[18][b] += g*x[19][b]; gx[19][b] += g*x[18][b];
+            gx[17][b] += g*x[19][b]; gx[19][b] += g*x[17][b];
+            gx[17][b] += g*x[20][b]; gx[20][b] += g*x[17][b];
+            gx[18][b] += g*x[21][b]; gx[21][b] += g*x[18][b];
+            gx[16][b] += g*x[22][b]; gx[22][b] += g*x[16][b];
+            gx[15][b] += g*x[22][b]; gx[22][b] += g*x[15][b];
+            gx[18][b] += g*x[20][b]; gx[20][b] += g*x[18][b];
+            gx[16][b] += g*x[20][b]; gx[20][b] += g*x[16][b];
+            gx[17][b] += g*x[21][b]; gx[21][b] += g*x[17][b];
+            gx[15][b] += g*x[20][b]; gx[20][b] += g*x[15][b];
+            gx[16][b] += g*x[19][b]; gx[19][b] += g*x[16][b];
+            gx[16][b] += g*x[21][b]; gx[21][b] += g*x[16][b];
+            gx[17][b] += g*x[22][b]; gx[22][b] += g*x[17][b];
+            g = gf[15][b];
+            gx[11][b] += g*x[30][b]; gx[30][b] += g*x[11][b];
+            gx[12][b] += g*x[29][b]; gx[29][b] += g*x[12][b];
+            gx[11][b] += g*x[28][b]; gx[28][b] += g*x[11][b];
+            gx[13][b] += g*x[27][b]; gx[27][b] += g*x[13][b];
+            gx[13][b] += g*x[28][b]; gx[28][b] += g*x[13][b];
+            gx[12][b] += g*x[27][b]; gx[27][b] += g*x[12][b];
+            gx[12][b] += g*x[28][b]; gx[28][b] += g*x[12][b];
+            gx[10][b] += g*x[27][b]; gx[27][b] += g*x[10][b];
+            gx[10][b] += g*x[29][b]; gx[29][b] += g*x[10][b];
+            gx[12][b] += g*x[30][b]; gx[30][b] += g*x[12][b];
+            gx[13][b] += g*x[29][b]; gx[29][b] += g*x[13][b];
+            gx[11][b] += g*x[29][b]; gx[29][b] += g*x[11][b];
+            gx[10][b] += g*x[28][b]; gx[28][b] += g*x[10][b];
+            gx[11][b] += g*x[27][b]; gx[27][b] += g*x[11][b];
+            gx[13][b] += g*x[30][b]; gx[30][b] += g*x[13][b];
+            gx[10][b] += g*x[30][b]; gx[30][b] += g*x[10][b];
+            g = gf[16][b];
+            gx[29][b] += g*x[2][b]; gx[2][b] += g*x[29][b];
+            gx[27][b] += g*x[2][b]; gx[2][b] += g*x[27][b];
+            gx[28][b] += g*x[2][b]; gx[2][b] += g*x[28][b];
+            gx[29][b] += g*x[5][b]; gx[5][b] += g*x[29][b];
+            gx[30][b] += g*x[5][b]; gx[5][b] += g*x[30][b];
+            gx[27][b] += g*x[4][b]; gx[4][b] += g*x[27][b];
+            gx[29][b] += g*x[3][b]; gx[3][b] += g*x[29][b];
+            gx[27][b] += g*x[3][b]; gx[3][b] += g*x[27][b];
+            gx[28][b] += g*x[4][b]; gx[4][b] += g*x[28][b];
+            gx[27][b] += g*x[5][b]; gx[5][b] += g*x[27][b];
+            gx[29][b] += g*x[4][b]; gx[4][b] += g*x[29][b];
+            gx[30][b] += g*x[3][b]; gx[3][b] += g*x[30][b];
+            gx[28][b] += g*x[5][b]; gx[5][b] += g*x[28][b];
+            gx[2][b] += g*x[30][b]; gx[30][b] += g*x[2][b];
+            gx[28][b] += g*x[3][b]; gx[3][b] += g*x[28][b];
+            gx[30][b] += g*x[4][b]; gx[4][b] += g*x[30][b];
+            g = gf[17][b];
+            gx[30][b] += g*x[9][b]; gx[9][b] += g*x[30][b];
+            gx[29][b] += g*x[7][b]; gx[7][b] += g*x[29][b];
+            gx[29][b] += g*x[9][b]; gx[9][b] += g*x[29][b];
+            gx[29][b] += g*x[6][b]; gx[6][b] += g*x[29][b];
+            gx[27][b] += g*x[7][b]; gx[7][b] += g*x[27][b];
+            gx[27][b] += g*x[6][b]; gx[6][b] += g*x[27][b];
+            gx[28][b] += g*x[7][b]; gx[7][b] += g*x[28][b];
+            gx[28][b] += g*x[9][b]; gx[9][b] += g*x[28][b];
+            gx[27][b] += g*x[8][b]; gx[8][b] += g*x[27][b];
+            gx[30][b] += g*x[7][b]; gx[7][b] += g*x[30][b];
+            gx[28][b] += g*x[8][b]; gx[8][b] += g*x[28][b];
+            gx[27][b] += g*x[9][b]; gx[9][b] += g*x[27][b];
+            gx[28][b] += g*x[6][b]; gx[6][b] += g*x[28][b];
+            gx[30][b] += g*x[8][b]; gx[8][b] += g*x[30][b];
+            gx[30][b] += g*x[6][b]; gx[6][b] += g*x[30][b];
+            gx[29][b] += g*x[8][b]; gx[8][b] += g*x[29][b];
+            g = gf[18][b];
+            gx[13][b] += g*x[14][b]; gx[14][b] += g*x[13][b];
+            gx[12][b] += g*x[14][b]; gx[14][b] += g*x[12][b];
+            gx[11][b] += g*x[14][b]; gx[14][b] += g*x[11][b];
+            gx[10][b] += g*x[14][b]; gx[14][b] += g*x[10][b];
+            g = gf[19][b];
+            gx[10][b] += g*x[11][b]; gx[11][b] += g*x[10][b];
+            gx[12][b] += g*x[13][b]; gx[13][b] += g*x[12][b];
+            g = gf[20][b];
+            gx[6][b] += g*x[6][b]; gx[6][b] += g*x[6][b];
+            gx[7][b] += g*x[7][b]; gx[7][b] += g*x[7][b];
+            gx[8][b] += g*x[8][b]; gx[8][b] += g*x[8][b];
+            gx[9][b] += g*x[9][b]; gx[9][b] += g*x[9][b];
+            g = gf[21][b];
+            gx[26][b] += g*x[3][b]; gx[3][b] += g*x[26][b];
+            gx[25][b] += g*x[2][b]; gx[2][b] += g*x[25][b];
+            gx[24][b] += g*x[4][b]; gx[4][b] += g*x[24][b];
+            gx[23][b] += g*x[4][b]; gx[4][b] += g*x[23][b];
+            gx[26][b] += g*x[2][b]; gx[2][b] += g*x[26][b];
+            gx[23][b] += g*x[5][b]; gx[5][b] += g*x[23][b];
+            gx[24][b] += g*x[5][b]; gx[5][b] += g*x[24][b];
+            gx[25][b] += g*x[3][b]; gx[3][b] += g*x[25][b];
+            g = gf[22][b];
+            gx[11][b] += g*x[7][b]; gx[7][b] += g*x[11][b];
+            gx[13][b] += g*x[9][b]; gx[9][b] += g*x[13][b];
+            gx[12][b] += g*x[7][b]; gx[7][b] += g*x[12][b];
+            gx[10][b] += g*x[8][b]; gx[8][b] += g*x[10][b];
+            gx[10][b] += g*x[6][b]; gx[6][b] += g*x[10][b];
+            gx[13][b] += g*x[8][b]; gx[8][b] += g*x[13][b];
+            gx[12][b] += g*x[6][b]; gx[6][b] += g*x[12][b];
+            gx[11][b] += g*x[9][b]; gx[9][b] += g*x[11][b];
+            g = gf[23][b];
+            gx[19][b] += g*x[4][b]; gx[4][b] += g*x[19][b];
+            gx[15][b] += g*x[3][b]; gx[3][b] += g*x[15][b];
+            gx[22][b] += g*x[4][b]; gx[4][b] += g*x[22][b];
+            gx[19][b] += g*x[5][b]; gx[5][b] += g*x[19][b];
+            gx[16][b] += g*x[2][b]; gx[2][b] += g*x[16][b];
+            gx[17][b] += g*x[3][b]; gx[3][b] += g*x[17][b];
+            gx[18][b] += g*x[3][b]; gx[3][b] += g*x[18][b];
+            gx[22][b] += g*x[5][b]; gx[5][b] += g*x[22][b];
+            gx[21][b] += g*x[4][b]; gx[4][b] += g*x[21][b];
+            gx[18][b] += g*x[2][b]; gx[2][b] += g*x[18][b];
+            gx[15][b] += g*x[2][b]; gx[2][b] += g*x[15][b];
+            gx[17][b] += g*x[2][b]; gx[2][b] += g*x[17][b];
+            gx[20][b] += g*x[4][b]; gx[4][b] += g*x[20][b];
+            gx[16][b] += g*x[3][b]; gx[3][b] += g*x[16][b];
+            gx[21][b] += g*x[5][b]; gx[5][b] += g*x[21][b];
+            gx[20][b] += g*x[5][b]; gx[5][b] += g*x[20][b];
+            g = gf[24][b];
+            gx[12][b] += g*x[2][b]; gx[2][b] += g*x[12][b];
+            gx[10][b] += g*x[4][b]; gx[4][b] += g*x[10][b];
+            gx[13][b] += g*x[3][b]; gx[3][b] += g*x[13][b];
+            gx[11][b] += g*x[5][b]; gx[5][b] += g*x[11][b];
+            g = gf[25][b];
+            gx[16][b] += g*x[4][b]; gx[4][b] += g*x[16][b];
+            gx[21][b] += g*x[3][b]; gx[3][b] += g*x[21][b];
+            gx[15][b] += g*x[5][b]; gx[5][b] += g*x[15][b];
+            gx[18][b] += g*x[4][b]; gx[4][b] += g*x[18][b];
+            gx[22][b] += g*x[2][b]; gx[2][b] += g*x[22][b];
+            gx[20][b] += g*x[2][b]; gx[2][b] += g*x[20][b];
+            gx[17][b] += g*x[5][b]; gx[5][b] += g*x[17][b];
+            gx[19][b] += g*x[3][b]; gx[3][b] += g*x[19][b];
+            g = gf[26][b];
+            gx[12][b] += g*x[9][b]; gx[9][b] += g*x[12][b];
+            gx[11][b] += g*x[8][b]; gx[8][b] += g*x[11][b];
+            gx[10][b] += g*x[7][b]; gx[7][b] += g*x[10][b];
+            gx[13][b] += g*x[7][b]; gx[7][b] += g*x[13][b];
+            gx[10][b] += g*x[9][b]; gx[9][b] += g*x[10][b];
+            gx[13][b] += g*x[6][b]; gx[6][b] += g*x[13][b];
+            gx[12][b] += g*x[8][b]; gx[8][b] += g*x[12][b];
+            gx[11][b] += g*x[6][b]; gx[6][b] += g*x[11][b];
+            g = gf[27][b];
+            gx[27][b] += g*x[30][b]; gx[30][b] += g*x[27][b];
+            gx[28][b] += g*x[29][b]; gx[29][b] += g*x[28][b];
+            g = gf[28][b];
+            gx[23][b] += g*x[6][b]; gx[6][b] += g*x[23][b];
+            gx[26][b] += g*x[6][b]; gx[6][b] += g*x[26][b];
+            gx[26][b] += g*x[8][b]; gx[8][b] += g*x[26][b];
+            gx[23][b] += g*x[8][b]; gx[8][b] += g*x[23][b];
+            gx[24][b] += g*x[7][b]; gx[7][b] += g*x[24][b];
+            gx[24][b] += g*x[9][b]; gx[9][b] += g*x[24][b];
+            gx[25][b] += g*x[6][b]; gx[6][b] += g*x[25][b];
+            gx[25][b] += g*x[9][b]; gx[9][b] += g*x[25][b];
+            gx[23][b] += g*x[9][b]; gx[9][b] += g*x[23][b];
+            gx[24][b] += g*x[8][b]; gx[8][b] += g*x[24][b];
+            gx[24][b] += g*x[6][b]; gx[6][b] += g*x[24][b];
+            gx[25][b] += g*x[8][b]; gx[8][b] += g*x[25][b];
+            gx[26][b] += g*x[7][b]; gx[7][b] += g*x[26][b];
+            gx[25][b] += g*x[7][b]; gx[7][b] += g*x[25][b];
+            gx[23][b] += g*x[7][b]; gx[7][b] += g*x[23][b];
+            gx[26][b] += g*x[9][b]; gx[9][b] += g*x[26][b];
+            g = gf[29][b];
+            gx[6][b] += g*x[9][b]; gx[9][b] += g*x[6][b];
+            gx[7][b] += g*x[8][b]; gx[8][b] += g*x[7][b];
+            g = gf[30][b];
+            gx[11][b] += g*x[25][b]; gx[25][b] += g*x[11][b];
+            gx[13][b] += g*x[23][b]; gx[23][b] += g*x[13][b];
+            gx[12][b] += g*x[24][b]; gx[24][b] += g*x[12][b];
+            gx[10][b] += g*x[26][b]; gx[26][b] += g*x[10][b];
+            gx[11][b] += g*x[26][b]; gx[26][b] += g*x[11][b];
+            gx[10][b] += g*x[25][b]; gx[25][b] += g*x[10][b];
+            gx[13][b] += g*x[24][b]; gx[24][b] += g*x[13][b];
+            gx[12][b] += g*x[23][b]; gx[23][b] += g*x[12][b];
+            g = gf[31][b];
+            gx[0][b] += g*x[14][b]; gx[14][b] += g*x[0][b];
+            gx[14][b] += g*x[1][b]; gx[1][b] += g*x[14][b];
+            g = gf[32][b];
+            gx[12][b] += g*x[22][b]; gx[22][b] += g*x[12][b];
+            gx[12][b] += g*x[20][b]; gx[20][b] += g*x[12][b];
+            gx[11][b] += g*x[15][b]; gx[15][b] += g*x[11][b];
+            gx[10][b] += g*x[18][b]; gx[18][b] += g*x[10][b];
+            gx[13][b] += g*x[19][b]; gx[19][b] += g*x[13][b];
+            gx[11][b] += g*x[17][b]; gx[17][b] += g*x[11][b];
+            gx[13][b] += g*x[21][b]; gx[21][b] += g*x[13][b];
+            gx[10][b] += g*x[16][b]; gx[16][b] += g*x[10][b];
+            g = gf[33][b];
+            gx[14][b] += g*x[25][b]; gx[25][b] += g*x[14][b];
+            gx[14][b] += g*x[24][b]; gx[24][b] += g*x[14][b];
+            gx[14][b] += g*x[26][b]; gx[26][b] += g*x[14][b];
+            gx[14][b] += g*x[23][b]; gx[23][b] += g*x[14][b];
+            g = gf[34][b];
+            gx[25][b] += g*x[25][b]; gx[25][b] += g*x[25][b];
+            gx[23][b] += g*x[23][b]; gx[23][b] += g*x[23][b];
+            gx[26][b] += g*x[26][b]; gx[26][b] += g*x[26][b];
+            gx[24][b] += g*x[24][b]; gx[24][b] += g*x[24][b];
+            g = gf[35][b];
+            gx[0][b] += g*x[18][b]; gx[18][b] += g*x[0][b];
+            gx[1][b] += g*x[20][b]; gx[20][b] += g*x[1][b];
+            gx[1][b] += g*x[21][b]; gx[21][b] += g*x[1][b];
+            gx[0][b] += g*x[15][b]; gx[15][b] += g*x[0][b];
+            gx[19][b] += g*x[1][b]; gx[1][b] += g*x[19][b];
+            gx[0][b] += g*x[17][b]; gx[17][b] += g*x[0][b];
+            gx[0][b] += g*x[16][b]; gx[16][b] += g*x[0][b];
+            gx[1][b] += g*x[22][b]; gx[22][b] += g*x[1][b];
+            g = gf[36][b];
+            gx[19][b] += g*x[8][b]; gx[8][b] += g*x[19][b];
+            gx[20][b] += g*x[7][b]; gx[7][b] += g*x[20][b];
+            gx[15][b] += g*x[9][b]; gx[9][b] += g*x[15][b];
+            gx[22][b] += g*x[7][b]; gx[7][b] += g*x[22][b];
+            gx[22][b] += g*x[6][b]; gx[6][b] += g*x[22][b];
+            gx[19][b] += g*x[9][b]; gx[9][b] += g*x[19][b];
+            gx[21][b] += g*x[8][b]; gx[8][b] += g*x[21][b];
+            gx[17][b] += g*x[9][b]; gx[9][b] += g*x[17][b];
+            gx[17][b] += g*x[7][b]; gx[7][b] += g*x[17][b];
+            gx[20][b] += g*x[6][b]; gx[6][b] += g*x[20][b];
+            gx[18][b] += g*x[8][b]; gx[8][b] += g*x[18][b];
+            gx[16][b] += g*x[6][b]; gx[6][b] += g*x[16][b];
+            gx[18][b] += g*x[6][b]; gx[6][b] += g*x[18][b];
+            gx[21][b] += g*x[9][b]; gx[9][b] += g*x[21][b];
+            gx[15][b] += g*x[7][b]; gx[7][b] += g*x[15][b];
+            gx[16][b] += g*x[8][b]; gx[8][b] += g*x[16][b];
+            g = gf[37][b];
+            gx[20][b] += g*x[28][b]; gx[28][b] += g*x[20][b];
+            gx[18][b] += g*x[28][b]; gx[28][b] += g*x[18][b];
+            gx[17][b] += g*x[27][b]; gx[27][b] += g*x[17][b];
+            gx[22][b] += g*x[29][b]; gx[29][b] += g*x[22][b];
+            gx[20][b] += g*x[30][b]; gx[30][b] += g*x[20][b];
+            gx[19][b] += g*x[30][b]; gx[30][b] += g*x[19][b];
+            gx[16][b] += g*x[30][b]; gx[30][b] += g*x[16][b];
+            gx[22][b] += g*x[27][b]; gx[27][b] += g*x[22][b];
+            gx[21][b] += g*x[29][b]; gx[29][b] += g*x[21][b];
+            gx[17][b] += g*x[28][b]; gx[28][b] += g*x[17][b];
+            gx[16][b] += g*x[29][b]; gx[29][b] += g*x[16][b];
+            gx[21][b] += g*x[27][b]; gx[27][b] += g*x[21][b];
+            gx[18][b] += g*x[27][b]; gx[27][b] += g*x[18][b];
+            gx[19][b] += g*x[28][b]; gx[28][b] += g*x[19][b];
+            gx[15][b] += g*x[29][b]; gx[29][b] += g*x[15][b];
+            gx[15][b] += g*x[30][b]; gx[30][b] += g*x[15][b];
+            g = gf[38][b];
+            gx[22][b] += g*x[23][b]; gx[23][b] += g*x[22][b];
+            gx[16][b] += g*x[26][b]; gx[26][b] += g*x[16][b];
+            gx[20][b] += g*x[24][b]; gx[24][b] += g*x[20][b];
+            gx[18][b] += g*x[25][b]; gx[25][b] += g*x[18][b];
+            gx[21][b] += g*x[23][b]; gx[23][b] += g*x[21][b];
+            gx[15][b] += g*x[26][b]; gx[26][b] += g*x[15][b];
+            gx[19][b] += g*x[24][b]; gx[24][b] += g*x[19][b];
+            gx[17][b] += g*x[25][b]; gx[25][b] += g*x[17][b];
+            g = gf[39][b];
+            gx[23][b] += g*x[26][b]; gx[26][b] += g*x[23][b];
+            gx[24][b] += g*x[25][b]; gx[25][b] += g*x[24][b];
+            gx[24][b] += g*x[26][b]; gx[26][b] += g*x[24][b];
+            gx[23][b] += g*x[25][b]; gx[25][b] += g*x[23][b];
+            g = gf[40][b];
+            gx[0][b] += g*x[29][b]; gx[29][b] += g*x[0][b];
+            gx[1][b] += g*x[27][b]; gx[27][b] += g*x[1][b];
+            gx[1][b] += g*x[30][b]; gx[30][b] += g*x[1][b];
+            gx[0][b] += g*x[30][b]; gx[30][b] += g*x[0][b];
+            gx[1][b] += g*x[29][b]; gx[29][b] += g*x[1][b];
+            gx[0][b] += g*x[27][b]; gx[27][b] += g*x[0][b];
+            gx[0][b] += g*x[28][b]; gx[28][b] += g*x[0][b];
+            gx[1][b] += g*x[28][b]; gx[28][b] += g*x[1][b];
+            g = gf[41][b];
+            gx[16][b] += g*x[5][b]; gx[5][b] += g*x[16][b];
+            gx[21][b] += g*x[2][b]; gx[2][b] += g*x[21][b];
+            gx[18][b] += g*x[5][b]; gx[5][b] += g*x[18][b];
+            gx[19][b] += g*x[2][b]; gx[2][b] += g*x[19][b];
+            gx[22][b] += g*x[3][b]; gx[3][b] += g*x[22][b];
+            gx[15][b] += g*x[4][b]; gx[4][b] += g*x[15][b];
+            gx[17][b] += g*x[4][b]; gx[4][b] += g*x[17][b];
+            gx[20][b] += g*x[3][b]; gx[3][b] += g*x[20][b];
+            g = gf[42][b];
+            gx[10][b] += g*x[12][b]; gx[12][b] += g*x[10][b];
+            gx[11][b] += g*x[13][b]; gx[13][b] += g*x[11][b];
+            gx[11][b] += g*x[12][b]; gx[12][b] += g*x[11][b];
+            gx[10][b] += g*x[13][b]; gx[13][b] += g*x[10][b];
+            g = gf[43][b];
+            gx[12][b] += g*x[5][b]; gx[5][b] += g*x[12][b];
+            gx[13][b] += g*x[4][b]; gx[4][b] += g*x[13][b];
+            gx[11][b] += g*x[3][b]; gx[3][b] += g*x[11][b];
+            gx[11][b] += g*x[2][b]; gx[2][b] += g*x[11][b];
+            gx[12][b] += g*x[4][b]; gx[4][b] += g*x[12][b];
+            gx[10][b] += g*x[3][b]; gx[3][b] += g*x[10][b];
+            gx[10][b] += g*x[2][b]; gx[2][b] += g*x[10][b];
+            gx[13][b] += g*x[5][b]; gx[5][b] += g*x[13][b];
+            g = gf[44][b];
+            gx[7][b] += g*x[9][b]; gx[9][b] += g*x[7][b];
+            gx[8][b] += g*x[9][b]; gx[9][b] += g*x[8][b];
+            gx[6][b] += g*x[7][b]; gx[7][b] += g*x[6][b];
+            gx[6][b] += g*x[8][b]; gx[8][b] += g*x[6][b];
+            g = gf[45][b];
+            gx[15][b] += g*x[16][b]; gx[16][b] += g*x[15][b];
+            gx[17][b] += g*x[18][b]; gx[18][b] += g*x[17][b];
+            gx[21][b] += g*x[22][b]; gx[22][b] += g*x[21][b];
+            gx[19][b] += g*x[20][b]; gx[20][b] += g*x[19][b];
+            g = gf[46][b];
+            gx[14][b] += g*x[9][b]; gx[9][b] += g*x[14][b];
+            gx[14][b] += g*x[7][b]; gx[7][b] += g*x[14][b];
+            gx[14][b] += g*x[6][b]; gx[6][b] += g*x[14][b];
+            gx[14][b] += g*x[8][b]; gx[8][b] += g*x[14][b];
+            g = gf[47][b];
+            gx[10][b] += g*x[5][b]; gx[5][b] += g*x[10][b];
+            gx[13][b] += g*x[2][b]; gx[2][b] += g*x[13][b];
+            gx[11][b] += g*x[4][b]; gx[4][b] += g*x[11][b];
+            gx[12][b] += g*x[3][b]; gx[3][b] += g*x[12][b];
+            g = gf[48][b];
+            gx[25][b] += g*x[28][b]; gx[28][b] += g*x[25][b];
+            gx[25][b] += g*x[27][b]; gx[27][b] += g*x[25][b];
+            gx[26][b] += g*x[30][b]; gx[30][b] += g*x[26][b];
+            gx[26][b] += g*x[29][b]; gx[29][b] += g*x[26][b];
+            gx[24][b] += g*x[28][b]; gx[28][b] += g*x[24][b];
+            gx[24][b] += g*x[30][b]; gx[30][b] += g*x[24][b];
+            gx[23][b] += g*x[27][b]; gx[27][b] += g*x[23][b];
+            gx[23][b] += g*x[29][b]; gx[29][b] += g*x[23][b];
+            g = gf[49][b];
+            gx[11][b] += g*x[1][b]; gx[1][b] += g*x[11][b];
+            gx[0][b] += g*x[12][b]; gx[12][b] += g*x[0][b];
+            gx[10][b] += g*x[1][b]; gx[1][b] += g*x[10][b];
+            gx[0][b] += g*x[13][b]; gx[13][b] += g*x[0][b];
+            g = gf[50][b];
+            gx[17][b] += g*x[17][b]; gx[17][b] += g*x[17][b];
+            gx[18][b] += g*x[18][b]; gx[18][b] += g*x[18][b];
+            gx[22][b] += g*x[22][b]; gx[22][b] += g*x[22][b];
+            gx[20][b] += g*x[20][b]; gx[20][b] += g*x[20][b];
+            gx[16][b] += g*x[16][b]; gx[16][b] += g*x[16][b];
+            gx[15][b] += g*x[15][b]; gx[15][b] += g*x[15][b];
+            gx[21][b] += g*x[21][b]; gx[21][b] += g*x[21][b];
+            gx[19][b] += g*x[19][b]; gx[19][b] += g*x[19][b];
+            g = gf[51][b];
+            gx[10][b] += g*x[24][b]; gx[24][b] += g*x[10][b];
+            gx[11][b] += g*x[23][b]; gx[23][b] += g*x[11][b];
+            gx[11][b] += g*x[24][b]; gx[24][b] += g*x[11][b];
+            gx[12][b] += g*x[25][b]; gx[25][b] += g*x[12][b];
+            gx[13][b] += g*x[26][b]; gx[26][b] += g*x[13][b];
+            gx[12][b] += g*x[26][b]; gx[26][b] += g*x[12][b];
+            gx[10][b] += g*x[23][b]; gx[23][b] += g*x[10][b];
+            gx[13][b] += g*x[25][b]; gx[25][b] += g*x[13][b];
+            g = gf[52][b];
+            gx[14][b] += g*x[20][b]; gx[20][b] += g*x[14][b];
+            gx[14][b] += g*x[15][b]; gx[15][b] += g*x[14][b];
+            gx[14][b] += g*x[22][b]; gx[22][b] += g*x[14][b];
+            gx[14][b] += g*x[17][b]; gx[17][b] += g*x[14][b];
+            gx[14][b] += g*x[18][b]; gx[18][b] += g*x[14][b];
+            gx[14][b] += g*x[21][b]; gx[21][b] += g*x[14][b];
+            gx[14][b] += g*x[16][b]; gx[16][b] += g*x[14][b];
+            gx[14][b] += g*x[19][b]; gx[19][b] += g*x[14][b];
+            g = gf[53][b];
+            gx[10][b] += g*x[17][b]; gx[17][b] += g*x[10][b];
+            gx[12][b] += g*x[21][b]; gx[21][b] += g*x[12][b];
+            gx[13][b] += g*x[20][b]; gx[20][b] += g*x[13][b];
+            gx[11][b] += g*x[18][b]; gx[18][b] += g*x[11][b];
+            gx[13][b] += g*x[22][b]; gx[22][b] += g*x[13][b];
+            gx[10][b] += g*x[15][b]; gx[15][b] += g*x[10][b];
+            gx[11][b] += g*x[16][b]; gx[16][b] += g*x[11][b];
+            gx[12][b] += g*x[19][b]; gx[19][b] += g*x[12][b];
+            g = gf[54][b];
+            gx[1][b] += g*x[24][b]; gx[24][b] += g*x[1][b];
+            gx[0][b] += g*x[25][b]; gx[25][b] += g*x[0][b];
+            gx[1][b] += g*x[23][b]; gx[23][b] += g*x[1][b];
+            gx[0][b] += g*x[26][b]; gx[26][b] += g*x[0][b];
+            g = gf[55][b];
+            gx[4][b] += g*x[9][b]; gx[9][b] += g*x[4][b];
+            gx[3][b] += g*x[6][b]; gx[6][b] += g*x[3][b];
+            gx[2][b] += g*x[9][b]; gx[9][b] += g*x[2][b];
+            gx[5][b] += g*x[8][b]; gx[8][b] += g*x[5][b];
+            gx[3][b] += g*x[7][b]; gx[7][b] += g*x[3][b];
+            gx[4][b] += g*x[7][b]; gx[7][b] += g*x[4][b];
+            gx[2][b] += g*x[8][b]; gx[8][b] += g*x[2][b];
+            gx[5][b] += g*x[6][b]; gx[6][b] += g*x[5][b];
+            g = gf[56][b];
+            gx[12][b] += g*x[15][b]; gx[15][b] += g*x[12][b];
+            gx[13][b] += g*x[15][b]; gx[15][b] += g*x[13][b];
+            gx[10][b] += g*x[21][b]; gx[21][b] += g*x[10][b];
+            gx[11][b] += g*x[20][b]; gx[20][b] += g*x[11][b];
+            gx[13][b] += g*x[16][b]; gx[16][b] += g*x[13][b];
+            gx[11][b] += g*x[21][b]; gx[21][b] += g*x[11][b];
+            gx[12][b] += g*x[18][b]; gx[18][b] += g*x[12][b];
+            gx[10][b] += g*x[20][b]; gx[20][b] += g*x[10][b];
+            gx[10][b] += g*x[22][b]; gx[22][b] += g*x[10][b];
+            gx[13][b] += g*x[17][b]; gx[17][b] += g*x[13][b];
+            gx[11][b] += g*x[22][b]; gx[22][b] += g*x[11][b];
+            gx[12][b] += g*x[17][b]; gx[17][b] += g*x[12][b];
+            gx[12][b] += g*x[16][b]; gx[16][b] += g*x[12][b];
+            gx[13][b] += g*x[18][b]; gx[18][b] += g*x[13][b];
+            gx[10][b] += g*x[19][b]; gx[19][b] += g*x[10][b];
+            gx[11][b] += g*x[19][b]; gx[19][b] += g*x[11][b];
+            g = gf[57][b];
+            gx[23][b] += g*x[28][b]; gx[28][b] += g*x[23][b];
+            gx[24][b] += g*x[29][b]; gx[29][b] += g*x[24][b];
+            gx[24][b] += g*x[27][b]; gx[27][b] += g*x[24][b];
+            gx[26][b] += g*x[27][b]; gx[27][b] += g*x[26][b];
+            gx[25][b] += g*x[30][b]; gx[30][b] += g*x[25][b];
+            gx[26][b] += g*x[28][b]; gx[28][b] += g*x[26][b];
+            gx[23][b] += g*x[30][b]; gx[30][b] += g*x[23][b];
+            gx[25][b] += g*x[29][b]; gx[29][b] += g*x[25][b];
+            g = gf[58][b];
+            gx[23][b] += g*x[3][b]; gx[3][b] += g*x[23][b];
+            gx[25][b] += g*x[4][b]; gx[4][b] += g*x[25][b];
+            gx[25][b] += g*x[5][b]; gx[5][b] += g*x[25][b];
+            gx[26][b] += g*x[4][b]; gx[4][b] += g*x[26][b];
+            gx[24][b] += g*x[3][b]; gx[3][b] += g*x[24][b];
+            gx[26][b] += g*x[5][b]; gx[5][b] += g*x[26][b];
+            gx[23][b] += g*x[2][b]; gx[2][b] += g*x[23][b];
+            gx[24][b] += g*x[2][b]; gx[2][b] += g*x[24][b];
+            g = gf[59][b];
+            gx[14][b] += g*x[27][b]; gx[27][b] += g*x[14][b];
+            gx[14][b] += g*x[28][b]; gx[28][b] += g*x[14][b];
+            gx[14][b] += g*x[29][b]; gx[29][b] += g*x[14][b];
+            gx[14][b] += g*x[30][b]; gx[30][b] += g*x[14][b];
+            g = gf[60][b];
+            gx[29][b] += g*x[29][b]; gx[29][b] += g*x[29][b];
+            gx[28][b] += g*x[28][b]; gx[28][b] += g*x[28][b];
+            gx[27][b] += g*x[27][b]; gx[27][b] += g*x[27][b];
+            gx[30][b] += g*x[30][b]; gx[30][b] += g*x[30][b];
+            g = gf[61][b];
+            gx[1][b] += g*x[25][b]; gx[25][b] += g*x[1][b];
+            gx[0][b] += g*x[24][b]; gx[24][b] += g*x[0][b];
+            gx[0][b] += g*x[23][b]; gx[23][b] += g*x[0][b];
+            gx[1][b] += g*x[26][b]; gx[26][b] += g*x[1][b];
+            g = gf[62][b];
+            gx[14][b] += g*x[5][b]; gx[5][b] += g*x[14][b];
+            gx[14][b] += g*x[3][b]; gx[3][b] += g*x[14][b];
+            gx[14][b] += g*x[2][b]; gx[2][b] += g*x[14][b];
+            gx[14][b] += g*x[4][b]; gx[4][b] += g*x[14][b];
+            g = gf[63][b];
+            gx[0][b] += g*x[11][b]; gx[11][b] += g*x[0][b];
+            gx[13][b] += g*x[1][b]; gx[1][b] += g*x[13][b];
+            gx[0][b] += g*x[10][b]; gx[10][b] += g*x[0][b];
+            gx[12][b] += g*x[1][b]; gx[1][b] += g*x[12][b];
+            g = gf[64][b];
+            gx[28][b] += g*x[30][b]; gx[30][b] += g*x[28][b];
+            gx[27][b] += g*x[29][b]; gx[29][b] += g*x[27][b];
+            gx[27][b] += g*x[28][b]; gx[28][b] += g*x[27][b];
+            gx[29][b] += g*x[30][b]; gx[30][b] += g*x[29][b];
+            g = gf[65][b];
+            gx[11][b] += g*x[11][b]; gx[11][b] += g*x[11][b];
+            gx[10][b] += g*x[10][b]; gx[10][b] += g*x[10][b];
+            gx[12][b] += g*x[12][b]; gx[12][b] += g*x[12][b];
+            gx[13][b] += g*x[13][b]; gx[13][b] += g*x[13][b];
+            g = gf[66][b];
+            gx[23][b] += g*x[24][b]; gx[24][b] += g*x[23][b];
+            gx[25][b] += g*x[26][b]; gx[26][b] += g*x[25][b];
+            g = gf[67][b];
+            gx[16][b] += g*x[17][b]; gx[17][b] += g*x[16][b];
+            gx[19][b] += g*x[22][b]; gx[22][b] += g*x[19][b];
+            gx[20][b] += g*x[21][b]; gx[21][b] += g*x[20][b];
+            gx[15][b] += g*x[18][b]; gx[18][b] += g*x[15][b];
+            g = gf[68][b];
+            gx[14][b] += g*x[14][b]; gx[14][b] += g*x[14][b];
+        }
+}
+
+// Sites of the m dimers of a block from first on, with their extra points, in structures of arrays,
+// and the exp(-r) of their 31 distances
+static void computeBlockVariables(
+        const double3 * positions,
+        const int first,
+        const int m,
+        double (* sx)[NN_FEATURE_BLOCK],
+        double (* sy)[NN_FEATURE_BLOCK],
+        double (* sz)[NN_FEATURE_BLOCK],
+        double (* x)[NN_FEATURE_BLOCK]) {
+
+        for (int b = 0; b < m; b++) {
+            double3 sites[10];
+            for (int s = 0; s < 6; s++)
+                sites[s] = positions[6*(first + b) + s];
+            computeExtraPoint(sites + Oa, sites + Ha1, sites + Ha2, sites + Xa1, sites + Xa2);
+            computeExtraPoint(sites + Ob, sites + Hb1, sites + Hb2, sites + Xb1, sites + Xb2);
+            for (int s = 0; s < 10; s++) {
+                sx[s][b] = sites[s].x;
+                sy[s][b] = sites[s].y;
+                sz[s][b] = sites[s].z;
+            }
+        }
+
+        for (int k = 0; k < NN_NUM_DISTANCES; k++) {
+            const int i = nnDistanceSites[k][0], j = nnDistanceSites[k][1];
+            for (int b = 0; b < m; b++) {
+                double dx = sx[i][b] - sx[j][b];
+                double dy = sy[i][b] - sy[j][b];
+                double dz = sz[i][b] - sz[j][b];
+                x[k][b] = sqrt(dx*dx + dy*dy + dz*dz);
+            }
+        }
+        for (int k = 0; k < NN_NUM_DISTANCES; k++)
+            for (int b = 0; b < m; b++)
+                x[k][b] = exp(-x[k][b]);
+}
+
+template <typename T>
+void computeNNFeatures(const double3 * positions, int n, T * features) {
+
+        // sites, then distances and their exponentials, then the features of one block
+        double sx[10][NN_FEATURE_BLOCK], sy[10][NN_FEATURE_BLOCK], sz[10][NN_FEATURE_BLOCK];
+        double x[NN_NUM_DISTANCES][NN_FEATURE_BLOCK];
+        double f[NN_NUM_FEATURES][NN_FEATURE_BLOCK];
+
+        for (int first = 0; first < n; first += NN_FEATURE_BLOCK) {
+            const int m = n - first < NN_FEATURE_BLOCK ? n - first : NN_FEATURE_BLOCK;
+
+            computeBlockVariables(positions, first, m, sx, sy, sz, x);
+            poly2d(x, m, f);
+
+            // one row per dimer
+            for (int b = 0; b < m; b++)
+                for (int k = 0; k < NN_NUM_FEATURES; k++)
+                    features[(size_t)(first + b)*NN_NUM_FEATURES + k] = (T) f[k][b];
+        }
+}
+
+template <typename T>
+void computeNNFeatureGradients(const double3 * positions, int n, const T * featureGradients, double3 * gradients) {
+
+        double sx[10][NN_FEATURE_BLOCK], sy[10][NN_FEATURE_BLOCK], sz[10][NN_FEATURE_BLOCK];
+        double x[NN_NUM_DISTANCES][NN_FEATURE_BLOCK], gx[NN_NUM_DISTANCES][NN_FEATURE_BLOCK];
+        double gf[NN_NUM_FEATURES][NN_FEATURE_BLOCK];
+
+        for (int first = 0; first < n; first += NN_FEATURE_BLOCK) {
+            const int m = n - first < NN_FEATURE_BLOCK ? n - first : NN_FEATURE_BLOCK;
+
+            // forward again, then back through the features to the 31 exponentials
+            computeBlockVariables(positions, first, m, sx, sy, sz, x);
+            for (int b = 0; b < m; b++)
+                for (int k = 0; k < NN_NUM_FEATURES; k++)
+                    gf[k][b] = featureGradients[(size_t)(first + b)*NN_NUM_FEATURES + k];
+            for (int k = 0; k < NN_NUM_DISTANCES; k++)
+                for (int b = 0; b < m; b++)
+                    gx[k][b] = 0.;
+            poly2dGradient(x, gf, m, gx);
+
+            // then to the sites as in accumulateDimerForces: d exp(-r)/d site i = -exp(-r) (site i - site j)/r
+            for (int b = 0; b < m; b++) {
+                double3 sites[10], siteGradients[10];
+                for (int s = 0; s < 10; s++) {
+                    sites[s] = make_double3(sx[s][b], sy[s][b], sz[s][b]);
+                    siteGradients[s] = make_double3(0.);
+                }
+
+                for (int k = 0; k < NN_NUM_DISTANCES; k++) {
+                    const int i = nnDistanceSites[k][0], j = nnDistanceSites[k][1];
+                    double3 d = sites[i] - sites[j];
+                    double3 gOO = d * (-x[k][b]/sqrt(dot(d, d)));
+                    computeGrads(&gx[k][b], &gOO, siteGradients + i, siteGradients + j, 1.);
+                }
+
+                distributeXpointGrad(sites + Oa, sites + Ha1, sites + Ha2,
+                        siteGradients + Xa1, siteGradients + Xa2,
+                        siteGradients + Oa, siteGradients + Ha1, siteGradients + Ha2, 1.);
+                distributeXpointGrad(sites + Ob, sites + Hb1, sites + Hb2,
+                        siteGradients + Xb1, siteGradients + Xb2,
+                        siteGradients + Ob, siteGradients + Hb1, siteGradients + Hb2, 1.);
+
+                for (int s = 0; s < 6; s++)
+                    gradients[6*(first + b) + s] += siteGradients[s];
+            }
+        }
+}
+
+template void computeNNFeatures<double>(const double3 * positions, int n, double * features);
+template void computeNNFeatures<float>(const double3 * positions, int n, float * features);
+template void computeNNFeatureGradients<double>(const double3 * positions, int n, const double * featureGradients,
+                                                double3 * gradients);
+template void computeNNFeatureGradients<float>(const double3 * positions, int n, const float * featureGradients,
+                                               double3 * gradients);
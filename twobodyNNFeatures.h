@@ -0,0 +1,35 @@
+#ifndef TWOBODYNNFEATURES
+#define TWOBODYNNFEATURES
+
+#include "hostVectorTypes.h"
+
+// Inputs of the NN two-body model of NN_2L2H2O_poly2d: the 31 site-site distances of a dimer
+// (extra points included), their exp(-r), and the 69 symmetrized second degree sums of poly_2d()
+// in BenchMarking_InputGeneration.py, which the network was trained on.
+
+#define NN_NUM_DISTANCES 31
+#define NN_NUM_FEATURES  69
+
+// Dimers processed together, in structures of arrays so that each step is vectorized across them
+#define NN_FEATURE_BLOCK 64
+
+// Sites of the 31 distances (Oa ... Xb2 of twobodyForceInteraction.h), in the order of the training script,
+// which is also the order of the exp variables of the polynomial
+extern const int nnDistanceSites[NN_NUM_DISTANCES][2];
+
+// Features of n dimers. positions holds the 6 atoms of each dimer, Oa Ha1 Ha2 Ob Hb1 Hb2 (6*n entries),
+// the second molecule already at its minimum image, e.g. as loadDimerPositions and computeLoadedDimerTerms
+// leave them. The extra points are built by computeExtraPoint as in the polynomial.
+// features gets n rows of NN_NUM_FEATURES values, the layout Layer_Net_t::predict takes.
+template <typename T>
+void computeNNFeatures(const double3 * positions, int n, T * features);
+
+// Reverse of computeNNFeatures: given the gradients of the score of each dimer with respect to its features
+// (n x NN_NUM_FEATURES, as Layer_Net_t::predict_and_gradient returns them), add the gradients with respect
+// to its 6 atoms to gradients (6*n entries, same order as positions). The extra point gradients are moved
+// to the atoms by distributeXpointGrad, as for the polynomial, and the sign is that of the host engine
+// "forces", i.e. dE/dx.
+template <typename T>
+void computeNNFeatureGradients(const double3 * positions, int n, const T * featureGradients, double3 * gradients);
+
+#endif
@@ -0,0 +1,194 @@
+#include "twobodyNeighborList.h"
+#include "twobodySystem.h"
+#include "vectorOps.cu"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+NeighborList::NeighborList(double skin, double cutoff) :
+    skin(skin), cutoff(cutoff), builds(0), referenceBox(makeNonPeriodicBox()), numCells(make_int3(0)) {}
+
+static bool sameBox(const PeriodicBox & a, const PeriodicBox & b) {
+    if (a.periodic != b.periodic)
+        return false;
+    return !a.periodic || (a.a.x == b.a.x && a.b.x == b.b.x && a.b.y == b.b.y
+                           && a.c.x == b.c.x && a.c.y == b.c.y && a.c.z == b.c.z);
+}
+
+void NeighborList::gatherOxygens(const double4* posq, unsigned int nMolecules) {
+    current.resize(nMolecules);
+    for (unsigned int i = 0; i < nMolecules; i++)
+        current[i] = trimTo3(posq[3*i]);
+}
+
+void NeighborList::gatherOxygens(const WaterSystem & system) {
+    current.resize(system.getNumMolecules());
+    for (unsigned int i = 0; i < system.getNumMolecules(); i++)
+        current[i] = system.getPosition(3*i);
+}
+
+bool NeighborList::update(const double4* posq, unsigned int nMolecules, const PeriodicBox & box) {
+    gatherOxygens(posq, nMolecules);
+    return updateCurrent(box);
+}
+
+bool NeighborList::update(const WaterSystem & system, const PeriodicBox & box) {
+    gatherOxygens(system);
+    return updateCurrent(box);
+}
+
+void NeighborList::build(const double4* posq, unsigned int nMolecules, const PeriodicBox & box) {
+    gatherOxygens(posq, nMolecules);
+    buildCurrent(box);
+}
+
+void NeighborList::build(const WaterSystem & system, const PeriodicBox & box) {
+    gatherOxygens(system);
+    buildCurrent(box);
+}
+
+bool NeighborList::updateCurrent(const PeriodicBox & box) {
+    const unsigned int nMolecules = current.size();
+
+    if (builds == 0 || reference.size() != nMolecules || !sameBox(box, referenceBox)) {
+        buildCurrent(box);
+        return true;
+    }
+
+    // Pairs can only cross into the cutoff once two oxygens moved by skin in total.
+    // Displacements use the minimum image, so molecules wrapped back into the box do not count as moving.
+    double maxDisplacement2 = 0.;
+    #pragma omp parallel for reduction(max:maxDisplacement2)
+    for (int i = 0; i < (int)nMolecules; i++) {
+        double3 d = minimumImage(box, current[i] - reference[i]);
+        maxDisplacement2 = std::max(maxDisplacement2, dot(d, d));
+    }
+
+    if (maxDisplacement2 > 0.25*skin*skin) {
+        buildCurrent(box);
+        return true;
+    }
+    return false;
+}
+
+// Distinct cells next to c along one dimension (c itself included), wrapping around for periodic boxes
+static int neighborCells(int c, int n, bool periodic, int cells[3]) {
+    int count = 0;
+    for (int d = -1; d <= 1; d++) {
+        int k = c + d;
+        if (periodic)
+            k = (k + n) % n;
+        else if (k < 0 || k >= n)
+            continue;
+        if (std::find(cells, cells + count, k) == cells + count)
+            cells[count++] = k;
+    }
+    return count;
+}
+
+void NeighborList::buildCurrent(const PeriodicBox & box) {
+
+    const unsigned int nMolecules = current.size();
+    const double listCutoff = cutoff + skin;
+    const double listCutoff2 = listCutoff*listCutoff;
+
+    reference = current;
+    referenceBox = box;
+    rowOffsets.assign(nMolecules + 1, 0);
+    pairList.clear();
+    builds++;
+
+    if (nMolecules == 0)
+        return;
+
+    // Cells must be at least listCutoff wide so only the 27 surrounding cells need to be searched.
+    // Fewer, wider cells are always correct, so cap the grid to keep a few stray molecules from blowing it up.
+    const int maxCells = 2*(int)std::cbrt((double)nMolecules) + 1;
+
+    // Position of each oxygen in [0, 1) along the three cell directions
+    std::vector<double3> scaled(nMolecules);
+    double3 extent;
+    if (box.periodic) {
+        extent = periodicBoxWidths(box);
+        if (2.*listCutoff > std::min(extent.x, std::min(extent.y, extent.z)))
+            throw std::runtime_error("NeighborList: cutoff + skin is larger than half the periodic box width");
+        for (unsigned int i = 0; i < nMolecules; i++) {
+            double3 s = fractionalCoordinates(box, reference[i]);
+            scaled[i] = make_double3(s.x - floor(s.x), s.y - floor(s.y), s.z - floor(s.z));
+        }
+    } else {
+        double3 lo = reference[0];
+        double3 hi = lo;
+        for (unsigned int i = 0; i < nMolecules; i++) {
+            lo = make_double3(std::min(lo.x, reference[i].x), std::min(lo.y, reference[i].y), std::min(lo.z, reference[i].z));
+            hi = make_double3(std::max(hi.x, reference[i].x), std::max(hi.y, reference[i].y), std::max(hi.z, reference[i].z));
+        }
+        extent = hi - lo;
+        double3 invExtent = make_double3(1./std::max(extent.x, listCutoff),
+                                         1./std::max(extent.y, listCutoff),
+                                         1./std::max(extent.z, listCutoff));
+        for (unsigned int i = 0; i < nMolecules; i++)
+            scaled[i] = (reference[i] - lo)*invExtent;
+    }
+    numCells.x = std::max(1, std::min(maxCells, (int)(extent.x/listCutoff)));
+    numCells.y = std::max(1, std::min(maxCells, (int)(extent.y/listCutoff)));
+    numCells.z = std::max(1, std::min(maxCells, (int)(extent.z/listCutoff)));
+
+    const int totalCells = numCells.x*numCells.y*numCells.z;
+    std::vector<int3> cellOf(nMolecules);
+    for (unsigned int i = 0; i < nMolecules; i++) {
+        cellOf[i] = make_int3(std::min((int)(scaled[i].x*numCells.x), numCells.x - 1),
+                              std::min((int)(scaled[i].y*numCells.y), numCells.y - 1),
+                              std::min((int)(scaled[i].z*numCells.z), numCells.z - 1));
+    }
+
+    // counting sort of the molecules by cell
+    cellStart.assign(totalCells + 1, 0);
+    for (unsigned int i = 0; i < nMolecules; i++)
+        cellStart[(cellOf[i].z*numCells.y + cellOf[i].y)*numCells.x + cellOf[i].x + 1]++;
+    for (int c = 0; c < totalCells; c++)
+        cellStart[c + 1] += cellStart[c];
+    cellMolecules.resize(nMolecules);
+    std::vector<unsigned int> fill(cellStart.begin(), cellStart.end() - 1);
+    for (unsigned int i = 0; i < nMolecules; i++)
+        cellMolecules[fill[(cellOf[i].z*numCells.y + cellOf[i].y)*numCells.x + cellOf[i].x]++] = i;
+
+    // Two passes over the surrounding cells: count the neighbors of each molecule, then fill the rows
+    for (int pass = 0; pass < 2; pass++) {
+        #pragma omp parallel for schedule(dynamic, 64)
+        for (int i = 0; i < (int)nMolecules; i++) {
+            unsigned int count = 0;
+            unsigned int * row = pass ? pairList.data() + rowOffsets[i] : NULL;
+            int cx[3], cy[3], cz[3];
+            int nx = neighborCells(cellOf[i].x, numCells.x, box.periodic, cx);
+            int ny = neighborCells(cellOf[i].y, numCells.y, box.periodic, cy);
+            int nz = neighborCells(cellOf[i].z, numCells.z, box.periodic, cz);
+            for (int iz = 0; iz < nz; iz++)
+            for (int iy = 0; iy < ny; iy++)
+            for (int ix = 0; ix < nx; ix++) {
+                int c = (cz[iz]*numCells.y + cy[iy])*numCells.x + cx[ix];
+                for (unsigned int k = cellStart[c]; k < cellStart[c + 1]; k++) {
+                    unsigned int j = cellMolecules[k];
+                    if (j <= (unsigned int)i)
+                        continue;
+                    double3 d = minimumImage(box, reference[j] - reference[i]);
+                    if (dot(d, d) < listCutoff2) {
+                        if (pass)
+                            row[count] = j;
+                        count++;
+                    }
+                }
+            }
+            if (pass)
+                std::sort(row, row + count);
+            else
+                rowOffsets[i + 1] = count;
+        }
+
+        if (pass == 0) {
+            for (unsigned int i = 0; i < nMolecules; i++)
+                rowOffsets[i + 1] += rowOffsets[i];
+            pairList.resize(rowOffsets[nMolecules]);
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#ifndef TWOBODYNEIGHBORLIST
+#define TWOBODYNEIGHBORLIST
+
+#include "hostVectorTypes.h"
+#include "periodicBox.h"
+#include <vector>
+
+class WaterSystem;
+
+// Verlet list of the molecule pairs closer than cutoff + skin, measured between the oxygens.
+// The list is built by binning the oxygens into cells at least cutoff + skin wide, so the cost is linear
+// in the number of molecules, and it is reused until some oxygen has moved more than half the skin.
+// Pairs are stored once (j > i) in compressed rows: the neighbors of i are
+// neighbors()[offsets()[i]] ... neighbors()[offsets()[i+1]-1].
+// With a periodic box the cells tile the box, distances use the minimum image and cutoff + skin
+// must not exceed half the smallest box width.
+class NeighborList {
+public:
+    // the default cutoff is r2f of the two-body interaction
+    NeighborList(double skin = 1.0, double cutoff = 6.5);
+
+    // Rebuild the list if needed, posq holds 3*nMolecules atoms ordered O, H1, H2.
+    // The list is also rebuilt when the box changes. Returns true if the list was rebuilt.
+    bool update(const double4* posq, unsigned int nMolecules, const PeriodicBox & box = makeNonPeriodicBox());
+
+    // Rebuild the list unconditionally
+    void build(const double4* posq, unsigned int nMolecules, const PeriodicBox & box = makeNonPeriodicBox());
+
+    // Same, for a system stored as structures of arrays
+    bool update(const WaterSystem & system, const PeriodicBox & box = makeNonPeriodicBox());
+    void build(const WaterSystem & system, const PeriodicBox & box = makeNonPeriodicBox());
+
+    const std::vector<unsigned int>& offsets() const { return rowOffsets; }
+    const std::vector<unsigned int>& neighbors() const { return pairList; }
+    unsigned int numPairs() const { return pairList.size(); }
+    unsigned int numBuilds() const { return builds; }
+
+    double getCutoff() const { return cutoff; }
+    double getSkin() const { return skin; }
+
+private:
+    // both layouts copy the oxygens to current first
+    void gatherOxygens(const double4* posq, unsigned int nMolecules);
+    void gatherOxygens(const WaterSystem & system);
+    bool updateCurrent(const PeriodicBox & box);
+    void buildCurrent(const PeriodicBox & box);
+
+    double skin;
+    double cutoff;
+    unsigned int builds;
+
+    std::vector<unsigned int> rowOffsets;
+    std::vector<unsigned int> pairList;
+
+    // oxygen positions of this call, and the ones and box at the last build, to measure displacements
+    std::vector<double3> current;
+    std::vector<double3> reference;
+    PeriodicBox referenceBox;
+
+    // cell grid, molecules sorted by cell
+    int3 numCells;
+    std::vector<unsigned int> cellStart;
+    std::vector<unsigned int> cellMolecules;
+};
+
+#endif
@@ -0,0 +1,92 @@
+#include "twobodySystem.h"
+#include <algorithm>
+
+static unsigned int paddedSize(unsigned int n) {
+    return (n + SYSTEM_PADDING - 1)/SYSTEM_PADDING*SYSTEM_PADDING;
+}
+
+WaterSystem::WaterSystem(unsigned int nMolecules) : nMolecules(0) {
+    resize(nMolecules);
+}
+
+WaterSystem::WaterSystem(const double4* posq, unsigned int nMolecules) : nMolecules(0) {
+    setPositions(posq, nMolecules);
+}
+
+void WaterSystem::resize(unsigned int nMolecules) {
+    this->nMolecules = nMolecules;
+    const unsigned int size = paddedSize(3*nMolecules);
+    posX.assign(size, 0.);
+    posY.assign(size, 0.);
+    posZ.assign(size, 0.);
+    charges.assign(size, 0.);
+    molecules.resize(nMolecules);
+    siteForces.resize((3 + MOLECULE_SITES)*nMolecules);
+}
+
+void WaterSystem::setPositions(const double4* posq, unsigned int nMolecules) {
+    if (nMolecules != this->nMolecules)
+        resize(nMolecules);
+
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < (int)(3*nMolecules); i++) {
+        posX[i] = posq[i].x;
+        posY[i] = posq[i].y;
+        posZ[i] = posq[i].z;
+        charges[i] = posq[i].w;
+    }
+}
+
+void WaterSystem::getPositions(double4* posq) const {
+    for (unsigned int i = 0; i < 3*nMolecules; i++)
+        posq[i] = make_double4(posX[i], posY[i], posZ[i], charges[i]);
+}
+
+void ForceBuffers::resize(unsigned int nSites, int nThreads) {
+    this->nSites = nSites;
+    stride = paddedSize(nSites);
+    const size_t size = 3*nThreads*(size_t)stride;
+    if (deterministic && fixedData.size() < size)
+        fixedData.resize(size);
+    if (!deterministic && data.size() < size)
+        data.resize(size);
+}
+
+void ForceBuffers::clear(int thread) {
+    const size_t first = 3*thread*(size_t)stride;
+    if (deterministic)
+        std::fill(fixedData.begin() + first, fixedData.begin() + first + 3*stride, 0);
+    else
+        std::fill(data.begin() + first, data.begin() + first + 3*stride, 0.);
+}
+
+void ForceBuffers::reduce(double3 * forces, int nThreads) const {
+    if (deterministic) {
+        const long long * buffer = fixedData.data();
+
+        #pragma omp for schedule(static)
+        for (int i = 0; i < (int)nSites; i++) {
+            long long fx = 0, fy = 0, fz = 0;
+            for (int t = 0; t < nThreads; t++) {
+                fx += buffer[(3*t + 0)*stride + i];
+                fy += buffer[(3*t + 1)*stride + i];
+                fz += buffer[(3*t + 2)*stride + i];
+            }
+            forces[i] = make_double3(fromFixedPoint(fx), fromFixedPoint(fy), fromFixedPoint(fz));
+        }
+        return;
+    }
+
+    const double * buffer = data.data();
+
+    #pragma omp for schedule(static)
+    for (int i = 0; i < (int)nSites; i++) {
+        double3 f = make_double3(0., 0., 0.);
+        for (int t = 0; t < nThreads; t++) {
+            f.x += buffer[(3*t + 0)*stride + i];
+            f.y += buffer[(3*t + 1)*stride + i];
+            f.z += buffer[(3*t + 2)*stride + i];
+        }
+        forces[i] = f;
+    }
+}
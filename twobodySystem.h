@@ -0,0 +1,156 @@
+#ifndef TWOBODYSYSTEM
+#define TWOBODYSYSTEM
+
+#include "hostVectorTypes.h"
+#include "twobodyForceInteraction.h"
+#include <math.h>
+#include <stdlib.h>
+#include <new>
+#include <vector>
+
+// Arrays start on a cache line, which is also the width of an AVX-512 register
+#define SYSTEM_ALIGNMENT 64
+
+// and hold a multiple of this many atoms, so full registers can be loaded up to the end
+#define SYSTEM_PADDING (SYSTEM_ALIGNMENT/sizeof(double))
+
+template <typename T>
+struct AlignedAllocator {
+    typedef T value_type;
+
+    AlignedAllocator() {}
+    template <typename U> AlignedAllocator(const AlignedAllocator<U> &) {}
+
+    T * allocate(size_t n) {
+        void * p = NULL;
+        if (posix_memalign(&p, SYSTEM_ALIGNMENT, n*sizeof(T)) != 0)
+            throw std::bad_alloc();
+        return (T *) p;
+    }
+    void deallocate(T * p, size_t) { free(p); }
+
+    template <typename U> bool operator==(const AlignedAllocator<U> &) const { return true; }
+    template <typename U> bool operator!=(const AlignedAllocator<U> &) const { return false; }
+};
+
+typedef std::vector<double, AlignedAllocator<double> > AlignedVector;
+typedef std::vector<long long, AlignedAllocator<long long> > AlignedFixedVector;
+typedef std::vector<double3, AlignedAllocator<double3> > AlignedDouble3Vector;
+typedef std::vector<MoleculeTerms, AlignedAllocator<MoleculeTerms> > MoleculeTermsVector;
+
+// Scale of the 64 bit fixed point accumulators of the deterministic mode, 2^32 as in OpenMM:
+// a resolution of 2e-10 and a range of 2e9 kcal/mol or kcal/mol/A
+#define FIXED_POINT_SCALE 4294967296.0
+
+// rounded to nearest, truncation would bias sums of many small terms
+inline long long toFixedPoint(double v) {
+    return llrint(v*FIXED_POINT_SCALE);
+}
+
+inline double fromFixedPoint(long long v) {
+    return v/FIXED_POINT_SCALE;
+}
+
+/**
+ * One structure of arrays of forces per thread, so that each thread adds its pair contributions
+ * without atomics, and reduce() sums them once all the pairs are done. The entries are sites: the atoms,
+ * followed for the host engine by the extra points and intramolecular gradients of each water.
+ * In deterministic mode the buffers are 64 bit fixed point: integer sums do not depend on their order,
+ * so the forces are bitwise identical whatever the number of threads and the scheduling.
+ */
+class ForceBuffers {
+public:
+    ForceBuffers() : nSites(0), stride(0), deterministic(false) {}
+
+    void setDeterministic(bool deterministic) { this->deterministic = deterministic; }
+    bool isDeterministic() const { return deterministic; }
+
+    // Room for nSites sites in each of nThreads buffers, the contents are undefined until clear()
+    void resize(unsigned int nSites, int nThreads);
+
+    // Zero the buffer of one thread, best called by that thread so that its pages are local to it
+    void clear(int thread);
+
+    // Add a pair contribution to a site in the buffer of a thread
+    void add(int thread, unsigned int site, double3 f) {
+        if (deterministic) {
+            long long * p = fixedData.data() + 3*thread*(size_t)stride + site;
+            p[0] += toFixedPoint(f.x);
+            p[stride] += toFixedPoint(f.y);
+            p[2*stride] += toFixedPoint(f.z);
+        } else {
+            double * p = data.data() + 3*thread*(size_t)stride + site;
+            p[0] += f.x;
+            p[stride] += f.y;
+            p[2*stride] += f.z;
+        }
+    }
+
+    // Sum the buffers of the first nThreads threads into forces (nSites entries, overwritten).
+    // Called by all the threads of a parallel region, which share the sites, after a barrier.
+    void reduce(double3 * forces, int nThreads) const;
+
+private:
+    unsigned int nSites, stride;
+    bool deterministic;
+    AlignedVector data;
+    AlignedFixedVector fixedData;
+};
+
+/**
+ * Positions and charges of a system of water molecules as structures of arrays: x, y, z and q each
+ * in their own aligned array padded with zeros, atoms ordered O, H1, H2 for each molecule as in posq.
+ * The three atoms of a molecule are then consecutive in each array.
+ * It also keeps what the engine needs per evaluation, so it is allocated once per system: the per-thread
+ * force buffers, the terms of each molecule shared by its dimers and the summed forces on all the sites.
+ */
+class WaterSystem {
+public:
+    WaterSystem(unsigned int nMolecules = 0);
+    WaterSystem(const double4* posq, unsigned int nMolecules);
+
+    // Copy 3*nMolecules atoms from the OpenMM layout, resizing if needed
+    void setPositions(const double4* posq, unsigned int nMolecules);
+    void getPositions(double4* posq) const;
+
+    double3 getPosition(unsigned int atom) const { return make_double3(posX[atom], posY[atom], posZ[atom]); }
+
+    unsigned int getNumMolecules() const { return nMolecules; }
+    unsigned int getNumAtoms() const { return 3*nMolecules; }
+    // length of the arrays
+    unsigned int getPaddedSize() const { return posX.size(); }
+
+    const double * x() const { return posX.data(); }
+    const double * y() const { return posY.data(); }
+    const double * z() const { return posZ.data(); }
+    const double * q() const { return charges.data(); }
+
+    // for drivers that update the positions in place
+    double * x() { return posX.data(); }
+    double * y() { return posY.data(); }
+    double * z() { return posZ.data(); }
+    double * q() { return charges.data(); }
+
+    ForceBuffers & getForceBuffers() { return buffers; }
+    // getNumMolecules() entries, filled by each evaluation
+    MoleculeTermsVector & getMoleculeTerms() { return molecules; }
+    const MoleculeTermsVector & getMoleculeTerms() const { return molecules; }
+    // forces on the atoms then MOLECULE_SITES sites per molecule, as summed from the buffers
+    AlignedDouble3Vector & getSiteForces() { return siteForces; }
+
+    // Accumulate forces and energy in fixed point, for results that are bitwise reproducible
+    // with any number of threads, see ForceBuffers
+    void setDeterministic(bool deterministic) { buffers.setDeterministic(deterministic); }
+    bool isDeterministic() const { return buffers.isDeterministic(); }
+
+private:
+    void resize(unsigned int nMolecules);
+
+    unsigned int nMolecules;
+    AlignedVector posX, posY, posZ, charges;
+    ForceBuffers buffers;
+    MoleculeTermsVector molecules;
+    AlignedDouble3Vector siteForces;
+};
+
+#endif
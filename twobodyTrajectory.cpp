@@ -0,0 +1,323 @@
+#include "twobodyTrajectory.h"
+#include "twobodyForceCPU.h"
+#include "stageTrace.h"
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <exception>
+#include <future>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+static inline int omp_get_max_threads() { return 1; }
+static inline int omp_get_thread_num() { return 0; }
+#endif
+
+static const char BINARY_MAGIC[8] = {'M', 'B', '2', 'B', 'T', 'R', 'J', '1'};
+
+// per frame: number of atoms and periodic flag, then the box
+#define BINARY_FRAME_HEADER (2*sizeof(uint32_t) + 9*sizeof(double))
+
+TrajectoryReader::TrajectoryReader(const char * filename) : data(NULL), size(0), position(0), frames(0) {
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error(std::string("TrajectoryReader: cannot open ") + filename);
+    struct stat status;
+    if (fstat(fd, &status) != 0) {
+        close(fd);
+        throw std::runtime_error(std::string("TrajectoryReader: cannot read ") + filename);
+    }
+    size = status.st_size;
+
+    if (size > 0) {
+        void * p = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            close(fd);
+            throw std::runtime_error(std::string("TrajectoryReader: cannot map ") + filename);
+        }
+        // read once from start to end, let the kernel read ahead
+        madvise(p, size, MADV_SEQUENTIAL);
+        data = (const char *) p;
+    }
+    // the mapping stays valid without the descriptor
+    close(fd);
+
+    format = XYZ;
+    if (size >= sizeof(BINARY_MAGIC) && memcmp(data, BINARY_MAGIC, sizeof(BINARY_MAGIC)) == 0) {
+        format = BINARY;
+        position = sizeof(BINARY_MAGIC);
+    }
+}
+
+TrajectoryReader::~TrajectoryReader() {
+    if (data != NULL)
+        munmap((void *) data, size);
+}
+
+void TrajectoryReader::error(const char * message) const {
+    std::ostringstream text;
+    text << "TrajectoryReader: frame " << frames << ": " << message;
+    throw std::runtime_error(text.str());
+}
+
+bool TrajectoryReader::nextLine(const char *& line, size_t & length) {
+    if (position >= size)
+        return false;
+    line = data + position;
+    const char * end = (const char *) memchr(line, '\n', size - position);
+    length = end != NULL ? end - line : size - position;
+    position += length + 1;
+    if (length > 0 && line[length-1] == '\r')
+        length--;
+    return true;
+}
+
+bool TrajectoryReader::read(TrajectoryFrame & frame) {
+    bool found = format == BINARY ? readBinary(frame) : readXYZ(frame);
+    if (found)
+        frames++;
+    return found;
+}
+
+// Parse up to n doubles from a line, which is not terminated in the mapping. Returns the number parsed.
+static int parseNumbers(const char * line, size_t length, double * values, int n) {
+    char buffer[256];
+    length = length < sizeof(buffer) - 1 ? length : sizeof(buffer) - 1;
+    memcpy(buffer, line, length);
+    buffer[length] = '\0';
+
+    char * p = buffer;
+    int count = 0;
+    for (; count < n; count++) {
+        char * end;
+        values[count] = strtod(p, &end);
+        if (end == p)
+            break;
+        p = end;
+    }
+    return count;
+}
+
+// Why the 9 numbers a, b, c of a box are not in the reduced form of periodicBox.h, NULL if they are
+static const char * reducedBoxError(const double v[9]) {
+    if (v[1] != 0. || v[2] != 0. || v[5] != 0.)
+        return "must be in reduced form, a along x and b in the xy plane";
+    if (!(v[0] > 0.) || !(v[4] > 0.) || !(v[8] > 0.))
+        return "must have positive ax, by and cz";
+    if (!(fabs(v[3]) <= v[0]/2) || !(fabs(v[6]) <= v[0]/2) || !(fabs(v[7]) <= v[4]/2))
+        return "must be reduced, with |bx| and |cx| at most ax/2 and |cy| at most by/2";
+    return NULL;
+}
+
+static bool isBlank(const char * line, size_t length) {
+    for (size_t i = 0; i < length; i++)
+        if (line[i] != ' ' && line[i] != '\t')
+            return false;
+    return true;
+}
+
+bool TrajectoryReader::readXYZ(TrajectoryFrame & frame) {
+    const char * line;
+    size_t length;
+
+    // blank lines between frames, e.g. at the end of the file
+    do {
+        if (!nextLine(line, length))
+            return false;
+    } while (isBlank(line, length));
+
+    double count;
+    if (parseNumbers(line, length, &count, 1) != 1 || count < 0 || count != (unsigned int) count)
+        error("expected the number of atoms");
+    const unsigned int nAtoms = (unsigned int) count;
+    if (nAtoms % 3 != 0)
+        error("the number of atoms is not a multiple of 3");
+
+    if (!nextLine(line, length))
+        error("missing comment line");
+    frame.box = makeNonPeriodicBox();
+    const std::string comment(line, length);
+    size_t lattice = comment.find("Lattice=\"");
+    if (lattice != std::string::npos) {
+        const char * numbers = comment.c_str() + lattice + 9;
+        double v[9];
+        if (parseNumbers(numbers, strlen(numbers), v, 9) != 9)
+            error("expected 9 numbers in Lattice");
+        if (const char * reason = reducedBoxError(v))
+            error((std::string("Lattice ") + reason).c_str());
+        frame.box = makeTriclinicBox(make_double3(v[0], v[1], v[2]), make_double3(v[3], v[4], v[5]),
+                                     make_double3(v[6], v[7], v[8]));
+    }
+
+    frame.nMolecules = nAtoms/3;
+    frame.posq.resize(nAtoms);
+    for (unsigned int i = 0; i < nAtoms; i++) {
+        if (!nextLine(line, length))
+            error("unexpected end of file");
+
+        // element, then x, y, z
+        size_t first = 0;
+        while (first < length && (line[first] == ' ' || line[first] == '\t'))
+            first++;
+        const char expected = i % 3 == 0 ? 'O' : 'H';
+        if (first == length || line[first] != expected)
+            error(i % 3 == 0 ? "expected an oxygen, atoms must be ordered O, H, H"
+                             : "expected a hydrogen, atoms must be ordered O, H, H");
+        size_t last = first;
+        while (last < length && line[last] != ' ' && line[last] != '\t')
+            last++;
+
+        double x[3];
+        if (parseNumbers(line + last, length - last, x, 3) != 3)
+            error("expected the element and x, y, z of an atom");
+        frame.posq[i] = make_double4(x[0], x[1], x[2], 0.);
+    }
+    return true;
+}
+
+bool TrajectoryReader::readBinary(TrajectoryFrame & frame) {
+    if (position == size)
+        return false;
+    if (size - position < BINARY_FRAME_HEADER)
+        error("truncated frame header");
+
+    uint32_t header[2];
+    double box[9];
+    memcpy(header, data + position, sizeof(header));
+    memcpy(box, data + position + sizeof(header), sizeof(box));
+    position += BINARY_FRAME_HEADER;
+
+    const uint32_t nAtoms = header[0];
+    if (nAtoms % 3 != 0)
+        error("the number of atoms is not a multiple of 3");
+    if (size - position < 3*sizeof(double)*(size_t)nAtoms)
+        error("truncated frame");
+
+    frame.nMolecules = nAtoms/3;
+    frame.box = makeNonPeriodicBox();
+    if (header[1] != 0) {
+        if (const char * reason = reducedBoxError(box))
+            error((std::string("the box ") + reason).c_str());
+        frame.box = makeTriclinicBox(make_double3(box[0], box[1], box[2]), make_double3(box[3], box[4], box[5]),
+                                     make_double3(box[6], box[7], box[8]));
+    }
+
+    const char * positions = data + position;
+    frame.posq.resize(nAtoms);
+    for (uint32_t i = 0; i < nAtoms; i++) {
+        double x[3];
+        memcpy(x, positions + 3*sizeof(double)*i, sizeof(x));
+        frame.posq[i] = make_double4(x[0], x[1], x[2], 0.);
+    }
+    position += 3*sizeof(double)*(size_t)nAtoms;
+    return true;
+}
+
+BinaryTrajectoryWriter::BinaryTrajectoryWriter(const char * filename) : file(filename, std::ios::binary) {
+    if (!file)
+        throw std::runtime_error(std::string("BinaryTrajectoryWriter: cannot open ") + filename);
+    file.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+}
+
+void BinaryTrajectoryWriter::write(const TrajectoryFrame & frame) {
+    const uint32_t header[2] = {3*frame.nMolecules, frame.box.periodic ? 1u : 0u};
+    const PeriodicBox & b = frame.box;
+    const double box[9] = {b.a.x, b.a.y, b.a.z, b.b.x, b.b.y, b.b.z, b.c.x, b.c.y, b.c.z};
+    file.write((const char *) header, sizeof(header));
+    file.write((const char *) box, sizeof(box));
+
+    std::vector<double> positions(9*frame.nMolecules);
+    for (unsigned int i = 0; i < 3*frame.nMolecules; i++) {
+        positions[3*i + 0] = frame.posq[i].x;
+        positions[3*i + 1] = frame.posq[i].y;
+        positions[3*i + 2] = frame.posq[i].z;
+    }
+    file.write((const char *) positions.data(), positions.size()*sizeof(double));
+    if (!file)
+        throw std::runtime_error("BinaryTrajectoryWriter: write failed");
+}
+
+// Read up to n frames, returns how many were read
+static int readFrames(TrajectoryReader * reader, std::vector<TrajectoryFrame> * frames, int n) {
+    STAGE_SPAN("trajectory.read");
+    int count = 0;
+    while (count < n && reader->read((*frames)[count]))
+        count++;
+    return count;
+}
+
+size_t score_trajectory_cpu(
+        TrajectoryReader & reader,
+        const TwoBodyPolynomial & polynomial,
+        bool computeForces,
+        int batchSize,
+        const FrameOutput & output) {
+
+        if (batchSize < 1)
+            batchSize = 1;
+
+        // while one batch is evaluated the next one is read into the other
+        std::vector<TrajectoryFrame> batches[2];
+        batches[0].resize(batchSize);
+        batches[1].resize(batchSize);
+
+        // each thread keeps its system and neighbor list across the frames it evaluates
+        const int nThreads = omp_get_max_threads();
+        std::vector<WaterSystem> systems(nThreads);
+        std::vector<NeighborList> neighbors(nThreads);
+        std::vector<double> energies(batchSize);
+        std::vector<std::vector<double3> > forces(batchSize);
+        std::vector<std::exception_ptr> errors(batchSize);
+
+        size_t first = 0;
+        int current = 0;
+        int n = readFrames(&reader, &batches[current], batchSize);
+        while (n > 0) {
+            std::future<int> next = std::async(std::launch::async, readFrames, &reader, &batches[1 - current], batchSize);
+            std::vector<TrajectoryFrame> & frames = batches[current];
+
+            // consecutive frames go to the same thread, so its neighbor list is usually only updated
+            #pragma omp parallel for schedule(static)
+            for (int f = 0; f < n; f++) {
+                // an exception must not leave the parallel region, it is rethrown below
+                errors[f] = std::exception_ptr();
+                try {
+                    const int thread = omp_get_thread_num();
+                    systems[thread].setPositions(frames[f].posq.data(), frames[f].nMolecules);
+                    double3 * frameForces = NULL;
+                    if (computeForces) {
+                        forces[f].resize(3*frames[f].nMolecules);
+                        frameForces = forces[f].data();
+                    }
+                    evaluate_2b_cpu(systems[thread], frameForces, &energies[f], neighbors[thread], frames[f].box, polynomial);
+                } catch (...) {
+                    errors[f] = std::current_exception();
+                }
+            }
+
+            // the first failed frame, before any frame of the batch is output
+            for (int f = 0; f < n; f++)
+                if (errors[f])
+                    std::rethrow_exception(errors[f]);
+
+            {
+                STAGE_SPAN("trajectory.output");
+                for (int f = 0; f < n; f++)
+                    output(first + f, frames[f], energies[f], computeForces ? forces[f].data() : NULL);
+            }
+            first += n;
+
+            // rethrows the errors of the reader
+            n = next.get();
+            current = 1 - current;
+        }
+        return first;
+}
@@ -0,0 +1,92 @@
+#ifndef TWOBODYTRAJECTORY
+#define TWOBODYTRAJECTORY
+
+#include "hostVectorTypes.h"
+#include "periodicBox.h"
+#include "twobodyForcePolynomial.h"
+#include <stddef.h>
+#include <functional>
+#include <fstream>
+#include <vector>
+
+// One frame of a trajectory of water molecules, atoms ordered O, H1, H2 as in posq (charges are 0)
+typedef struct {
+    unsigned int nMolecules;
+    std::vector<double4> posq;
+    PeriodicBox box;
+} TrajectoryFrame;
+
+/**
+ * Sequential reader of a trajectory file, memory mapped so that frames are parsed straight from the
+ * page cache. Two formats are recognized from the start of the file:
+ *
+ * XYZ: for each frame a line with the number of atoms, a comment line, then one line per atom with
+ * its element and x, y, z in A. The atoms must be ordered O, H, H for each molecule. The box is read
+ * from an extended XYZ comment, Lattice="ax ay az bx by bz cx cy cz", in the reduced form of
+ * periodicBox.h (ax, by, cz > 0, |bx|, |cx| <= ax/2, |cy| <= by/2, otherwise the reader throws), without
+ * it the frame is not periodic. The box of a periodic binary frame is checked the same way.
+ *
+ * Binary (BinaryTrajectoryWriter): the 8 bytes MB2BTRJ1, then for each frame the number of atoms and
+ * a periodic flag (2 uint32), the box vectors a, b, c (9 doubles, zero if not periodic) and x, y, z of
+ * each atom (3 doubles per atom). Frames are copied without any parsing, the fastest way to re-score
+ * a trajectory more than once.
+ *
+ * Errors in the file throw std::runtime_error with the frame number.
+ */
+class TrajectoryReader {
+public:
+    enum Format { XYZ, BINARY };
+
+    TrajectoryReader(const char * filename);
+    ~TrajectoryReader();
+
+    // Read the next frame into frame, reusing its storage. Returns false at the end of the file.
+    bool read(TrajectoryFrame & frame);
+
+    Format getFormat() const { return format; }
+    size_t numFramesRead() const { return frames; }
+
+private:
+    TrajectoryReader(const TrajectoryReader &);
+    TrajectoryReader & operator=(const TrajectoryReader &);
+
+    bool readXYZ(TrajectoryFrame & frame);
+    bool readBinary(TrajectoryFrame & frame);
+    // next line without its end of line, false at the end of the file
+    bool nextLine(const char *& line, size_t & length);
+    void error(const char * message) const;
+
+    const char * data;
+    size_t size, position;
+    Format format;
+    size_t frames;
+};
+
+// Writes the binary format of TrajectoryReader, e.g. to convert an XYZ trajectory once
+class BinaryTrajectoryWriter {
+public:
+    BinaryTrajectoryWriter(const char * filename);
+
+    void write(const TrajectoryFrame & frame);
+
+private:
+    std::ofstream file;
+};
+
+// Called in frame order with the index of each frame, its energy and its forces (NULL unless requested)
+typedef std::function<void(size_t index, const TrajectoryFrame & frame, double energy, const double3 * forces)> FrameOutput;
+
+// Evaluate every frame of a trajectory with the host engine and pass the results to output in order.
+// Frames are read batchSize at a time by a background thread while the previous batch is evaluated,
+// and the frames of a batch are evaluated in parallel, one per OpenMP thread with its own system and
+// neighbor list, which is faster than threading the pairs of one frame for the usual small boxes.
+// Returns the number of frames. The exception of a frame that fails (e.g. a box too small for the cutoff)
+// is rethrown before its batch is output.
+size_t score_trajectory_cpu(
+        TrajectoryReader & reader,
+        const TwoBodyPolynomial & polynomial,
+        bool computeForces,
+        int batchSize,
+        const FrameOutput & output);
+
+#endif